@@ -196,6 +196,7 @@ static uint opt_protocol= 0;
 static char *opt_plugin_dir= 0, *opt_default_auth= 0;
 static uint opt_parallel= 0;
 static char *opt_dir;
+static ulonglong opt_chunk_rows= 0;
 
 /**
  A flag to indicate that backup uses multiple files for output.
@@ -297,6 +298,15 @@ static struct my_option my_long_options[] =
   {"character-sets-dir", 0,
    "Directory for character set files.", (char **)&charsets_dir,
    (char **)&charsets_dir, 0, GET_STR, REQUIRED_ARG, 0, 0, 0, 0, 0, 0},
+  {"chunk-rows", 0,
+   "With --dir, dump the data of a table that has a primary key on one "
+   "integer column and more rows than this into several files "
+   "table.txt, table.txt.1, table.txt.2, ... of about this many rows each, "
+   "split by ranges of the primary key. The files are dumped by the "
+   "--parallel connections and loaded in parallel by mariadb-import --dir. "
+   "0 means that every table is dumped into one file.",
+   &opt_chunk_rows, &opt_chunk_rows, 0, GET_ULL, REQUIRED_ARG,
+   0, 0, ULONGLONG_MAX, 0, 0, 0},
   {"comments", 'i', "Write additional information.",
    &opt_comments, &opt_comments, 0, GET_BOOL, NO_ARG,
    1, 0, 0, 0, 0, 0},
@@ -1303,6 +1313,13 @@ static int get_options(int *argc, char ***argv)
             "%s: You must use option --tab or --dir with --header\n", my_progname_short);
     return(EX_USAGE);
   }
+  if (opt_chunk_rows && (!opt_dir || opt_header))
+  {
+    fprintf(stderr,
+            "%s: You must use option --dir and not --header with --chunk-rows\n",
+            my_progname_short);
+    return(EX_USAGE);
+  }
 
   /* We don't delete master logs if slave data option */
   if (opt_slave_data)
@@ -4164,6 +4181,109 @@ static void send_query_completion_func(MYSQL* mysql, const char* query,
       mysql_error(mysql));
 }
 
+/* The maximum number of files for the data of a table with --chunk-rows */
+#define MAX_TABLE_CHUNKS 4096
+
+/*
+  Split the data of a table by ranges of its primary key for --chunk-rows
+
+  SYNOPSIS
+    get_table_chunks()
+    table_name          quoted table name in the current database
+    chunks        OUT   one WHERE condition per chunk
+
+  DESCRIPTION
+    If the table has a primary key on a single integer column and the
+    cardinality of the key exceeds --chunk-rows, the range of the key
+    between MIN() and MAX() is split into chunks of about --chunk-rows
+    rows each. Otherwise chunks is left empty.
+*/
+
+static void get_table_chunks(const char *table_name,
+                             std::vector<std::string> &chunks)
+{
+  MYSQL_RES *res;
+  MYSQL_ROW row;
+  MYSQL_FIELD *field;
+  char query[64 + NAME_LEN * 6];
+  char column[NAME_LEN * 2 + 3], *quoted_column;
+  char value[24];
+  ulonglong n_rows, min_value, max_value, step, n_chunks;
+  my_bool is_unsigned, multi_column;
+  DBUG_ENTER("get_table_chunks");
+
+  my_snprintf(query, sizeof(query), "SHOW KEYS FROM %s", table_name);
+  if (mysql_query_with_error_report(mysql, &res, query))
+    DBUG_VOID_RETURN;
+  /* SHOW KEYS lists the PRIMARY KEY first */
+  row= mysql_fetch_row(res);
+  if (!row || strcmp(row[2], "PRIMARY") || !row[6] ||
+      (n_rows= strtoull(row[6], NULL, 10)) <= opt_chunk_rows)
+  {
+    mysql_free_result(res);
+    DBUG_VOID_RETURN;
+  }
+  quoted_column= quote_name(row[4], column, 1);
+  if (quoted_column != column)
+    strmake(column, quoted_column, sizeof(column) - 1);
+  row= mysql_fetch_row(res);
+  multi_column= row && !strcmp(row[2], "PRIMARY");
+  mysql_free_result(res);
+  if (multi_column)
+    DBUG_VOID_RETURN;
+
+  my_snprintf(query, sizeof(query), "SELECT MIN(%s), MAX(%s) FROM %s",
+              column, column, table_name);
+  if (mysql_query_with_error_report(mysql, &res, query))
+    DBUG_VOID_RETURN;
+  field= mysql_fetch_field(res);
+  row= mysql_fetch_row(res);
+  if (!row || !row[0] || !row[1] ||
+      (field->type != MYSQL_TYPE_TINY && field->type != MYSQL_TYPE_SHORT &&
+       field->type != MYSQL_TYPE_INT24 && field->type != MYSQL_TYPE_LONG &&
+       field->type != MYSQL_TYPE_LONGLONG))
+  {
+    mysql_free_result(res);
+    DBUG_VOID_RETURN;
+  }
+  is_unsigned= MY_TEST(field->flags & UNSIGNED_FLAG);
+  min_value= is_unsigned ? strtoull(row[0], NULL, 10)
+                         : (ulonglong) strtoll(row[0], NULL, 10);
+  max_value= is_unsigned ? strtoull(row[1], NULL, 10)
+                         : (ulonglong) strtoll(row[1], NULL, 10);
+  mysql_free_result(res);
+
+  n_chunks= MY_MIN(n_rows / opt_chunk_rows + 1, MAX_TABLE_CHUNKS);
+  step= (max_value - min_value) / n_chunks + 1;
+  n_chunks= (max_value - min_value) / step + 1;
+  if (n_chunks < 2)
+    DBUG_VOID_RETURN;
+
+  verbose_msg("-- Dumping the data of %s into %llu files\n",
+              table_name, n_chunks);
+  for (ulonglong i= 0; i < n_chunks; i++)
+  {
+    std::string cond;
+    if (i)
+    {
+      my_snprintf(value, sizeof(value), is_unsigned ? "%llu" : "%lld",
+                  min_value + i * step);
+      cond.append(column).append(">=").append(value);
+    }
+    if (i + 1 < n_chunks)
+    {
+      my_snprintf(value, sizeof(value), is_unsigned ? "%llu" : "%lld",
+                  min_value + (i + 1) * step);
+      if (i)
+        cond.append(" AND ");
+      cond.append(column).append("<").append(value);
+    }
+    chunks.push_back(cond);
+  }
+  DBUG_VOID_RETURN;
+}
+
+
 /*
 
  SYNOPSIS
@@ -4271,103 +4391,127 @@ static void dump_table(const char *table, const char *db, const uchar *hash_key,
     char filename[FN_REFLEN], tmp_path[FN_REFLEN];
     char out_dir_buf[FN_REFLEN];
     char *out_dir= path;
+    std::vector<std::string> chunks;
     if (!out_dir)
     {
       my_snprintf(out_dir_buf, sizeof(out_dir_buf), "%s/%s", opt_dir, db);
       out_dir= out_dir_buf;
     }
 
+    if (opt_chunk_rows)
+      get_table_chunks(result_table, chunks);
+    if (chunks.empty())
+      chunks.push_back(std::string());
+
     /*
       Convert the path to native os format
       and resolve to the full filepath.
     */
     convert_dirname(tmp_path,out_dir,NullS);
     my_load_path(tmp_path, tmp_path, NULL);
-    fn_format(filename, table, tmp_path, ".txt", MYF(MY_UNPACK_FILENAME));
 
-    /* Must delete the file that 'INTO OUTFILE' will write to */
-    my_delete(filename, MYF(0));
+    for (size_t chunk= 0; chunk < chunks.size(); chunk++)
+    {
+      fn_format(filename, table, tmp_path, ".txt", MYF(MY_UNPACK_FILENAME));
+      if (chunk)
+      {
+        size_t filename_length= strlen(filename);
+        my_snprintf(filename + filename_length,
+                    sizeof(filename) - filename_length, ".%zu", chunk);
+      }
 
-    /* convert to a unix path name to stick into the query */
-    to_unix_path(filename);
+      /* Must delete the file that 'INTO OUTFILE' will write to */
+      my_delete(filename, MYF(0));
 
-    /* now build the query string */
+      /* convert to a unix path name to stick into the query */
+      to_unix_path(filename);
 
-    dynstr_append_checked(&query_string, "SELECT /*!40001 SQL_NO_CACHE */ ");
-    dynstr_append_checked(&query_string, select_field_names.str);
-    dynstr_append_checked(&query_string, " INTO OUTFILE '");
-    dynstr_append_checked(&query_string, filename);
-    dynstr_append_checked(&query_string, "'");
+      /* now build the query string */
 
-    dynstr_append_checked(&query_string, " /*!50138 CHARACTER SET ");
-    dynstr_append_checked(&query_string, default_charset == mysql_universal_client_charset ?
-                                         my_charset_bin.coll_name.str : /* backward compatibility */
-                                         default_charset);
-    dynstr_append_checked(&query_string, " */");
+      dynstr_set_checked(&query_string, "SELECT /*!40001 SQL_NO_CACHE */ ");
+      dynstr_append_checked(&query_string, select_field_names.str);
+      dynstr_append_checked(&query_string, " INTO OUTFILE '");
+      dynstr_append_checked(&query_string, filename);
+      dynstr_append_checked(&query_string, "'");
 
-    if (fields_terminated || enclosed || opt_enclosed || escaped)
-      dynstr_append_checked(&query_string, " FIELDS");
+      dynstr_append_checked(&query_string, " /*!50138 CHARACTER SET ");
+      dynstr_append_checked(&query_string, default_charset == mysql_universal_client_charset ?
+                                           my_charset_bin.coll_name.str : /* backward compatibility */
+                                           default_charset);
+      dynstr_append_checked(&query_string, " */");
 
-    add_load_option(&query_string, " TERMINATED BY ", fields_terminated);
-    add_load_option(&query_string, " ENCLOSED BY ", enclosed);
-    add_load_option(&query_string, " OPTIONALLY ENCLOSED BY ", opt_enclosed);
-    add_load_option(&query_string, " ESCAPED BY ", escaped);
-    add_load_option(&query_string, " LINES TERMINATED BY ", lines_terminated);
+      if (fields_terminated || enclosed || opt_enclosed || escaped)
+        dynstr_append_checked(&query_string, " FIELDS");
 
-    if (opt_header)
-    {
-      dynstr_append_checked(&query_string, " FROM ( SELECT ");
-      if (order_by)
-        dynstr_append_checked(&query_string, " 0 AS `_$is_data_row$_`,");
-      dynstr_append_checked(&query_string, select_field_names_for_header.str);
-      dynstr_append_checked(&query_string, " UNION ALL SELECT ");
-      if (order_by)
-        dynstr_append_checked(&query_string, "1 AS `_$is_data_row$_`,");
-      dynstr_append_checked(&query_string, select_field_names.str);
-    }
-    dynstr_append_checked(&query_string, " FROM ");
-    char quoted_db_buf[NAME_LEN * 2 + 3];
-    char *qdatabase= quote_name(db, quoted_db_buf, opt_quoted);
-    dynstr_append_checked(&query_string, qdatabase);
-    dynstr_append_checked(&query_string, ".");
-    dynstr_append_checked(&query_string, result_table);
+      add_load_option(&query_string, " TERMINATED BY ", fields_terminated);
+      add_load_option(&query_string, " ENCLOSED BY ", enclosed);
+      add_load_option(&query_string, " OPTIONALLY ENCLOSED BY ", opt_enclosed);
+      add_load_option(&query_string, " ESCAPED BY ", escaped);
+      add_load_option(&query_string, " LINES TERMINATED BY ", lines_terminated);
 
-    if (versioned)
-      vers_append_system_time(&query_string);
+      if (opt_header)
+      {
+        dynstr_append_checked(&query_string, " FROM ( SELECT ");
+        if (order_by)
+          dynstr_append_checked(&query_string, " 0 AS `_$is_data_row$_`,");
+        dynstr_append_checked(&query_string, select_field_names_for_header.str);
+        dynstr_append_checked(&query_string, " UNION ALL SELECT ");
+        if (order_by)
+          dynstr_append_checked(&query_string, "1 AS `_$is_data_row$_`,");
+        dynstr_append_checked(&query_string, select_field_names.str);
+      }
+      dynstr_append_checked(&query_string, " FROM ");
+      char quoted_db_buf[NAME_LEN * 2 + 3];
+      char *qdatabase= quote_name(db, quoted_db_buf, opt_quoted);
+      dynstr_append_checked(&query_string, qdatabase);
+      dynstr_append_checked(&query_string, ".");
+      dynstr_append_checked(&query_string, result_table);
 
-    if (where)
-    {
-      dynstr_append_checked(&query_string, " WHERE ");
-      dynstr_append_checked(&query_string, where);
-    }
-    if (opt_header)
-      dynstr_append_checked(&query_string, ") s");
+      if (versioned)
+        vers_append_system_time(&query_string);
 
-    if (order_by)
-    {
+      if (where && !chunks[chunk].empty())
+      {
+        dynstr_append_checked(&query_string, " WHERE (");
+        dynstr_append_checked(&query_string, where);
+        dynstr_append_checked(&query_string, ") AND ");
+        dynstr_append_checked(&query_string, chunks[chunk].c_str());
+      }
+      else if (where || !chunks[chunk].empty())
+      {
+        dynstr_append_checked(&query_string, " WHERE ");
+        dynstr_append_checked(&query_string,
+                              where ? where : chunks[chunk].c_str());
+      }
       if (opt_header)
-        dynstr_append_checked(&query_string, " ORDER BY `_$is_data_row$_`,");
-      else
-        dynstr_append_checked(&query_string, " ORDER BY ");
-      dynstr_append_checked(&query_string, order_by);
-      my_free(order_by);
-      order_by= 0;
-    }
-    if (opt_parallel)
-    {
-      if (connection_pool.execute_async(query_string.str,send_query_completion_func,nullptr,true))
+        dynstr_append_checked(&query_string, ") s");
+
+      if (order_by)
+      {
+        if (opt_header)
+          dynstr_append_checked(&query_string, " ORDER BY `_$is_data_row$_`,");
+        else
+          dynstr_append_checked(&query_string, " ORDER BY ");
+        dynstr_append_checked(&query_string, order_by);
+      }
+      if (opt_parallel)
+      {
+        if (connection_pool.execute_async(query_string.str,send_query_completion_func,nullptr,true))
+        {
+          dynstr_free(&query_string);
+          DB_error(mysql, "when executing send_query 'SELECT INTO OUTFILE'");
+          DBUG_VOID_RETURN;
+        }
+      }
+      else if (mysql_real_query(mysql, query_string.str, (ulong)query_string.length))
       {
         dynstr_free(&query_string);
-        DB_error(mysql, "when executing send_query 'SELECT INTO OUTFILE'");
+        DB_error(mysql, "when executing 'SELECT INTO OUTFILE'");
         DBUG_VOID_RETURN;
       }
     }
-    else if (mysql_real_query(mysql, query_string.str, (ulong)query_string.length))
-    {
-      dynstr_free(&query_string);
-      DB_error(mysql, "when executing 'SELECT INTO OUTFILE'");
-      DBUG_VOID_RETURN;
-    }
+    my_free(order_by);
+    order_by= 0;
   }
   else
   {
@@ -42,6 +42,11 @@
 #include <tpool.h>
 #include <vector>
 #include <unordered_set>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
 #include <my_dir.h>
 
 tpool::thread_pool *thread_pool;
@@ -74,6 +79,24 @@ static char **argv_to_free;
 static void safe_exit(int error, MYSQL *mysql);
 static void set_exitcode(int code);
 
+/*
+  State shared by the data files of a table that mariadb-dump --chunk-rows
+  wrote into table.txt, table.txt.1, table.txt.2, ...
+  table.txt is loaded together with table.sql, which creates the table.
+  The other files are loaded concurrently after that.
+*/
+struct table_chunks
+{
+  std::mutex mutex;
+  std::condition_variable cond;
+  bool created= false;   /* table.sql was executed */
+  bool failed= false;    /* table.sql failed */
+  size_t pending= 0;     /* data files that were not loaded yet */
+  bool tz_utc= false;
+  std::string engine;
+  std::vector<std::string> triggers; /* created after the last data file */
+};
+
 struct table_load_params
 {
   std::string data_file; /* name of the file to load with LOAD DATA INFILE */
@@ -82,6 +105,7 @@ struct table_load_params
   std::string tablename; /* name of the table */
   std::string dbname;    /* name of the database */
   ulonglong size;        /* size of the data file */
+  std::shared_ptr<table_chunks> chunks; /* if there are several data files */
 };
 
 std::unordered_set<std::string> ignore_databases;
@@ -575,6 +599,49 @@ static int create_db_if_not_exists(MYSQL *mysql, const char *dbname)
   return 0;
 }
 
+/*
+  Count a data file of a chunked table as done. The last one gets the
+  triggers and the engine of the table.
+
+  @return whether this was the last data file of the table
+*/
+static bool chunk_done(table_chunks *chunks, std::vector<std::string> *triggers,
+                       std::string *engine)
+{
+  std::lock_guard<std::mutex> lock(chunks->mutex);
+  if (--chunks->pending)
+    return false;
+  triggers->swap(chunks->triggers);
+  *engine= chunks->engine;
+  return true;
+}
+
+/*
+  A data file of a chunked table that could not be loaded must be counted
+  as done as well, or the triggers of the table would never be recreated.
+*/
+class chunk_failure_guard
+{
+  MYSQL *mysql;
+  table_chunks *chunks;
+  char *tablename;
+public:
+  chunk_failure_guard(MYSQL *mysql, table_chunks *chunks, char *tablename)
+    : mysql(mysql), chunks(chunks), tablename(tablename) {}
+  /* The data file was loaded; the caller will count it as done */
+  void release() { chunks= nullptr; }
+  ~chunk_failure_guard()
+  {
+    std::vector<std::string> triggers;
+    std::string engine;
+    if (!chunks || !chunk_done(chunks, &triggers, &engine))
+      return;
+    for (const auto &trigger: triggers)
+      if (mysql_query(mysql, trigger.c_str()))
+        db_error_with_table(mysql, tablename);
+  }
+};
+
 static int handle_one_table(const table_load_params *params, MYSQL *mysql)
 {
   char tablename[FN_REFLEN], hard_path[FN_REFLEN],
@@ -603,7 +670,10 @@ static int handle_one_table(const table_load_params *params, MYSQL *mysql)
   if (!filename[0])
     filename= params->sql_file.c_str();
 
-  fn_format(tablename, filename, "", "", 1 | 2); /* removes path & ext. */
+  if (!params->tablename.empty())
+    strmake(tablename, params->tablename.c_str(), sizeof(tablename) - 1);
+  else
+    fn_format(tablename, filename, "", "", 1 | 2); /* removes path & ext. */
 
   const char *db= current_db ? current_db : params->dbname.c_str();
   std::string full_tablename= quote_identifier(db);
@@ -613,11 +683,21 @@ static int handle_one_table(const table_load_params *params, MYSQL *mysql)
   bool tz_utc= false;
   std::string engine;
   std::vector<std::string> triggers;
+  table_chunks *chunks= params->chunks.get();
+  chunk_failure_guard chunk_guard(mysql, chunks, tablename);
   if (!params->sql_file.empty())
   {
     std::string sql_text= parse_sql_script(params->sql_file.c_str(), &tz_utc, &triggers,&engine);
     if (execute_sql_batch(mysql, sql_text.c_str(),params->sql_file.c_str()))
+    {
+      if (chunks)
+      {
+        std::lock_guard<std::mutex> lock(chunks->mutex);
+        chunks->failed= true;
+        chunks->cond.notify_all();
+      }
       DBUG_RETURN(1);
+    }
     if (params->data_file.empty())
     {
       /*
@@ -626,11 +706,40 @@ static int handle_one_table(const table_load_params *params, MYSQL *mysql)
       */
       DBUG_RETURN(0);
     }
+    if (chunks)
+    {
+      /*
+        The other data files are loaded concurrently on other connections,
+        so the table is neither locked nor are its keys disabled.
+        The triggers are created after the last data file was loaded.
+      */
+      std::lock_guard<std::mutex> lock(chunks->mutex);
+      chunks->tz_utc= tz_utc;
+      chunks->engine= engine;
+      chunks->triggers.swap(triggers);
+      chunks->created= true;
+      chunks->cond.notify_all();
+    }
     if (tz_utc && exec_sql(mysql, "SET TIME_ZONE='+00:00';"))
       DBUG_RETURN(1);
-    if (exec_sql(mysql, std::string("LOCK TABLE ") + full_tablename + "WRITE"))
+    if (!chunks &&
+        exec_sql(mysql, std::string("LOCK TABLE ") + full_tablename + "WRITE"))
+      DBUG_RETURN(1);
+    if (!chunks &&
+        exec_sql(mysql, std::string("ALTER TABLE ") + full_tablename + " DISABLE KEYS"))
       DBUG_RETURN(1);
-    if (exec_sql(mysql, std::string("ALTER TABLE ") + full_tablename + " DISABLE KEYS"))
+  }
+  else if (chunks)
+  {
+    /* Wait until the first data file of the table created the table */
+    std::unique_lock<std::mutex> lock(chunks->mutex);
+    chunks->cond.wait(lock, [chunks]{ return chunks->created || chunks->failed; });
+    if (chunks->failed)
+      DBUG_RETURN(1);
+    tz_utc= chunks->tz_utc;
+    lock.unlock();
+    if (tz_utc &&
+        exec_sql(mysql, "SET @save_tz=@@TIME_ZONE, TIME_ZONE='+00:00';"))
       DBUG_RETURN(1);
   }
   if (!opt_local_file)
@@ -695,6 +804,13 @@ static int handle_one_table(const table_load_params *params, MYSQL *mysql)
       fprintf(stdout, "%s.%s: %s\n", db, tablename, info);
   }
 
+  bool last_chunk= false;
+  if (chunks)
+  {
+    chunk_guard.release();
+    last_chunk= chunk_done(chunks, &triggers, &engine);
+  }
+
   /* Create triggers after loading data */
   for (const auto &trigger: triggers)
   {
@@ -705,7 +821,13 @@ static int handle_one_table(const table_load_params *params, MYSQL *mysql)
     }
   }
 
-  if (!params->sql_file.empty())
+  if (chunks)
+  {
+    if (last_chunk && (engine == "MyISAM" || engine == "Aria") &&
+        exec_sql(mysql, std::string("FLUSH TABLE ").append(full_tablename).c_str()))
+      DBUG_RETURN(1);
+  }
+  else if (!params->sql_file.empty())
   {
     if (exec_sql(mysql, std::string("ALTER TABLE ") + full_tablename + " ENABLE KEYS;"))
         DBUG_RETURN(1);
@@ -967,11 +1089,32 @@ static void tpool_thread_exit(void)
   mysql_thread_end();
 }
 
+/**
+  Check whether a file is an additional data file of a table,
+  written by mariadb-dump --chunk-rows as table.txt.1, table.txt.2, ...
+
+  @param name - file name
+
+  @return length of the name of the first data file table.txt
+  @retval 0 if the file is not an additional data file
+*/
+static size_t chunk_file_prefix(const char *name)
+{
+  const char *dot= strrchr(name, '.');
+  if (!dot || !dot[1] || dot[1 + strspn(dot + 1, "0123456789")])
+    return 0;
+  size_t len= (size_t) (dot - name);
+  if (len <= 4 || strncmp(dot - 4, ".txt", 4))
+    return 0;
+  return len;
+}
+
 /**
   Get files to load, for --dir case
   Enumerates all files in the subdirectories, and returns only *.txt files
   (table data files),  or .sql files,  there is no corresponding .txt file
-  (view definitions)
+  (view definitions). The additional data files of a table that was
+  dumped with --chunk-rows are placed after all other data files.
 
   @param dir - directory to scan
   @param files - vector to store the files
@@ -984,6 +1127,8 @@ static void scan_backup_dir(const char *dir,
 {
   MY_DIR *dir_info;
   std::vector<std::string> subdirs;
+  /* additional data files, and the first data file of their table */
+  std::vector<std::pair<table_load_params, std::string>> chunk_files;
   int stat_err;
   struct stat st;
   if ((stat_err= stat(dir, &st)) != 0 || (st.st_mode & S_IFDIR) == 0)
@@ -1027,10 +1172,13 @@ static void scan_backup_dir(const char *dir,
       table_load_params par{};
       par.dbname= dbname;
       fi= &dir_info2->dir_entry[j];
-      if (has_extension(fi->name, ".sql") || has_extension(fi->name, ".txt"))
+      size_t chunk_prefix= chunk_file_prefix(fi->name);
+      if (chunk_prefix || has_extension(fi->name, ".sql") ||
+          has_extension(fi->name, ".txt"))
       {
         std::string full_table_name=
-            std::string(dbname) + "." + std::string(fi->name);
+            std::string(dbname) + "." +
+            std::string(fi->name, chunk_prefix ? chunk_prefix : strlen(fi->name));
         full_table_name.resize(full_table_name.size() - 4);
         if (ignore_tables.find(full_table_name) != ignore_tables.end())
         {
@@ -1050,7 +1198,16 @@ static void scan_backup_dir(const char *dir,
       if (!MY_S_ISDIR(fi->mystat->st_mode))
       {
         /* test file*/
-        if (has_extension(fi->name, ".txt"))
+        if (chunk_prefix)
+        {
+          par.data_file= file;
+          par.size= fi->mystat->st_size;
+          par.tablename= std::string(fi->name, chunk_prefix - 4);
+          chunk_files.emplace_back(par, file.substr(0, file.size() -
+                                                    strlen(fi->name) +
+                                                    chunk_prefix));
+        }
+        else if (has_extension(fi->name, ".txt"))
         {
           par.data_file= file;
           par.size= fi->mystat->st_size;
@@ -1085,6 +1242,25 @@ static void scan_backup_dir(const char *dir,
   }
   my_dirend(dir_info);
 
+  /* Link the additional data files to the first data file of their table */
+  std::unordered_map<std::string, size_t> data_files;
+  for (size_t i= 0; i < files.size(); i++)
+    data_files[files[i].data_file]= i;
+  for (auto &chunk : chunk_files)
+  {
+    auto it= data_files.find(chunk.second);
+    if (it == data_files.end())
+      fatal_error("Expected file '%s' is missing", chunk.second.c_str());
+    table_load_params &first= files[it->second];
+    if (!first.chunks)
+    {
+      first.chunks= std::make_shared<table_chunks>();
+      first.chunks->pending= 1;
+    }
+    first.chunks->pending++;
+    chunk.first.chunks= first.chunks;
+  }
+
   /* sort files by size, descending. Put view definitions at the end of the list.*/
   std::sort(files.begin(), files.end(),
             [](const table_load_params &a, const table_load_params &b) -> bool
@@ -1096,6 +1272,20 @@ static void scan_backup_dir(const char *dir,
               return a.sql_file < b.sql_file;
             });
 
+  /*
+    The additional data files wait for their table to be created, so they
+    must be loaded after all first data files, also with --parallel.
+  */
+  std::vector<table_load_params> chunks;
+  for (auto &chunk : chunk_files)
+    chunks.push_back(chunk.first);
+  std::sort(chunks.begin(), chunks.end(),
+            [](const table_load_params &a, const table_load_params &b) -> bool
+            {
+              return a.size > b.size;
+            });
+  files.insert(files.end(), chunks.begin(), chunks.end());
+
   std::sort(views.begin(), views.end(),
             [](const table_load_params &a, const table_load_params &b) -> bool
             {
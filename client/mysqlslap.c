@@ -90,6 +90,7 @@
 #include <sys/wait.h>
 #endif
 #include <ctype.h>
+#include <my_bit.h>
 #include <welcome_copyright_notice.h>   /* ORACLE_WELCOME_COPYRIGHT_NOTICE */
 
 #ifdef _WIN32
@@ -143,6 +144,7 @@ static unsigned long connect_flags= CLIENT_MULTI_RESULTS |
 static int verbose;
 static uint commit_rate;
 static uint detach_rate;
+static uint opt_query_rate;
 const char *num_int_cols_opt;
 const char *num_char_cols_opt;
 
@@ -215,6 +217,24 @@ struct thread_context {
   ulonglong limit;
 };
 
+/*
+  Histogram of query latencies in microseconds. Latencies below 4 have
+  a bucket of their own, larger ones are split into 4 buckets per power
+  of 2, so a quantile is accurate to within 25%.
+*/
+#define LATENCY_BUCKETS 256
+
+typedef struct latency_histogram latency_histogram;
+
+struct latency_histogram {
+  ulonglong count;
+  ulonglong max;
+  ulonglong bucket[LATENCY_BUCKETS];
+};
+
+/* Latencies of all clients of one concurrency level, under counter_mutex */
+static latency_histogram query_latency;
+
 typedef struct conclusions conclusions;
 
 struct conclusions {
@@ -432,6 +452,7 @@ void concurrency_loop(MYSQL *mysql, uint current, option_string *eptr)
                    sizeof(stats) * iterations, MYF(MY_ZEROFILL|MY_FAE|MY_WME));
 
   bzero(&conclusion, sizeof(conclusions));
+  bzero(&query_latency, sizeof(query_latency));
 
   if (auto_actual_queries)
     client_limit= auto_actual_queries;
@@ -674,6 +695,13 @@ static struct my_option my_long_options[] =
   {"query", 'q', "Query to run or file containing query to run.",
     &user_supplied_query, &user_supplied_query,
     0, GET_STR, REQUIRED_ARG, 0, 0, 0, 0, 0, 0},
+  {"query-rate", 0,
+    "Number of queries per second that each client starts. Queries are "
+    "started on schedule even if earlier ones were slow, and their latency "
+    "is counted from the scheduled start. 0 means to start each query as "
+    "soon as the previous one has completed.",
+    &opt_query_rate, &opt_query_rate, 0, GET_UINT, REQUIRED_ARG,
+    0, 0, UINT_MAX, 0, 0, 0},
   {"silent", 's', "Run program in silent mode - no output.",
     &opt_silent, &opt_silent, 0, GET_BOOL,  NO_ARG,
     0, 0, 0, 0, 0, 0},
@@ -1772,6 +1800,62 @@ run_statements(MYSQL *mysql, statement *stmt)
   DBUG_RETURN(0);
 }
 
+static uint latency_bucket(ulonglong value)
+{
+  uint bits;
+  if (value < 4)
+    return (uint) value;
+  bits= my_bit_log2_uint64(value);
+  return (bits - 1) * 4 + (uint) ((value >> (bits - 2)) & 3);
+}
+
+
+static void latency_add(latency_histogram *h, ulonglong value)
+{
+  h->bucket[latency_bucket(value)]++;
+  h->count++;
+  set_if_bigger(h->max, value);
+}
+
+
+static void latency_merge(latency_histogram *to, const latency_histogram *from)
+{
+  uint i;
+  for (i= 0; i < LATENCY_BUCKETS; i++)
+    to->bucket[i]+= from->bucket[i];
+  to->count+= from->count;
+  set_if_bigger(to->max, from->max);
+}
+
+
+/*
+  Return the upper limit of the bucket that contains the given
+  fraction of the recorded values, but not more than the maximum.
+*/
+
+static ulonglong latency_quantile(const latency_histogram *h, double fraction)
+{
+  ulonglong rank= (ulonglong) (fraction * h->count + 0.999999);
+  ulonglong seen= 0;
+  uint i;
+
+  for (i= 0; i < LATENCY_BUCKETS; i++)
+  {
+    if ((seen+= h->bucket[i]) >= rank && h->bucket[i])
+    {
+      ulonglong limit;
+      uint shift;
+      if (i < 4)
+        return i;
+      shift= i / 4 - 1;
+      limit= ((ulonglong) (4 + i % 4 + 1) << shift) - 1;
+      return MY_MIN(limit, h->max);
+    }
+  }
+  return h->max;
+}
+
+
 static int
 run_scheduler(stats *sptr, statement *stmts, uint concur, ulonglong limit)
 {
@@ -1849,7 +1933,9 @@ pthread_handler_t run_task(void *p)
 {
   ulonglong queries;
   ulonglong detach_counter;
+  ulonglong start_time, query_start, latency;
   unsigned int commit_counter;
+  latency_histogram *histogram= NULL;
   MYSQL *mysql;
   MYSQL_RES *result;
   statement *ptr;
@@ -1892,10 +1978,14 @@ pthread_handler_t run_task(void *p)
   if (verbose >= 3)
     printf("connected!\n");
   queries= 0;
+  histogram= (latency_histogram *) my_malloc(PSI_NOT_INSTRUMENTED,
+                                             sizeof(latency_histogram),
+                                             MYF(MY_ZEROFILL|MY_FAE|MY_WME));
 
   commit_counter= 0;
   if (commit_rate)
     run_query(mysql, "SET AUTOCOMMIT=0", strlen("SET AUTOCOMMIT=0"));
+  start_time= my_interval_timer();
 
 limit_not_met:
     for (ptr= con->stmt, detach_counter= 0; 
@@ -1916,6 +2006,19 @@ pthread_handler_t run_task(void *p)
           goto end;
       }
 
+      query_start= my_interval_timer();
+      if (opt_query_rate)
+      {
+        /*
+          Open loop: the query is due at a fixed time, and the time that
+          it had to wait for the previous ones counts as latency.
+        */
+        ulonglong due= start_time + queries * 1000000000ULL / opt_query_rate;
+        if (due > query_start)
+          my_sleep((ulong) ((due - query_start) / 1000));
+        query_start= due;
+      }
+
       /* 
         We have to execute differently based on query type. This should become a function.
       */
@@ -1977,6 +2080,8 @@ pthread_handler_t run_task(void *p)
           }
         }
       } while(mysql_next_result(mysql) == 0);
+      latency= (my_interval_timer() - query_start) / 1000;
+      latency_add(histogram, latency);
       queries++;
 
       if (commit_rate && (++commit_counter == commit_rate))
@@ -2001,9 +2106,12 @@ pthread_handler_t run_task(void *p)
   mysql_thread_end();
 
   pthread_mutex_lock(&counter_mutex);
+  if (histogram)
+    latency_merge(&query_latency, histogram);
   thread_counter--;
   pthread_cond_signal(&count_threshhold);
   pthread_mutex_unlock(&counter_mutex);
+  my_free(histogram);
 
   DBUG_RETURN(0);
 }
@@ -2191,6 +2299,13 @@ print_conclusions(conclusions *con)
                     con->max_timing / 1000, con->max_timing % 1000);
   printf("\tNumber of clients running queries: %d\n", con->users);
   printf("\tAverage number of queries per client: %llu\n", con->avg_rows); 
+  if (query_latency.count)
+    printf("\tQuery latency in milliseconds: median %.3f, 95%% %.3f, "
+           "99%% %.3f, maximum %.3f\n",
+           latency_quantile(&query_latency, 0.5) / 1000.0,
+           latency_quantile(&query_latency, 0.95) / 1000.0,
+           latency_quantile(&query_latency, 0.99) / 1000.0,
+           query_latency.max / 1000.0);
   printf("\n");
 }
 
@@ -52,6 +52,7 @@ Street, Fifth Floor, Boston, MA 02110-1335 USA
 #include <trx0sys.h>
 #include <set>
 #include <string>
+#include <mutex>
 #include <mysqld.h>
 #include <sstream>
 #include "fil_cur.h"
@@ -60,6 +61,7 @@ Street, Fifth Floor, Boston, MA 02110-1335 USA
 #include "backup_copy.h"
 #include "backup_debug.h"
 #include "backup_mysql.h"
+#include "ds_compress.h"
 #include <btr0btr.h>
 #ifdef _WIN32
 #include <direct.h> /* rmdir */
@@ -85,6 +87,8 @@ Street, Fifth Floor, Boston, MA 02110-1335 USA
 
 /* locations of tablespaces read from .isl files */
 static std::map<std::string, std::string> tablespace_locations;
+/* protects tablespace_locations during parallel copy-back */
+static std::mutex tablespace_locations_mutex;
 
 /* Whether LOCK BINLOG FOR BACKUP has been issued during backup */
 bool binlog_locked;
@@ -139,6 +143,7 @@ struct datadir_iter_t {
 Represents the context of the thread processing MySQL data directory. */
 struct datadir_thread_ctxt_t {
 	datadir_iter_t		*it;
+	ds_ctxt_t		*ds;
 	uint			n_thread;
 	uint			*count;
 	pthread_mutex_t*	count_mutex;
@@ -1026,7 +1031,8 @@ ds_ctxt_t::backup_file_printf(const char *filename, const char *fmt, ...)
 
 static
 bool
-run_data_threads(datadir_iter_t *it, void (*func)(datadir_thread_ctxt_t *ctxt), uint n)
+run_data_threads(datadir_iter_t *it, void (*func)(datadir_thread_ctxt_t *ctxt), uint n,
+		 ds_ctxt_t *ds = NULL)
 {
 	datadir_thread_ctxt_t	*data_threads;
 	uint			i, count;
@@ -1041,6 +1047,7 @@ run_data_threads(datadir_iter_t *it, void (*func)(datadir_thread_ctxt_t *ctxt),
 
 	for (i = 0; i < n; i++) {
 		data_threads[i].it = it;
+		data_threads[i].ds = ds;
 		data_threads[i].n_thread = i + 1;
 		data_threads[i].count = &count;
 		data_threads[i].count_mutex = &count_mutex;
@@ -1221,6 +1228,7 @@ read_link_file(const char *ibd_filepath, const char *link_filepath)
 			}
 		}
 
+		std::lock_guard<std::mutex> lock(tablespace_locations_mutex);
 		tablespace_locations[ibd_filepath] = filepath;
 	}
 	free(filepath);
@@ -1230,20 +1238,21 @@ read_link_file(const char *ibd_filepath, const char *link_filepath)
 /************************************************************************
 Return the location of given .ibd if it was previously read
 from .isl file.
-@return NULL or destination .ibd file path. */
+@return empty string or destination .ibd file path. */
 static
-const char *
+std::string
 tablespace_filepath(const char *ibd_filepath)
 {
 	std::map<std::string, std::string>::iterator it;
+	std::lock_guard<std::mutex> lock(tablespace_locations_mutex);
 
 	it = tablespace_locations.find(ibd_filepath);
 
 	if (it != tablespace_locations.end()) {
-		return it->second.c_str();
+		return it->second;
 	}
 
-	return NULL;
+	return std::string();
 }
 
 
@@ -1261,6 +1270,7 @@ copy_or_move_file(ds_ctxt *datasink0, const char *src_file_path,
 	ds_ctxt_t *datasink = datasink0; /* copy to datadir by default */
 	char filedir[FN_REFLEN];
 	size_t filedir_len;
+	std::string filepath;
 	bool ret;
 
 	/* read the link from .isl file */
@@ -1278,7 +1288,6 @@ copy_or_move_file(ds_ctxt *datasink0, const char *src_file_path,
 	/* check if there is .isl file */
 	if (ends_with(src_file_path, ".ibd")) {
 		char *link_filepath;
-		const char *filepath;
 
 		link_filepath = strdup(src_file_path);
 		strcpy(link_filepath + strlen(link_filepath) - 3, "isl");
@@ -1287,10 +1296,10 @@ copy_or_move_file(ds_ctxt *datasink0, const char *src_file_path,
 
 		filepath = tablespace_filepath(src_file_path);
 
-		if (filepath != NULL) {
-			dirname_part(filedir, filepath, &filedir_len);
+		if (!filepath.empty()) {
+			dirname_part(filedir, filepath.c_str(), &filedir_len);
 
-			dst_file_path = filepath + filedir_len;
+			dst_file_path = filepath.c_str() + filedir_len;
 			dst_dir = filedir;
 
 			if (!directory_exists(dst_dir, true)) {
@@ -1663,16 +1672,127 @@ copy_back_aria_logs(const char *dstdir)
 }
 
 
+/************************************************************************
+Copy or move the files of the backup directory that are not InnoDB system,
+undo or redo log files to the data directory. Invoked by copy_back() in
+--parallel threads. */
+static void copy_back_thread_func(datadir_thread_ctxt_t *ctxt)
+{
+	bool ret = true;
+	datadir_node_t node;
+
+	datadir_node_init(&node);
+
+	while (datadir_iter_next(ctxt->it, &node)) {
+		const char *ext_list[] = {"backup-my.cnf",
+			"xtrabackup_binary",
+			MB_BINLOG_INFO,
+			MB_METADATA_FILENAME,
+			XTRABACKUP_BINLOG_INFO,
+			XTRABACKUP_METADATA_FILENAME,
+			".qp", XB_ZLIB_EXT, ".pmap", ".tmp",
+			NULL};
+		const char *filename;
+		char c_tmp;
+		int i_tmp;
+
+		/* Skip aria log files */
+		if (is_aria_log_dir_file(node))
+			continue;
+
+		if (strstr(node.filepath,"/" ROCKSDB_BACKUP_DIR "/")
+#ifdef _WIN32
+			|| strstr(node.filepath,"\\" ROCKSDB_BACKUP_DIR "\\")
+#endif
+		)
+		{
+			// copied at later step
+			continue;
+		}
+
+		/* create empty directories */
+		if (node.is_empty_dir) {
+			char path[FN_REFLEN];
+
+			snprintf(path, sizeof(path), "%s/%s",
+				mysql_data_home, node.filepath_rel);
+
+			msg(ctxt->n_thread, "Creating directory %s", path);
+
+			if (mkdirp(path, 0777, MYF(0)) < 0) {
+				char errbuf[MYSYS_STRERROR_SIZE];
+				my_strerror(errbuf, sizeof(errbuf), my_errno);
+				msg(ctxt->n_thread,
+				    "Can not create directory %s: %s",
+				    path, errbuf);
+				ret = false;
+
+				goto cleanup;
+
+			}
+
+			msg(ctxt->n_thread, " ...done.");
+
+			continue;
+		}
+
+		filename = base_name(node.filepath);
+
+		/* skip .qp and .zz files */
+		if (filename_matches(filename, ext_list)) {
+			continue;
+		}
+
+		/* skip undo tablespaces */
+		if (sscanf(filename, "undo%d%c", &i_tmp, &c_tmp) == 1) {
+			continue;
+		}
+
+		/* skip the redo log (it was already copied) */
+		if (!strcmp(filename, LOG_FILE_NAME)) {
+			continue;
+		}
+
+                /* skip buffer pool dump */
+                if (!strcmp(filename, default_buffer_pool_file)) {
+                        continue;
+                }
+
+		/* skip innodb data files */
+		for (Tablespace::const_iterator iter(srv_sys_space.begin()),
+		       end(srv_sys_space.end()); iter != end; ++iter) {
+			if (!strcmp(base_name(iter->filepath()), filename)) {
+				goto next_file;
+			}
+		}
+
+		if (!(ret = copy_or_move_file(ctxt->ds, node.filepath,
+					      node.filepath_rel,
+					      mysql_data_home,
+					      ctxt->n_thread))) {
+			goto cleanup;
+		}
+	next_file:
+		continue;
+	}
+
+cleanup:
+	datadir_node_free(&node);
+
+	pthread_mutex_lock(ctxt->count_mutex);
+	--(*ctxt->count);
+	pthread_mutex_unlock(ctxt->count_mutex);
+
+	ctxt->ret = ret;
+}
+
 bool
 copy_back()
 {
 	bool ret = false;
 	datadir_iter_t *it = NULL;
-	datadir_node_t node;
 	const char *dst_dir;
 
-	memset(&node, 0, sizeof(node));
-
 	if (!opt_force_non_empty_dirs) {
 		if (!directory_exists_and_empty(mysql_data_home,
 							"Original data")) {
@@ -1800,96 +1920,10 @@ copy_back()
 
 	it = datadir_iter_new(".", false);
 
-	datadir_node_init(&node);
-
-	while (datadir_iter_next(it, &node)) {
-		const char *ext_list[] = {"backup-my.cnf",
-			"xtrabackup_binary",
-			MB_BINLOG_INFO,
-			MB_METADATA_FILENAME,
-			XTRABACKUP_BINLOG_INFO,
-			XTRABACKUP_METADATA_FILENAME,
-			".qp", ".pmap", ".tmp",
-			NULL};
-		const char *filename;
-		char c_tmp;
-		int i_tmp;
-
-		/* Skip aria log files */
-		if (is_aria_log_dir_file(node))
-			continue;
-
-		if (strstr(node.filepath,"/" ROCKSDB_BACKUP_DIR "/")
-#ifdef _WIN32
-			|| strstr(node.filepath,"\\" ROCKSDB_BACKUP_DIR "\\")
-#endif
-		)
-		{
-			// copied at later step
-			continue;
-		}
-
-		/* create empty directories */
-		if (node.is_empty_dir) {
-			char path[FN_REFLEN];
-
-			snprintf(path, sizeof(path), "%s/%s",
-				mysql_data_home, node.filepath_rel);
-
-			msg("Creating directory %s", path);
-
-			if (mkdirp(path, 0777, MYF(0)) < 0) {
-				char errbuf[MYSYS_STRERROR_SIZE];
-				my_strerror(errbuf, sizeof(errbuf), my_errno);
-				msg("Can not create directory %s: %s",
-					path, errbuf);
-				ret = false;
-
-				goto cleanup;
-
-			}
-
-			msg(" ...done.");
-
-			continue;
-		}
-
-		filename = base_name(node.filepath);
-
-		/* skip .qp files */
-		if (filename_matches(filename, ext_list)) {
-			continue;
-		}
-
-		/* skip undo tablespaces */
-		if (sscanf(filename, "undo%d%c", &i_tmp, &c_tmp) == 1) {
-			continue;
-		}
-
-		/* skip the redo log (it was already copied) */
-		if (!strcmp(filename, LOG_FILE_NAME)) {
-			continue;
-		}
-
-                /* skip buffer pool dump */
-                if (!strcmp(filename, default_buffer_pool_file)) {
-                        continue;
-                }
-
-		/* skip innodb data files */
-		for (Tablespace::const_iterator iter(srv_sys_space.begin()),
-		       end(srv_sys_space.end()); iter != end; ++iter) {
-			if (!strcmp(base_name(iter->filepath()), filename)) {
-				goto next_file;
-			}
-		}
-
-		if (!(ret = copy_or_move_file(ds_tmp, node.filepath, node.filepath_rel,
-					      mysql_data_home, 1))) {
-			goto cleanup;
-		}
-	next_file:
-		continue;
+	if (!(ret = run_data_threads(it, copy_back_thread_func,
+				     xtrabackup_parallel
+				     ? xtrabackup_parallel : 1, ds_tmp))) {
+		goto cleanup;
 	}
 
 	/* copy buffer pool dump */
@@ -1908,8 +1942,6 @@ copy_back()
 		datadir_iter_free(it);
 	}
 
-	datadir_node_free(&node);
-
 	if (ds_tmp != NULL) {
 		ds_destroy(ds_tmp);
 	}
@@ -1926,6 +1958,24 @@ decrypt_decompress_file(const char *filepath, uint thread_n)
 	char *dest_filepath = strdup(filepath);
 	bool needs_action = false;
 
+	if (opt_decompress && ends_with(filepath, XB_ZLIB_EXT)) {
+		/* Decompress in this thread; no external tool is needed. */
+		dest_filepath[strlen(dest_filepath) - 3] = 0;
+		msg(thread_n, "decompressing %s", filepath);
+		bool ok = xb_decompress_zlib_file(filepath, dest_filepath);
+		free(dest_filepath);
+		if (!ok) {
+			return(false);
+		}
+		if (opt_remove_original) {
+			msg(thread_n, "Removing %s", filepath);
+			if (my_delete(filepath, MYF(MY_WME)) != 0) {
+				return(false);
+			}
+		}
+		return(true);
+	}
+
 	cmd << IF_WIN("type ","cat ") << filepath;
 
  	if (opt_decompress
@@ -1977,7 +2027,8 @@ static void decrypt_decompress_thread_func(datadir_thread_ctxt_t *ctxt)
 			continue;
 		}
 
-		if (!ends_with(node.filepath, ".qp")) {
+		if (!ends_with(node.filepath, ".qp")
+		    && !ends_with(node.filepath, XB_ZLIB_EXT)) {
 			continue;
 		}
 
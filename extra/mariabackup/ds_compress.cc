@@ -4,6 +4,17 @@ Copyright (c) 2022, MariaDB Corporation.
 
 Compressing datasink implementation for XtraBackup.
 
+With --compress=quicklz, the output is a qpress archive (.qp).
+With --compress=zlib, each chunk is compressed with deflate and the
+output (.zz) has the following format:
+  "xbzlib10" (8 bytes) uint64 chunk size
+  for each chunk:
+    "NEWBNEWB" (8 bytes) uint64 uncompressed offset
+    uint32 compressed length, uint32 adler32 of the compressed data
+    the compressed data
+  "ENDSENDS" (8 bytes) uint64 uncompressed size
+All integers are little-endian.
+
 This program is free software; you can redistribute it and/or modify
 it under the terms of the GNU General Public License as published by
 the Free Software Foundation; version 2 of the License.
@@ -26,6 +37,7 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1335  USA
 #include <zlib.h>
 #include "common.h"
 #include "datasink.h"
+#include "ds_compress.h"
 
 #define COMPRESS_CHUNK_SIZE ((size_t) (xtrabackup_compress_chunk_size))
 #define MY_QLZ_COMPRESS_OVERHEAD 400
@@ -43,6 +55,9 @@ typedef struct {
 	size_t			from_len;
 	char			*to;
 	size_t			to_len;
+	size_t			to_size;
+	my_bool			zlib;
+	int			level;
 	qlz_state_compress	state;
 	ulong			adler;
 } comp_thread_ctxt_t;
@@ -50,6 +65,7 @@ typedef struct {
 typedef struct {
 	comp_thread_ctxt_t	*threads;
 	uint			nthreads;
+	my_bool			zlib;
 } ds_compress_ctxt_t;
 
 typedef struct {
@@ -62,6 +78,7 @@ typedef struct {
 extern char		*xtrabackup_compress_alg;
 extern uint		xtrabackup_compress_threads;
 extern ulonglong	xtrabackup_compress_chunk_size;
+extern uint		xtrabackup_compress_level;
 
 static ds_ctxt_t *compress_init(const char *root);
 static ds_file_t *compress_open(ds_ctxt_t *ctxt, const char *path,
@@ -85,7 +102,7 @@ datasink_t datasink_compress = {
 static inline int write_uint32_le(ds_file_t *file, ulong n);
 static inline int write_uint64_le(ds_file_t *file, ulonglong n);
 
-static comp_thread_ctxt_t *create_worker_threads(uint n);
+static comp_thread_ctxt_t *create_worker_threads(uint n, my_bool zlib);
 static void destroy_worker_threads(comp_thread_ctxt_t *threads, uint n);
 static void *compress_worker_thread_func(void *arg);
 
@@ -96,9 +113,17 @@ compress_init(const char *root)
 	ds_ctxt_t		*ctxt;
 	ds_compress_ctxt_t	*compress_ctxt;
 	comp_thread_ctxt_t	*threads;
+	const my_bool		zlib = !strcasecmp(xtrabackup_compress_alg,
+						   "zlib");
+
+	/* The compressed length of a chunk is stored in 32 bits. */
+	if (zlib && COMPRESS_CHUNK_SIZE > UINT_MAX32 / 2) {
+		msg("compress: --compress-chunk-size is too large for zlib.");
+		return NULL;
+	}
 
 	/* Create and initialize the worker threads */
-	threads = create_worker_threads(xtrabackup_compress_threads);
+	threads = create_worker_threads(xtrabackup_compress_threads, zlib);
 	if (threads == NULL) {
 		msg("compress: failed to create worker threads.");
 		return NULL;
@@ -110,6 +135,7 @@ compress_init(const char *root)
 	compress_ctxt = (ds_compress_ctxt_t *) (ctxt + 1);
 	compress_ctxt->threads = threads;
 	compress_ctxt->nthreads = xtrabackup_compress_threads;
+	compress_ctxt->zlib = zlib;
 
 	ctxt->ptr = compress_ctxt;
 	ctxt->root = my_strdup(PSI_NOT_INSTRUMENTED, root, MYF(MY_FAE));
@@ -136,20 +162,25 @@ compress_open(ds_ctxt_t *ctxt, const char *path,
 
 	comp_ctxt = (ds_compress_ctxt_t *) ctxt->ptr;
 
-	/* Append the .qp extension to the filename */
-	fn_format(new_name, path, "", ".qp", MYF(MY_APPEND_EXT));
+	/* Append the .qp or .zz extension to the filename */
+	fn_format(new_name, path, "",
+		  comp_ctxt->zlib ? XB_ZLIB_EXT : ".qp", MYF(MY_APPEND_EXT));
 
 	dest_file = ds_open(dest_ctxt, new_name, mystat);
 	if (dest_file == NULL) {
 		return NULL;
 	}
 
-	/* Write the qpress archive header */
-	if (ds_write(dest_file, "qpress10", 8) ||
-	    write_uint64_le(dest_file, COMPRESS_CHUNK_SIZE)) {
+	/* Write the archive header */
+	if (ds_write(dest_file, comp_ctxt->zlib ? "xbzlib10" : "qpress10", 8)
+	    || write_uint64_le(dest_file, COMPRESS_CHUNK_SIZE)) {
 		goto err;
 	}
 
+	if (comp_ctxt->zlib) {
+		goto done;
+	}
+
 	/* We are going to create a one-file "flat" (i.e. with no
 	subdirectories) archive. So strip the directory part from the path and
 	remove the '.qp' suffix. */
@@ -164,6 +195,7 @@ compress_open(ds_ctxt_t *ctxt, const char *path,
 		goto err;
 	}
 
+done:
 	file = (ds_file_t *) my_malloc(PSI_NOT_INSTRUMENTED,
                   sizeof(ds_file_t) + sizeof(ds_compress_file_t), MYF(MY_FAE));
 	comp_file = (ds_compress_file_t *) (file + 1);
@@ -274,6 +306,11 @@ compress_write(ds_file_t *file, const uchar *buf, size_t len)
 						comp_file->bytes_processed);
 			comp_file->bytes_processed += thd->from_len;
 
+			if (!fail && comp_ctxt->zlib) {
+				fail = write_uint32_le(dest_file,
+						       ulong(thd->to_len));
+			}
+
 			if (!fail) {
 				fail = write_uint32_le(dest_file, thd->adler) ||
 					ds_write(dest_file, thd->to,
@@ -307,14 +344,16 @@ compress_close(ds_file_t *file)
 	comp_file = (ds_compress_file_t *) file->ptr;
 	dest_file = comp_file->dest_file;
 
-	/* Write the qpress file trailer */
+	/* Write the file trailer */
 	ds_write(dest_file, "ENDSENDS", 8);
 
 	/* Supposedly the number of written bytes should be written as a
 	"recovery information" in the file trailer, but in reality qpress
-	always writes 8 zeros here. Let's do the same */
+	always writes 8 zeros here. Let's do the same. Our own format
+	records the size, so that truncation can be detected. */
 
-	write_uint64_le(dest_file, 0);
+	write_uint64_le(dest_file, comp_file->comp_ctxt->zlib
+			? comp_file->bytes_processed : 0);
 
 	rc = ds_close(dest_file);
 
@@ -380,7 +419,7 @@ destroy_worker_thread(comp_thread_ctxt_t *thd)
 
 static
 comp_thread_ctxt_t *
-create_worker_threads(uint n)
+create_worker_threads(uint n, my_bool zlib)
 {
 	comp_thread_ctxt_t	*threads;
 	uint 			i;
@@ -393,10 +432,13 @@ create_worker_threads(uint n)
 		comp_thread_ctxt_t *thd = threads + i;
 
 		thd->num = i + 1;
+		thd->zlib = zlib;
+		thd->level = int(xtrabackup_compress_level);
+		thd->to_size = zlib
+			? size_t(compressBound(uLong(COMPRESS_CHUNK_SIZE)))
+			: COMPRESS_CHUNK_SIZE + MY_QLZ_COMPRESS_OVERHEAD;
 		thd->to = static_cast<char*>
-			(my_malloc(PSI_NOT_INSTRUMENTED,
-				   COMPRESS_CHUNK_SIZE +
-				   MY_QLZ_COMPRESS_OVERHEAD,
+			(my_malloc(PSI_NOT_INSTRUMENTED, thd->to_size,
 				   MYF(MY_FAE)));
 
 		/* Initialize and data mutex and condition var */
@@ -457,6 +499,24 @@ compress_worker_thread_func(void *arg)
 
 		if (thd->cancelled)
 			break;
+
+		if (thd->zlib) {
+			uLongf	to_len = uLongf(thd->to_size);
+
+			/* The buffer is sized by compressBound(),
+			so this cannot fail. */
+			int err = compress2((Bytef *) thd->to, &to_len,
+					    (const Bytef *) thd->from,
+					    uLong(thd->from_len), thd->level);
+			xb_a(err == Z_OK);
+			thd->to_len = to_len;
+			thd->adler = adler32(adler32(0L, Z_NULL, 0),
+					     (uchar *) thd->to,
+					     (uInt)thd->to_len);
+			pthread_cond_signal(&thd->done_cond);
+			continue;
+		}
+
 		thd->to_len = qlz_compress(thd->from, thd->to, thd->from_len,
 					   &thd->state);
 
@@ -478,3 +538,102 @@ compress_worker_thread_func(void *arg)
 
 	return NULL;
 }
+
+/** Decompress a file that was created by --compress=zlib.
+@param src	the compressed file
+@param dst	the file to create
+@return whether the file was successfully decompressed */
+bool
+xb_decompress_zlib_file(const char *src, const char *dst)
+{
+	uchar		header[16];
+	uchar		*in = NULL;
+	uchar		*out = NULL;
+	ulonglong	chunk_size;
+	ulong		in_size;
+	ulonglong	offset = 0;
+	bool		ret = false;
+	File		dst_fd = -1;
+	File		src_fd = my_open(src, O_RDONLY | O_BINARY, MYF(MY_WME));
+
+	if (src_fd < 0) {
+		return false;
+	}
+
+	if (my_read(src_fd, header, 16, MYF(MY_WME | MY_NABP))) {
+		goto err;
+	}
+
+	chunk_size = uint8korr(header + 8);
+	if (memcmp(header, "xbzlib10", 8)
+	    || chunk_size == 0 || chunk_size != uLong(chunk_size)) {
+		goto corrupted;
+	}
+
+	in_size = compressBound(uLong(chunk_size));
+	in = static_cast<uchar*>(my_malloc(PSI_NOT_INSTRUMENTED, in_size,
+					   MYF(MY_WME)));
+	out = static_cast<uchar*>(my_malloc(PSI_NOT_INSTRUMENTED,
+					    size_t(chunk_size), MYF(MY_WME)));
+	if (!in || !out) {
+		goto err;
+	}
+
+	dst_fd = my_create(dst, 0, O_WRONLY | O_BINARY | O_TRUNC,
+			   MYF(MY_WME));
+	if (dst_fd < 0) {
+		goto err;
+	}
+
+	for (;;) {
+		uchar	block[8];
+		ulong	in_len;
+		uLongf	out_len = uLongf(chunk_size);
+
+		if (my_read(src_fd, header, 16, MYF(MY_WME | MY_NABP))) {
+			goto err;
+		}
+
+		if (!memcmp(header, "ENDSENDS", 8)) {
+			if (uint8korr(header + 8) != offset) {
+				goto corrupted;
+			}
+			break;
+		}
+
+		if (memcmp(header, "NEWBNEWB", 8)
+		    || uint8korr(header + 8) != offset
+		    || my_read(src_fd, block, 8, MYF(MY_WME | MY_NABP))) {
+			goto corrupted;
+		}
+
+		in_len = uint4korr(block);
+		if (in_len > in_size
+		    || my_read(src_fd, in, in_len, MYF(MY_WME | MY_NABP))
+		    || adler32(adler32(0L, Z_NULL, 0), in, uInt(in_len))
+		    != uint4korr(block + 4)
+		    || uncompress(out, &out_len, in, in_len) != Z_OK) {
+			goto corrupted;
+		}
+
+		if (my_write(dst_fd, out, out_len, MYF(MY_WME | MY_NABP))) {
+			goto err;
+		}
+
+		offset += out_len;
+	}
+
+	ret = true;
+	goto err;
+
+corrupted:
+	msg("decompress: %s is corrupted", src);
+err:
+	if (dst_fd >= 0 && my_close(dst_fd, MYF(MY_WME))) {
+		ret = false;
+	}
+	my_close(src_fd, MYF(MY_WME));
+	my_free(in);
+	my_free(out);
+	return ret;
+}
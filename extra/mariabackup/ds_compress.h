@@ -25,4 +25,13 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1335  USA
 
 extern datasink_t datasink_compress;
 
+/** File name extension of --compress=zlib output */
+#define XB_ZLIB_EXT ".zz"
+
+/** Decompress a file that was created by --compress=zlib.
+@param src	the compressed file
+@param dst	the file to create
+@return whether the file was successfully decompressed */
+bool xb_decompress_zlib_file(const char *src, const char *dst);
+
 #endif
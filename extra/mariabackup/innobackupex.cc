@@ -117,6 +117,7 @@ my_bool ibx_xb_close_files;
 const char *ibx_xtrabackup_compress_alg;
 uint ibx_xtrabackup_compress_threads;
 ulonglong ibx_xtrabackup_compress_chunk_size;
+uint ibx_xtrabackup_compress_level;
 my_bool ibx_xtrabackup_export;
 char *ibx_xtrabackup_extra_lsndir;
 char *ibx_xtrabackup_incremental_basedir;
@@ -194,6 +195,7 @@ enum innobackupex_options
 	OPT_COMPRESS,
 	OPT_COMPRESS_THREADS,
 	OPT_COMPRESS_CHUNK_SIZE,
+	OPT_COMPRESS_LEVEL,
 	OPT_EXPORT,
 	OPT_EXTRA_LSNDIR,
 	OPT_INCREMENTAL_BASEDIR,
@@ -326,7 +328,7 @@ static struct my_option ibx_long_options[] =
 	 (uchar *) 0, (uchar*) 0,
 	 0, GET_BOOL, NO_ARG, 0, 0, 0, 0, 0, 0},
 
-	{"decompress", OPT_DECOMPRESS, "Decompresses all files with the .qp "
+	{"decompress", OPT_DECOMPRESS, "Decompresses all files with the .qp or .zz "
 	 "extension in a backup previously made with the --compress option.",
 	 (uchar *) &opt_ibx_decompress,
 	 (uchar *) &opt_ibx_decompress,
@@ -497,6 +499,12 @@ static struct my_option ibx_long_options[] =
 	 (uchar*) &ibx_xtrabackup_compress_chunk_size,
 	 0, GET_ULL, REQUIRED_ARG, (1 << 16), 1024, ULONGLONG_MAX, 0, 0, 0},
 
+	{"compress-level", OPT_COMPRESS_LEVEL, "Compression level for "
+	 "--compress=zlib, from 1 (fastest) to 9 (best compression).",
+	 (uchar*) &ibx_xtrabackup_compress_level,
+	 (uchar*) &ibx_xtrabackup_compress_level,
+	 0, GET_UINT, REQUIRED_ARG, 1, 1, 9, 0, 0, 0},
+
 	{"export", OPT_EXPORT, " enables exporting individual tables for import "
 	 "into another server.",
 	 (uchar*) &ibx_xtrabackup_export, (uchar*) &ibx_xtrabackup_export,
@@ -634,7 +642,7 @@ You can download full text of the license on http://www.gnu.org/licenses/gpl-2.0
 \n\
 SYNOPOSIS\n\
 \n\
-innobackupex [--compress] [--compress-threads=NUMBER-OF-THREADS] [--compress-chunk-size=CHUNK-SIZE]\n\
+innobackupex [--compress[=zlib|quicklz]] [--compress-threads=NUMBER-OF-THREADS] [--compress-chunk-size=CHUNK-SIZE] [--compress-level=LEVEL]\n\
              [--include=REGEXP] [--user=NAME]\n\
              [--password=WORD] [--port=PORT] [--socket=SOCKET]\n\
              [--no-timestamp] [--ibbackup=IBBACKUP-BINARY]\n\
@@ -695,8 +703,8 @@ cases when there is not enough free disk space to copy files.\n\
 The --decompress command will decompress a backup made\n\
 with the --compress option. The\n\
 --parallel option will allow multiple files to be decompressed\n\
-simultaneously. In order to decompress, the qpress utility MUST be installed\n\
-and accessible within the path. This process will remove the original\n\
+simultaneously. In order to decompress .qp files, the qpress utility MUST be\n\
+installed and accessible within the path. This process will remove the original\n\
 compressed files and leave the results in the same location.\n\
 \n\
 On success the exit code innobackupex is 0. A non-zero exit code \n\
@@ -742,7 +750,8 @@ ibx_get_one_option(const struct my_option *opt,
 	case OPT_COMPRESS:
 		if (argument == NULL)
 			xtrabackup_compress_alg = "quicklz";
-		else if (strcasecmp(argument, "quicklz"))
+		else if (strcasecmp(argument, "quicklz")
+			 && strcasecmp(argument, "zlib"))
 		{
 			ibx_msg("Invalid --compress argument: %s\n", argument);
 			return 1;
@@ -880,6 +889,7 @@ ibx_init()
 	xtrabackup_compress_alg = ibx_xtrabackup_compress_alg;
 	xtrabackup_compress_threads = ibx_xtrabackup_compress_threads;
 	xtrabackup_compress_chunk_size = ibx_xtrabackup_compress_chunk_size;
+	xtrabackup_compress_level = ibx_xtrabackup_compress_level;
 	xtrabackup_export = ibx_xtrabackup_export;
 	xtrabackup_extra_lsndir = ibx_xtrabackup_extra_lsndir;
 	xtrabackup_incremental_basedir = ibx_xtrabackup_incremental_basedir;
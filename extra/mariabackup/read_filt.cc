@@ -26,6 +26,13 @@ Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1335  USA
 #include "common.h"
 #include "fil_cur.h"
 #include "xtrabackup.h"
+#include "buf0trk.h"
+#include <algorithm>
+#include <vector>
+
+/* Sorted page_id_t::raw() of the pages that may have been modified since
+incremental_lsn, according to the changed page tracking file */
+static std::vector<uint64_t> changed_pages;
 
 /****************************************************************//**
 Perform read filter context initialization that is common to all read
@@ -39,6 +46,9 @@ rf_pass_through_init(
 	ctxt->offset = 0;
 	ctxt->data_file_size = cursor->statinfo.st_size;
 	ctxt->buffer_capacity = cursor->buf_size;
+	ctxt->page_size = cursor->page_size;
+	ctxt->changed_page = NULL;
+	ctxt->changed_end = NULL;
 }
 
 /****************************************************************//**
@@ -71,3 +81,101 @@ xb_read_filt_t rf_pass_through = {
 	&rf_pass_through_init,
 	&rf_pass_through_get_next_batch,
 };
+
+/****************************************************************//**
+Initialize the changed page read filter. Only the pages of the
+tablespace that are listed in the changed page tracking file will
+be read, unless the whole tablespace was marked as modified.  */
+static
+void
+rf_changed_pages_init(
+	xb_read_filt_ctxt_t*	ctxt,	/*!<in/out: read filter context */
+	const xb_fil_cur_t*	cursor)	/*!<in: file cursor */
+{
+	rf_pass_through_init(ctxt, cursor);
+
+	const uint64_t	first = page_id_t(cursor->space_id, 0).raw();
+	const uint64_t	last = page_id_t(cursor->space_id, FIL_NULL).raw();
+	const uint64_t*	all = changed_pages.data();
+	const uint64_t*	all_end = all + changed_pages.size();
+	const uint64_t*	begin = std::lower_bound(all, all_end, first);
+	const uint64_t*	end = std::upper_bound(begin, all_end, last);
+
+	if (begin == end || end[-1] != last) {
+		ctxt->changed_page = begin;
+		ctxt->changed_end = end;
+	}
+}
+
+/****************************************************************//**
+Get the next batch of contiguous changed pages.  */
+static
+void
+rf_changed_pages_get_next_batch(
+/*============================*/
+	xb_read_filt_ctxt_t*	ctxt,			/*!<in/out: read filter
+							context */
+	int64_t*		read_batch_start,	/*!<out: starting read
+							offset in bytes for the
+							next batch of pages */
+	int64_t*		read_batch_len)		/*!<out: length in
+							bytes of the next batch
+							of pages */
+{
+	if (!ctxt->changed_page) {
+		rf_pass_through_get_next_batch(ctxt, read_batch_start,
+					       read_batch_len);
+		return;
+	}
+
+	const int64_t	page_size = int64_t(ctxt->page_size);
+	const int64_t	max_pages = int64_t(ctxt->buffer_capacity) / page_size;
+	const uint64_t*	p = ctxt->changed_page;
+
+	*read_batch_len = 0;
+
+	if (p == ctxt->changed_end) {
+		return;
+	}
+
+	const uint32_t	page_no = page_id_t(*p).page_no();
+	int64_t		n = 1;
+
+	while (++p != ctxt->changed_end && n < max_pages
+	       && page_id_t(*p).page_no() == page_no + n) {
+		n++;
+	}
+
+	ctxt->changed_page = p;
+	*read_batch_start = int64_t(page_no) * page_size;
+
+	if (*read_batch_start >= ctxt->data_file_size) {
+		/* The file was shrunk; no further pages exist. */
+		ctxt->changed_page = ctxt->changed_end;
+		return;
+	}
+
+	*read_batch_len = std::min(n * page_size,
+				   ctxt->data_file_size - *read_batch_start);
+	ctxt->offset = *read_batch_start + *read_batch_len;
+}
+
+/* The changed page read filter */
+xb_read_filt_t rf_changed_pages = {
+	&rf_changed_pages_init,
+	&rf_changed_pages_get_next_batch,
+};
+
+/** Load the changed page tracking file of the server.
+@param from_lsn	the LSN of the previous backup
+@param to_lsn	the checkpoint LSN at the start of this backup
+@return whether rf_changed_pages can be used */
+bool rf_changed_pages_load(uint64_t from_lsn, uint64_t to_lsn)
+{
+	char	path[FN_REFLEN];
+
+	snprintf(path, sizeof path, "%s" FN_ROOTDIR "%s",
+		 srv_data_home, BUF_TRACK_FILE_NAME);
+
+	return buf_track_t::read(path, from_lsn, to_lsn, changed_pages);
+}
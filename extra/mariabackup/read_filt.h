@@ -35,6 +35,10 @@ struct xb_read_filt_ctxt_t {
 	int64_t		offset;		/*!< current file offset */
 	int64_t		data_file_size;	/*!< data file size */
 	size_t		buffer_capacity;/*!< read buffer capacity */
+	size_t		page_size;	/*!< physical page size */
+	const uint64_t*	changed_page;	/*!< next changed page, or NULL
+					to read the whole file */
+	const uint64_t*	changed_end;	/*!< end of the changed pages */
 };
 
 /* The read filter */
@@ -47,5 +51,12 @@ struct xb_read_filt_t {
 };
 
 extern xb_read_filt_t rf_pass_through;
+extern xb_read_filt_t rf_changed_pages;
+
+/** Load the changed page tracking file of the server.
+@param from_lsn	the LSN of the previous backup
+@param to_lsn	the checkpoint LSN at the start of this backup
+@return whether rf_changed_pages can be used */
+bool rf_changed_pages_load(uint64_t from_lsn, uint64_t to_lsn);
 
 #endif
@@ -81,6 +81,7 @@ Street, Fifth Floor, Boston, MA 02110-1335 USA
 #include "trx0sys.h"
 #include <buf0dblwr.h>
 #include <buf0flu.h>
+#include <buf0trk.h>
 #include "ha_innodb.h"
 #include "fts0types.h"
 
@@ -206,6 +207,9 @@ lsn_t checkpoint_no_start;
 /** whether log_copying_thread() is active; protected by recv_sys.mutex */
 static bool log_copying_running;
 
+/** whether the changed page tracking file covers the incremental backup */
+static bool use_changed_pages;
+
 uint xtrabackup_parallel;
 
 char *xtrabackup_stream_str = NULL;
@@ -216,6 +220,7 @@ const char *xtrabackup_compress_alg = NULL;
 uint xtrabackup_compress = FALSE;
 uint xtrabackup_compress_threads;
 ulonglong xtrabackup_compress_chunk_size = 0;
+uint xtrabackup_compress_level = 1;
 
 /* sleep interval beetween log copy iterations in log copying thread
 in milliseconds (default is 1 second) */
@@ -1305,6 +1310,7 @@ enum options_xtrabackup
   OPT_XTRA_COMPRESS,
   OPT_XTRA_COMPRESS_THREADS,
   OPT_XTRA_COMPRESS_CHUNK_SIZE,
+  OPT_XTRA_COMPRESS_LEVEL,
   OPT_LOG,
   OPT_INNODB,
   OPT_INNODB_DATA_FILE_PATH,
@@ -1495,29 +1501,33 @@ struct my_option xb_client_options[]= {
 
     {"compress", OPT_XTRA_COMPRESS,
      "Compress individual backup files using the "
-     "specified compression algorithm. It uses no longer maintained QuickLZ "
-     "library hence this option was deprecated with MariaDB 10.1.31 and 10.2.13.",
+     "specified compression algorithm. Supported algorithms are 'zlib' "
+     "and 'quicklz' (the default). 'quicklz' uses the no longer maintained "
+     "QuickLZ library and was deprecated with MariaDB 10.1.31 and 10.2.13.",
      (G_PTR *) &xtrabackup_compress_alg, (G_PTR *) &xtrabackup_compress_alg, 0,
      GET_STR, OPT_ARG, 0, 0, 0, 0, 0, 0},
 
     {"compress-threads", OPT_XTRA_COMPRESS_THREADS,
      "Number of threads for parallel data compression. The default value is "
-     "1. "
-     "This option was deprecated as it relies on the no longer "
-     "maintained QuickLZ library.",
+     "1.",
      (G_PTR *) &xtrabackup_compress_threads,
      (G_PTR *) &xtrabackup_compress_threads, 0, GET_UINT, REQUIRED_ARG, 1, 1,
      UINT_MAX, 0, 0, 0},
 
     {"compress-chunk-size", OPT_XTRA_COMPRESS_CHUNK_SIZE,
      "Size of working buffer(s) for compression threads in bytes. The default "
-     "value is 64K. "
-     "This option was deprecated as it relies on the no longer "
-     "maintained QuickLZ library.",
+     "value is 64K.",
      (G_PTR *) &xtrabackup_compress_chunk_size,
      (G_PTR *) &xtrabackup_compress_chunk_size, 0, GET_ULL, REQUIRED_ARG,
      (1 << 16), 1024, ULONGLONG_MAX, 0, 0, 0},
 
+    {"compress-level", OPT_XTRA_COMPRESS_LEVEL,
+     "Compression level for --compress=zlib, from 1 (fastest) "
+     "to 9 (best compression).",
+     (G_PTR *) &xtrabackup_compress_level,
+     (G_PTR *) &xtrabackup_compress_level, 0, GET_UINT, REQUIRED_ARG,
+     1, 1, 9, 0, 0, 0},
+
     {"incremental-force-scan", OPT_XTRA_INCREMENTAL_FORCE_SCAN,
      "Perform a full-scan incremental backup even in the presence of changed "
      "page bitmap data",
@@ -1624,10 +1634,9 @@ struct my_option xb_client_options[]= {
      NO_ARG, 0, 0, 0, 0, 0, 0},
 
     {"decompress", OPT_DECOMPRESS,
-     "Decompresses all files with the .qp "
+     "Decompresses all files with the .qp or .zz "
      "extension in a backup previously made with the --compress option. "
-     "This option was deprecated as it relies on the no longer "
-     "maintained QuickLZ library.",
+     "Decompressing .qp files requires the qpress utility.",
      (uchar *) &opt_decompress, (uchar *) &opt_decompress, 0, GET_BOOL, NO_ARG,
      0, 0, 0, 0, 0, 0},
 
@@ -1695,7 +1704,7 @@ struct my_option xb_client_options[]= {
      0, 0, 0, 0},
 
     {"remove-original", OPT_REMOVE_ORIGINAL,
-     "Remove .qp files after decompression.", (uchar *) &opt_remove_original,
+     "Remove .qp and .zz files after decompression.", (uchar *) &opt_remove_original,
      (uchar *) &opt_remove_original, 0, GET_BOOL, NO_ARG, 0, 0, 0, 0, 0, 0},
 
     {"ftwrl-wait-query-type", OPT_LOCK_WAIT_QUERY_TYPE,
@@ -2310,7 +2319,7 @@ xb_get_one_option(const struct my_option *opt,
   case OPT_XTRA_COMPRESS:
     if (argument == NULL)
       xtrabackup_compress_alg = "quicklz";
-    else if (strcasecmp(argument, "quicklz"))
+    else if (strcasecmp(argument, "quicklz") && strcasecmp(argument, "zlib"))
     {
       msg("Invalid --compress argument: %s", argument);
       return 1;
@@ -3268,9 +3277,11 @@ static my_bool xtrabackup_copy_datafile(ds_ctxt *ds_data,
 
 	memset(&write_filt_ctxt, 0, sizeof(xb_write_filt_ctxt_t));
 
-	bool was_dropped;
+	bool was_dropped, was_created;
 	mysql_mutex_lock(&recv_sys.mutex);
 	was_dropped = (ddl_tracker.drops.find(node->space->id) != ddl_tracker.drops.end());
+	was_created = (ddl_tracker.id_to_name.find(node->space->id)
+		       != ddl_tracker.id_to_name.end());
 	mysql_mutex_unlock(&recv_sys.mutex);
 	if (was_dropped) {
 		if (node->is_open()) {
@@ -3281,7 +3292,12 @@ static my_bool xtrabackup_copy_datafile(ds_ctxt *ds_data,
 		goto skip;
 	}
 
-	read_filter = &rf_pass_through;
+	/* Tablespaces that were created or renamed after the backup
+	started may be missing from the changed page tracking file.
+	The doublewrite buffer and undo logs are always scanned. */
+	read_filter = use_changed_pages && &write_filter == &wf_incremental
+		&& fil_is_user_tablespace_id(node->space->id) && !was_created
+		? &rf_changed_pages : &rf_pass_through;
 
 	res = xb_fil_cur_open(&cursor, read_filter, node, thread_n, ULLONG_MAX);
 	if (res == XB_FIL_CUR_SKIP) {
@@ -5414,6 +5430,20 @@ static bool xtrabackup_backup_func()
 		goto fail;
 	}
 
+	if (xtrabackup_incremental && !xtrabackup_incremental_force_scan) {
+		use_changed_pages = rf_changed_pages_load(
+			incremental_lsn, log_sys.next_checkpoint_lsn);
+		if (use_changed_pages) {
+			msg("Copying the pages listed in "
+			    BUF_TRACK_FILE_NAME " since LSN " LSN_PF,
+			    incremental_lsn);
+		} else {
+			msg(BUF_TRACK_FILE_NAME " does not cover LSN " LSN_PF
+			    " to " LSN_PF "; scanning all pages",
+			    incremental_lsn, log_sys.next_checkpoint_lsn);
+		}
+	}
+
 	/* copy log file by current position */
 
 	mysql_mutex_lock(&recv_sys.mutex);
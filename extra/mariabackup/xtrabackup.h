@@ -124,6 +124,7 @@ extern const char	*xtrabackup_compress_alg;
 
 extern uint		xtrabackup_compress_threads;
 extern ulonglong	xtrabackup_compress_chunk_size;
+extern uint		xtrabackup_compress_level;
 
 extern my_bool		xtrabackup_export;
 extern char		*xtrabackup_extra_lsndir;
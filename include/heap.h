@@ -108,6 +108,13 @@ typedef struct st_heap_block
 } HP_BLOCK;
 
 struct st_heap_info;			/* For reference */
+struct st_hp_blob_chunk;
+
+typedef struct st_hp_blob_desc		/* Blob column of the record */
+{
+  uint offset;				/* Start of the column in the record */
+  uint packlength;			/* Bytes used for the length */
+} HP_BLOB_DESC;
 
 typedef struct st_hp_keydef		/* Key definition with open */
 {
@@ -134,6 +141,8 @@ typedef struct st_heap_share
 {
   HP_BLOCK block;
   HP_KEYDEF  *keydef;
+  HP_BLOB_DESC *blob_descs;
+  struct st_hp_blob_chunk *blob_chunks;	/* Stored blob values */
   ulonglong data_length,index_length,max_table_size;
   ulonglong auto_increment;
   ulong min_records,max_records;	/* Params to open */
@@ -147,6 +156,7 @@ typedef struct st_heap_share
   uint visible;                         /* Offset to the visible/deleted mark */
   uint changed;
   uint keys,max_key_length;
+  uint blobs;				/* Number of blob columns */
   uint currently_disabled_keys;    /* saved value from "keys" when disabled */
   uint open_count;
   uchar *del_link;			/* Link to next block with del. rec */
@@ -173,6 +183,7 @@ typedef struct st_heap_info
   uint opt_flag,update;
   uchar *lastkey;			/* Last used key with rkey */
   uchar *recbuf;                         /* Record buffer for rb-tree keys */
+  uchar **blob_ptrs;			/* Blob copies of a written record */
   enum ha_rkey_function last_find_flag;
   TREE_ELEMENT *parents[MAX_TREE_HEIGHT+1];
   TREE_ELEMENT **last_pos;
@@ -188,6 +199,8 @@ typedef struct st_heap_info
 typedef struct st_heap_create_info
 {
   HP_KEYDEF *keydef;
+  HP_BLOB_DESC *blob_descs;
+  uint blobs;
   uint auto_key;                        /* keynr [1 - maxkey] for auto key */
   uint auto_key_type;
   uint keys;
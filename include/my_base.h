@@ -389,6 +389,11 @@ enum ha_base_keytype {
 /* Flags used by start_bulk_insert */
 
 #define HA_CREATE_UNIQUE_INDEX_BY_SORT   1U
+/*
+  Any failed row fails the whole statement, so the engine may delay work
+  for the inserted rows until end_bulk_insert()
+*/
+#define HA_BULK_INSERT_ABORT_ON_ERROR    2U
 
 
 /*
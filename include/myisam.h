@@ -271,6 +271,7 @@ extern int mi_rprev(struct st_myisam_info *file,uchar *buf,int inx);
 extern int mi_rrnd(struct st_myisam_info *file,uchar *buf, my_off_t pos);
 extern int mi_scan_init(struct st_myisam_info *file);
 extern int mi_scan(struct st_myisam_info *file,uchar *buf);
+extern void mi_scan_seek(struct st_myisam_info *file, my_off_t filepos);
 extern int mi_rsame(struct st_myisam_info *file,uchar *record,int inx);
 extern int mi_rsame_with_pos(struct st_myisam_info *file,uchar *record,
 			     int inx, my_off_t pos);
@@ -463,6 +463,8 @@ typedef struct st_net {
   unsigned char compress;
   my_bool pkt_nr_can_be_reset;
   my_bool using_proxy_protocol;
+  /* Compression context reused for all packets, see my_compress_ctx() */
+  void *compress_ctx;
   /*
     Pointer to query object in query cache, do not equal NULL (0) for
     queries in cache that have not stored its results yet
@@ -633,7 +635,9 @@ void	my_net_local_init(NET *net);
 void	net_end(NET *net);
 void	net_clear(NET *net, my_bool clear_buffer);
 my_bool net_realloc(NET *net, size_t length);
+void	net_shrink(NET *net, size_t length);
 my_bool	net_flush(NET *net);
+my_bool	net_flush_response(NET *net);
 my_bool	my_net_write(NET *net,const unsigned char *packet, size_t len);
 my_bool	net_write_command(NET *net,unsigned char command,
 			  const unsigned char *header, size_t head_len,
@@ -0,0 +1,90 @@
+/**
+  @file zstd.h
+  This service provides dynamic access to Zstandard.
+*/
+
+#ifndef ZSTD_INCLUDED
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef MYSQL_ABI_CHECK
+#include <stdbool.h>
+#include <stddef.h>
+#endif
+
+#ifndef MYSQL_DYNAMIC_PLUGIN
+#define provider_service_zstd provider_service_zstd_static
+#endif
+
+#ifndef ZSTD_VERSION_NUMBER
+typedef struct ZSTD_CCtx_s ZSTD_CCtx;
+typedef struct ZSTD_DCtx_s ZSTD_DCtx;
+
+#define ZSTD_createCCtx(...)     provider_service_zstd->ZSTD_createCCtx_ptr     (__VA_ARGS__)
+#define ZSTD_freeCCtx(...)       provider_service_zstd->ZSTD_freeCCtx_ptr       (__VA_ARGS__)
+#define ZSTD_compressCCtx(...)   provider_service_zstd->ZSTD_compressCCtx_ptr   (__VA_ARGS__)
+#define ZSTD_createDCtx(...)     provider_service_zstd->ZSTD_createDCtx_ptr     (__VA_ARGS__)
+#define ZSTD_freeDCtx(...)       provider_service_zstd->ZSTD_freeDCtx_ptr       (__VA_ARGS__)
+#define ZSTD_decompressDCtx(...) provider_service_zstd->ZSTD_decompressDCtx_ptr (__VA_ARGS__)
+#define ZSTD_isError(...)        provider_service_zstd->ZSTD_isError_ptr        (__VA_ARGS__)
+#endif
+
+#define DEFINE_ZSTD_createCCtx(NAME) NAME( \
+    void                                   \
+)
+
+#define DEFINE_ZSTD_freeCCtx(NAME) NAME( \
+    ZSTD_CCtx *cctx                      \
+)
+
+#define DEFINE_ZSTD_compressCCtx(NAME) NAME( \
+    ZSTD_CCtx *cctx,                         \
+    void *dst,                               \
+    size_t dstCapacity,                      \
+    const void *src,                         \
+    size_t srcSize,                          \
+    int compressionLevel                     \
+)
+
+#define DEFINE_ZSTD_createDCtx(NAME) NAME( \
+    void                                   \
+)
+
+#define DEFINE_ZSTD_freeDCtx(NAME) NAME( \
+    ZSTD_DCtx *dctx                      \
+)
+
+#define DEFINE_ZSTD_decompressDCtx(NAME) NAME( \
+    ZSTD_DCtx *dctx,                           \
+    void *dst,                                 \
+    size_t dstCapacity,                        \
+    const void *src,                           \
+    size_t srcSize                             \
+)
+
+#define DEFINE_ZSTD_isError(NAME) NAME( \
+    size_t code                         \
+)
+
+struct provider_service_zstd_st
+{
+  ZSTD_CCtx *DEFINE_ZSTD_createCCtx((*ZSTD_createCCtx_ptr));
+  size_t DEFINE_ZSTD_freeCCtx((*ZSTD_freeCCtx_ptr));
+  size_t DEFINE_ZSTD_compressCCtx((*ZSTD_compressCCtx_ptr));
+  ZSTD_DCtx *DEFINE_ZSTD_createDCtx((*ZSTD_createDCtx_ptr));
+  size_t DEFINE_ZSTD_freeDCtx((*ZSTD_freeDCtx_ptr));
+  size_t DEFINE_ZSTD_decompressDCtx((*ZSTD_decompressDCtx_ptr));
+  unsigned DEFINE_ZSTD_isError((*ZSTD_isError_ptr));
+
+  bool is_loaded;
+};
+
+extern struct provider_service_zstd_st *provider_service_zstd;
+
+#ifdef __cplusplus
+}
+#endif
+
+#define ZSTD_INCLUDED
+#endif
@@ -25,7 +25,8 @@ extern "C" {
 #include <my_list.h>
 
 struct st_thr_lock;
-extern ulong locks_immediate,locks_waited ;
+extern ulong locks_waited;
+extern ulong thr_lock_immediate_count(void);
 
 /*
   Important: if a new lock type is added, a matching lock description
@@ -265,18 +265,35 @@ void lf_pinbox_free(LF_PINS *pins, void *addr)
                       lf_pinbox_real_free(pins););
 }
 
+/*
+  Size of the array that lf_pinbox_real_free() sorts the purgatory into.
+  Larger purgatories are processed in several passes.
+*/
+#define LF_PURGATORY_SCAN_SIZE (LF_PURGATORY_SIZE * 2)
+
+/* Addresses in st_match_and_save_arg::addr that are pinned are tagged */
+#define PINNED_TAG ((intptr) 1)
+#define untag(A)   ((void *)((intptr)(A) & ~PINNED_TAG))
+
 struct st_match_and_save_arg {
-  LF_PINS *pins;
-  LF_PINBOX *pinbox;
-  void *old_purgatory;
+  void **addr;                                  /* sorted addresses */
+  uint n;                                       /* number of addresses */
+  uint pinned;                                  /* number found pinned */
+  my_bool sorted;                               /* whether addr is sorted */
 };
 
+static int ptr_cmp(const void *a, const void *b)
+{
+  const char *x= untag(*(void * const *) a), *y= untag(*(void * const *) b);
+  return x < y ? -1 : x > y;
+}
+
 /*
   Callback for lf_dynarray_iterate:
   Scan all pins of all threads, for each active (non-null) pin,
-  scan the current thread's purgatory. If present there, move it
-  to a new purgatory. At the end, the old purgatory will contain
-  pointers not pinned by any thread.
+  look it up in the sorted array of addresses from the current thread's
+  purgatory and tag it if found. At the end, the untagged addresses are
+  not pinned by any thread.
 */
 static int match_and_save(void *e, void *a)
 {
@@ -290,26 +307,22 @@ static int match_and_save(void *e, void *a)
     for (i= 0; i < LF_PINBOX_PINS; i++)
     {
       void *p= my_atomic_loadptr((void **)&el->pin[i]);
-      if (p)
+      void **found;
+      if (!p)
+        continue;
+      if (!arg->sorted)
       {
-        void *cur= arg->old_purgatory;
-        void **list_prev= &arg->old_purgatory;
-        while (cur)
-        {
-          void *next= pnext_node(arg->pinbox, cur);
-
-          if (p == cur)
-          {
-            /* pinned - keeping */
-            add_to_purgatory(arg->pins, cur);
-            /* unlink from old purgatory */
-            *list_prev= next;
-          }
-          else
-            list_prev= (void **)((char *)cur+arg->pinbox->free_ptr_offset);
-          cur= next;
-        }
-        if (!arg->old_purgatory)
+        /* Sort only when the first pin is seen; most pins are unused. */
+        qsort(arg->addr, arg->n, sizeof *arg->addr, ptr_cmp);
+        arg->sorted= TRUE;
+      }
+      if ((found= bsearch(&p, arg->addr, arg->n, sizeof *arg->addr,
+                          ptr_cmp)) &&
+          !((intptr) *found & PINNED_TAG))
+      {
+        /* pinned - keeping */
+        *found= (void *)((intptr) *found | PINNED_TAG);
+        if (++arg->pinned == arg->n)
           return 1;
       }
     }
@@ -319,27 +332,55 @@ static int match_and_save(void *e, void *a)
 
 /*
   Scan the purgatory and free everything that can be freed
+
+  DESCRIPTION
+    The addresses of the purgatory are copied to an array and sorted, so
+    that every pin of every thread costs a binary search instead of a walk
+    over the whole purgatory list.
 */
 static void lf_pinbox_real_free(LF_PINS *pins)
 {
   LF_PINBOX *pinbox= pins->pinbox;
-
+  void *addr[LF_PURGATORY_SCAN_SIZE];
+  struct st_match_and_save_arg arg;
   /* Store info about current purgatory. */
-  struct st_match_and_save_arg arg = {pins, pinbox, pins->purgatory};
+  void *old_purgatory= pins->purgatory;
+
   /* Reset purgatory. */
   pins->purgatory= NULL;
   pins->purgatory_count= 0;
 
+  arg.addr= addr;
+  while (old_purgatory)
+  {
+    void *first= NULL, *last= NULL;
+    uint i;
+
+    for (arg.n= 0; old_purgatory && arg.n < LF_PURGATORY_SCAN_SIZE; arg.n++)
+    {
+      addr[arg.n]= old_purgatory;
+      old_purgatory= pnext_node(pinbox, old_purgatory);
+    }
+    arg.pinned= 0;
+    arg.sorted= FALSE;
 
-  lf_dynarray_iterate(&pinbox->pinarray, match_and_save, &arg);
+    lf_dynarray_iterate(&pinbox->pinarray, match_and_save, &arg);
 
-  if (arg.old_purgatory)
-  {
+    for (i= 0; i < arg.n; i++)
+    {
+      if ((intptr) addr[i] & PINNED_TAG)
+        add_to_purgatory(pins, untag(addr[i]));
+      else
+      {
+        pnext_node(pinbox, addr[i])= first;
+        first= addr[i];
+        if (!last)
+          last= first;
+      }
+    }
     /* Some objects in the old purgatory were not pinned, free them. */
-    void *last= arg.old_purgatory;
-    while (pnext_node(pinbox, last))
-      last= pnext_node(pinbox, last);
-    pinbox->free_func(arg.old_purgatory, last, pinbox->free_func_arg);
+    if (first)
+      pinbox->free_func(first, last, pinbox->free_func_arg);
   }
 }
 
@@ -838,6 +838,16 @@ int _my_b_cache_read(IO_CACHE *info, uchar *Buffer, size_t Count)
       info->seek_not_done=1;
       DBUG_RETURN(1);
     }
+#ifdef POSIX_FADV_WILLNEED
+    /*
+      Let the kernel read the next buffer in the background while the
+      caller is processing this one.
+    */
+    if (info->type == READ_CACHE &&
+        info->end_of_file - pos_in_file > length)
+      posix_fadvise(info->file, (off_t) (pos_in_file + length),
+                    (off_t) info->read_length, POSIX_FADV_WILLNEED);
+#endif
   }
   /*
     Count is the remaining number of bytes requested.
@@ -217,6 +217,9 @@ typedef struct st_simple_key_cache_cb
     from key cache, which might improve performance in many cases;
     to enable this add:
     #define SERIALIZED_READ_FROM_CACHE
+    Reads of at most KEYCACHE_SHORT_READ_LENGTH bytes from a cached block
+    are always done without releasing the lock, as releasing and
+    reacquiring it costs more than the copy.
   - to set an upper bound for number of threads simultaneously
     using the key cache; this setting helps to determine an optimal
     size for hash table and improve performance when the number of
@@ -248,6 +251,14 @@ typedef struct st_simple_key_cache_cb
     #define KEYCACHE_DEBUG_LOG  "my_key_cache_debug.log"
 */
 
+/*
+  Maximum length of a read from a cache block that is copied without
+  releasing cache_lock. This covers the index pages of MyISAM tables
+  with the default block sizes, so that a cache hit locks the cache
+  only once.
+*/
+#define KEYCACHE_SHORT_READ_LENGTH 1024
+
 #define STRUCT_PTR(TYPE, MEMBER, a)                                           \
           (TYPE *) ((char *) (a) - offsetof(TYPE, MEMBER))
 
@@ -2900,15 +2911,19 @@ uchar *simple_key_cache_read(SIMPLE_KEY_CACHE_CB *keycache,
         {
           DBUG_ASSERT(block->status & (BLOCK_READ | BLOCK_IN_USE));
 #if !defined(SERIALIZED_READ_FROM_CACHE)
-          keycache_pthread_mutex_unlock(&keycache->cache_lock);
+          if (read_length > KEYCACHE_SHORT_READ_LENGTH)
+            keycache_pthread_mutex_unlock(&keycache->cache_lock);
 #endif
 
           /* Copy data from the cache buffer */
           memcpy(buff, block->buffer+offset, (size_t) read_length);
 
 #if !defined(SERIALIZED_READ_FROM_CACHE)
-          keycache_pthread_mutex_lock(&keycache->cache_lock);
-          DBUG_ASSERT(block->status & (BLOCK_READ | BLOCK_IN_USE));
+          if (read_length > KEYCACHE_SHORT_READ_LENGTH)
+          {
+            keycache_pthread_mutex_lock(&keycache->cache_lock);
+            DBUG_ASSERT(block->status & (BLOCK_READ | BLOCK_IN_USE));
+          }
 #endif
         }
       }
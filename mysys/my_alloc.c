@@ -521,6 +521,75 @@ void free_root(MEM_ROOT *root, myf MyFlags)
 }
 
 
+/*
+  Deallocate everything used by alloc_root, but keep some blocks for reuse
+
+  SYNOPSIS
+    free_root_keep_blocks()
+      root		Memory root
+      keep_size		Max total size of the blocks to keep, not counting
+                        the preallocated block
+
+  NOTES
+    Works like free_root(root, MYF(MY_KEEP_PREALLOC)), except that blocks
+    are marked free instead of being freed as long as their total size
+    does not exceed keep_size. This lets a root that is freed after every
+    statement reuse its blocks instead of allocating them again.
+*/
+
+void free_root_keep_blocks(MEM_ROOT *root, size_t keep_size)
+{
+  USED_MEM *next, *old, *keep= 0;
+  USED_MEM *lists[2];
+  uint i;
+  DBUG_ENTER("free_root_keep_blocks");
+
+#if defined(HAVE_valgrind) && defined(EXTRA_DEBUG)
+  /* Blocks are allocated for every single object, there is nothing to reuse */
+  keep_size= 0;
+#endif
+  if (!keep_size)
+  {
+    free_root(root, MYF(MY_KEEP_PREALLOC));
+    DBUG_VOID_RETURN;
+  }
+
+  lists[0]= root->used;
+  lists[1]= root->free;
+  for (i= 0; i < 2; i++)
+  {
+    for (next= lists[i]; next ;)
+    {
+      old= next; next= next->next;
+      if (old == root->pre_alloc)
+        continue;
+      if (old->size <= keep_size)
+      {
+        keep_size-= old->size;
+        old->left= old->size - ALIGN_SIZE(sizeof(USED_MEM));
+        TRASH_MEM(old);
+        old->next= keep;
+        keep= old;
+      }
+      else
+        root_free(root, old, old->size);
+    }
+  }
+  root->used= 0;
+  root->free= keep;
+  if (root->pre_alloc)
+  {
+    root->pre_alloc->left= root->pre_alloc->size - ALIGN_SIZE(sizeof(USED_MEM));
+    TRASH_MEM(root->pre_alloc);
+    root->pre_alloc->next= root->free;
+    root->free= root->pre_alloc;
+  }
+  root->block_num= 4;
+  root->first_block_usage= 0;
+  DBUG_VOID_RETURN;
+}
+
+
 /*
   Find block that contains an object and set the pre_alloc to it
 */
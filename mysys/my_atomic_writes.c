@@ -20,10 +20,13 @@ my_bool my_may_have_atomic_write= IF_WIN(1,0);
 #ifdef __linux__
 
 my_bool has_shannon_atomic_write, has_fusion_io_atomic_write,
-        has_sfx_atomic_write;
+        has_sfx_atomic_write, has_blk_atomic_write;
 my_bool has_sfx_card;
 
 #include <sys/ioctl.h>
+#include <sys/sysmacros.h>
+#include <sys/vfs.h>
+#include <dirent.h>
 
 /* Linux seems to allow up to 15 partitions per block device.
 Partition number 0 is the whole block device. */
@@ -429,6 +432,124 @@ static my_bool sfx_could_disable_punch_hole(File file)
   return 0;
 }
 
+/***********************************************************************
+  Block devices that report a power-fail atomic write unit
+  (such as NVMe AWUPF) in sysfs, starting with Linux 6.11
+************************************************************************/
+
+/**
+   Read a number from a sysfs file
+   @param[in]  path   file name
+   @param[out] val    the number
+   @return TRUE       The file could be read
+*/
+
+static my_bool read_sysfs_ulong(const char *path, unsigned long *val)
+{
+  char buf[32];
+  ssize_t len;
+  int fd= open(path, O_RDONLY);
+  if (fd < 0)
+    return FALSE;
+  len= read(fd, buf, sizeof buf - 1);
+  close(fd);
+  if (len <= 0)
+    return FALSE;
+  buf[len]= 0;
+  *val= strtoul(buf, NULL, 10);
+  return TRUE;
+}
+
+/**
+   Check if the system has a block device that guarantees atomic writes
+   @return TRUE   Device exists
+*/
+
+static my_bool test_if_blk_atomic_write_exists()
+{
+  my_bool found= FALSE;
+  struct dirent *d;
+  DIR *dir= opendir("/sys/block");
+
+  if (!dir)
+    return FALSE;
+  while (!found && (d= readdir(dir)))
+  {
+    char path[FN_REFLEN];
+    unsigned long max_bytes;
+    if (d->d_name[0] == '.')
+      continue;
+    snprintf(path, sizeof path,
+             "/sys/block/%s/queue/atomic_write_unit_max_bytes", d->d_name);
+    found= read_sysfs_ulong(path, &max_bytes) && max_bytes > 0;
+  }
+  closedir(dir);
+  return found;
+}
+
+/**
+   Check if a file is on a block device that guarantees that a page write
+   is atomic
+   @param[in] file              OS file handle
+   @param[in] page_size         page size
+   @return TRUE                 Atomic write supported
+
+   @notes
+   The device only guarantees the atomicity of a single write command.
+   A page write must therefore bypass the page cache, and it must not be
+   split by the file system or by a device boundary. We require that the
+   file be opened with O_DIRECT, that each page be contained in one file
+   system block (or that the file be a block device), and that the
+   partition start at a multiple of the page size.
+*/
+
+static my_bool blk_has_atomic_write(File file, int page_size)
+{
+  struct stat stat_buff;
+  char path[64];
+  const char *queue= "queue";
+  unsigned long max_bytes, boundary, start;
+  dev_t dev;
+  int flags= fcntl(file, F_GETFL);
+
+  if (flags == -1 || !(flags & O_DIRECT) || fstat(file, &stat_buff) < 0)
+    return FALSE;
+
+  if (S_ISBLK(stat_buff.st_mode))
+    dev= stat_buff.st_rdev;
+  else
+  {
+    struct statfs statfs_buff;
+    if (!S_ISREG(stat_buff.st_mode) || fstatfs(file, &statfs_buff) < 0 ||
+        statfs_buff.f_bsize < page_size)
+      return FALSE;
+    dev= stat_buff.st_dev;
+  }
+
+  snprintf(path, sizeof path, "/sys/dev/block/%u:%u/start",
+           major(dev), minor(dev));
+  if (read_sysfs_ulong(path, &start))
+  {
+    /* This is a partition; the queue limits are in the parent device. */
+    if ((start << 9) % page_size)
+      return FALSE;
+    queue= "../queue";
+  }
+
+  snprintf(path, sizeof path,
+           "/sys/dev/block/%u:%u/%s/atomic_write_unit_max_bytes",
+           major(dev), minor(dev), queue);
+  if (!read_sysfs_ulong(path, &max_bytes) ||
+      max_bytes < (unsigned long) page_size)
+    return FALSE;
+
+  snprintf(path, sizeof path,
+           "/sys/dev/block/%u:%u/%s/atomic_write_boundary_bytes",
+           major(dev), minor(dev), queue);
+  return read_sysfs_ulong(path, &boundary) &&
+    boundary % (unsigned long) page_size == 0;
+}
+
 /***********************************************************************
   Generic atomic write code
 ************************************************************************/
@@ -443,9 +564,11 @@ void my_init_atomic_write(void)
   has_shannon_atomic_write= test_if_shannon_card_exists();
   has_fusion_io_atomic_write= test_if_fusion_io_card_exists();
   has_sfx_atomic_write= test_if_sfx_card_exists();
+  has_blk_atomic_write= test_if_blk_atomic_write_exists();
 
   my_may_have_atomic_write= has_shannon_atomic_write ||
-    has_fusion_io_atomic_write || has_sfx_atomic_write;
+    has_fusion_io_atomic_write || has_sfx_atomic_write ||
+    has_blk_atomic_write;
 
 #ifdef TEST_SHANNON
   printf("%s(): has_shannon_atomic_write=%d, my_may_have_atomic_write=%d\n",
@@ -486,6 +609,10 @@ my_bool my_test_if_atomic_write(File handle, int page_size)
       sfx_has_atomic_write(handle, page_size))
     return 1;
 
+  if (has_blk_atomic_write &&
+      blk_has_atomic_write(handle, page_size))
+    return 1;
+
   return 0;
 }
 
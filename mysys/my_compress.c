@@ -105,6 +105,74 @@ int my_compress_buffer(uchar *dest, size_t *destLen,
     return err;
 }
 
+/*
+  Create a compression context, that can be reused by my_compress_ctx()
+  for many independent buffers. This saves the allocation and
+  initialization of the deflate state per buffer.
+
+  RETURN
+    context, or NULL on out of memory
+*/
+
+void *my_compress_ctx_init(void)
+{
+  z_stream *stream= (z_stream *) my_malloc(key_memory_my_compress_alloc,
+                                           sizeof(z_stream), MYF(MY_WME));
+  if (!stream)
+    return 0;
+  stream->zalloc= (alloc_func)my_az_allocator;
+  stream->zfree= (free_func)my_az_free;
+  stream->opaque= (voidpf)0;
+  if (deflateInit(stream, Z_DEFAULT_COMPRESSION) != Z_OK)
+  {
+    my_free(stream);
+    return 0;
+  }
+  return stream;
+}
+
+
+void my_compress_ctx_end(void *ctx)
+{
+  if (ctx)
+  {
+    deflateEnd((z_stream *) ctx);
+    my_free(ctx);
+  }
+}
+
+
+/*
+  Works like my_compress_buffer(), but uses a context created with
+  my_compress_ctx_init(). The output is a complete zlib stream, that can
+  be uncompressed by my_uncompress().
+*/
+
+int my_compress_ctx(void *ctx, uchar *dest, size_t *destLen,
+                    const uchar *source, size_t sourceLen)
+{
+  z_stream *stream= (z_stream *) ctx;
+  int err;
+
+  if ((err= deflateReset(stream)) != Z_OK)
+    return err;
+
+  stream->next_in= (Bytef*)source;
+  stream->avail_in= (uInt)sourceLen;
+  stream->next_out= (Bytef*)dest;
+  stream->avail_out= (uInt)*destLen;
+  if ((size_t)stream->avail_out != *destLen ||
+      (size_t)stream->avail_in != sourceLen)
+    return Z_BUF_ERROR;
+
+  err= deflate(stream, Z_FINISH);
+  if (err != Z_STREAM_END)
+    return err == Z_OK ? Z_BUF_ERROR : err;
+  *destLen= stream->total_out;
+  return Z_OK;
+}
+
+
 uchar *my_compress_alloc(const uchar *packet, size_t *len, size_t *complen)
 {
   uchar *compbuf;
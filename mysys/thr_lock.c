@@ -92,9 +92,37 @@ be any number of TL_WRITE_CONCURRENT_INSERT locks aktive at the same time.
 #include <errno.h>
 
 my_bool thr_lock_inited=0;
-ulong locks_immediate = 0L, locks_waited = 0L;
+ulong locks_waited = 0L;
 enum thr_lock_type thr_upgraded_concurrent_insert_lock = TL_WRITE;
 
+/*
+  Number of locks that were granted without waiting.
+
+  This is incremented for every table of every statement, so it is split
+  into cache line sized slots selected by the thread id. This way threads
+  that lock different tables do not write to the same cache line.
+*/
+#define LOCKS_IMMEDIATE_SLOTS 64
+static struct st_locks_immediate
+{
+  ulong count;
+} MY_ALIGNED(CPU_LEVEL1_DCACHE_LINESIZE) locks_immediate[LOCKS_IMMEDIATE_SLOTS];
+
+static inline void count_lock_immediate(THR_LOCK_DATA *data)
+{
+  locks_immediate[data->owner->thread_id % LOCKS_IMMEDIATE_SLOTS].count++;
+}
+
+ulong thr_lock_immediate_count(void)
+{
+  ulong sum= 0;
+  uint i;
+  for (i= 0; i < LOCKS_IMMEDIATE_SLOTS; i++)
+    sum+= locks_immediate[i].count;
+  return sum;
+}
+
+
 /* The following constants are only for debug output */
 #define MAX_THREADS 1000
 #define MAX_LOCKS   1000
@@ -706,7 +734,7 @@ thr_lock(THR_LOCK_DATA *data, THR_LOCK_INFO *owner, ulong lock_wait_timeout)
 	check_locks(lock,"read lock with old write lock", lock_type, 0);
 	if ((lock->get_status) && (*lock->get_status)(data->status_param, 0))
           result= THR_LOCK_ABORTED;
-	statistic_increment(locks_immediate,&THR_LOCK_lock);
+	count_lock_immediate(data);
 	goto end;
       }
       if (lock->write.data->type == TL_WRITE_ONLY)
@@ -730,7 +758,7 @@ thr_lock(THR_LOCK_DATA *data, THR_LOCK_INFO *owner, ulong lock_wait_timeout)
       check_locks(lock,"read lock with no write locks", lock_type, 0);
       if ((lock->get_status) && (*lock->get_status)(data->status_param, 0))
         result= THR_LOCK_ABORTED;
-      statistic_increment(locks_immediate,&THR_LOCK_lock);
+      count_lock_immediate(data);
       goto end;
     }
     /*
@@ -761,7 +789,7 @@ thr_lock(THR_LOCK_DATA *data, THR_LOCK_INFO *owner, ulong lock_wait_timeout)
           We don't have to do get_status here as we will do it when we change
           the delayed lock to a real write lock
         */
-	statistic_increment(locks_immediate,&THR_LOCK_lock);
+	count_lock_immediate(data);
 	goto end;
       }
     }
@@ -841,7 +869,7 @@ thr_lock(THR_LOCK_DATA *data, THR_LOCK_INFO *owner, ulong lock_wait_timeout)
             (*lock->get_status)(data->status_param,
                                 lock_type == TL_WRITE_CONCURRENT_INSERT))
           result= THR_LOCK_ABORTED;
-	statistic_increment(locks_immediate,&THR_LOCK_lock);
+	count_lock_immediate(data);
 	goto end;
       }
       DBUG_PRINT("lock",("write locked 2 by thread: %lu",
@@ -877,7 +905,7 @@ thr_lock(THR_LOCK_DATA *data, THR_LOCK_INFO *owner, ulong lock_wait_timeout)
               (*lock->get_status)(data->status_param, concurrent_insert))
             result= THR_LOCK_ABORTED;
 	  check_locks(lock,"only write lock", lock_type, 0);
-	  statistic_increment(locks_immediate,&THR_LOCK_lock);
+	  count_lock_immediate(data);
 	  goto end;
 	}
       }
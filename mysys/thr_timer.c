@@ -23,16 +23,39 @@
 #include "thr_timer.h"
 #include <m_string.h>
 #include <queues.h>
+#include <my_atomic.h>
 #ifdef HAVE_TIMER_CREATE
 #include <sys/syscall.h>
 #endif
 
-struct timespec next_timer_expire_time;
+/*
+  Timers are kept in several queues, each with its own mutex, so that
+  threads that arm and disarm their timers at the same time rarely block
+  each other. The queue of a timer is chosen by its address.
+  LOCK_timer is only used by the timer thread while it scans the queues
+  and waits, and by threads that add a timer that expires before the time
+  the timer thread is waiting for.
+*/
+#define TIMER_QUEUES 16
+
+static struct st_timer_queue
+{
+  mysql_mutex_t mutex;
+  QUEUE queue;
+  /* Dummy element with max time, to simplify usage */
+  thr_timer_t max_timer_data;
+} MY_ALIGNED(CPU_LEVEL1_DCACHE_LINESIZE) timer_queues[TIMER_QUEUES];
+
+/*
+  Time the timer thread is waiting for, as nanoseconds since the epoch.
+  ULONGLONG_MAX while the timer thread is scanning the queues.
+  Protected by LOCK_timer for writes.
+*/
+static volatile int64 next_timer_expire;
 
 static my_bool thr_timer_inited= 0;
 static mysql_mutex_t LOCK_timer;
 static mysql_cond_t  COND_timer;
-static QUEUE timer_queue;
 pthread_t timer_thread;
 
 #if SIZEOF_VOIDP == 4
@@ -47,6 +70,17 @@ pthread_t timer_thread;
 
 static void *timer_handler(void *arg __attribute__((unused)));
 
+static inline struct st_timer_queue *timer_queue_of(thr_timer_t *timer_data)
+{
+  return &timer_queues[((size_t) timer_data / sizeof(*timer_data)) %
+                       TIMER_QUEUES];
+}
+
+static inline ulonglong timespec_to_nsec(const struct timespec *ts)
+{
+  return (ulonglong) ts->MY_tv_sec * 1000000000ULL + ts->MY_tv_nsec;
+}
+
 /*
   Compare two timespecs
 */
@@ -68,25 +102,40 @@ static int compare_timespec(void *not_used __attribute__((unused)),
   @return 1 error; Can't create thread
 */
 
-static thr_timer_t max_timer_data;
+static void delete_timer_queues(void)
+{
+  uint i;
+  for (i= 0; i < TIMER_QUEUES; i++)
+  {
+    mysql_mutex_destroy(&timer_queues[i].mutex);
+    delete_queue(&timer_queues[i].queue);
+  }
+}
 
 my_bool init_thr_timer(uint alloc_timers)
 {
   pthread_attr_t thr_attr;
   my_bool res= 0;
+  uint i;
   DBUG_ENTER("init_thr_timer");
 
-  init_queue(&timer_queue, alloc_timers+2, offsetof(thr_timer_t,expire_time),
-             0, compare_timespec, NullS,
-             offsetof(thr_timer_t, index_in_queue)+1, 1);
+  for (i= 0; i < TIMER_QUEUES; i++)
+  {
+    struct st_timer_queue *q= &timer_queues[i];
+    init_queue(&q->queue, alloc_timers / TIMER_QUEUES + 2,
+               offsetof(thr_timer_t,expire_time), 0, compare_timespec, NullS,
+               offsetof(thr_timer_t, index_in_queue)+1, 1);
+    mysql_mutex_init(key_LOCK_timer, &q->mutex, MY_MUTEX_INIT_FAST);
+
+    /* Set dummy element with max time into the queue to simplify usage */
+    bzero(&q->max_timer_data, sizeof(q->max_timer_data));
+    set_max_time(&q->max_timer_data.expire_time);
+    queue_insert(&q->queue, (uchar*) &q->max_timer_data);
+  }
   mysql_mutex_init(key_LOCK_timer, &LOCK_timer, MY_MUTEX_INIT_FAST);
   mysql_cond_init(key_COND_timer, &COND_timer, NULL);
-
-  /* Set dummy element with max time into the queue to simplify usage */
-  bzero(&max_timer_data, sizeof(max_timer_data));
-  set_max_time(&max_timer_data.expire_time);
-  queue_insert(&timer_queue, (uchar*) &max_timer_data);
-  next_timer_expire_time= max_timer_data.expire_time;
+  next_timer_expire= timespec_to_nsec(&timer_queues[0].max_timer_data.
+                                      expire_time);
 
   /* Create a thread to handle timers */
   pthread_attr_init(&thr_attr);
@@ -100,7 +149,7 @@ my_bool init_thr_timer(uint alloc_timers)
     res= 1;
     mysql_mutex_destroy(&LOCK_timer);
     mysql_cond_destroy(&COND_timer);
-    delete_queue(&timer_queue);
+    delete_timer_queues();
   }
   pthread_attr_destroy(&thr_attr);
 
@@ -123,7 +172,7 @@ void end_thr_timer(void)
 
   mysql_mutex_destroy(&LOCK_timer);
   mysql_cond_destroy(&COND_timer);
-  delete_queue(&timer_queue);
+  delete_timer_queues();
   DBUG_VOID_RETURN;
 }
 
@@ -178,7 +227,8 @@ void thr_timer_set_period(thr_timer_t* timer_data, ulonglong micro_seconds)
 
 my_bool thr_timer_settime(thr_timer_t *timer_data, ulonglong micro_seconds)
 {
-  int reschedule;
+  struct st_timer_queue *q= timer_queue_of(timer_data);
+  ulonglong expire;
   DBUG_ENTER("thr_timer_settime");
   DBUG_PRINT("enter",("thread: %s  micro_seconds: %llu",my_thread_name(),
                       micro_seconds));
@@ -188,26 +238,37 @@ my_bool thr_timer_settime(thr_timer_t *timer_data, ulonglong micro_seconds)
   set_timespec_nsec(timer_data->expire_time, micro_seconds*1000);
   timer_data->expired= 0;
 
-  mysql_mutex_lock(&LOCK_timer);        /* Lock from threads & timers */
-  if (queue_insert_safe(&timer_queue,(uchar*) timer_data))
+  expire= timespec_to_nsec(&timer_data->expire_time);
+
+  mysql_mutex_lock(&q->mutex);          /* Lock from threads & timers */
+  if (queue_insert_safe(&q->queue,(uchar*) timer_data))
   {
     DBUG_PRINT("info", ("timer queue full"));
     fprintf(stderr,"Warning: thr_timer queue is full\n");
     timer_data->expired= 1;
-    mysql_mutex_unlock(&LOCK_timer);
+    mysql_mutex_unlock(&q->mutex);
     DBUG_RETURN(1);
-  }    
-
-  /* Reschedule timer if the current one has more time left than new one */
-  reschedule= cmp_timespec(next_timer_expire_time, timer_data->expire_time);
-  mysql_mutex_unlock(&LOCK_timer);
-  if (reschedule > 0)
+  }
+  mysql_mutex_unlock(&q->mutex);
+
+  /*
+    Reschedule timer if the current one has more time left than new one.
+    If the timer thread has scanned our queue before we inserted the timer,
+    it has not yet published the time it is waiting for, so we will see
+    ULONGLONG_MAX here and wait for LOCK_timer.
+  */
+  if (expire < (ulonglong) my_atomic_load64(&next_timer_expire))
   {
+    mysql_mutex_lock(&LOCK_timer);
+    if (expire < (ulonglong) next_timer_expire)
+    {
 #if defined(MAIN)
-  printf("reschedule\n"); fflush(stdout);
+      printf("reschedule\n"); fflush(stdout);
 #endif
-    DBUG_PRINT("info", ("reschedule"));
-    mysql_cond_signal(&COND_timer);
+      DBUG_PRINT("info", ("reschedule"));
+      mysql_cond_signal(&COND_timer);
+    }
+    mysql_mutex_unlock(&LOCK_timer);
   }
 
   DBUG_RETURN(0);
@@ -222,19 +283,20 @@ my_bool thr_timer_settime(thr_timer_t *timer_data, ulonglong micro_seconds)
 
 void thr_timer_end(thr_timer_t *timer_data)
 {
+  struct st_timer_queue *q= timer_queue_of(timer_data);
   DBUG_ENTER("thr_timer_end");
 
-  mysql_mutex_lock(&LOCK_timer);
+  mysql_mutex_lock(&q->mutex);
   if (!timer_data->expired)
   {
     DBUG_ASSERT(timer_data->index_in_queue != 0);
-    DBUG_ASSERT(queue_element(&timer_queue, timer_data->index_in_queue) ==
+    DBUG_ASSERT(queue_element(&q->queue, timer_data->index_in_queue) ==
                 (uchar*) timer_data);
-    queue_remove(&timer_queue, timer_data->index_in_queue);
+    queue_remove(&q->queue, timer_data->index_in_queue);
     /* Mark as expired for asserts to work */
     timer_data->expired= 1;
   }
-  mysql_mutex_unlock(&LOCK_timer);
+  mysql_mutex_unlock(&q->mutex);
   DBUG_VOID_RETURN;
 }
 
@@ -243,11 +305,11 @@ void thr_timer_end(thr_timer_t *timer_data)
   Come here when some timer in queue is due.
 */
 
-static sig_handler process_timers(struct timespec *now)
+static sig_handler process_timers(QUEUE *timer_queue, struct timespec *now)
 {
   thr_timer_t *timer_data;
   DBUG_ENTER("process_timers");
-  DBUG_PRINT("info",("active timers: %d", timer_queue.elements - 1));
+  DBUG_PRINT("info",("active timers: %d", timer_queue->elements - 1));
 
 #if defined(MAIN)
   printf("process_timer\n"); fflush(stdout);
@@ -260,7 +322,7 @@ static sig_handler process_timers(struct timespec *now)
     void *func_arg;
     my_bool is_periodic;
 
-    timer_data= (thr_timer_t*) queue_top(&timer_queue);
+    timer_data= (thr_timer_t*) queue_top(timer_queue);
     function=   timer_data->func;
     func_arg=   timer_data->func_arg;
     is_periodic= timer_data->period != 0;
@@ -273,7 +335,7 @@ static sig_handler process_timers(struct timespec *now)
       for periodic timers, they need to be removed from
       queue prior to destroying timer_data.
     */
-    queue_remove_top(&timer_queue);		/* Remove timer */
+    queue_remove_top(timer_queue);		/* Remove timer */
     (*function)(func_arg);                      /* Inform thread of timeout */
 
     /*
@@ -284,11 +346,11 @@ static sig_handler process_timers(struct timespec *now)
     {
       set_timespec_nsec(timer_data->expire_time, timer_data->period * 1000);
       timer_data->expired= 0;
-      queue_insert(&timer_queue, (uchar*)timer_data);
+      queue_insert(timer_queue, (uchar*)timer_data);
     }
 
     /* Check if next one has also expired */
-    timer_data= (thr_timer_t*) queue_top(&timer_queue);
+    timer_data= (thr_timer_t*) queue_top(timer_queue);
     if (cmp_timespec(timer_data->expire_time, (*now)) > 0)
       break;                                    /* All data processed */
   }
@@ -310,21 +372,32 @@ static void *timer_handler(void *arg __attribute__((unused)))
   while (likely(thr_timer_inited))
   {
     int error;
-    struct timespec *top_time;
+    uint i;
     struct timespec now, abstime;
 
+    /* Make new timers wait for LOCK_timer until we have scanned all queues */
+    my_atomic_store64(&next_timer_expire, (int64) ULONGLONG_MAX);
     set_timespec(now, 0);
+    abstime= timer_queues[0].max_timer_data.expire_time;
 
-    top_time= &(((thr_timer_t*) queue_top(&timer_queue))->expire_time);
-
-    if (cmp_timespec((*top_time), now) <= 0)
+    for (i= 0; i < TIMER_QUEUES; i++)
     {
-      process_timers(&now);
-      top_time= &(((thr_timer_t*) queue_top(&timer_queue))->expire_time);
+      struct st_timer_queue *q= &timer_queues[i];
+      struct timespec *top_time;
+
+      mysql_mutex_lock(&q->mutex);
+      top_time= &(((thr_timer_t*) queue_top(&q->queue))->expire_time);
+      if (cmp_timespec((*top_time), now) <= 0)
+      {
+        process_timers(&q->queue, &now);
+        top_time= &(((thr_timer_t*) queue_top(&q->queue))->expire_time);
+      }
+      if (cmp_timespec((*top_time), abstime) < 0)
+        abstime= *top_time;
+      mysql_mutex_unlock(&q->mutex);
     }
 
-    abstime= *top_time;
-    next_timer_expire_time= *top_time;
+    my_atomic_store64(&next_timer_expire, (int64) timespec_to_nsec(&abstime));
     if ((error= mysql_cond_timedwait(&COND_timer, &LOCK_timer, &abstime)) &&
         error != ETIME && error != ETIMEDOUT)
     {
@@ -566,7 +639,10 @@ static void run_test()
     mysql_cond_wait(&COND_thread_count, &LOCK_thread_count);
   }
   mysql_mutex_unlock(&LOCK_thread_count);
-  DBUG_ASSERT(timer_queue.elements == 1);
+#ifndef DBUG_OFF
+  for (i= 0; i < TIMER_QUEUES; i++)
+    DBUG_ASSERT(timer_queues[i].queue.elements == 1);
+#endif
   end_thr_timer();
   printf("Test succeeded\n");
   DBUG_VOID_RETURN;
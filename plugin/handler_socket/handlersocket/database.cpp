@@ -710,6 +710,42 @@ prepare_keybuf(const cmd_exec_args& args, uchar *key_buf, TABLE *table,
   return kplen_sum;
 }
 
+struct in_range_seq {
+  const uchar *keys;
+  size_t key_len;
+  key_part_map kpm;
+  uint range_flag;
+  size_t num_keys;
+  size_t cur;
+};
+
+static range_seq_t
+in_range_seq_init(void *init_param, uint n_ranges, uint flags)
+{
+  in_range_seq *const seq = static_cast<in_range_seq *>(init_param);
+  seq->cur = 0;
+  return seq;
+}
+
+static bool
+in_range_seq_next(range_seq_t rseq, KEY_MULTI_RANGE *range)
+{
+  in_range_seq *const seq = static_cast<in_range_seq *>(rseq);
+  if (seq->cur >= seq->num_keys) {
+    return true; /* no more ranges */
+  }
+  range->start_key.key = seq->keys + seq->cur * seq->key_len;
+  range->start_key.length = seq->key_len;
+  range->start_key.keypart_map = seq->kpm;
+  range->start_key.flag = HA_READ_KEY_EXACT;
+  range->end_key = range->start_key;
+  range->end_key.flag = HA_READ_AFTER_KEY;
+  range->range_flag = seq->range_flag;
+  range->ptr = 0;
+  ++seq->cur;
+  return false;
+}
+
 void
 dbcontext::cmd_find_internal(dbcallback_i& cb, const prep_stmt& pst,
   ha_rkey_function find_flag, const cmd_exec_args& args)
@@ -775,6 +811,38 @@ dbcontext::cmd_find_internal(dbcallback_i& cb, const prep_stmt& pst,
   }
   hnd->ha_index_or_rnd_end();
   hnd->ha_index_init(pst.get_idxnum(), 1);
+  /* read the IN values with a single multi range read */
+  const bool use_mrr = args.invalues_keypart >= 0 && mod_op == 0 &&
+    find_flag == HA_READ_KEY_EXACT;
+  std::vector<uchar> mrr_keys;
+  std::vector<uchar> mrr_buf;
+  in_range_seq mrr_seq;
+  RANGE_SEQ_IF mrr_funcs = { 0, in_range_seq_init, in_range_seq_next, 0, 0 };
+  uint mrr_mode = HA_MRR_SINGLE_POINT | HA_MRR_NO_ASSOCIATION;
+  HANDLER_BUFFER mrr_hbuf;
+  if (use_mrr) {
+    mrr_keys.resize(args.invalueslen * kplen_sum);
+    for (size_t i = 0; i < args.invalueslen; ++i) {
+      prepare_keybuf(args, &mrr_keys[i * kplen_sum], table, kinfo, i);
+    }
+    mrr_seq.keys = &mrr_keys[0];
+    mrr_seq.key_len = kplen_sum;
+    mrr_seq.kpm = (1U << args.kvalslen) - 1;
+    mrr_seq.range_flag = EQ_RANGE;
+    if ((kinfo.flags & HA_NOSAME) && !(kinfo.flags & HA_NULL_PART_KEY) &&
+      args.kvalslen == kinfo.user_defined_key_parts) {
+      mrr_seq.range_flag |= UNIQUE_RANGE;
+    }
+    mrr_seq.num_keys = args.invalueslen;
+    uint mrr_bufsz = static_cast<uint>(thd->variables.mrr_buff_size);
+    Cost_estimate mrr_cost;
+    hnd->multi_range_read_info(pst.get_idxnum(), args.invalueslen,
+      args.invalueslen, args.kvalslen, &mrr_bufsz, &mrr_mode, &mrr_cost);
+    mrr_buf.resize(mrr_bufsz);
+    mrr_hbuf.buffer = mrr_hbuf.end_of_used_area =
+      mrr_bufsz ? &mrr_buf[0] : 0;
+    mrr_hbuf.buffer_end = mrr_hbuf.buffer + mrr_bufsz;
+  }
   if (need_resp_record) {
     cb.dbcb_resp_begin(pst.get_ret_fields().size());
   }
@@ -784,7 +852,17 @@ dbcontext::cmd_find_internal(dbcallback_i& cb, const prep_stmt& pst,
   int r = 0;
   bool is_first = true;
   for (uint32_t cnt = 0; cnt < limit + skip;) {
-    if (is_first) {
+    if (use_mrr) {
+      if (is_first) {
+	is_first = false;
+	r = hnd->multi_range_read_init(&mrr_funcs, &mrr_seq,
+	  args.invalueslen, mrr_mode, &mrr_hbuf);
+      }
+      range_id_t range_info;
+      if (r == 0) {
+	r = hnd->multi_range_read_next(&range_info);
+      }
+    } else if (is_first) {
       is_first = false;
       const key_part_map kpm = (1U << args.kvalslen) - 1;
       r = hnd->ha_index_read_map(table->record[0], key_buf, kpm, find_flag);
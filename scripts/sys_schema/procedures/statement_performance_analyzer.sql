@@ -427,6 +427,9 @@ BEGIN
   `SUM_NO_GOOD_INDEX_USED` bigint(20) unsigned NOT NULL,
   `FIRST_SEEN` timestamp NULL DEFAULT NULL,
   `LAST_SEEN` timestamp NULL DEFAULT NULL,
+  `QUANTILE_95` bigint(20) unsigned NOT NULL,
+  `QUANTILE_99` bigint(20) unsigned NOT NULL,
+  `QUANTILE_999` bigint(20) unsigned NOT NULL,
   INDEX (SCHEMA_NAME, DIGEST)
 ) DEFAULT CHARSET=utf8';
 
@@ -505,7 +508,10 @@ SELECT `d_end`.`SCHEMA_NAME`,
        `d_end`.`SUM_NO_INDEX_USED`-IFNULL(`d_start`.`SUM_NO_INDEX_USED`, 0) AS ''SUM_NO_INDEX_USED'',
        `d_end`.`SUM_NO_GOOD_INDEX_USED`-IFNULL(`d_start`.`SUM_NO_GOOD_INDEX_USED`, 0) AS ''SUM_NO_GOOD_INDEX_USED'',
        `d_end`.`FIRST_SEEN`,
-       `d_end`.`LAST_SEEN`
+       `d_end`.`LAST_SEEN`,
+       `d_end`.`QUANTILE_95`,
+       `d_end`.`QUANTILE_99`,
+       `d_end`.`QUANTILE_999`
   FROM tmp_digests d_end
        LEFT OUTER JOIN ', v_quoted_table, ' d_start ON `d_start`.`DIGEST` = `d_end`.`DIGEST`
                                                     AND (`d_start`.`SCHEMA_NAME` = `d_end`.`SCHEMA_NAME`
@@ -106,6 +106,22 @@ class Bounded_queue
    */
   void push(Element_type *element);
 
+  /**
+    Check if push() would discard an element right away, because the queue
+    is full and the key of the element is not better than the top one.
+
+    @param key            Key made by keymaker_function for the element.
+   */
+  bool rejects(Key_type *key)
+  {
+    DBUG_ASSERT(is_initialized());
+    if (!queue_is_full((&m_queue)))
+      return false;
+    return m_queue.compare(m_queue.first_cmp_arg,
+                           reinterpret_cast<uchar*>(&key),
+                           queue_top(&m_queue)) * m_queue.max_at_top <= 0;
+  }
+
   /**
     Removes the top element from the queue.
 
@@ -24,6 +24,7 @@
 #include "event_db_repository.h"
 #include "sql_connect.h"         // init_new_connection_handler_thread
 #include "sql_class.h"
+#include <algorithm>
 
 /**
   @addtogroup Event_Scheduler
@@ -43,6 +44,12 @@
 #define COND_STATE_WAIT(mythd, abstime, stage) \
         cond_wait(mythd, abstime, stage, SCHED_FUNC, __FILE__, __LINE__)
 
+/*
+  How long an idle event worker thread waits for the next event before
+  it exits, in seconds.
+*/
+#define EVENT_WORKER_IDLE_TIMEOUT 60
+
 extern pthread_attr_t connection_attrib;
 extern ulong event_executed;
 
@@ -244,12 +251,14 @@ event_scheduler_thread(void *arg)
 
 
 /**
-  Function that executes an event in a child thread. Setups the
-  environment for the event execution and cleans after that.
+  Function that executes events in a child thread. After an event has
+  been executed, the thread waits for the scheduler to hand over the
+  next one, so that frequently firing events do not create a thread
+  for every execution.
 
   SYNOPSIS
     event_worker_thread()
-      arg  The Event_job_data object to be processed
+      arg  The Event_scheduler that created the thread
 
   RETURN VALUE
     0  OK
@@ -258,16 +267,18 @@ event_scheduler_thread(void *arg)
 pthread_handler_t
 event_worker_thread(void *arg)
 {
-  THD *thd;
-  Event_queue_element_for_exec *event= (Event_queue_element_for_exec *)arg;
+  Event_scheduler *scheduler= (Event_scheduler *) arg;
+  Event_queue_element_for_exec *event;
 
-  thd= event->thd;
-
-  mysql_thread_set_psi_id(thd->thread_id);
   my_thread_set_name("event_worker");
 
-  Event_worker_thread worker_thread;
-  worker_thread.run(thd, event);
+  while ((event= scheduler->get_worker_event()))
+  {
+    mysql_thread_set_psi_id(event->thd->thread_id);
+
+    Event_worker_thread worker_thread;
+    worker_thread.run(event->thd, event);
+  }
 
   my_thread_end();
   return 0;                                     // Can't return anything here
@@ -357,11 +368,14 @@ Event_scheduler::Event_scheduler(Event_queue *queue_arg)
   mutex_last_unlocked_in_func("n/a"),
   mutex_scheduler_data_locked(FALSE),
   waiting_on_cond(FALSE),
-  started_events(0)
+  started_events(0),
+  idle_workers(0),
+  live_workers(0)
 {
   mysql_mutex_init(key_event_scheduler_LOCK_scheduler_state,
                    &LOCK_scheduler_state, MY_MUTEX_INIT_FAST);
   mysql_cond_init(key_event_scheduler_COND_state, &COND_state, NULL);
+  mysql_cond_init(key_event_scheduler_COND_worker, &COND_worker, NULL);
   mysql_mutex_record_order(&LOCK_scheduler_state, &LOCK_global_system_variables);
 }
 
@@ -369,8 +383,20 @@ Event_scheduler::Event_scheduler(Event_queue *queue_arg)
 Event_scheduler::~Event_scheduler()
 {
   stop();                                    /* does nothing if not running */
+
+  /*
+    The worker threads access the scheduler until they exit. The idle ones
+    were woken up by the scheduler thread when it stopped, and the busy
+    ones have been killed on shutdown.
+  */
+  LOCK_DATA();
+  while (live_workers)
+    mysql_cond_wait(&COND_worker, &LOCK_scheduler_state);
+  UNLOCK_DATA();
+
   mysql_mutex_destroy(&LOCK_scheduler_state);
   mysql_cond_destroy(&COND_state);
+  mysql_cond_destroy(&COND_worker);
 }
 
 
@@ -522,6 +548,8 @@ Event_scheduler::run(THD *thd)
   state= INITIALIZED;
   DBUG_PRINT("info", ("Broadcasting COND_state back to the stoppers"));
   mysql_cond_broadcast(&COND_state);
+  /* Let the idle worker threads exit */
+  mysql_cond_broadcast(&COND_worker);
   UNLOCK_DATA();
 
   DBUG_RETURN(res);
@@ -558,27 +586,56 @@ Event_scheduler::execute_top(Event_queue_element_for_exec *event_name)
              event_name->dbname.str, event_name->name.str));
 
   /*
-    TODO: should use thread pool here, preferably with an upper limit
-    on number of threads: if too many events are scheduled for the
-    same time, starting all of them at once won't help them run truly
-    in parallel (because of the great amount of synchronization), so
-    we may as well execute them in sequence, keeping concurrency at a
-    reasonable level.
+    Hand the event over to an idle worker thread. Only if there is none,
+    create a new thread, which will pick up the event from worker_queue.
+
+    TODO: there should be an upper limit on the number of threads: if too
+    many events are scheduled for the same time, starting all of them at
+    once won't help them run truly in parallel (because of the great
+    amount of synchronization), so we may as well execute them in
+    sequence, keeping concurrency at a reasonable level.
   */
-  /* Major failure */
-  if ((res= mysql_thread_create(key_thread_event_worker,
-                                &th, &connection_attrib, event_worker_thread,
-                                event_name)))
+  LOCK_DATA();
+  worker_queue.push_back(event_name);
+  if (idle_workers >= worker_queue.size())
   {
-    mysql_mutex_lock(&LOCK_global_system_variables);
-    Events::opt_event_scheduler= Events::EVENTS_OFF;
-    mysql_mutex_unlock(&LOCK_global_system_variables);
-
-    sql_print_error("Event_scheduler::execute_top: Can not create event worker"
-                    " thread (errno=%d). Stopping event scheduler", res);
+    mysql_cond_signal(&COND_worker);
+    UNLOCK_DATA();
+  }
+  else
+  {
+    live_workers++;
+    UNLOCK_DATA();
 
-    deinit_event_thread(new_thd);
-    goto error;
+    /* Major failure */
+    if ((res= mysql_thread_create(key_thread_event_worker,
+                                  &th, &connection_attrib, event_worker_thread,
+                                  this)))
+    {
+      mysql_mutex_lock(&LOCK_global_system_variables);
+      Events::opt_event_scheduler= Events::EVENTS_OFF;
+      mysql_mutex_unlock(&LOCK_global_system_variables);
+
+      sql_print_error("Event_scheduler::execute_top: Can not create event "
+                      "worker thread (errno=%d). Stopping event scheduler",
+                      res);
+
+      LOCK_DATA();
+      live_workers--;
+      auto it= std::find(worker_queue.begin(), worker_queue.end(),
+                         event_name);
+      const bool pending= it != worker_queue.end();
+      if (pending)
+        worker_queue.erase(it);
+      if (!live_workers)
+        mysql_cond_broadcast(&COND_worker);
+      UNLOCK_DATA();
+
+      if (!pending)
+        DBUG_RETURN(TRUE);            /* an existing worker took the event */
+      deinit_event_thread(new_thd);
+      goto error;
+    }
   }
 
   started_events++;
@@ -594,6 +651,52 @@ Event_scheduler::execute_top(Event_queue_element_for_exec *event_name)
 }
 
 
+/**
+  Waits for an event to be handed over by execute_top(). Invoked by the
+  worker threads between the events.
+
+  SYNOPSIS
+    Event_scheduler::get_worker_event()
+
+  RETURN VALUE
+    The event to execute
+    NULL  if the thread should exit, because the scheduler is no longer
+          running or no event arrived in EVENT_WORKER_IDLE_TIMEOUT seconds
+*/
+
+Event_queue_element_for_exec *
+Event_scheduler::get_worker_event()
+{
+  Event_queue_element_for_exec *event= NULL;
+  bool timed_out= false;
+
+  LOCK_DATA();
+  for (;;)
+  {
+    if (!worker_queue.empty())
+    {
+      event= worker_queue.front();
+      worker_queue.pop_front();
+      break;
+    }
+    if (state != RUNNING || timed_out)
+    {
+      if (!--live_workers)
+        mysql_cond_broadcast(&COND_worker);
+      break;
+    }
+    struct timespec abstime;
+    set_timespec(abstime, EVENT_WORKER_IDLE_TIMEOUT);
+    idle_workers++;
+    timed_out= mysql_cond_timedwait(&COND_worker, &LOCK_scheduler_state,
+                                    &abstime) != 0;
+    idle_workers--;
+  }
+  UNLOCK_DATA();
+  return event;
+}
+
+
 /*
   Checks whether the state of the scheduler is RUNNING
 
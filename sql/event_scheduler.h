@@ -30,6 +30,7 @@
   module are in events.h and event_data_objects.h.
 */
 
+#include <deque>
 
 class Event_queue;
 class Event_job_data;
@@ -90,6 +91,9 @@ class Event_scheduler
   bool
   run(THD *thd);
 
+  Event_queue_element_for_exec *
+  get_worker_event();
+
 
   /* Information retrieving methods follow */
   bool
@@ -144,6 +148,18 @@ class Event_scheduler
 
   ulonglong started_events;
 
+  /* Signalled when an event is handed over to an idle worker thread */
+  mysql_cond_t COND_worker;
+
+  /* Events that are waiting to be picked up by a worker thread */
+  std::deque<Event_queue_element_for_exec*> worker_queue;
+
+  /* Number of worker threads that are waiting for an event */
+  uint idle_workers;
+
+  /* Number of worker threads that exist, busy or idle */
+  uint live_workers;
+
 private:
   /* Prevent use of these */
   Event_scheduler(const Event_scheduler &);
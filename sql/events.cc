@@ -1018,11 +1018,13 @@ static PSI_mutex_info all_events_mutexes[]=
   { &key_event_scheduler_LOCK_scheduler_state, "Event_scheduler::LOCK_scheduler_state", PSI_FLAG_GLOBAL}
 };
 
-PSI_cond_key key_event_scheduler_COND_state, key_COND_queue_state;
+PSI_cond_key key_event_scheduler_COND_state, key_event_scheduler_COND_worker,
+             key_COND_queue_state;
 
 static PSI_cond_info all_events_conds[]=
 {
   { &key_event_scheduler_COND_state, "Event_scheduler::COND_state", PSI_FLAG_GLOBAL},
+  { &key_event_scheduler_COND_worker, "Event_scheduler::COND_worker", PSI_FLAG_GLOBAL},
   { &key_COND_queue_state, "COND_queue_state", PSI_FLAG_GLOBAL},
 };
 
@@ -27,7 +27,8 @@
 
 #ifdef HAVE_PSI_INTERFACE
 extern PSI_mutex_key key_event_scheduler_LOCK_scheduler_state;
-extern PSI_cond_key key_event_scheduler_COND_state;
+extern PSI_cond_key key_event_scheduler_COND_state,
+                    key_event_scheduler_COND_worker;
 extern PSI_thread_key key_thread_event_scheduler, key_thread_event_worker;
 #endif /* HAVE_PSI_INTERFACE */
 
@@ -54,6 +54,7 @@ static uint make_sortkey(Sort_param *param, uchar *to);
 static uint make_packed_sortkey(Sort_param *param, uchar *to);
 
 static void register_used_fields(Sort_param *param);
+static bool sort_keys_are_fields(Sort_param *param);
 static bool save_index(Sort_param *param, uint count,
                        SORT_INFO *table_sort);
 static uint suffix_length(ulong string_length);
@@ -351,6 +352,20 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
       DBUG_ASSERT(thd->is_error());
       goto err;
     }
+
+    /*
+      Rows whose sort key can't enter the full queue do not need the WHERE
+      condition evaluated. That is only done when the sort key consists of
+      plain fields, so that making it has no side effects, and nobody needs
+      the exact number of matching rows (FOUND_ROWS(), ROWNUM(), ANALYZE).
+    */
+    if (select && select->cond && !thd->lex->with_rownum &&
+        !thd->lex->analyze_stmt &&
+        !(join && (join->select_options & OPTION_FOUND_ROWS)) &&
+        sort_keys_are_fields(&param))
+      param.pq_precheck_key= (uchar*) my_malloc(PSI_INSTRUMENT_ME,
+                                                param.rec_length,
+                                                MYF(MY_THREAD_SPECIFIC));
   }
   else
   {
@@ -367,6 +382,9 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
     size_t min_sort_memory= MY_MAX(MIN_SORT_MEMORY,
                                    param.sort_length*MERGEBUFF2);
     set_if_bigger(min_sort_memory, sizeof(Merge_chunk*) * MERGEBUFF2);
+    set_if_smaller(memory_available,
+                   MY_MAX((size_t) thd->limit_spill_buffer_size(memory_available),
+                          min_sort_memory));
     while (memory_available >= min_sort_memory)
     {
       ulonglong keys= memory_available / (param.rec_length + sizeof(char*));
@@ -493,6 +511,7 @@ SORT_INFO *filesort(THD *thd, TABLE *table, Filesort *filesort,
 
   err:
   param.tmp_buffer.free();
+  my_free(param.pq_precheck_key);
   if (!subselect || !subselect->is_uncacheable())
   {
     if (!param.using_addon_fields())
@@ -836,6 +855,23 @@ static void dbug_print_record(TABLE *table, bool print_rowid)
 #endif 
 
 
+/**
+  Check if all sort keys are columns of the sorted table
+
+  @retval TRUE  Making the sort key has no side effects
+*/
+
+static bool sort_keys_are_fields(Sort_param *param)
+{
+  for (SORT_FIELD &sort_field: *param->sort_keys)
+  {
+    if (!sort_field.field)
+      return FALSE;
+  }
+  return TRUE;
+}
+
+
 /**
   Search after sort_keys, and write them into tempfile
   (if we run out of space in the sort_keys buffer).
@@ -983,7 +1019,11 @@ static ha_rows find_all_keys(THD *thd, Sort_param *param, SQL_SELECT *select,
     {
       param->examined_rows++;
       thd->inc_examined_row_count_fast();
-      if (select && select->cond)
+      if (param->pq_precheck_key &&
+          (make_sortkey(param, param->pq_precheck_key, ref_pos),
+           pq->rejects(param->pq_precheck_key)))
+        write_record= false;                    // Can't get into the result
+      else if (select && select->cond)
       {
         /*
           If the condition 'select->cond' contains a subquery, restore the
@@ -1132,6 +1172,7 @@ write_keys(Sort_param *param,  SORT_INFO *fs_info, uint count,
   if ((ha_rows) count > param->limit_rows)
     count=(uint) param->limit_rows;               /* purecov: inspected */
   buffpek.set_rowcount(static_cast<ha_rows>(count));
+  MYSQL_FILESORT_SPILL(count);
 
   for (uint ix= 0; ix < count; ++ix)
   {
@@ -1550,7 +1591,33 @@ static bool save_index(Sort_param *param, uint count,
 }
 
 
-/** Merge buffers to make < MERGEBUFF2 buffers. */
+/*
+  Smallest part of the sort buffer that merge_many_buff() gives to each
+  merged chunk, so that the chunks are read in reasonably large pieces
+*/
+#define MERGE_MIN_CHUNK_SIZE (2 * DISK_CHUNK_SIZE)
+/* Largest number of chunks merged by one merge_buffers() call */
+#define MERGEBUFF_MAX 128
+
+/**
+  Number of chunks to merge at a time in merge_many_buff()
+
+  The fan-in grows with the sort buffer, so that big sort buffers need
+  fewer passes over the temporary file. Up to 2*fan_in+1 chunks are left
+  for the final merge, and each of them still gets MERGE_MIN_CHUNK_SIZE
+  bytes, and at least one record. With the default sort_buffer_size this
+  is MERGEBUFF.
+*/
+
+static uint merge_fan_in(size_t sort_buffer_size, uint rec_length)
+{
+  size_t chunks= sort_buffer_size / MY_MAX(MERGE_MIN_CHUNK_SIZE, rec_length);
+  uint fan_in= (uint) MY_MIN((chunks ? chunks - 1 : 0) / 2, MERGEBUFF_MAX);
+  return MY_MAX(fan_in, MERGEBUFF);
+}
+
+
+/** Merge buffers to make < 2*merge_fan_in()+1 buffers. */
 
 int merge_many_buff(Sort_param *param, Sort_buffer sort_buffer,
                     Merge_chunk *buffpek, uint *maxbuffer, IO_CACHE *t_file)
@@ -1558,9 +1625,12 @@ int merge_many_buff(Sort_param *param, Sort_buffer sort_buffer,
   uint i;
   IO_CACHE t_file2,*from_file,*to_file,*temp;
   Merge_chunk *lastbuff;
+  const uint fan_in= merge_fan_in(sort_buffer.size(),
+                                 param->rec_length);
+  const uint fan_in2= fan_in * 2 + 1;
   DBUG_ENTER("merge_many_buff");
 
-  if (*maxbuffer < MERGEBUFF2)
+  if (*maxbuffer < fan_in2)
     DBUG_RETURN(0);                             /* purecov: inspected */
   if (flush_io_cache(t_file) ||
       open_cached_file(&t_file2, mysql_tmpdir, TEMP_PREFIX, DISK_CHUNK_SIZE,
@@ -1568,17 +1638,17 @@ int merge_many_buff(Sort_param *param, Sort_buffer sort_buffer,
     DBUG_RETURN(1);				/* purecov: inspected */
 
   from_file= t_file; to_file= &t_file2;
-  while (*maxbuffer >= MERGEBUFF2)
+  while (*maxbuffer >= fan_in2)
   {
     if (reinit_io_cache(from_file, READ_CACHE, 0L, 0, 0))
       goto cleanup;
     if (reinit_io_cache(to_file, WRITE_CACHE,0L, 0, 0))
       goto cleanup;
     lastbuff=buffpek;
-    for (i= 0; i <= *maxbuffer - MERGEBUFF * 3 / 2 ; i+= MERGEBUFF)
+    for (i= 0; i <= *maxbuffer - fan_in * 3 / 2 ; i+= fan_in)
     {
       if (merge_buffers(param, from_file, to_file, sort_buffer, lastbuff++,
-                        buffpek + i, buffpek + i + MERGEBUFF - 1, 0))
+                        buffpek + i, buffpek + i + fan_in - 1, 0))
       goto cleanup;
     }
     if (merge_buffers(param, from_file, to_file, sort_buffer, lastbuff++,
@@ -1596,7 +1666,7 @@ int merge_many_buff(Sort_param *param, Sort_buffer sort_buffer,
     *t_file=t_file2;				// Copy result file
   }
 
-  DBUG_RETURN(*maxbuffer >= MERGEBUFF2);	/* Return 1 if interrupted */
+  DBUG_RETURN(*maxbuffer >= fan_in2);		/* Return 1 if interrupted */
 } /* merge_many_buff */
 
 
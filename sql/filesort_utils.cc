@@ -383,6 +383,101 @@ void Filesort_buffer::free_sort_buffer()
 }
 
 
+/*
+  Buckets smaller than this are sorted by insertion sort in radixsort_msd()
+*/
+static constexpr size_t RADIXSORT_MSD_SMALL= 32;
+/*
+  Minimum number of keys for which radixsort_msd() is used instead of
+  my_qsort2(). Below this the allocation of the scratch buffer and the
+  counting passes are not paid back.
+*/
+static constexpr uint RADIXSORT_MSD_MIN_KEYS= 1000;
+/*
+  Maximum recursion depth of radixsort_msd(). Longer common prefixes are
+  sorted with my_qsort2(), which keeps the stack usage bounded for long
+  sort keys.
+*/
+static constexpr size_t RADIXSORT_MSD_MAX_DEPTH= 16;
+
+
+/**
+  Sort fixed length keys with a most-significant-digit radix sort
+
+  Unlike radixsort_for_str_ptr(), which does one pass over all keys for
+  every byte of the key, this stops at the first byte that distinguishes
+  the keys of a bucket. Its cost therefore does not depend on the key
+  length, but on the length of the common prefixes.
+
+  @param keys    Keys to sort
+  @param buffer  Scratch space for n pointers
+  @param n       Number of keys
+  @param offset  Number of leading bytes that are equal for all keys
+  @param length  Length of the keys
+  @param depth   Recursion depth
+*/
+
+static void radixsort_msd(uchar **keys, uchar **buffer, size_t n,
+                          size_t offset, size_t length, size_t depth)
+{
+  uint32 pos[256];
+
+  while (offset < length)
+  {
+    if (n < RADIXSORT_MSD_SMALL)
+    {
+      for (size_t i= 1; i < n; i++)
+      {
+        uchar *key= keys[i];
+        size_t j= i;
+        for (; j && memcmp(keys[j - 1] + offset, key + offset,
+                           length - offset) > 0; j--)
+          keys[j]= keys[j - 1];
+        keys[j]= key;
+      }
+      return;
+    }
+
+    if (depth == RADIXSORT_MSD_MAX_DEPTH)
+    {
+      size_t size= length;
+      my_qsort2(keys, n, sizeof(uchar*), get_ptr_compare(size), &size);
+      return;
+    }
+
+    bzero(pos, sizeof pos);
+    for (size_t i= 0; i < n; i++)
+      pos[keys[i][offset]]++;
+
+    if (pos[keys[0][offset]] == n)
+    {
+      /* All keys have the same byte here; no need to distribute them */
+      offset++;
+      continue;
+    }
+
+    /* Turn the counts into bucket starts; the scatter moves them to ends */
+    for (uint32 i= 0, start= 0; i < 256; i++)
+    {
+      uint32 cnt= pos[i];
+      pos[i]= start;
+      start+= cnt;
+    }
+    for (size_t i= 0; i < n; i++)
+      buffer[pos[keys[i][offset]]++]= keys[i];
+    memcpy(keys, buffer, n * sizeof *keys);
+
+    if (++offset == length)
+      return;
+    for (uint32 i= 0, start= 0; i < 256; start= pos[i++])
+      if (pos[i] - start > 1)
+        radixsort_msd(keys + start, buffer, pos[i] - start, offset, length,
+                      depth + 1);
+    return;
+  }
+}
+
+
 void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
 {
   size_t size= param->sort_length;
@@ -396,12 +491,16 @@ void Filesort_buffer::sort_buffer(const Sort_param *param, uint count)
     reverse_record_pointers();
 
   uchar **buffer= NULL;
+  /*
+    Fixed length keys from make_sortkey() compare with memcmp(), so they
+    can be sorted byte by byte
+  */
   if (!param->using_packed_sortkeys() &&
-      radixsort_is_applicable(count, param->sort_length) &&
+      count >= RADIXSORT_MSD_MIN_KEYS &&
       (buffer= (uchar**) my_malloc(PSI_INSTRUMENT_ME, count*sizeof(char*),
                                    MYF(MY_THREAD_SPECIFIC))))
   {
-    radixsort_for_str_ptr(m_sort_keys, count, param->sort_length, buffer);
+    radixsort_msd(m_sort_keys, buffer, count, 0, size, 0);
     my_free(buffer);
     return;
   }
@@ -41,6 +41,9 @@ class ha_handler_stats
 
   ulonglong undo_records_read;
 
+  /* Time spent waiting for row locks, in timer_tracker_frequency() units */
+  ulonglong lock_wait_time;
+
   /* Time spent in engine, in timer_tracker_frequency() units */
   ulonglong engine_time;
 
@@ -330,6 +330,7 @@ void ha_partition::ha_partition_init()
 {
   DBUG_ENTER("ha_partition::ha_partition_init");
   init_alloc_root(PSI_INSTRUMENT_ME, &m_mem_root, 512, 512, MYF(0));
+  init_alloc_root(PSI_INSTRUMENT_ME, &m_bulk_root, 8192, 0, MYF(0));
   init_handler_variables();
   DBUG_VOID_RETURN;
 }
@@ -403,6 +404,7 @@ void ha_partition::init_handler_variables()
   m_mode= 0;
   m_open_test_lock= 0;
   m_file_buffer= NULL;
+  m_file_buffer_length= 0;
   m_name_buffer_ptr= NULL;
   m_engine_array= NULL;
   m_connect_string= NULL;
@@ -441,6 +443,8 @@ void ha_partition::init_handler_variables()
   m_key_not_found= FALSE;
   auto_increment_lock= FALSE;
   auto_increment_safe_stmt_log_lock= FALSE;
+  m_bulk_rows= NULL;
+  m_bulk_rows_size= 0;
   /*
     this allows blackhole to work properly
   */
@@ -521,6 +525,7 @@ ha_partition::~ha_partition()
   }
   clear_handler_file();
   free_root(&m_mem_root, MYF(0));
+  free_bulk_rows();
 
   DBUG_VOID_RETURN;
 }
@@ -718,6 +723,7 @@ int ha_partition::create_partitioning_metadata(const char *path,
   DBUG_ENTER("ha_partition::create_partitioning_metadata");
 
   mark_trx_read_write();
+  forget_par_file_in_share();
   /*
     We need to update total number of parts since we might write the handler
     file as part of a partition management command
@@ -3014,6 +3020,7 @@ void ha_partition::clear_handler_file()
     plugin_unlock_list(NULL, m_engine_array, m_tot_parts);
   free_root(&m_mem_root, MYF(MY_KEEP_PREALLOC));
   m_file_buffer= NULL;
+  m_file_buffer_length= 0;
   m_engine_array= NULL;
   m_connect_string= NULL;
 }
@@ -3152,40 +3159,57 @@ bool ha_partition::new_handlers_from_part_info(MEM_ROOT *mem_root)
 int ha_partition::read_par_file(const char *name)
 {
   char buff[FN_REFLEN];
-  uchar *tot_name_len_offset;
+  uchar *tot_name_len_offset, *pos, *end;
   File file;
+  MY_STAT stat_info;
   uchar *file_buffer;
-  uint i, len_bytes, len_words, tot_partition_words, tot_name_words, chksum;
+  size_t file_length, len_bytes;
+  uint i, len_words, tot_partition_words, tot_name_words, chksum;
   DBUG_ENTER("ha_partition::read_par_file");
   DBUG_PRINT("enter", ("table name: '%s'", name));
 
   if (m_file_buffer)
     DBUG_RETURN(0);
-  fn_format(buff, name, "", ha_par_ext, MY_APPEND_EXT);
 
-  /* Following could be done with mysql_file_stat to read in whole file */
-  if ((file= mysql_file_open(key_file_ha_partition_par,
-                             buff, O_RDONLY | O_SHARE, MYF(0))) < 0)
-    DBUG_RETURN(1);
-  if (mysql_file_read(file, (uchar *) &buff[0], PAR_WORD_SIZE, MYF(MY_NABP)))
-    goto err1;
-  len_words= uint4korr(buff);
-  len_bytes= PAR_WORD_SIZE * len_words;
-  if (mysql_file_seek(file, 0, MY_SEEK_SET, MYF(0)) == MY_FILEPOS_ERROR)
-    goto err1;
-  if (!(file_buffer= (uchar*) alloc_root(&m_mem_root, len_bytes)))
-    goto err1;
-  if (mysql_file_read(file, file_buffer, len_bytes, MYF(MY_NABP)))
-    goto err2;
+  /*
+    All instances of a TABLE_SHARE read the same file. Only the first one
+    needs to read it from disk; with thousands of partitions the file is
+    large and it is read on every open of the table.
+  */
+  if (!(file_buffer= copy_par_file_from_share(name, &file_length)))
+  {
+    fn_format(buff, name, "", ha_par_ext, MY_APPEND_EXT);
+    if ((file= mysql_file_open(key_file_ha_partition_par,
+                               buff, O_RDONLY | O_SHARE, MYF(0))) < 0)
+      DBUG_RETURN(1);
+    if (!mysql_file_fstat(file, &stat_info, MYF(0)) &&
+        (file_length= (size_t) stat_info.st_size) >= PAR_ENGINES_OFFSET &&
+        (file_buffer= (uchar*) alloc_root(&m_mem_root, file_length)) &&
+        mysql_file_read(file, file_buffer, file_length, MYF(MY_NABP)))
+      file_buffer= NULL;
+    (void) mysql_file_close(file, MYF(0));
+    if (!file_buffer)
+      DBUG_RETURN(2);
+  }
+  else if (file_length < PAR_ENGINES_OFFSET)
+    DBUG_RETURN(2);
+
+  len_words= uint4korr(file_buffer);
+  len_bytes= PAR_WORD_SIZE * (size_t) len_words;
+  if (len_bytes > file_length || len_bytes < PAR_ENGINES_OFFSET)
+    DBUG_RETURN(2);
 
   chksum= 0;
   for (i= 0; i < len_words; i++)
     chksum ^= uint4korr((file_buffer) + PAR_WORD_SIZE * i);
   if (chksum)
-    goto err2;
+    DBUG_RETURN(2);
   m_tot_parts= uint4korr((file_buffer) + PAR_NUM_PARTS_OFFSET);
   DBUG_PRINT("info", ("No of parts: %u", m_tot_parts));
   tot_partition_words= (m_tot_parts + PAR_WORD_SIZE - 1) / PAR_WORD_SIZE;
+  if (PAR_ENGINES_OFFSET + PAR_WORD_SIZE * ((size_t) tot_partition_words + 1) >
+      len_bytes)
+    DBUG_RETURN(2);
 
   tot_name_len_offset= file_buffer + PAR_ENGINES_OFFSET +
                        PAR_WORD_SIZE * tot_partition_words;
@@ -3196,43 +3220,120 @@ int ha_partition::read_par_file(const char *name)
     engines array + name length word + name array.
   */
   if (len_words != (tot_partition_words + tot_name_words + 4))
-    goto err2;
-  m_file_buffer= file_buffer;          // Will be freed in clear_handler_file()
-  m_name_buffer_ptr= (char*) (tot_name_len_offset + PAR_WORD_SIZE);
+    DBUG_RETURN(2);
 
   if (!(m_connect_string= (LEX_CSTRING*)
         alloc_root(&m_mem_root, m_tot_parts * sizeof(LEX_CSTRING))))
-    goto err2;
+    DBUG_RETURN(2);
   bzero(m_connect_string, m_tot_parts * sizeof(LEX_CSTRING));
 
-  /* Read connection arguments (for federated X engine) */
-  for (i= 0; i < m_tot_parts; i++)
+  /*
+    Read connection arguments (for federated X engine). If they are
+    missing, there are no extra options; probably not a federatedx engine.
+  */
+  pos= file_buffer + len_bytes;
+  end= file_buffer + file_length;
+  for (i= 0; i < m_tot_parts && end - pos >= 4; i++)
   {
     LEX_CSTRING connect_string;
-    uchar buffer[4];
-    char *tmp;
-    if (my_read(file, buffer, 4, MYF(MY_NABP)))
-    {
-      /* No extra options; Probably not a federatedx engine */
-      break;
-    }
-    connect_string.length= uint4korr(buffer);
-    connect_string.str= tmp= (char*) alloc_root(&m_mem_root,
-                                                connect_string.length+1);
-    if (my_read(file, (uchar*) connect_string.str, connect_string.length,
-                MYF(MY_NABP)))
+    connect_string.length= uint4korr(pos);
+    pos+= 4;
+    if ((size_t) (end - pos) < connect_string.length)
       break;
-    tmp[connect_string.length]= 0;
+    if (!(connect_string.str= strmake_root(&m_mem_root, (const char*) pos,
+                                           connect_string.length)))
+      DBUG_RETURN(2);
     m_connect_string[i]= connect_string;
+    pos+= connect_string.length;
   }
 
-  (void) mysql_file_close(file, MYF(0));
+  m_file_buffer= file_buffer;          // Will be freed in clear_handler_file()
+  m_file_buffer_length= file_length;
+  m_name_buffer_ptr= (char*) (tot_name_len_offset + PAR_WORD_SIZE);
   DBUG_RETURN(0);
+}
 
-err2:
-err1:
-  (void) mysql_file_close(file, MYF(0));
-  DBUG_RETURN(2);
+
+/**
+  Copy the .par file contents that were cached in the Partition_share
+
+  @param       name    Name of table file (without extension)
+  @param[out]  length  Size of the file
+
+  @return Copy of the file contents, allocated on m_mem_root
+    @retval NULL  The contents were not cached for this table
+*/
+
+uchar *ha_partition::copy_par_file_from_share(const char *name,
+                                              size_t *length)
+{
+  Partition_share *share;
+  uchar *image= NULL;
+  DBUG_ENTER("ha_partition::copy_par_file_from_share");
+
+  if (!table_share || table_share->db_type() != ht ||
+      !table_share->normalized_path.str ||
+      strcmp(name, table_share->normalized_path.str))
+    DBUG_RETURN(NULL);
+
+  lock_shared_ha_data();
+  if ((share= static_cast<Partition_share*>(table_share->ha_share)) &&
+      share->par_file_image &&
+      (image= (uchar*) alloc_root(&m_mem_root, share->par_file_length)))
+  {
+    memcpy(image, share->par_file_image, share->par_file_length);
+    *length= share->par_file_length;
+  }
+  unlock_shared_ha_data();
+  DBUG_RETURN(image);
+}
+
+
+/**
+  Cache the .par file contents in the Partition_share for the other
+  instances of the table.
+*/
+
+void ha_partition::store_par_file_in_share()
+{
+  DBUG_ENTER("ha_partition::store_par_file_in_share");
+
+  if (!m_file_buffer || !table_share->normalized_path.str)
+    DBUG_VOID_RETURN;
+
+  lock_shared_ha_data();
+  if (!part_share->par_file_image &&
+      (part_share->par_file_image= (uchar*)
+       my_memdup(key_memory_ha_partition_file, m_file_buffer,
+                 m_file_buffer_length, MYF(0))))
+    part_share->par_file_length= m_file_buffer_length;
+  unlock_shared_ha_data();
+  DBUG_VOID_RETURN;
+}
+
+
+/**
+  Discard the cached .par file contents because the file is being
+  replaced by a partition management command.
+*/
+
+void ha_partition::forget_par_file_in_share()
+{
+  Partition_share *share;
+  DBUG_ENTER("ha_partition::forget_par_file_in_share");
+
+  if (!table_share || table_share->db_type() != ht)
+    DBUG_VOID_RETURN;
+
+  lock_shared_ha_data();
+  if ((share= static_cast<Partition_share*>(table_share->ha_share)))
+  {
+    my_free(share->par_file_image);
+    share->par_file_image= NULL;
+    share->par_file_length= 0;
+  }
+  unlock_shared_ha_data();
+  DBUG_VOID_RETURN;
 }
 
 
@@ -3664,6 +3765,7 @@ bool ha_partition::set_ha_share_ref(Handler_share **ha_share_arg)
     DBUG_RETURN(true);
   if (!(part_share= get_share()))
     DBUG_RETURN(true);
+  store_par_file_in_share();
   DBUG_ASSERT(part_share->partitions_share_refs.num_parts >= m_tot_parts);
   ha_shares= part_share->partitions_share_refs.ha_shares;
   for (i= 0; i < m_tot_parts; i++)
@@ -4680,6 +4782,12 @@ int ha_partition::write_row(const uchar * buf)
   m_last_part= part_id;
   DBUG_PRINT("info", ("Insert in partition %u", part_id));
 
+  if (m_bulk_rows && buf == table->record[0])
+  {
+    error= buffer_bulk_row(part_id, buf);
+    goto exit;
+  }
+
   start_part_bulk_insert(thd, part_id);
 
   DBUG_ASSERT(!m_file[part_id]->row_logging);
@@ -5064,10 +5172,153 @@ void ha_partition::start_bulk_insert(ha_rows rows, uint flags)
   bitmap_clear_all(&m_bulk_insert_started);
   /* use the last bit for marking if bulk_insert_started was called */
   bitmap_set_bit(&m_bulk_insert_started, m_tot_parts);
+  init_bulk_rows();
   DBUG_VOID_RETURN;
 }
 
 
+/*
+  Start buffering the rows of a bulk insert in write_row(), if possible
+
+  DESCRIPTION
+    When the rows arrive in mixed partition order, writing each row at once
+    interleaves the bulk inserts of the partitions. The rows are instead
+    buffered per partition and written partition by partition when more
+    than bulk_insert_buffer_size bytes are buffered and in end_bulk_insert().
+
+    A write error is then reported for an earlier row and nothing may see
+    a row before it is written. Buffering is thus only done when any error
+    makes the statement fail and roll back: not for IGNORE, REPLACE or
+    ON DUPLICATE KEY UPDATE, and not with auto_increment, triggers, blobs
+    or unique constraints that are checked above the engine.
+*/
+
+void ha_partition::init_bulk_rows()
+{
+  THD *thd= ha_thd();
+  LEX *lex= thd->lex;
+  DBUG_ENTER("ha_partition::init_bulk_rows");
+
+  free_bulk_rows();
+  if (m_tot_parts < 2 || !thd->variables.bulk_insert_buff_size ||
+      (lex->sql_command != SQLCOM_INSERT &&
+       lex->sql_command != SQLCOM_INSERT_SELECT &&
+       lex->sql_command != SQLCOM_LOAD) ||
+      lex->ignore || lex->duplicates != DUP_ERROR ||
+      table->next_number_field || table->triggers ||
+      table->s->blob_fields || table->s->long_unique_table ||
+      table->s->period.unique_keys ||
+      !m_file[0]->has_transactions_and_rollback())
+    DBUG_VOID_RETURN;
+
+  m_bulk_rows= (Bulk_row**) my_malloc(PSI_INSTRUMENT_ME,
+                                      2 * m_tot_parts * sizeof *m_bulk_rows,
+                                      MYF(MY_ZEROFILL));
+  DBUG_VOID_RETURN;
+}
+
+
+/*
+  Buffer a row of a bulk insert
+
+  SYNOPSIS
+    buffer_bulk_row()
+    part_id               Partition of the row
+    buf                   The row
+
+  RETURN VALUE
+    >0                    Error code from writing the buffered rows
+    0                     Success
+*/
+
+int ha_partition::buffer_bulk_row(uint part_id, const uchar *buf)
+{
+  const size_t reclength= table->s->reclength;
+  Bulk_row *row, **last;
+
+  if (!(row= (Bulk_row*) alloc_root(&m_bulk_root,
+                                    sizeof(Bulk_row) + reclength)))
+    return HA_ERR_OUT_OF_MEM;
+  row->next= NULL;
+  memcpy(row + 1, buf, reclength);
+  last= &m_bulk_rows[m_tot_parts + part_id];
+  if (*last)
+    (*last)->next= row;
+  else
+    m_bulk_rows[part_id]= row;
+  *last= row;
+
+  m_bulk_rows_size+= reclength;
+  if (m_bulk_rows_size < ha_thd()->variables.bulk_insert_buff_size)
+    return 0;
+  return write_bulk_rows();
+}
+
+
+/*
+  Write the buffered rows, partition by partition
+
+  RETURN VALUE
+    >0                    Error code
+    0                     Success
+
+  NOTES
+    On error, record[0] holds the row that could not be written and
+    m_last_part its partition, so that the error can be reported.
+*/
+
+int ha_partition::write_bulk_rows()
+{
+  THD *thd= ha_thd();
+  uchar *rec0= table->record[0];
+  const size_t reclength= table->s->reclength;
+  const uint saved_last_part= m_last_part;
+  uchar *saved_rec;
+  int error= 0;
+  DBUG_ENTER("ha_partition::write_bulk_rows");
+
+  if (!(saved_rec= (uchar*) memdup_root(&m_bulk_root, rec0, reclength)))
+    error= HA_ERR_OUT_OF_MEM;
+
+  for (uint i= 0; !error && i < m_tot_parts; i++)
+  {
+    for (Bulk_row *row= m_bulk_rows[i]; row; row= row->next)
+    {
+      memcpy(rec0, row + 1, reclength);
+      start_part_bulk_insert(thd, i);
+      if (unlikely((error= m_file[i]->ha_write_row(rec0))))
+      {
+        m_last_part= i;
+        break;
+      }
+    }
+  }
+
+  if (!error)
+  {
+    memcpy(rec0, saved_rec, reclength);
+    m_last_part= saved_last_part;
+  }
+  bzero(m_bulk_rows, 2 * m_tot_parts * sizeof *m_bulk_rows);
+  m_bulk_rows_size= 0;
+  free_root(&m_bulk_root, MYF(MY_MARK_BLOCKS_FREE));
+  DBUG_RETURN(error);
+}
+
+
+/*
+  Stop buffering rows in write_row() and discard any buffered rows
+*/
+
+void ha_partition::free_bulk_rows()
+{
+  my_free(m_bulk_rows);
+  m_bulk_rows= NULL;
+  m_bulk_rows_size= 0;
+  free_root(&m_bulk_root, MYF(0));
+}
+
+
 /*
   Check if start_bulk_insert has been called for this partition,
   if not, call it and mark it called
@@ -5222,6 +5473,10 @@ int ha_partition::end_bulk_insert()
   if (!bitmap_is_set(&m_bulk_insert_started, m_tot_parts))
     DBUG_RETURN(error);
 
+  if (m_bulk_rows_size && (error= write_bulk_rows()))
+    my_errno= error;
+  free_bulk_rows();
+
   for (i= bitmap_get_first_set(&m_bulk_insert_started);
        i < m_tot_parts;
        i= bitmap_get_next_set(&m_bulk_insert_started, i))
@@ -7504,12 +7759,57 @@ int ha_partition::partition_scan_set_up(uchar * buf, bool idx_read_flag)
       m_part_spec.start_part= start_part;
     DBUG_ASSERT(m_part_spec.start_part < m_tot_parts);
     m_ordered_scan_ongoing= m_ordered;
+    if (m_ordered_scan_ongoing &&
+        m_index_scan_type != partition_index_last &&
+        m_index_scan_type != partition_index_read_last &&
+        thd_sql_command(ha_thd()) != SQLCOM_HA_READ &&
+        partitions_in_index_order())
+    {
+      /*
+        All rows of a partition precede the rows of the next partition in
+        the index order. Reading the partitions one after another returns
+        the rows in order, and a LIMIT stops the scan before the remaining
+        partitions are even accessed (with Spider, before the remaining
+        shards are queried). HANDLER READ is excluded, because it may
+        change the scan direction, which needs the priority queue.
+      */
+      DBUG_PRINT("info", ("partitions are in index order"));
+      m_ordered_scan_ongoing= FALSE;
+    }
   }
   DBUG_ASSERT(m_part_spec.start_part < m_tot_parts);
   DBUG_ASSERT(m_part_spec.end_part < m_tot_parts);
   DBUG_RETURN(0);
 }
 
+/**
+  Check if the partitions are ordered by the active index
+
+  This is the case when the table is RANGE partitioned by a single column
+  which is the first key part of the index, stored in ascending order.
+  NULL values belong to the first partition and they are also sorted
+  first in the index.
+
+  @retval TRUE  a forward index scan can read the partitions one by one
+  @retval FALSE the partitions have to be merged by the priority queue
+*/
+
+bool ha_partition::partitions_in_index_order() const
+{
+  if (m_part_info->part_type != RANGE_PARTITION || m_is_sub_partitioned ||
+      m_part_info->num_part_fields != 1 ||
+      (!m_part_info->column_list &&
+       (!m_part_info->part_expr ||
+        m_part_info->part_expr->type() != Item::FIELD_ITEM)))
+    return FALSE;
+
+  const KEY_PART_INFO *key_part= table->key_info[active_index].key_part;
+  const Field *field= m_part_info->part_field_array[0];
+  return key_part->field == field &&
+         !(key_part->key_part_flag & (HA_REVERSE_SORT | HA_PART_KEY_SEG));
+}
+
+
 /**
   Check if we can search partitions in parallel
 
@@ -7843,7 +8143,7 @@ int ha_partition::handle_unordered_scan_next_partition(uchar * buf)
     case partition_read_range:
       DBUG_PRINT("info", ("read_range_first on partition %u", i));
       error= file->read_range_first(m_start_key.key? &m_start_key: NULL,
-                                    end_range, eq_range, FALSE);
+                                    end_range, eq_range, m_ordered);
       break;
     case partition_index_read:
       DBUG_PRINT("info", ("index_read on partition %u", i));
@@ -9561,6 +9861,7 @@ int ha_partition::reset(void)
   }
   bitmap_clear_all(&m_partitions_to_reset);
   m_extra_prepare_for_update= FALSE;
+  free_bulk_rows();
   DBUG_RETURN(result);
 }
 
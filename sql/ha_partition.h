@@ -112,11 +112,20 @@ class Partition_share : public Handler_share
   const char *partition_engine_name;
   /** Storage for each partitions Handler_share */
   Parts_share_refs partitions_share_refs;
+  /**
+    Contents of the .par file, stored by the first ha_partition instance
+    for the table_share so that later instances do not have to read
+    the file again. Protected by TABLE_SHARE::LOCK_ha_data.
+  */
+  uchar *par_file_image;
+  size_t par_file_length;
   Partition_share()
     : auto_inc_initialized(false),
     next_auto_inc_val(0),
     partition_name_hash_initialized(false),
     partition_engine_name(NULL),
+    par_file_image(NULL),
+    par_file_length(0),
     partition_names(NULL)
   {
     mysql_mutex_init(key_partition_auto_inc_mutex,
@@ -127,6 +136,7 @@ class Partition_share : public Handler_share
   ~Partition_share()
   {
     mysql_mutex_destroy(&auto_inc_mutex);
+    my_free(par_file_image);
     if (partition_names)
     {
       my_free(partition_names);
@@ -300,6 +310,7 @@ class ha_partition final :public handler
   int  m_mode;                          // Open mode
   uint m_open_test_lock;                // Open test_if_locked
   uchar *m_file_buffer;                 // Content of the .par file
+  size_t m_file_buffer_length;          // Size of m_file_buffer
   char *m_name_buffer_ptr;		// Pointer to first partition name
   MEM_ROOT m_mem_root;
   plugin_ref *m_engine_array;           // Array of types of the handlers
@@ -429,6 +440,20 @@ class ha_partition final :public handler
   /** For optimizing ha_start_bulk_insert calls */
   MY_BITMAP m_bulk_insert_started;
   ha_rows   m_bulk_inserted_rows;
+  /** A row buffered by write_row() during bulk insert; the record follows */
+  struct Bulk_row
+  {
+    Bulk_row *next;
+  };
+  /** Memory for the buffered rows */
+  MEM_ROOT m_bulk_root;
+  /**
+    First buffered row of each partition, followed by the last buffered row
+    of each partition; NULL if write_row() does not buffer rows
+  */
+  Bulk_row **m_bulk_rows;
+  /** Total size of the buffered records */
+  size_t m_bulk_rows_size;
   /** used for prediction of start_bulk_insert rows */
   enum_monotonicity_info m_part_func_monotonicity_info;
   part_id_range m_direct_update_part_spec;
@@ -592,6 +617,9 @@ class ha_partition final :public handler
   bool create_handler_file(const char *name);
   bool setup_engine_array(MEM_ROOT *mem_root, handlerton *first_engine);
   int read_par_file(const char *name);
+  uchar *copy_par_file_from_share(const char *name, size_t *length);
+  void store_par_file_in_share();
+  void forget_par_file_in_share();
   handlerton *get_def_part_engine(const char *name);
   bool get_from_handler_file(const char *name, MEM_ROOT *mem_root,
                              bool is_clone);
@@ -728,6 +756,10 @@ class ha_partition final :public handler
 private:
   ha_rows guess_bulk_insert_rows();
   void start_part_bulk_insert(THD *thd, uint part_id);
+  void init_bulk_rows();
+  int buffer_bulk_row(uint part_id, const uchar *buf);
+  int write_bulk_rows();
+  void free_bulk_rows();
   long estimate_read_buffer_size(long original_size);
 public:
 
@@ -939,6 +971,7 @@ class ha_partition final :public handler
   int common_index_read(uchar * buf, bool have_start_key);
   int common_first_last(uchar * buf);
   int partition_scan_set_up(uchar * buf, bool idx_read_flag);
+  bool partitions_in_index_order() const;
   bool check_parallel_search();
   int handle_pre_scan(bool reverse_order, bool use_parallel);
   int handle_unordered_next(uchar * buf, bool next_same);
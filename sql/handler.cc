@@ -6193,6 +6193,37 @@ int handler::calculate_checksum()
   table->use_all_stored_columns();
   stats.checksum= 0;
 
+  /*
+    Classify the stored columns once instead of for every row.
+    BLOB and VARCHAR have pointers in their field, we must convert
+    to string; GEOMETRY is implemented on top of BLOB.
+    BIT may store its data among NULL bits, convert as well.
+  */
+  const bool skip_null= !(thd->variables.old_behavior &
+                          OLD_MODE_COMPAT_5_1_CHECKSUM);
+  Field **fields= (Field**) thd->alloc(sizeof(Field*) * table->s->fields);
+  bool *as_string= (bool*) thd->alloc(sizeof(bool) * table->s->fields);
+  uint n_fields= 0;
+  if (!fields || !as_string)
+    return HA_ERR_OUT_OF_MEM;
+  for (uint i= 0; i < table->s->fields; i++)
+  {
+    Field *f= table->field[i];
+    if (!f->stored_in_db())
+      continue;
+    switch (f->type()) {
+    case MYSQL_TYPE_BLOB:
+    case MYSQL_TYPE_VARCHAR:
+    case MYSQL_TYPE_GEOMETRY:
+    case MYSQL_TYPE_BIT:
+      as_string[n_fields]= true;
+      break;
+    default:
+      as_string[n_fields]= false;
+    }
+    fields[n_fields++]= f;
+  }
+
   if ((error= ha_rnd_init(1)))
     return error;
 
@@ -6218,42 +6249,28 @@ int handler::calculate_checksum()
 
     uchar *checksum_start= NULL;
     size_t checksum_length= 0;
-    for (uint i= 0; i < table->s->fields; i++ )
+    for (uint i= 0; i < n_fields; i++)
     {
-      Field *f= table->field[i];
-      if (!f->stored_in_db())
-        continue;
+      Field *f= fields[i];
 
-
-      if (! (thd->variables.old_behavior & OLD_MODE_COMPAT_5_1_CHECKSUM) &&
-            f->is_real_null(0))
+      if (skip_null && f->is_real_null(0))
       {
         flush_checksum(&row_crc, &checksum_start, &checksum_length);
         continue;
       }
-     /*
-       BLOB and VARCHAR have pointers in their field, we must convert
-       to string; GEOMETRY is implemented on top of BLOB.
-       BIT may store its data among NULL bits, convert as well.
-     */
-      switch (f->type()) {
-        case MYSQL_TYPE_BLOB:
-        case MYSQL_TYPE_VARCHAR:
-        case MYSQL_TYPE_GEOMETRY:
-        case MYSQL_TYPE_BIT:
-        {
-          flush_checksum(&row_crc, &checksum_start, &checksum_length);
-          String tmp;
-          f->val_str(&tmp);
-          row_crc= my_checksum(row_crc, (uchar*) tmp.ptr(), tmp.length());
-          break;
-        }
-        default:
-          if (!checksum_start)
-            checksum_start= f->ptr;
-          DBUG_ASSERT(checksum_start + checksum_length == f->ptr);
-          checksum_length+= f->pack_length();
-          break;
+      if (as_string[i])
+      {
+        flush_checksum(&row_crc, &checksum_start, &checksum_length);
+        String tmp;
+        f->val_str(&tmp);
+        row_crc= my_checksum(row_crc, (uchar*) tmp.ptr(), tmp.length());
+      }
+      else
+      {
+        if (!checksum_start)
+          checksum_start= f->ptr;
+        DBUG_ASSERT(checksum_start + checksum_length == f->ptr);
+        checksum_length+= f->pack_length();
       }
     }
     flush_checksum(&row_crc, &checksum_start, &checksum_length);
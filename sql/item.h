@@ -2524,6 +2524,8 @@ class Item :public Value_source,
   { return this; }
   virtual Item* date_conds_transformer(THD *thd, uchar *arg)
   { return this; }
+  virtual Item *vcol_subst_transformer(THD *thd, uchar *arg)
+  { return this; }
   virtual bool expr_cache_is_needed(THD *) { return FALSE; }
   virtual Item *safe_charset_converter(THD *thd, CHARSET_INFO *tocs);
   bool needs_charset_converter(uint32 length, CHARSET_INFO *tocs) const
@@ -5878,7 +5878,18 @@ longlong Item_func_like::val_int()
   }
   null_value=0;
   if (canDoTurboBM)
-    return turboBM_matches(res->ptr(), res->length()) ? !negated : negated;
+  {
+    if (!turboBM_matches(res->ptr(), res->length()))
+      return negated;
+    /*
+      In a multi-byte string a byte match is a character match only
+      if the string is well formed. Otherwise let wildcmp() decide.
+    */
+    if (!cmp_collation.collation->use_mb() ||
+        Well_formed_prefix(cmp_collation.collation, res->ptr(),
+                           res->length()).length() == res->length())
+      return !negated;
+  }
   return cmp_collation.collation->wildcmp(
 		    res->ptr(),res->ptr()+res->length(),
 		    res2->ptr(),res2->ptr()+res2->length(),
@@ -6064,7 +6075,9 @@ bool Item_func_like::fix_fields(THD *thd, Item **ref)
       {
         const char* tmp = first + 1;
         for (; *tmp != wild_many && *tmp != wild_one && *tmp != escape; tmp++) ;
-        canDoTurboBM = (tmp == last) && !args[0]->collation.collation->use_mb();
+        canDoTurboBM = (tmp == last) &&
+                       (!args[0]->collation.collation->use_mb() ||
+                        turboBM_is_byte_search(first + 1, len - 2));
       }
       if (canDoTurboBM)
       {
@@ -6562,6 +6575,25 @@ void Item_func_like::turboBM_compute_bad_character_shifts()
 }
 
 
+/**
+  Check if the pattern can be searched for byte by byte in a string
+  of a multi-byte character set.
+
+  This is the case for the binary collations of UTF-8, e.g. utf8mb4_bin,
+  as a well formed UTF-8 string never matches in the middle of another
+  character.
+*/
+
+bool Item_func_like::turboBM_is_byte_search(const char *str,
+                                            size_t length) const
+{
+  CHARSET_INFO *cs= cmp_collation.collation;
+  return (cs->state & MY_CS_BINSORT) && (cs->state & MY_CS_UNICODE) &&
+         cs->mbminlen == 1 && !cs->sort_order &&
+         Well_formed_prefix(cs, str, length).length() == length;
+}
+
+
 /**
   Search for pattern in text.
 
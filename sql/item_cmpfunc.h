@@ -558,6 +558,7 @@ class Item_bool_rowready_func2 :public Item_bool_func2_with_rev
   Item_bool_rowready_func2(THD *thd, Item *a, Item *b):
     Item_bool_func2_with_rev(thd, a, b), cmp(tmp_arg, tmp_arg + 1)
   { }
+  Item *vcol_subst_transformer(THD *thd, uchar *arg) override;
   Sql_mode_dependency value_depends_on_sql_mode() const override;
   void print(String *str, enum_query_type query_type) override
   {
@@ -2675,6 +2676,7 @@ class Item_func_in :public Item_func_opt_neg,
   Item *in_predicate_to_equality_transformer(THD *thd, uchar *arg) override;
   uint32 max_length_of_left_expr();
   Item* varchar_upper_cmp_transformer(THD *thd, uchar *arg) override;
+  Item *vcol_subst_transformer(THD *thd, uchar *arg) override;
 };
 
 class cmp_item_row :public cmp_item
@@ -2881,6 +2883,7 @@ class Item_func_like :public Item_bool_func2
   void turboBM_compute_good_suffix_shifts(int* suff);
   void turboBM_compute_bad_character_shifts();
   bool turboBM_matches(const char* text, int text_len) const;
+  bool turboBM_is_byte_search(const char *str, size_t length) const;
   enum { alphabet_size = 256 };
 
   Item *escape_item;
@@ -827,11 +827,11 @@ bool Aggregator_distinct::setup(THD *thd)
     table->file->extra(HA_EXTRA_NO_ROWS);		// Don't update rows
     table->no_rows=1;
 
-    if (table->s->db_type() == heap_hton)
+    if (table->s->db_type() == heap_hton && !table->s->blob_fields)
     {
       /*
-        No blobs, otherwise it would have been MyISAM: set up a compare
-        function and its arguments to use with Unique.
+        No blobs: set up a compare function and its arguments to use with
+        Unique.
       */
       qsort_cmp2 compare_key;
       void* cmp_arg;
@@ -1530,6 +1530,8 @@ Item_sum_sum::Item_sum_sum(THD *thd, Item_sum_sum *item)
    Type_handler_hybrid_field_type(item),
    direct_added(FALSE), direct_reseted_field(FALSE),
    curr_dec_buff(item->curr_dec_buff),
+   int_sum_enabled(item->int_sum_enabled),
+   int_sum_scale(item->int_sum_scale), int_sum(item->int_sum),
    count(item->count)
 {
   /* TODO: check if the following assignments are really needed */
@@ -1562,6 +1564,7 @@ void Item_sum_sum::clear()
   DBUG_ENTER("Item_sum_sum::clear");
   null_value=1;
   count= 0;
+  int_sum= 0;
   if (result_type() == DECIMAL_RESULT)
   {
     curr_dec_buff= 0;
@@ -1578,6 +1581,7 @@ void Item_sum_sum::fix_length_and_dec_double()
   set_handler(&type_handler_double); // Change FLOAT to DOUBLE
   decimals= args[0]->decimals;
   sum= 0.0;
+  int_sum_enabled= false;
 }
 
 
@@ -1594,6 +1598,20 @@ void Item_sum_sum::fix_length_and_dec_decimal()
                                                            unsigned_flag);
   curr_dec_buff= 0;
   my_decimal_set_zero(dec_buffs);
+  /*
+    Adding each value of an integer argument to dec_buffs would convert
+    it to decimal and invoke my_decimal_add() for every row. Sum the
+    values in a longlong instead, and add it to dec_buffs only when it
+    would overflow or when the result is needed.
+    Do the same for DECIMAL arguments of up to 18 digits, e.g.
+    DECIMAL(18,4), by summing the values multiplied by 10^decimals.
+  */
+  int_sum_enabled= (args[0]->cmp_type() == INT_RESULT &&
+                    !args[0]->unsigned_flag) ||
+    (args[0]->cmp_type() == DECIMAL_RESULT &&
+     args[0]->decimal_precision() <= 18);
+  int_sum_scale= args[0]->cmp_type() == DECIMAL_RESULT ? args[0]->decimals : 0;
+  int_sum= 0;
 }
 
 
@@ -1650,12 +1668,42 @@ bool Item_sum_sum::add()
   DBUG_RETURN(0);
 }
 
+/**
+  Read the argument for int_sum.
+
+  @param[out] val  the value multiplied by 10^int_sum_scale
+  @param      buf  buffer for the DECIMAL value
+  @param[out] dec  the DECIMAL value if it could not be converted
+
+  @retval false  val was set, or the argument is NULL
+  @retval true   the value does not fit; it was returned in dec
+*/
+
+bool Item_sum_sum::arg_val_scaled_int(longlong *val, my_decimal *buf,
+                                      const my_decimal **dec)
+{
+  if (args[0]->cmp_type() == INT_RESULT)
+  {
+    *val= args[0]->val_int();
+    return false;
+  }
+  const my_decimal *d= args[0]->val_decimal(buf);
+  if (args[0]->null_value || !decimal2scaled_longlong(d, int_sum_scale, val))
+    return false;
+  *dec= d;
+  return true;
+}
+
+
 void Item_sum_sum::add_helper(bool perform_removal)
 {
   DBUG_ENTER("Item_sum_sum::add_helper");
 
   if (result_type() == DECIMAL_RESULT)
   {
+    longlong int_val;
+    my_decimal value;
+    const my_decimal *val= nullptr;
     if (unlikely(direct_added))
     {
       /* Add value stored by Item_sum_sum::direct_add */
@@ -1670,11 +1718,52 @@ void Item_sum_sum::add_helper(bool perform_removal)
         null_value= 0;
       }
     }
+    else if (int_sum_enabled &&
+             aggr->Aggrtype() == Aggregator::SIMPLE_AGGREGATOR &&
+             !arg_val_scaled_int(&int_val, &value, &val))
+    {
+      direct_reseted_field= FALSE;
+      if (!args[0]->null_value)
+      {
+        if (perform_removal)
+        {
+          if (!count)
+            DBUG_VOID_RETURN;
+          count--;
+          if (int_val > 0 ? int_sum < LONGLONG_MIN + int_val
+              : int_sum > LONGLONG_MAX + int_val)
+          {
+            /* int_sum - int_val would overflow */
+            flush_int_sum();
+            check_result(E_DEC_FATAL_ERROR,
+                         scaled_longlong2decimal(int_val, int_sum_scale,
+                                                 &value));
+            my_decimal_sub(E_DEC_FATAL_ERROR, dec_buffs + (curr_dec_buff ^ 1),
+                           dec_buffs + curr_dec_buff, &value);
+            curr_dec_buff^= 1;
+          }
+          else
+            int_sum-= int_val;
+        }
+        else
+        {
+          count++;
+          if (int_val > 0 ? int_sum > LONGLONG_MAX - int_val
+              : int_sum < LONGLONG_MIN - int_val)
+            flush_int_sum();
+          int_sum+= int_val;
+        }
+        null_value= (count > 0) ? 0 : 1;
+      }
+    }
     else
     {
       direct_reseted_field= FALSE;
-      my_decimal value;
-      const my_decimal *val= aggr->arg_val_decimal(&value);
+      if (!val)
+      {
+        flush_int_sum();
+        val= aggr->arg_val_decimal(&value);
+      }
       if (!aggr->arg_is_null(true))
       {
         if (perform_removal)
@@ -1746,7 +1835,10 @@ longlong Item_sum_sum::val_int()
   if (aggr)
     aggr->endup();
   if (result_type() == DECIMAL_RESULT)
+  {
+    flush_int_sum();
     return dec_buffs[curr_dec_buff].to_longlong(unsigned_flag);
+  }
   return val_int_from_real();
 }
 
@@ -1757,7 +1849,10 @@ double Item_sum_sum::val_real()
   if (aggr)
     aggr->endup();
   if (result_type() == DECIMAL_RESULT)
+  {
+    flush_int_sum();
     sum= dec_buffs[curr_dec_buff].to_double();
+  }
   return sum;
 }
 
@@ -1777,7 +1872,10 @@ my_decimal *Item_sum_sum::val_decimal(my_decimal *val)
   if (aggr)
     aggr->endup();
   if (result_type() == DECIMAL_RESULT)
+  {
+    flush_int_sum();
     return null_value ? NULL : (dec_buffs + curr_dec_buff);
+  }
   return val_decimal_from_real(val);
 }
 
@@ -2122,6 +2220,7 @@ my_decimal *Item_sum_avg::val_decimal(my_decimal *val)
   if (result_type() != DECIMAL_RESULT)
     return val_decimal_from_real(val);
 
+  flush_int_sum();
   sum_dec= dec_buffs + curr_dec_buff;
   int2my_decimal(E_DEC_FATAL_ERROR, count, 0, &cnt);
   my_decimal_div(E_DEC_FATAL_ERROR, val, sum_dec, &cnt, prec_increment);
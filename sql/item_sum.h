@@ -824,12 +824,43 @@ class Item_sum_sum :public Item_sum_num,
   my_decimal direct_sum_decimal;
   my_decimal dec_buffs[2];
   uint curr_dec_buff;
+  /**
+    Whether the argument is a signed integer or a short DECIMAL, so that
+    the values can be summed in int_sum before being added to
+    dec_buffs[curr_dec_buff]
+  */
+  bool int_sum_enabled;
+  /** Number of decimal digits of int_sum, 0 for an integer argument */
+  decimal_digits_t int_sum_scale;
+  /**
+    Sum of values that have not been added to dec_buffs yet,
+    multiplied by 10^int_sum_scale
+  */
+  longlong int_sum;
   bool fix_length_and_dec(THD *thd) override;
+  /** Read the argument multiplied by 10^int_sum_scale */
+  bool arg_val_scaled_int(longlong *val, my_decimal *buf,
+                          const my_decimal **dec);
+  /** Add int_sum to dec_buffs[curr_dec_buff] */
+  void flush_int_sum()
+  {
+    if (int_sum)
+    {
+      my_decimal value;
+      check_result(E_DEC_FATAL_ERROR,
+                   scaled_longlong2decimal(int_sum, int_sum_scale, &value));
+      my_decimal_add(E_DEC_FATAL_ERROR, dec_buffs + (curr_dec_buff ^ 1),
+                     &value, dec_buffs + curr_dec_buff);
+      curr_dec_buff^= 1;
+      int_sum= 0;
+    }
+  }
 
 public:
   Item_sum_sum(THD *thd, Item *item_par, bool distinct):
     Item_sum_num(thd, item_par), direct_added(FALSE),
-    direct_reseted_field(FALSE)
+    direct_reseted_field(FALSE), int_sum_enabled(false), int_sum_scale(0),
+    int_sum(0)
   {
     set_distinct(distinct);
   }
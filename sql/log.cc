@@ -2597,6 +2597,10 @@ File open_binlog(IO_CACHE *log, const char *log_file_name, const char **errmsg)
     *errmsg = "Could not open log file";
     goto err;
   }
+#ifdef POSIX_FADV_SEQUENTIAL
+  /* Logs are read from start to end; let the kernel read ahead further. */
+  posix_fadvise(file, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
   if (init_io_cache_ext(log, file, (size_t)binlog_file_cache_size, READ_CACHE,
             0, 0, MYF(MY_WME|MY_DONT_CHECK_FILESIZE), key_file_binlog_cache))
   {
@@ -3501,6 +3505,7 @@ MYSQL_BIN_LOG::MYSQL_BIN_LOG(uint *sync_period)
   index_file_name[0] = 0;
   bzero((char*) &index_file, sizeof(index_file));
   bzero((char*) &purge_index_file, sizeof(purge_index_file));
+  my_hash_clear(&gtid_list_cache);
 }
 
 void MYSQL_BIN_LOG::stop_background_thread()
@@ -3552,6 +3557,7 @@ void MYSQL_BIN_LOG::cleanup()
       delete b;
     }
 
+    my_hash_free(&gtid_list_cache);
     mysql_mutex_destroy(&LOCK_log);
     mysql_mutex_destroy(&LOCK_index);
     mysql_mutex_destroy(&LOCK_xid_list);
@@ -3586,6 +3592,25 @@ void MYSQL_BIN_LOG::init(ulong max_size_arg)
 }
 
 
+/* Cached Gtid_list_log_event of a binlog file */
+struct binlog_gtid_list_entry
+{
+  char *name;
+  size_t name_len;
+  uint32 count;
+  rpl_gtid *list;
+};
+
+
+static uchar *gtid_list_cache_get_key(const uchar *rec, size_t *length,
+                                      my_bool)
+{
+  const binlog_gtid_list_entry *e= (const binlog_gtid_list_entry *) rec;
+  *length= e->name_len;
+  return (uchar *) e->name;
+}
+
+
 void MYSQL_BIN_LOG::init_pthread_objects()
 {
   Event_log::init_pthread_objects();
@@ -3604,6 +3629,8 @@ void MYSQL_BIN_LOG::init_pthread_objects()
                   &COND_binlog_background_thread, 0);
   mysql_cond_init(key_BINLOG_COND_binlog_background_thread_end,
                   &COND_binlog_background_thread_end, 0);
+  my_hash_init(PSI_INSTRUMENT_ME, &gtid_list_cache, &my_charset_bin, 16, 0, 0,
+               gtid_list_cache_get_key, my_free, 0);
 }
 
 
@@ -4519,6 +4546,7 @@ bool MYSQL_BIN_LOG::reset_logs(THD *thd, bool create_new_log,
   close(LOG_CLOSE_TO_BE_OPENED|LOG_CLOSE_SYNC_GTID_INDEX);
 
   last_used_log_number= 0;                      // Reset log number cache
+  my_hash_reset(&gtid_list_cache);
 
   /*
     First delete all old log files and then update the index file.
@@ -5065,6 +5093,75 @@ int MYSQL_BIN_LOG::register_create_index_entry(const char *entry)
   DBUG_RETURN(register_purge_index_entry(entry));
 }
 
+/**
+  Look up the cached Gtid_list_log_event of a binlog file.
+
+  @param log_name   name of the binlog file
+  @param out_glev   copy of the cached event, to be deleted by the caller
+
+  @retval true      the file was found in the cache
+  @retval false     the file must be read
+*/
+
+bool MYSQL_BIN_LOG::get_cached_gtid_list(const char *log_name,
+                                         Gtid_list_log_event **out_glev)
+{
+  const char *base= log_name + dirname_length(log_name);
+  Gtid_list_log_event *glev= NULL;
+
+  mysql_mutex_lock(&LOCK_index);
+  if (const binlog_gtid_list_entry *e= (const binlog_gtid_list_entry *)
+      my_hash_search(&gtid_list_cache, (const uchar *) base, strlen(base)))
+    glev= new Gtid_list_log_event(e->list, e->count, 0);
+  mysql_mutex_unlock(&LOCK_index);
+
+  if (glev && !glev->is_valid())
+  {
+    delete glev;
+    glev= NULL;
+  }
+  *out_glev= glev;
+  return glev != NULL;
+}
+
+
+/**
+  Remember the Gtid_list_log_event read from the start of a binlog file.
+  Failure to allocate memory only means the file will be read again.
+
+  @param log_name   name of the binlog file
+  @param glev       the event
+*/
+
+void MYSQL_BIN_LOG::cache_gtid_list(const char *log_name,
+                                    const Gtid_list_log_event *glev)
+{
+  const char *base= log_name + dirname_length(log_name);
+  size_t name_len= strlen(base);
+  uint32 count= glev->count;
+  binlog_gtid_list_entry *e;
+  char *name;
+  rpl_gtid *list;
+
+  if (!my_multi_malloc(PSI_INSTRUMENT_ME, MYF(0),
+                       &e, sizeof(*e), &name, name_len + 1,
+                       &list, count * sizeof(*list) + 1, NullS))
+    return;
+  memcpy(name, base, name_len + 1);
+  e->name= name;
+  e->name_len= name_len;
+  e->count= count;
+  e->list= list;
+  memcpy(list, glev->list, count * sizeof(*list));
+
+  mysql_mutex_lock(&LOCK_index);
+  if (my_hash_search(&gtid_list_cache, (const uchar *) name, name_len) ||
+      my_hash_insert(&gtid_list_cache, (const uchar *) e))
+    my_free(e);
+  mysql_mutex_unlock(&LOCK_index);
+}
+
+
 int MYSQL_BIN_LOG::purge_index_entry(THD *thd, ulonglong *reclaimed_space,
                                      bool need_mutex)
 {
@@ -5107,6 +5204,16 @@ int MYSQL_BIN_LOG::purge_index_entry(THD *thd, ulonglong *reclaimed_space,
     /* Get rid of the trailing '\n' */
     log_info.log_file_name[length-1]= 0;
 
+    if (need_mutex)
+      mysql_mutex_lock(&LOCK_index);
+    const char *base= log_info.log_file_name +
+      dirname_length(log_info.log_file_name);
+    if (uchar *e= my_hash_search(&gtid_list_cache, (const uchar *) base,
+                                 strlen(base)))
+      my_hash_delete(&gtid_list_cache, e);
+    if (need_mutex)
+      mysql_mutex_unlock(&LOCK_index);
+
     Gtid_index_base::make_gtid_index_file_name(buf, sizeof(buf),
                                                log_info.log_file_name);
     if (my_delete(buf, MYF(0)))
@@ -5920,7 +6027,16 @@ bool MYSQL_BIN_LOG::append_no_lock(Log_event* ev,
   DBUG_RETURN(error);
 }
 
-bool MYSQL_BIN_LOG::write_event_buffer(uchar* buf, uint len)
+/*
+  Append an event received by the slave IO thread to the relay log.
+
+  @param flush  Write the event to the file now. Otherwise it may stay in
+                the append buffer of log_file, where the SQL thread reads
+                it from memory, until the buffer fills up, the log is
+                rotated or synced, or flush_for_readers() is called.
+*/
+
+bool MYSQL_BIN_LOG::write_event_buffer(uchar* buf, uint len, bool flush)
 {
   bool error= 1;
   uchar *ebuf= 0;
@@ -5970,7 +6086,13 @@ bool MYSQL_BIN_LOG::write_event_buffer(uchar* buf, uint len)
 
   error= 0;
   DBUG_PRINT("info",("max_size: %lu",max_size));
-  if (flush_and_sync(0))
+  if (flush)
+  {
+    if (flush_and_sync(0))
+      goto err;
+  }
+  else if (sync_due() &&
+           (flush_io_cache(&log_file) || sync_log_file(log_file.file)))
     goto err;
   if (my_b_append_tell(&log_file) > max_size)
     error= new_file_without_locking();
@@ -5989,18 +6111,22 @@ bool MYSQL_BIN_LOG::flush_and_sync(bool *synced)
   mysql_mutex_assert_owner(&LOCK_log);
   if (flush_io_cache(&log_file))
     return 1;
-  uint sync_period= get_sync_period();
-  if (sync_period && ++sync_counter >= sync_period)
+  if (sync_due())
   {
-    sync_counter= 0;
-    err= mysql_file_sync(fd, MYF(MY_WME));
+    err= sync_log_file(fd);
     if (synced)
       *synced= 1;
+  }
+  return err;
+}
+
+int MYSQL_BIN_LOG::sync_log_file(File fd)
+{
+  int err= mysql_file_sync(fd, MYF(MY_WME));
 #ifndef DBUG_OFF
-    if (opt_binlog_dbug_fsync_sleep > 0)
-      my_sleep(opt_binlog_dbug_fsync_sleep);
+  if (opt_binlog_dbug_fsync_sleep > 0)
+    my_sleep(opt_binlog_dbug_fsync_sleep);
 #endif
-  }
   return err;
 }
 
@@ -8399,6 +8525,7 @@ MYSQL_BIN_LOG::queue_for_group_commit(group_commit_entry *orig_entry)
       */
       wfc->opaque_pointer= orig_entry;
       DEBUG_SYNC(orig_entry->thd, "group_commit_waiting_for_prior");
+      const ulonglong wait_start= microsecond_interval_timer();
       orig_entry->thd->ENTER_COND(&wfc->COND_wait_commit,
                                   &wfc->LOCK_wait_commit,
                                   &stage_waiting_for_prior_transaction_to_commit,
@@ -8448,6 +8575,8 @@ MYSQL_BIN_LOG::queue_for_group_commit(group_commit_entry *orig_entry)
         }
       }
       orig_entry->thd->EXIT_COND(&old_stage);
+      if (thd->rgi_slave)
+        thd->rgi_slave->add_prior_commit_wait_time(wait_start);
     }
     else
       mysql_mutex_unlock(&wfc->LOCK_wait_commit);
@@ -8810,6 +8939,8 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
   bool check_purge= false;
   ulong UNINIT_VAR(binlog_id);
   uint64 commit_id;
+  File sync_fd= -1;
+  ulong group_size __attribute__((unused))= 0;
   DBUG_ENTER("MYSQL_BIN_LOG::trx_group_commit_leader");
 
   {
@@ -8852,8 +8983,10 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
       current->next= queue;
       queue= current;
       current= next;
+      group_size++;
     }
     DBUG_ASSERT(leader == queue /* the leader should be first in queue */);
+    MYSQL_BINLOG_GROUP_COMMIT_START(group_size);
 
     /* Now we have in queue the list of transactions to be committed in order. */
   }
@@ -8926,8 +9059,21 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
     }
     set_current_thd(leader->thd);
 
+    /*
+      Unless the file is going to be rotated or semi-sync replication
+      needs the after_flush hook, the file is synced after LOCK_log has
+      been released, so that the next group can write its transactions
+      while this group waits for the sync.
+    */
     bool synced= 0;
-    if (unlikely(flush_and_sync(&synced)))
+    const bool defer_sync= !is_relay_log &&
+      my_b_write_tell(&log_file) < max_size
+#ifdef HAVE_REPLICATION
+      && !repl_semisync_master.get_master_enabled()
+#endif
+      ;
+    if (unlikely(defer_sync ? flush_io_cache(&log_file) :
+                 flush_and_sync(&synced)))
     {
       for (current= queue; current != NULL; current= current->next)
       {
@@ -8939,6 +9085,8 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
         }
       }
     }
+    else if (defer_sync && sync_due())
+      sync_fd= log_file.file;
     else
     {
       DEBUG_SYNC(leader->thd, "commit_before_update_binlog_end_pos");
@@ -9036,6 +9184,28 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
 
   DEBUG_SYNC(leader->thd, "commit_after_release_LOCK_log");
 
+  if (sync_fd >= 0)
+  {
+    /*
+      close() waits for LOCK_after_binlog_sync, so the file cannot be
+      closed under us.
+    */
+    if (unlikely(sync_log_file(sync_fd)))
+    {
+      for (current= queue; current != NULL; current= current->next)
+      {
+        if (!current->error)
+        {
+          current->error= ER_ERROR_ON_WRITE;
+          current->commit_errno= errno;
+          current->error_cache= NULL;
+        }
+      }
+    }
+    else
+      update_binlog_end_pos_after_sync(commit_offset);
+  }
+
   /*
     Loop through threads and run the binlog_sync hook
   */
@@ -9062,6 +9232,7 @@ MYSQL_BIN_LOG::trx_group_commit_leader(group_commit_entry *leader)
     }
   }
 
+  MYSQL_BINLOG_GROUP_COMMIT_DONE(leader->error);
   DEBUG_SYNC(leader->thd, "commit_before_get_LOCK_commit_ordered");
 
   mysql_mutex_lock(&LOCK_commit_ordered);
@@ -9462,6 +9633,12 @@ void MYSQL_BIN_LOG::close(uint exiting)
   if (log_state == LOG_OPENED)
   {
     DBUG_ASSERT(log_type == LOG_BIN);
+    if (!is_relay_log)
+    {
+      /* Wait for a group commit leader that is syncing the file */
+      mysql_mutex_lock(&LOCK_after_binlog_sync);
+      mysql_mutex_unlock(&LOCK_after_binlog_sync);
+    }
 #ifdef HAVE_REPLICATION
     if (exiting & LOG_CLOSE_STOP_EVENT)
     {
@@ -25,6 +25,7 @@ class Gtid_index_writer;
 
 class Format_description_log_event;
 class Gtid_log_event;
+class Gtid_list_log_event;
 
 bool reopen_fstreams(const char *filename, FILE *outstream, FILE *errstream);
 void setup_log_handling();
@@ -728,6 +729,13 @@ class MYSQL_BIN_LOG: public TC_LOG, private Event_log
 
   /* Binlog GTID index. */
   Gtid_index_writer *gtid_index;
+  /*
+    The Gtid_list_log_event at the start of each binlog file, keyed on the
+    base name of the file. This saves opening and reading every older binlog
+    file when a slave connects with a GTID position that is not covered by
+    the GTID index. Protected by LOCK_index.
+  */
+  HASH gtid_list_cache;
 
   /* pointer to the sync period variable, for binlog this will be
      sync_binlog_period, for relay log this will be
@@ -750,6 +758,17 @@ class MYSQL_BIN_LOG: public TC_LOG, private Event_log
     return *sync_period_ptr;
   }
 
+  /** @return whether the log should be synced now, according to the period */
+  bool sync_due()
+  {
+    uint sync_period= get_sync_period();
+    if (!sync_period || ++sync_counter < sync_period)
+      return false;
+    sync_counter= 0;
+    return true;
+  }
+  int sync_log_file(File fd);
+
   int write_to_file(IO_CACHE *cache);
   /*
     This is used to start writing to a new log file. The difference from
@@ -985,6 +1004,24 @@ class MYSQL_BIN_LOG: public TC_LOG, private Event_log
     unlock_binlog_end_pos();
   }
 
+  /*
+    Like update_binlog_end_pos(pos), for the group commit leader that synced
+    the log after releasing LOCK_log. Another thread may have published a
+    later position meanwhile.
+  */
+  void update_binlog_end_pos_after_sync(my_off_t pos)
+  {
+    mysql_mutex_assert_owner(&LOCK_after_binlog_sync);
+    mysql_mutex_assert_not_owner(&LOCK_binlog_end_pos);
+    lock_binlog_end_pos();
+    if (pos > binlog_end_pos)
+    {
+      binlog_end_pos= pos;
+      signal_bin_log_update();
+    }
+    unlock_binlog_end_pos();
+  }
+
   void wait_for_sufficient_commits();
   void binlog_trigger_immediate_group_commit();
   void wait_for_update_relay_log(THD* thd);
@@ -1027,7 +1064,18 @@ class MYSQL_BIN_LOG: public TC_LOG, private Event_log
   }
   bool write_event(Log_event *ev);
 
-  bool write_event_buffer(uchar* buf,uint len);
+  bool write_event_buffer(uchar* buf,uint len, bool flush= true);
+  /*
+    Write out the relay log events that are still in the append buffer,
+    for readers that open the log file by name.
+  */
+  void flush_for_readers()
+  {
+    mysql_mutex_lock(&LOCK_log);
+    if (is_open())
+      flush_io_cache(&log_file);
+    mysql_mutex_unlock(&LOCK_log);
+  }
   bool append(Log_event* ev, enum enum_binlog_checksum_alg checksum_alg);
   bool append_no_lock(Log_event* ev, enum enum_binlog_checksum_alg checksum_alg);
 
@@ -1086,6 +1134,9 @@ class MYSQL_BIN_LOG: public TC_LOG, private Event_log
   int sync_purge_index_file();
   int register_purge_index_entry(const char* entry);
   int register_create_index_entry(const char* entry);
+  bool get_cached_gtid_list(const char *log_name,
+                            Gtid_list_log_event **out_glev);
+  void cache_gtid_list(const char *log_name, const Gtid_list_log_event *glev);
   int purge_index_entry(THD *thd, ulonglong *decrease_log_space,
                         bool need_mutex);
   bool reset_logs(THD* thd, bool create_new_log,
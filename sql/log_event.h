@@ -3527,6 +3527,8 @@ class Gtid_list_log_event: public Log_event
 #ifdef MYSQL_SERVER
   Gtid_list_log_event(rpl_binlog_state *gtid_set, uint32 gl_flags);
   Gtid_list_log_event(slave_connection_state *gtid_set, uint32 gl_flags);
+  Gtid_list_log_event(const rpl_gtid *gtid_list, uint32 gtid_count,
+                      uint32 gl_flags);
 #ifdef HAVE_REPLICATION
   void pack_info(Protocol *protocol) override;
 #endif
@@ -4851,6 +4853,7 @@ class Rows_log_event : public Log_event
   KEY      *m_key_info; /* Pointer to KEY info for m_key_nr */
   uint      m_key_nr;   /* Key number */
   uint      m_usable_key_parts; /* A number of key_parts suited to lookup */
+  class Rows_scan_hash *m_scan_hash; /* Rows of a table without usable key */
   bool master_had_triggers;     /* set after tables opening */
 
   /*
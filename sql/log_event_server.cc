@@ -729,6 +729,40 @@ int Log_event_writer::encrypt_and_write(const uchar *pos, size_t len)
 
   dstsize= encryption_encrypted_length((uint)len, ENCRYPTION_KEY_SYSTEM_DATA,
                                        crypto->key_version);
+
+  /*
+    Once event_len has been written, encrypt straight into the write
+    buffer of the log instead of a temporary buffer that would be copied.
+    The output of the cipher does not depend on how the input is split.
+    The cipher may output up to MY_AES_BLOCK_SIZE-1 bytes that it carried
+    over from earlier calls in addition to the piece.
+  */
+  if (!event_len && file->type == WRITE_CACHE)
+  {
+    const size_t extra= dstsize - len;
+    do
+    {
+      size_t room= (size_t) (file->write_end - file->write_pos);
+      if (room < extra + 2 * MY_AES_BLOCK_SIZE)
+      {
+        if (my_b_flush_io_cache(file, 1))
+          return 1;
+        continue;
+      }
+      size_t piece= MY_MIN(len, (room - extra - MY_AES_BLOCK_SIZE) &
+                           ~size_t{MY_AES_BLOCK_SIZE - 1});
+      if (encryption_ctx_update(ctx, pos, (uint)piece, file->write_pos,
+                                &dstlen))
+        return 1;
+      DBUG_ASSERT(dstlen <= room);
+      file->write_pos+= dstlen;
+      bytes_written+= dstlen;
+      pos+= piece;
+      len-= piece;
+    } while (len);
+    return 0;
+  }
+
   if (!(dst= (uchar*)my_safe_alloca(dstsize)))
     return 1;
 
@@ -3242,6 +3276,19 @@ Gtid_list_log_event::Gtid_list_log_event(rpl_binlog_state *gtid_set,
 }
 
 
+Gtid_list_log_event::Gtid_list_log_event(const rpl_gtid *gtid_list,
+                                         uint32 gtid_count, uint32 gl_flags_)
+  : count(gtid_count), gl_flags(gl_flags_), list(0), sub_id_list(0)
+{
+  cache_type= EVENT_NO_CACHE;
+  /* Failure to allocate memory will be caught by is_valid() returning false. */
+  if (count < (1<<28) &&
+      (list = (rpl_gtid *)my_malloc(PSI_INSTRUMENT_ME,
+                           count * sizeof(*list) + (count == 0), MYF(MY_WME))))
+    memcpy(list, gtid_list, count * sizeof(*list));
+}
+
+
 Gtid_list_log_event::Gtid_list_log_event(slave_connection_state *gtid_set,
                                          uint32 gl_flags_)
   : count(gtid_set->count()), gl_flags(gl_flags_), list(0), sub_id_list(0)
@@ -4611,7 +4658,7 @@ Rows_log_event::Rows_log_event(THD *thd_arg, TABLE *tbl_arg,
 #ifdef HAVE_REPLICATION
     , m_curr_row(NULL), m_curr_row_end(NULL),
     m_key(NULL), m_key_info(NULL), m_key_nr(0),
-    master_had_triggers(0)
+    m_scan_hash(NULL), master_had_triggers(0)
 #endif
 {
   /*
@@ -6754,7 +6801,13 @@ int Rows_log_event::write_row(rpl_group_info *rgi, const bool overwrite)
     else if (m_curr_row == m_curr_row_end)
       estimated_rows= 1;
 
-    table->file->ha_start_bulk_insert(estimated_rows);
+    /*
+      Unless errors are skipped or rows overwritten, a failed row fails the
+      event and the whole transaction is rolled back.
+    */
+    table->file->ha_start_bulk_insert(estimated_rows,
+                                      overwrite || use_slave_mask ? 0 :
+                                      HA_BULK_INSERT_ABORT_ON_ERROR);
   }
 
   /*
@@ -7166,6 +7219,165 @@ static bool record_compare(TABLE *table, bool vers_from_plain= false)
 record_compare_differ:
   return true;
 }
+
+
+/**
+  @brief Computes a hash of the fields of table->record[0] that are
+  compared by record_compare()
+
+  Records that record_compare() considers equal have the same hash.
+*/
+static uint32 record_hash(TABLE *table, bool vers_from_plain)
+{
+  Hasher hasher;
+  bool all_values_set= bitmap_is_set_all(&table->has_value_set);
+
+  for (Field **ptr=table->field ; *ptr ; ptr++)
+  {
+    Field *f= *ptr;
+    if (f->vcol_info)
+      continue;
+    if (table->versioned() && f->vers_sys_field() &&
+        (table->s->primary_key < MAX_KEY ||
+         (vers_from_plain && table->vers_start_field() == f)))
+      continue;
+    if (!all_values_set && !f->has_explicit_value() &&
+        !(vers_from_plain && table->vers_end_field() == f))
+      continue;
+    f->hash(&hasher);
+  }
+  return hasher.finalize();
+}
+
+
+/**
+  Positions of the rows of a table that has no usable key, grouped by
+  record_hash().
+
+  Finding the rows of a multi-row UPDATE or DELETE event by a table scan
+  per row is quadratic. Instead, the table is scanned once when the first
+  row of the event is looked up, and the following rows are read by
+  position. If the positions would need more than max_heap_table_size
+  bytes of memory, they are not remembered and every row is searched by
+  a table scan, as before.
+*/
+class Rows_scan_hash
+{
+  struct Ref
+  {
+    Ref *next;
+    uchar pos[1];
+  };
+  struct Bucket
+  {
+    uint32 hash;
+    Ref *first;
+    Ref **last;
+  };
+
+  MEM_ROOT mem_root;
+  HASH buckets;
+  uint ref_length;
+
+public:
+  /** whether build() gave up because of the memory limit */
+  bool too_big= false;
+
+  Rows_scan_hash(uint ref_length_arg) : ref_length(ref_length_arg)
+  {
+    init_alloc_root(PSI_INSTRUMENT_ME, &mem_root, 8192, 0, MYF(0));
+    my_hash_init(PSI_INSTRUMENT_ME, &buckets, &my_charset_bin, 1024,
+                 offsetof(Bucket, hash), sizeof(uint32), NULL, NULL, 0);
+  }
+  ~Rows_scan_hash()
+  {
+    my_hash_free(&buckets);
+    free_root(&mem_root, MYF(0));
+  }
+
+  /**
+    Scan the table and remember the positions of all its rows.
+    Overwrites table->record[0].
+
+    @param max_size  memory limit; if it is exceeded, set too_big,
+                     forget all rows and return 0
+  */
+  int build(TABLE *table, bool vers_from_plain, size_t max_size)
+  {
+    handler *file= table->file;
+    size_t size= 0;
+    int error;
+    if (unlikely((error= file->ha_rnd_init_with_error(1))))
+      return error;
+    while (!(error= file->ha_rnd_next(table->record[0])))
+    {
+      /* Assume that every row needs a new bucket and HASH record */
+      if ((size+= sizeof(Ref) + ref_length + 2 * sizeof(Bucket)) > max_size)
+      {
+        too_big= true;
+        my_hash_reset(&buckets);
+        free_root(&mem_root, MYF(0));
+        return 0;
+      }
+      uint32 hash= record_hash(table, vers_from_plain);
+      Bucket *bucket= (Bucket*) my_hash_search(&buckets, (uchar*) &hash,
+                                               sizeof hash);
+      if (!bucket)
+      {
+        if (!(bucket= (Bucket*) alloc_root(&mem_root, sizeof *bucket)))
+          return HA_ERR_OUT_OF_MEM;
+        bucket->hash= hash;
+        bucket->first= NULL;
+        bucket->last= &bucket->first;
+        if (my_hash_insert(&buckets, (uchar*) bucket))
+          return HA_ERR_OUT_OF_MEM;
+      }
+      Ref *ref= (Ref*) alloc_root(&mem_root, sizeof(Ref) + ref_length);
+      if (!ref)
+        return HA_ERR_OUT_OF_MEM;
+      file->position(table->record[0]);
+      memcpy(ref->pos, file->ref, ref_length);
+      ref->next= NULL;
+      *bucket->last= ref;
+      bucket->last= &ref->next;
+    }
+    return error == HA_ERR_END_OF_FILE ? 0 : error;
+  }
+
+  /**
+    Find the row that is equal to table->record[1], in scan order.
+    The found row is read to table->record[0] and forgotten, because
+    the caller is going to update or delete it.
+
+    @return HA_ERR_KEY_NOT_FOUND if none of the remembered rows matches
+  */
+  int find(TABLE *table, uint32 hash, bool vers_from_plain)
+  {
+    Bucket *bucket= (Bucket*) my_hash_search(&buckets, (uchar*) &hash,
+                                             sizeof hash);
+    if (!bucket)
+      return HA_ERR_KEY_NOT_FOUND;
+    for (Ref **prev= &bucket->first; *prev; )
+    {
+      Ref *ref= *prev;
+      int error= table->file->ha_rnd_pos(table->record[0], ref->pos);
+      if (!error && record_compare(table, vers_from_plain))
+      {
+        prev= &ref->next;
+        continue;
+      }
+      if (error && error != HA_ERR_KEY_NOT_FOUND &&
+          error != HA_ERR_RECORD_DELETED)
+        return error;
+      /* The row was found, or it no longer exists */
+      if (!(*prev= ref->next))
+        bucket->last= prev;
+      if (!error)
+        return 0;
+    }
+    return HA_ERR_KEY_NOT_FOUND;
+  }
+};
 /**
   Traverses default item expr of a field, and underlying field's default values.
   If it is an extra field and has no value replicated, then its default expr
@@ -7713,6 +7925,57 @@ int Rows_log_event::find_row(rpl_group_info *rgi)
     /* We use this to test that the correct key is used in test cases. */
     DBUG_EXECUTE_IF("slave_crash_if_table_scan", abort(););
 
+    /*
+      If more rows of this event follow, remember the positions of all
+      rows of the table, so that the table is scanned only once.
+    */
+    const uchar *next_row= m_curr_row_end;
+    if (get_general_type_code() == UPDATE_ROWS_EVENT)
+      next_row+= m_curr_row_end - m_curr_row;          // the after image
+    if (!m_scan_hash && next_row < m_rows_end)
+    {
+      if (!(m_scan_hash= new Rows_scan_hash(table->file->ref_length)))
+      {
+        error= HA_ERR_OUT_OF_MEM;
+        goto end;
+      }
+      DBUG_PRINT("info",("building the row hash (rnd_next)"));
+      if (unlikely((error= m_scan_hash->build(table, m_vers_from_plain,
+                                              (size_t) thd->variables.
+                                              max_heap_table_size))))
+      {
+        table->file->print_error(error, MYF(0));
+        table->file->ha_index_or_rnd_end();
+        delete m_scan_hash;
+        m_scan_hash= NULL;
+        goto end;
+      }
+      restore_record(table, record[1]);
+    }
+
+    if (m_scan_hash && !m_scan_hash->too_big)
+    {
+      DBUG_PRINT("info",("locating record using the row hash (rnd_pos)"));
+      is_table_scan= true;
+      if (table->file->inited != handler::RND &&
+          unlikely((error= table->file->ha_rnd_init_with_error(0))))
+        goto end;
+      error= m_scan_hash->find(table, record_hash(table, m_vers_from_plain),
+                               m_vers_from_plain);
+      if (!error)
+        goto end;
+      if (error != HA_ERR_KEY_NOT_FOUND)
+      {
+        table->file->print_error(error, MYF(0));
+        goto end;
+      }
+      /*
+        The row may have been changed by an earlier row of this event.
+        Fall back to the table scan.
+      */
+      restore_record(table, record[1]);
+    }
+
     /* We don't have a key: search the table using rnd_next() */
     if (unlikely((error= table->file->ha_rnd_init_with_error(1))))
     {
@@ -7815,6 +8078,8 @@ int
 Delete_rows_log_event::do_after_row_operations(int error)
 {
   m_table->file->ha_index_or_rnd_end();
+  delete m_scan_hash;
+  m_scan_hash= NULL;
   my_free(m_key);
   m_key= NULL;
   m_key_info= NULL;
@@ -7971,6 +8236,8 @@ Update_rows_log_event::do_after_row_operations(int error)
 {
   /*error= ToDo:find out what this should really be, this triggers close_scan in nbd, returning error?*/
   m_table->file->ha_index_or_rnd_end();
+  delete m_scan_hash;
+  m_scan_hash= NULL;
   my_free(m_key); // Free for multi_malloc
   m_key= NULL;
   m_key_info= NULL;
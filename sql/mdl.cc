@@ -953,7 +953,9 @@ MDL_context::MDL_context()
   m_owner(NULL),
   m_needs_thr_lock_abort(FALSE),
   m_waiting_for(NULL),
-  m_pins(NULL)
+  m_pins(NULL),
+  m_free_tickets(NULL),
+  m_free_tickets_count(0)
 {
   mysql_prlock_init(key_MDL_context_LOCK_waiting_for, &m_LOCK_waiting_for);
 }
@@ -977,6 +979,13 @@ void MDL_context::destroy()
   DBUG_ASSERT(m_tickets[MDL_TRANSACTION].is_empty());
   DBUG_ASSERT(m_tickets[MDL_EXPLICIT].is_empty());
 
+  while (MDL_ticket *ticket= m_free_tickets)
+  {
+    m_free_tickets= ticket->next_in_context;
+    delete ticket;
+  }
+  m_free_tickets_count= 0;
+
   mysql_prlock_destroy(&m_LOCK_waiting_for);
   if (m_pins)
     lf_hash_put_pins(m_pins);
@@ -1064,6 +1073,24 @@ MDL_ticket *MDL_ticket::create(MDL_context *ctx_arg, enum_mdl_type type_arg
 #endif
                                )
 {
+  /*
+    Statements acquire and release a few tickets each, reuse the ones
+    released by the previous statements instead of allocating them.
+  */
+  if (MDL_ticket *ticket= ctx_arg->m_free_tickets)
+  {
+    ctx_arg->m_free_tickets= ticket->next_in_context;
+    ctx_arg->m_free_tickets_count--;
+    DBUG_ASSERT(ticket->m_ctx == ctx_arg);
+    DBUG_ASSERT(!ticket->m_psi);
+#ifndef DBUG_OFF
+    ticket->m_duration= duration_arg;
+#endif
+    ticket->m_time= 0;
+    ticket->m_type= type_arg;
+    ticket->m_lock= NULL;
+    return ticket;
+  }
   return new (std::nothrow)
              MDL_ticket(ctx_arg, type_arg
 #ifndef DBUG_OFF
@@ -1078,6 +1105,14 @@ void MDL_ticket::destroy(MDL_ticket *ticket)
   mysql_mdl_destroy(ticket->m_psi);
   ticket->m_psi= NULL;
 
+  MDL_context *ctx= ticket->m_ctx;
+  if (ctx->m_free_tickets_count < MDL_context::MAX_FREE_TICKETS)
+  {
+    ticket->next_in_context= ctx->m_free_tickets;
+    ctx->m_free_tickets= ticket;
+    ctx->m_free_tickets_count++;
+    return;
+  }
   delete ticket;
 }
 
@@ -1851,7 +1886,10 @@ void MDL_lock::remove_ticket(LF_PINS *pins, Ticket_list MDL_lock::*list,
       reflected in the bitmap might belong to the same context as a
       pending request).
     */
-    reschedule_waiters();
+    if (m_waiting.is_empty())
+      m_hog_lock_count= 0;                // What reschedule_waiters() does
+    else
+      reschedule_waiters();
     mysql_prlock_unlock(&m_rwlock);
   }
 }
@@ -2110,13 +2148,11 @@ MDL_context::try_acquire_lock_impl(MDL_request *mdl_request,
                                    )))
     return TRUE;
 
-  /* The below call implicitly locks MDL_lock::m_rwlock on success. */
-  if (!(lock= mdl_locks.find_or_insert(m_pins, key)))
-  {
-    MDL_ticket::destroy(ticket);
-    return TRUE;
-  }
-
+  /*
+    Everything that does not need the MDL_lock object is done before
+    MDL_lock::m_rwlock is taken, as every statement takes this lock for
+    every table it uses.
+  */
   DBUG_ASSERT(ticket->m_psi == NULL);
   ticket->m_psi= mysql_mdl_create(ticket,
                                   &mdl_request->key,
@@ -2125,13 +2161,20 @@ MDL_context::try_acquire_lock_impl(MDL_request *mdl_request,
                                   MDL_ticket::PENDING,
                                   mdl_request->m_src_file,
                                   mdl_request->m_src_line);
+  if (metadata_lock_info_plugin_loaded)
+    ticket->m_time= microsecond_interval_timer();
+
+  /* The below call implicitly locks MDL_lock::m_rwlock on success. */
+  if (!(lock= mdl_locks.find_or_insert(m_pins, key)))
+  {
+    MDL_ticket::destroy(ticket);
+    return TRUE;
+  }
 
   ticket->m_lock= lock;
 
   if (lock->can_grant_lock(mdl_request->type, this, false))
   {
-    if (metadata_lock_info_plugin_loaded)
-      ticket->m_time= microsecond_interval_timer();
     lock->m_granted.add_ticket(ticket);
 
     mysql_prlock_unlock(&lock->m_rwlock);
@@ -2347,8 +2390,6 @@ MDL_context::acquire_lock(MDL_request *mdl_request, double lock_wait_timeout)
   }
 #endif /* WITH_WSREP */
 
-  if (metadata_lock_info_plugin_loaded)
-    ticket->m_time= microsecond_interval_timer();
   lock->m_waiting.add_ticket(ticket);
 
   /*
@@ -2390,6 +2431,9 @@ MDL_context::acquire_lock(MDL_request *mdl_request, double lock_wait_timeout)
 #endif
 
   DBUG_PRINT("mdl", ("Waiting:  %s", ticket_msg));
+  MYSQL_MDL_WAIT_START(mdl_request->key.mdl_namespace(),
+                       (char *) mdl_request->key.db_name(),
+                       (char *) mdl_request->key.name());
   will_wait_for(ticket);
 
   /* There is a shared or exclusive lock on the object. */
@@ -2434,6 +2478,7 @@ MDL_context::acquire_lock(MDL_request *mdl_request, double lock_wait_timeout)
                                    mdl_request->key.get_wait_state_name());
 
   done_waiting_for();
+  MYSQL_MDL_WAIT_DONE(wait_status != MDL_wait::GRANTED);
 
 #ifdef HAVE_PSI_INTERFACE
   if (locker != NULL)
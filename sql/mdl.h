@@ -1062,6 +1062,15 @@ class MDL_context
   MDL_wait_for_subgraph *m_waiting_for;
   LF_PINS *m_pins;
   uint m_deadlock_overweight;
+  /**
+    Released tickets which are kept for reuse by MDL_ticket::create(),
+    linked through MDL_ticket::next_in_context. Context private.
+  */
+  MDL_ticket *m_free_tickets;
+  uint m_free_tickets_count;
+  /** Maximum number of released tickets to keep in m_free_tickets */
+  static constexpr uint MAX_FREE_TICKETS= 8;
+  friend class MDL_ticket;
 private:
   MDL_ticket *find_ticket(MDL_request *mdl_req,
                           enum_mdl_duration *duration);
@@ -7001,6 +7001,15 @@ static int show_net_compression(THD *thd, SHOW_VAR *var, void *,
   return 0;
 }
 
+static int show_table_locks_immediate(THD *thd, SHOW_VAR *var, void *buff,
+                                      system_status_var *, enum_var_type)
+{
+  var->type= SHOW_LONG;
+  var->value= buff;
+  *((long *) buff)= (long) thr_lock_immediate_count();
+  return 0;
+}
+
 static int show_starttime(THD *thd, SHOW_VAR *var, void *buff,
                           system_status_var *, enum_var_type)
 {
@@ -7628,6 +7637,8 @@ SHOW_VAR status_vars[]= {
   {"Opened_table_definitions", (char*) offsetof(STATUS_VAR, opened_shares), SHOW_LONG_STATUS},
   {"Opened_tables",            (char*) offsetof(STATUS_VAR, opened_tables), SHOW_LONG_STATUS},
   {"Opened_views",             (char*) offsetof(STATUS_VAR, opened_views), SHOW_LONG_STATUS},
+  {"Optimizer_join_order_cache_hits", (char*) offsetof(STATUS_VAR, optimizer_join_order_cache_hits), SHOW_LONG_STATUS},
+  {"Optimizer_join_order_cache_misses", (char*) offsetof(STATUS_VAR, optimizer_join_order_cache_misses), SHOW_LONG_STATUS},
   {"Prepared_stmt_count",      (char*) &show_prepared_stmt_count, SHOW_SIMPLE_FUNC},
   {"Rows_sent",                (char*) offsetof(STATUS_VAR, rows_sent), SHOW_LONGLONG_STATUS},
   {"Rows_read",                (char*) offsetof(STATUS_VAR, rows_read), SHOW_LONGLONG_STATUS},
@@ -7726,7 +7737,7 @@ SHOW_VAR status_vars[]= {
   */
   {"Subquery_cache_hit",       (char*) &subquery_cache_hit,     SHOW_LONG},
   {"Subquery_cache_miss",      (char*) &subquery_cache_miss,    SHOW_LONG},
-  {"Table_locks_immediate",    (char*) &locks_immediate,        SHOW_LONG},
+  {"Table_locks_immediate",    (char*) &show_table_locks_immediate, SHOW_SIMPLE_FUNC},
   {"Table_locks_waited",       (char*) &locks_waited,           SHOW_LONG},
   {"Table_open_cache_active_instances", (char*) &show_tc_active_instances, SHOW_SIMPLE_FUNC},
   {"Table_open_cache_hits",    (char*) offsetof(STATUS_VAR, table_open_cache_hits), SHOW_LONGLONG_STATUS},
@@ -146,6 +146,7 @@ my_bool my_net_init(NET *net, Vio *vio, void *thd, uint my_flags)
   net->last_errno=0;
   net->pkt_nr_can_be_reset= 0;
   net->using_proxy_protocol= 0;
+  net->compress_ctx= 0;
   net->thread_specific_malloc= MY_TEST(my_flags & MY_THREAD_SPECIFIC);
   net->thd= 0;
   net->extension= NULL;
@@ -197,6 +198,10 @@ void net_end(NET *net)
   my_free(net->buff);
   net->buff=0;
   net->using_proxy_protocol= 0;
+#ifdef HAVE_COMPRESS
+  my_compress_ctx_end(net->compress_ctx);
+  net->compress_ctx= 0;
+#endif
   DBUG_VOID_RETURN;
 }
 
@@ -397,6 +402,64 @@ my_bool net_flush(NET *net)
 }
 
 
+/**
+  Give back the memory of a packet buffer that was enlarged by
+  net_realloc() for a big packet. This is done between commands, so that
+  idle connections don't keep buffers of up to max_allowed_packet.
+
+  Nothing is done if the buffer has data that is not sent or not read yet.
+*/
+
+void net_shrink(NET *net, size_t length)
+{
+  uchar *buff;
+  size_t pkt_length= (length+IO_SIZE-1) & ~(IO_SIZE-1);
+  DBUG_ENTER("net_shrink");
+  if (net->max_packet <= pkt_length || net->write_pos != net->buff ||
+      (net->compress && net->remain_in_buf))
+    DBUG_VOID_RETURN;
+
+  if ((buff= (uchar*) my_realloc(key_memory_NET_buff,
+                                 (char*) net->buff, pkt_length +
+                                 NET_HEADER_SIZE + COMP_HEADER_SIZE + 1,
+                                 MYF(net->thread_specific_malloc
+                                     ? MY_THREAD_SPECIFIC : 0))))
+  {
+    net->buff= net->write_pos= net->read_pos= buff;
+    net->buff_end= buff + (net->max_packet= (ulong) pkt_length);
+  }
+  DBUG_VOID_RETURN;
+}
+
+
+/**
+  Flush the end of a response, unless the client has pipelined further
+  commands, i.e the next command is already in the read buffer.
+
+  In the latter case the response stays in write_buffer, and is sent
+  together with the responses to the following commands. This batches
+  responses of many small statements into fewer network writes. The
+  response is sent at the latest when the read buffer is drained and
+  a command completes with nothing else to read.
+
+  Responses are not held back with the compressed protocol, because
+  the compressed packet number is synced with the next command.
+*/
+
+my_bool net_flush_response(NET *net)
+{
+  DBUG_ENTER("net_flush_response");
+  if (!net->compress && net->vio && net->vio->has_data(net->vio) &&
+      net->write_pos != net->buff)
+  {
+    DBUG_PRINT("info", ("next command is pipelined, holding back %lu bytes",
+                        (ulong) (net->write_pos - net->buff)));
+    DBUG_RETURN(0);
+  }
+  DBUG_RETURN(net_flush(net));
+}
+
+
 /*****************************************************************************
 ** Write something to server/client buffer
 *****************************************************************************/
@@ -563,12 +626,19 @@ net_write_command(NET *net,uchar command,
     MAX_PACKET_LENGTH to net_real_write() if we are using the compressed
     protocol as we store the length of the compressed packet in 3 bytes.
 
+  @note
+    Data of at least NET_DIRECT_WRITE_LENGTH bytes (e.g. a row with a
+    large BLOB) is not copied to the cached buffer, even if it would fit
+    there. The buffer is flushed and the data is written from where it is.
+
   @retval
     0	ok
   @retval
     1
 */
 
+#define NET_DIRECT_WRITE_LENGTH (256*1024)
+
 static my_bool
 net_write_buff(NET *net, const uchar *packet, size_t len)
 {
@@ -581,18 +651,30 @@ net_write_buff(NET *net, const uchar *packet, size_t len)
 #ifdef DEBUG_DATA_PACKETS
   DBUG_DUMP("data_written", packet, len);
 #endif
-  if (len > left_length)
+  const bool direct= len >= NET_DIRECT_WRITE_LENGTH;
+  if (len > left_length || direct)
   {
     if (net->write_pos != net->buff)
     {
-      /* Fill up already used packet and write it */
-      memcpy((char*) net->write_pos,packet,left_length);
-      if (net_real_write(net, net->buff, 
-			 (size_t) (net->write_pos - net->buff) + left_length))
-	return 1;
+      if (direct)
+      {
+        /* Write what is cached, the data itself is written below */
+        if (net_real_write(net, net->buff,
+                           (size_t) (net->write_pos - net->buff)))
+          return 1;
+      }
+      else
+      {
+        /* Fill up already used packet and write it */
+        memcpy((char*) net->write_pos,packet,left_length);
+        if (net_real_write(net, net->buff,
+                           (size_t) (net->write_pos - net->buff) +
+                           left_length))
+          return 1;
+        packet+= left_length;
+        len-= left_length;
+      }
       net->write_pos= net->buff;
-      packet+= left_length;
-      len-= left_length;
     }
     if (net->compress)
     {
@@ -609,7 +691,7 @@ net_write_buff(NET *net, const uchar *packet, size_t len)
 	len-= left_length;
       }
     }
-    if (len > net->max_packet)
+    if (len > net->max_packet || direct)
       return net_real_write(net, packet, len) ? 1 : 0;
     /* Send out rest of the blocks as full sized blocks */
   }
@@ -659,11 +741,11 @@ net_real_write(NET *net,const uchar *packet, size_t len)
 #ifdef HAVE_COMPRESS
   if (net->compress)
   {
-    size_t complen;
+    size_t complen= len * 120 / 100 + 12;
     uchar *b;
     uint header_length=NET_HEADER_SIZE+COMP_HEADER_SIZE;
     if (!(b= (uchar*) my_malloc(key_memory_NET_compress_packet,
-                                len + NET_HEADER_SIZE + COMP_HEADER_SIZE + 1,
+                                MY_MAX(len, complen) + header_length + 1,
                                 MYF(MY_WME | (net->thread_specific_malloc
                                               ? MY_THREAD_SPECIFIC : 0)))))
     {
@@ -673,11 +755,23 @@ net_real_write(NET *net,const uchar *packet, size_t len)
       net->reading_or_writing= 0;
       DBUG_RETURN(1);
     }
-    memcpy(b+header_length,packet,len);
 
-    /* Don't compress error packets (compress == 2) */
-    if (net->compress == 2 || my_compress(b+header_length, &len, &complen))
+    /*
+      Compress directly into the packet buffer, reusing the deflate state
+      of the connection. Don't compress error packets (compress == 2).
+    */
+    if (net->compress != 2 && len >= MIN_COMPRESS_LENGTH &&
+        (net->compress_ctx ||
+         (net->compress_ctx= my_compress_ctx_init())) &&
+        !my_compress_ctx(net->compress_ctx, b+header_length, &complen,
+                         packet, len) &&
+        complen < len)
+      swap_variables(size_t, len, complen);
+    else
+    {
+      memcpy(b+header_length,packet,len);
       complen=0;
+    }
     int3store(&b[NET_HEADER_SIZE],complen);
     int3store(b,len);
     b[3]=(uchar) (net->compress_pkt_nr++);
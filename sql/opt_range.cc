@@ -120,6 +120,7 @@
 #include "sql_statistics.h"
 #include "uniques.h"
 #include "my_json_writer.h"
+#include "opt_trace.h"
 
 #ifndef EXTRA_DEBUG
 #define test_rb_tree(A,B) {}
@@ -2774,6 +2775,7 @@ SQL_SELECT::test_quick_select(THD *thd,
   table_info.add_table_name(head);
 
   Json_writer_object trace_range(thd, "range_analysis");
+  Opt_trace_timing trace_time(thd, &trace_range);
   if (unlikely(thd->trace_started()) && read_time != DBL_MAX)
   {
     Json_writer_object table_rec(thd, "table_scan");
@@ -8363,6 +8365,36 @@ SEL_TREE *Item_func_in::get_func_mm_tree(RANGE_OPT_PARAM *param,
   }
   else
   {
+    if (array && array->used_count &&
+        array->type_handler()->result_type() != ROW_RESULT)
+    {
+      /*
+        The array contains the constants sorted and without NULLs. Build
+        the tree from the distinct values in ascending order, so that
+        duplicates in a long IN list do not produce SEL_ARGs that need to
+        be merged again. Like above, a single constant item is reused.
+      */
+      MEM_ROOT *tmp_root= param->mem_root;
+      param->thd->mem_root= param->old_root;
+      Item *value_item= array->create_item(param->thd);
+      param->thd->mem_root= tmp_root;
+
+      if (value_item)
+      {
+        for (uint i= 0; i < array->used_count; i++)
+        {
+          if (i && !array->compare_elems(i, i - 1))
+            continue;
+          array->value_to_item(i, value_item);
+          SEL_TREE *tree2= get_mm_parts(param, field, Item_func::EQ_FUNC,
+                                        value_item);
+          if (!(tree= i ? tree_or(param, tree, tree2) : tree2))
+            break;
+        }
+        DBUG_RETURN(tree);
+      }
+    }
+
     tree= get_mm_parts(param, field, Item_func::EQ_FUNC, args[1]);
     if (tree)
     {
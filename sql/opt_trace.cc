@@ -86,8 +86,8 @@ ST_FIELD_INFO optimizer_trace_info[]=
 /*
   TODO: one-line needs to be implemented seperately
 */
-const char *Opt_trace_context::flag_names[]= {"enabled", "default",
-                                               NullS};
+const char *Opt_trace_context::flag_names[]= {"enabled", "timings",
+                                               "default", NullS};
 
 /*
   Returns if a particular command will be traced or not
@@ -497,6 +497,8 @@ void Opt_trace_start::init(THD *thd,
                thd->variables.optimizer_trace_max_mem_size);
     ctx->set_query(query, query_length, query_charset);
     traceable= TRUE;
+    if (var & Opt_trace_context::FLAG_TIMINGS)
+      start_time= my_interval_timer();
     opt_trace_disable_if_no_tables_access(thd, tbl);
     Json_writer *w= ctx->get_current_json();
     w->start_object();
@@ -510,6 +512,9 @@ Opt_trace_start::~Opt_trace_start()
   {
     Json_writer *w= ctx->get_current_json();
     w->end_array();
+    if (start_time)
+      w->add_member("r_time_ms").
+        add_double(double(my_interval_timer() - start_time) / 1e6);
     w->end_object();
     ctx->end();
     traceable= FALSE;
@@ -75,7 +75,8 @@ struct Opt_trace_info
 class Opt_trace_start
 {
  public:
-  Opt_trace_start(THD *thd_arg): ctx(&thd_arg->opt_trace), traceable(false) {}
+  Opt_trace_start(THD *thd_arg): ctx(&thd_arg->opt_trace), traceable(false),
+    start_time(0) {}
 
   void init(THD *thd, TABLE_LIST *tbl,
             enum enum_sql_command sql_command,
@@ -93,6 +94,41 @@ class Opt_trace_start
     False: otherwise
   */
   bool traceable;
+  /* When the statement started, if optimizer_trace=timings=on */
+  ulonglong start_time;
+};
+
+
+/**
+  Add the time spent in a phase of the optimizer as "r_time_ms" member of
+  the trace object of the phase, when optimizer_trace has timings=on.
+
+  Declare it right after the object and before its "steps" array, so that
+  the member is added after the array is closed:
+
+    Json_writer_object trace_prepare(thd, "join_preparation");
+    Opt_trace_timing trace_time(thd, &trace_prepare);
+    Json_writer_array trace_steps(thd, "steps");
+*/
+
+class Opt_trace_timing
+{
+ public:
+  Opt_trace_timing(THD *thd, Json_writer_object *obj_arg)
+    : obj(unlikely(obj_arg->trace_started()) &&
+          (thd->variables.optimizer_trace &
+           Opt_trace_context::FLAG_TIMINGS) ? obj_arg : nullptr),
+      start_time(obj ? my_interval_timer() : 0) {}
+
+  ~Opt_trace_timing()
+  {
+    if (obj)
+      obj->add("r_time_ms", double(my_interval_timer() - start_time) / 1e6);
+  }
+
+ private:
+  Json_writer_object *const obj;
+  const ulonglong start_time;
 };
 
 /**
@@ -120,7 +120,8 @@ class Opt_trace_context
   enum
   {
     FLAG_DEFAULT = 0,
-    FLAG_ENABLED = 1 << 0
+    FLAG_ENABLED = 1 << 0,
+    FLAG_TIMINGS = 1 << 1
   };
 
 private:
@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2026, MariaDB
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+/*
+  Virtual column substitution.
+
+  If a table has an indexed virtual column
+
+    ALTER TABLE t1 ADD v INT AS (CAST(JSON_VALUE(js, '$.a') AS INT)),
+                   ADD INDEX(v);
+
+  then a condition which uses the column's expression
+
+    WHERE CAST(JSON_VALUE(js, '$.a') AS INT) = 10
+
+  is rewritten into
+
+    WHERE v = 10
+
+  so that the index on v can be used by ref access and the range optimizer.
+  The rewrite is only done when the column can hold every value of the
+  expression, i.e. storing the value in the column does not change it.
+*/
+
+#include "mariadb.h"
+#include "sql_priv.h"
+#include "sql_select.h"
+
+#include "opt_trace.h"
+
+
+/*
+  @brief
+    Check if storing any value of the expression in the virtual column
+    would preserve it.
+*/
+
+static bool vcol_holds_expr_values(Field *field, Item *expr)
+{
+  if (field->type_handler() != expr->type_handler() ||
+      field->decimals() != expr->decimals)
+    return false;
+
+  switch (expr->cmp_type()) {
+  case STRING_RESULT:
+    return field->charset() == expr->collation.collation &&
+           field->char_length() >= expr->max_char_length();
+  case DECIMAL_RESULT:
+    return field->field_length >= expr->max_length;
+  default:
+    return true;
+  }
+}
+
+
+/*
+  @brief
+    Check if the passed item is the expression of an indexed virtual column.
+
+  @return
+    Field item for the virtual column if the item matches
+    NULL otherwise.
+*/
+
+static Item *indexed_vcol_for_expr(THD *thd, Item *item)
+{
+  if (item->type() != Item::FUNC_ITEM || item->const_item())
+    return nullptr;
+
+  table_map map= item->used_tables();
+  if ((map & PSEUDO_TABLE_BITS) || !map || (map & (map - 1)))
+    return nullptr;
+
+  List<Item_field> fields;
+  item->walk(&Item::collect_item_field_processor, 0, &fields);
+  if (!fields.elements)
+    return nullptr;
+
+  TABLE *table= fields.head()->field->table;
+  if (!table->vfield)
+    return nullptr;
+
+  for (Field **vf= table->vfield; *vf; vf++)
+  {
+    Field *field= *vf;
+    if ((field->flags & PART_KEY_FLAG) &&
+        field->vcol_info->expr->eq(item, true) &&
+        vcol_holds_expr_values(field, item))
+    {
+      Item_field *res= new (thd->mem_root) Item_field(thd, field);
+      if (!res)
+        return nullptr;
+      table->mark_column_with_deps(field);
+      return res;
+    }
+  }
+  return nullptr;
+}
+
+
+static void trace_vcol_substitution(THD *thd, Item *old_item, Item *new_item)
+{
+  Json_writer_object trace_wrapper(thd);
+  Json_writer_object obj(thd, "virtual_column_substitution");
+  obj.add("before", old_item)
+     .add("after", new_item);
+}
+
+
+/*
+  @brief
+    Rewrite "vcol_expr CMP expr" into "vcol CMP expr"
+
+  @detail
+    The expression may occur on both sides of the comparison. The column
+    has the same data type as the expression, so the comparator that was
+    set up by fix_fields() stays valid.
+*/
+
+Item *Item_bool_rowready_func2::vcol_subst_transformer(THD *thd, uchar *arg)
+{
+  for (uint i= 0; i < 2; i++)
+  {
+    Item *vcol;
+    if ((vcol= indexed_vcol_for_expr(thd, args[i])))
+    {
+      trace_vcol_substitution(thd, args[i], vcol);
+      thd->change_item_tree(&args[i], vcol);
+      update_used_tables();
+    }
+  }
+  return this;
+}
+
+
+/*
+  @brief
+    Rewrite "vcol_expr IN (list)" into "vcol IN (list)"
+*/
+
+Item *Item_func_in::vcol_subst_transformer(THD *thd, uchar *arg)
+{
+  Item *vcol;
+  if ((vcol= indexed_vcol_for_expr(thd, args[0])))
+  {
+    trace_vcol_substitution(thd, args[0], vcol);
+    thd->change_item_tree(&args[0], vcol);
+    update_used_tables();
+  }
+  return this;
+}
@@ -116,6 +116,15 @@ extern OPTIMIZER_COSTS heap_optimizer_costs, tmp_table_optimizer_costs;
 */
 #define JOIN_CACHE_ROW_COPY_COST_FACTOR(thd) 1.0
 
+/*
+  When a BNL or BNLH join buffer has to be refilled, the rows of the joined
+  table are saved to a temporary file during the first scan and read back
+  from it for the following refills. JOIN_CACHE_SPILL_ROW_COPY_COST_FACTOR
+  is multiplied with ROW_COPY_COST to get the cost of writing or reading
+  one row of the file, to which the disk reads of the file are added.
+*/
+#define JOIN_CACHE_SPILL_ROW_COPY_COST_FACTOR(thd) 1.0
+
 /*
   cost1 is better that cost2 only if cost1 + COST_EPS < cost2
   The main purpose of this is to ensure we use the first index or plan
@@ -284,7 +284,7 @@ Protocol::net_send_ok(THD *thd,
 
   error= my_net_write(net, (const unsigned char*)store.ptr(), store.length());
   if (likely(!error))
-    error= net_flush(net);
+    error= net_flush_response(net);
 
   thd->get_stmt_da()->set_overwrite_status(false);
   DBUG_PRINT("info", ("OK sent, so no more error sending allowed"));
@@ -348,7 +348,8 @@ Protocol::net_send_eof(THD *thd, uint server_status, uint statement_warn_count)
     thd->get_stmt_da()->set_overwrite_status(true);
     error= write_eof_packet(thd, net, server_status, statement_warn_count);
     if (likely(!error))
-      error= net_flush(net);
+      error= thd->get_command() == COM_BINLOG_DUMP ? net_flush(net) :
+                                                     net_flush_response(net);
     thd->get_stmt_da()->set_overwrite_status(false);
     DBUG_PRINT("info", ("EOF sent, so no more error sending allowed"));
   }
@@ -410,6 +410,7 @@ do_gco_wait(rpl_group_info *rgi, group_commit_orderer *gco,
   if (wait_count > entry->count_committing_event_groups)
   {
     DEBUG_SYNC(thd, "rpl_parallel_start_waiting_for_prior");
+    const ulonglong wait_start= microsecond_interval_timer();
     thd->set_time_for_next_stage();
     thd->ENTER_COND(&gco->COND_group_commit_orderer,
                     &entry->LOCK_parallel_entry,
@@ -437,6 +438,7 @@ do_gco_wait(rpl_group_info *rgi, group_commit_orderer *gco,
       mysql_cond_wait(&gco->COND_group_commit_orderer,
                       &entry->LOCK_parallel_entry);
     } while (wait_count > entry->count_committing_event_groups);
+    rgi->rpt->prior_start_wait_time+= microsecond_interval_timer() - wait_start;
   }
 }
 
@@ -949,9 +951,13 @@ retry_event_group(rpl_group_info *rgi, rpl_parallel_thread *rpt,
   mysql_mutex_lock(&rli->data_lock);
   ++rli->retried_trans;
   ++rpt->last_trans_retry_count;
+  ++rpt->trans_retries;
   statistic_increment(slave_retried_transactions, LOCK_status);
   mysql_mutex_unlock(&rli->data_lock);
 
+  if (rgi->speculation == rpl_group_info::SPECULATE_OPTIMISTIC)
+    entry->optimistic_conflicts++;
+
   for (;;)
   {
     mysql_mutex_lock(&entry->LOCK_parallel_entry);
@@ -1023,6 +1029,8 @@ retry_event_group(rpl_group_info *rgi, rpl_parallel_thread *rpt,
   WSREP_DEBUG("parallel slave retry, after trx start");
 
 #endif /* WITH_WSREP */
+  /* The events to retry may still be in the append buffer of the relay log */
+  rli->relay_log.flush_for_readers();
   strmake_buf(log_name, ir->name);
   if ((fd= open_binlog(&rlog, log_name, &errmsg)) <0)
   {
@@ -1598,6 +1606,8 @@ handle_rpl_parallel_thread(void *arg)
       if (end_of_group)
       {
         in_event_group= false;
+        if (!skip_event_group)
+          rpt->transactions_applied++;
         finish_event_group(rpt, event_gtid_sub_id, entry, rgi);
         rpt->loc_free_rgi(rgi);
         thd->rgi_slave= group_rgi= rgi= NULL;
@@ -2252,9 +2262,17 @@ void rpl_group_info::finish_start_alter_event_group()
    finish_event_group(rpt, this->gtid_sub_id, this->parallel_entry, this);
 }
 
+void rpl_group_info::add_prior_commit_wait_time(ulonglong wait_start)
+{
+  if (rpt)
+    rpt->prior_commit_wait_time+= microsecond_interval_timer() - wait_start;
+}
+
 rpl_parallel_thread::rpl_parallel_thread()
   : channel_name_length(0), last_error_number(0), last_error_timestamp(0),
-    worker_idle_time(0), last_trans_retry_count(0), start_time(0)
+    worker_idle_time(0), last_trans_retry_count(0), transactions_applied(0),
+    trans_retries(0), prior_start_wait_time(0), prior_commit_wait_time(0),
+    start_time(0)
 {
 }
 
@@ -2389,6 +2407,10 @@ rpl_parallel_thread_pool::copy_pool_for_pfs(Relay_log_info *rli)
       pfs_rpt->running= false;
       pfs_rpt->worker_idle_time= rpt->get_worker_idle_time();
       pfs_rpt->last_trans_retry_count= rpt->last_trans_retry_count;
+      pfs_rpt->transactions_applied= rpt->transactions_applied;
+      pfs_rpt->trans_retries= rpt->trans_retries;
+      pfs_rpt->prior_start_wait_time= rpt->prior_start_wait_time;
+      pfs_rpt->prior_commit_wait_time= rpt->prior_commit_wait_time;
     }
     pfs_bkp.is_valid= true;
   }
@@ -3492,6 +3514,25 @@ rpl_parallel::do_event(rpl_group_info *serial_rgi, Log_event *ev,
         }
         else
           speculation= rpl_group_info::SPECULATE_OPTIMISTIC;
+
+        if (mode < SLAVE_PARALLEL_AGGRESSIVE)
+        {
+          uint64 conflicts= e->optimistic_conflicts;
+          if (conflicts != e->seen_optimistic_conflicts)
+          {
+            e->seen_optimistic_conflicts= conflicts;
+            e->optimistic_backoff= e->optimistic_backoff_left
+              ? MY_MIN(2 * e->optimistic_backoff,
+                       rpl_parallel_entry::OPTIMISTIC_BACKOFF_MAX)
+              : rpl_parallel_entry::OPTIMISTIC_BACKOFF_MIN;
+            e->optimistic_backoff_left= e->optimistic_backoff;
+          }
+          if (e->optimistic_backoff_left)
+          {
+            e->optimistic_backoff_left--;
+            speculation= rpl_group_info::SPECULATE_WAIT;
+          }
+        }
       }
       gco->flags= flags;
     }
@@ -189,6 +189,20 @@ struct rpl_parallel_thread {
   ulonglong last_error_timestamp;
   ulonglong worker_idle_time;
   ulong last_trans_retry_count;
+  /* Number of event groups applied (not skipped) by this worker. */
+  ulonglong transactions_applied;
+  /* Total number of retries of event groups by this worker. */
+  ulonglong trans_retries;
+  /*
+    Total time in microseconds spent waiting for prior event groups to start
+    committing before this worker could start an event group (do_gco_wait()).
+  */
+  ulonglong prior_start_wait_time;
+  /*
+    Total time in microseconds spent waiting for prior event groups to
+    commit, to preserve the commit order.
+  */
+  ulonglong prior_commit_wait_time;
   ulonglong start_time;
   void start_time_tracker()
   {
@@ -394,6 +408,27 @@ struct rpl_parallel_entry {
   */
   uint64 stop_sub_id;
 
+  /*
+    Back-off of --slave-parallel-mode=optimistic after conflicts.
+
+    optimistic_conflicts is incremented by a worker when an event group
+    that was run speculatively had to be rolled back and retried. When the
+    SQL driver thread notices that, in rpl_parallel::do_event(), the next
+    optimistic_backoff event groups are scheduled with SPECULATE_WAIT
+    instead of SPECULATE_OPTIMISTIC. A conflict while a back-off is still
+    in effect doubles the window (up to OPTIMISTIC_BACKOFF_MAX), so that a
+    hot row does not cause a storm of rollbacks and retries.
+
+    Except for optimistic_conflicts, these are only accessed by the SQL
+    driver thread.
+  */
+  static const uint32 OPTIMISTIC_BACKOFF_MIN= 4;
+  static const uint32 OPTIMISTIC_BACKOFF_MAX= 1024;
+  Atomic_counter<uint64> optimistic_conflicts;
+  uint64 seen_optimistic_conflicts;
+  uint32 optimistic_backoff;
+  uint32 optimistic_backoff_left;
+
   /*
     Array recording the last rpl_thread_max worker threads that we
     queued event for. This is used to limit how many workers a single domain
@@ -1015,6 +1015,13 @@ struct rpl_group_info
     finish_event_group_called= value;
   }
 
+  /*
+    Account the time since wait_start (microsecond_interval_timer()) as
+    spent waiting for a prior event group to commit, if this is a parallel
+    replication worker.
+  */
+  void add_prior_commit_wait_time(ulonglong wait_start);
+
 };
 
 
@@ -560,9 +560,12 @@ class Repl_semi_sync_master
   /* Remove a semi-sync replication slave */
   void remove_slave();
 
-  /* It parses a reply packet and call report_reply_binlog to handle it. */
-  int report_reply_packet(uint32 server_id, const uchar *packet,
-                        ulong packet_len);
+  /* It parses a reply packet; the caller hands the acknowledged position
+   * to report_reply_binlog.
+   */
+  int read_reply_packet(uint32 server_id, const uchar *packet,
+                        ulong packet_len, char *log_file_name,
+                        my_off_t *log_file_pos);
 
   /* In semi-sync replication, reports up to which binlog position we have
    * received replies from the slave indicating that it already get the events.
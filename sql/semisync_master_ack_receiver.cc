@@ -233,6 +233,7 @@ void Ack_receiver::run()
   THD *thd= new THD(next_thread_id());
   NET net;
   unsigned char net_buff[REPLY_MESSAGE_MAX_LENGTH];
+  char reply_file_name[FN_REFLEN+1], ack_file_name[FN_REFLEN+1];
   DBUG_ENTER("Ack_receiver::run");
 
   my_thread_init();
@@ -268,6 +269,9 @@ void Ack_receiver::run()
   {
     int ret, slave_count= 0;
     Slave *slave;
+    my_off_t reply_file_pos, ack_file_pos= 0;
+    uint32 ack_server_id= 0;
+    bool got_ack= false;
 
     mysql_mutex_lock(&m_mutex);
     if (unlikely(m_status != ST_UP))
@@ -354,8 +358,24 @@ void Ack_receiver::run()
         if (likely(len != packet_error))
         {
           int res;
-          res= repl_semisync_master.report_reply_packet(slave->server_id(),
-                                                        net.read_pos, len);
+          res= repl_semisync_master.read_reply_packet(slave->server_id(),
+                                                      net.read_pos, len,
+                                                      reply_file_name,
+                                                      &reply_file_pos);
+          /*
+            Any slave's reply releases all transactions up to its position,
+            so only the most advanced reply of this round is reported.
+          */
+          if (res == 0 &&
+              (!got_ack ||
+               Active_tranx::compare(reply_file_name, reply_file_pos,
+                                     ack_file_name, ack_file_pos) > 0))
+          {
+            strmake_buf(ack_file_name, reply_file_name);
+            ack_file_pos= reply_file_pos;
+            ack_server_id= slave->server_id();
+            got_ack= true;
+          }
           if (unlikely(res < 0))
           {
             /*
@@ -379,6 +399,10 @@ void Ack_receiver::run()
       }
     }
     mysql_mutex_unlock(&m_mutex);
+
+    if (got_ack)
+      repl_semisync_master.report_reply_binlog(ack_server_id, ack_file_name,
+                                               ack_file_pos);
   }
 
 end:
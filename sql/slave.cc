@@ -7033,7 +7033,17 @@ static int queue_event(Master_info* mi, const uchar *buf, ulong event_len)
         int4store(&buf[event_len - BINLOG_CHECKSUM_LEN], crc);
       }
     }
-    if (likely(!rli->relay_log.write_event_buffer((uchar*)buf, event_len)))
+    /*
+      With GTID, relay logs are discarded when the slave restarts, so an
+      event need not be written to the file before the next one arrives
+      and the SQL thread can read it from the append buffer. Without GTID,
+      flush_master_info() needs the event in the file. A semi-sync ACK
+      promises that the event has been written.
+    */
+    const bool flush= mi->using_gtid == Master_info::USE_GTID_NO ||
+                      repl_semisync_slave.get_slave_enabled();
+    if (likely(!rli->relay_log.write_event_buffer((uchar*)buf, event_len,
+                                                  flush)))
     {
       mi->master_log_pos+= inc_pos;
       DBUG_PRINT("info", ("master_log_pos: %lu", (ulong) mi->master_log_pos));
@@ -7489,6 +7499,13 @@ static Log_event* next_event(rpl_group_info *rgi, ulonglong *event_size)
       rli->future_event_relay_log_pos= my_b_tell(cur_log);
       *event_size= rli->future_event_relay_log_pos - old_pos;
 
+      /*
+        Row events have copied their rows out of the event buffer. Don't
+        keep a second copy while the event waits to be applied.
+      */
+      if (ev->logged_status() == LOGGED_ROW_EVENT)
+        ev->free_temp_buf();
+
       if (hot_log)
         mysql_mutex_unlock(log_lock);
       DBUG_RETURN(ev);
@@ -21,6 +21,8 @@
 #endif
 #include "sp_cache.h"
 #include "sp_head.h"
+#include <algorithm>
+#include <vector>
 
 static mysql_mutex_t Cversion_lock;
 static ulong volatile Cversion= 1;
@@ -45,13 +47,17 @@ class sp_cache
   */
   inline bool insert(sp_head *sp)
   {
+    sp->set_sp_cache_last_used(++m_tick);
     return my_hash_insert(&m_hashtable, (const uchar *)sp);
   }
 
   inline sp_head *lookup(char *name, size_t namelen)
   {
-    return (sp_head *) my_hash_search(&m_hashtable, (const uchar *)name,
-                                      namelen);
+    sp_head *sp= (sp_head *) my_hash_search(&m_hashtable, (const uchar *)name,
+                                            namelen);
+    if (sp)
+      sp->set_sp_cache_last_used(++m_tick);
+    return sp;
   }
 
   inline void remove(sp_head *sp)
@@ -60,17 +66,13 @@ class sp_cache
   }
 
   /**
-    Remove all elements from a stored routine cache if the current
-    number of elements exceeds the argument value.
+    Remove the least recently used elements from a stored routine cache
+    if the current number of elements exceeds the argument value.
 
     @param[in] upper_limit_for_elements  Soft upper limit of elements that
                                          can be stored in the cache.
   */
-  void enforce_limit(ulong upper_limit_for_elements)
-  {
-    if (m_hashtable.records > upper_limit_for_elements)
-      my_hash_reset(&m_hashtable);
-  }
+  void enforce_limit(ulong upper_limit_for_elements);
 
 private:
   void init();
@@ -78,6 +80,8 @@ class sp_cache
 
   /* All routines in this cache */
   HASH m_hashtable;
+  /* Incremented on every lookup and insert */
+  ulonglong m_tick= 0;
 public:
   void clear();
 }; // class sp_cache
@@ -317,6 +321,39 @@ sp_cache::cleanup()
   my_hash_free(&m_hashtable);
 }
 
+/*
+  Evicting all routines when the limit is exceeded would make a
+  connection that keeps invoking slightly more than
+  stored_program_cache_size routines parse all of them again and again.
+  Evict only the least recently used ones. This is invoked between
+  statements, when none of the routines can be executing.
+*/
+
+void sp_cache::enforce_limit(ulong upper_limit_for_elements)
+{
+  if (m_hashtable.records <= upper_limit_for_elements)
+    return;
+
+  if (!upper_limit_for_elements)
+  {
+    my_hash_reset(&m_hashtable);
+    return;
+  }
+
+  std::vector<sp_head*> lru;
+  lru.reserve(m_hashtable.records);
+  for (ulong i= 0; i < m_hashtable.records; i++)
+    lru.push_back((sp_head*) my_hash_element(&m_hashtable, i));
+
+  const size_t n_evict= lru.size() - upper_limit_for_elements;
+  std::nth_element(lru.begin(), lru.begin() + n_evict, lru.end(),
+                   [](const sp_head *a, const sp_head *b) {
+                     return a->sp_cache_last_used() < b->sp_cache_last_used();
+                   });
+  for (size_t i= 0; i < n_evict; i++)
+    remove(lru[i]);
+}
+
 void sp_cache::clear()
 {
   my_hash_reset(&m_hashtable);
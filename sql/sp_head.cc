@@ -567,6 +567,7 @@ sp_head::sp_head(MEM_ROOT *mem_root_arg, sp_package *parent,
    m_body_utf8(null_clex_str),
    m_defstr(null_clex_str),
    m_sp_cache_version(0),
+   m_sp_cache_last_used(0),
    m_creation_ctx(0),
    unsafe_flags(0),
    new_query_arena_is_set(false),
@@ -594,6 +595,8 @@ sp_head::sp_head(MEM_ROOT *mem_root_arg, sp_package *parent,
   DBUG_ENTER("sp_head::sp_head");
 
   m_security_ctx.init();
+  m_trigger_ctx_query_id= 0;
+  m_trigger_ctx_invoker= NULL;
   m_backpatch.empty();
   m_backpatch_goto.empty();
   m_cont_backpatch.empty();
@@ -1728,14 +1731,29 @@ sp_head::execute_trigger(THD *thd,
 #ifndef NO_EMBEDDED_ACCESS_CHECKS
   Security_context *save_ctx= NULL;
 
-
-  if (suid() != SP_IS_NOT_SUID &&
-      m_security_ctx.change_security_context(thd,
-                                             &m_definer.user,
-                                             &m_definer.host,
-                                             &m_db,
-                                             &save_ctx))
-    DBUG_RETURN(TRUE);
+  if (suid() == SP_IS_NOT_SUID)
+    ;
+  else if (m_trigger_ctx_query_id == thd->query_id &&
+           m_trigger_ctx_invoker == thd->security_ctx)
+  {
+    /* m_security_ctx was set up for a previous row of this statement. */
+    save_ctx= thd->security_ctx;
+    thd->security_ctx= &m_security_ctx;
+  }
+  else
+  {
+    if (m_security_ctx.change_security_context(thd,
+                                               &m_definer.user,
+                                               &m_definer.host,
+                                               &m_db,
+                                               &save_ctx))
+      DBUG_RETURN(TRUE);
+    if (save_ctx)
+    {
+      m_trigger_ctx_query_id= thd->query_id;
+      m_trigger_ctx_invoker= save_ctx;
+    }
+  }
 
   /*
     Fetch information about table-level privileges for subject table into
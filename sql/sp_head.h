@@ -247,6 +247,15 @@ class sp_head :private Query_arena,
     m_sp_cache_version= version_arg;
   }
 
+  /** @return the tick of the SP cache when the routine was last used */
+  ulonglong sp_cache_last_used() const { return m_sp_cache_last_used; }
+
+  /** Note that the routine was looked up in or inserted into the cache. */
+  void set_sp_cache_last_used(ulonglong tick) const
+  {
+    m_sp_cache_last_used= tick;
+  }
+
   sp_rcontext *rcontext_create(THD *thd, Field *retval, List<Item> *args);
   sp_rcontext *rcontext_create(THD *thd, Field *retval,
                                Item **args, uint arg_count);
@@ -266,6 +275,12 @@ class sp_head :private Query_arena,
     sp_cache_flush_obsolete() will purge it.
   */
   mutable ulong m_sp_cache_version;
+  /**
+    Value of the per-thread tick of the stored routine cache when the
+    routine was last looked up. The least recently used routines are
+    evicted when stored_program_cache_size is exceeded.
+  */
+  mutable ulonglong m_sp_cache_last_used;
   Stored_program_creation_ctx *m_creation_ctx;
   /**
     Boolean combination of (1<<flag), where flag is a member of
@@ -341,6 +356,15 @@ class sp_head :private Query_arena,
   */
   Security_context m_security_ctx;
 
+private:
+  /*
+    The statement and the invoker for which execute_trigger() last
+    switched to m_security_ctx, so that the definer's account need not
+    be looked up again for each row of the statement.
+  */
+  query_id_t m_trigger_ctx_query_id;
+  const Security_context *m_trigger_ctx_invoker;
+
 protected:
   sp_head(MEM_ROOT *mem_root, sp_package *parent, const Sp_handler *handler,
           enum_sp_aggregate_type agg_type);
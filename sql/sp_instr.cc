@@ -303,6 +303,17 @@ sp_lex_keeper::reset_lex_and_exec_core(THD *thd, uint *nextp,
   ots.init(thd, m_lex->query_tables, SQLCOM_SELECT, &m_lex->var_list,
            nullptr, 0, thd->variables.character_set_client);
 
+  /*
+    An expression that refers to no tables and invokes no stored functions,
+    such as the assignment or the loop condition of a computation in a
+    stored routine, cannot open or lock anything. Do not open tables or
+    end the statement transaction for it.
+  */
+  const bool no_tables= open_tables && !m_lex->query_tables &&
+    !m_lex->uses_stored_routines();
+  if (no_tables)
+    open_tables= false;
+
   Json_writer_object trace_command(thd);
   Json_writer_array trace_command_steps(thd, "steps");
   if (open_tables)
@@ -318,7 +329,13 @@ sp_lex_keeper::reset_lex_and_exec_core(THD *thd, uint *nextp,
     Call after unit->cleanup() to close open table
     key read.
   */
-  if (open_tables)
+  if (no_tables)
+  {
+    /* A subquery without tables, such as (SELECT 1), has a unit. */
+    if (m_lex->unit.first_select()->first_inner_unit())
+      m_lex->unit.cleanup();
+  }
+  else if (open_tables)
   {
     m_lex->unit.cleanup();
     /* Here we also commit or rollback the current statement. */
@@ -502,6 +502,54 @@ static void send_read_only_warning(THD *thd, const LEX_CSTRING *msg_status,
 }
 
 
+/**
+  Check if engine-independent statistics of a table need not be collected
+  again, because the table has not been changed since they were collected
+  with the same settings by this server.
+
+  @note
+    The engine must report when the table was last changed. For a
+    partitioned table this is the last change of any partition.
+*/
+
+static bool eits_stats_up_to_date(THD *thd, TABLE *table)
+{
+  TABLE_SHARE *share= table->s;
+  ha_statistics *stats= &table->file->stats;
+  bool res;
+
+  mysql_mutex_lock(&share->LOCK_share);
+  res= share->eits_collect_time &&
+       stats->update_time && stats->update_time < share->eits_collect_time &&
+       stats->records == share->eits_collect_records &&
+       share->eits_histogram_size == thd->variables.histogram_size &&
+       share->eits_histogram_type == thd->variables.histogram_type &&
+       share->eits_ndv_sketch == thd->variables.analyze_ndv_sketch &&
+       thd->variables.sample_percentage == 100;
+  mysql_mutex_unlock(&share->LOCK_share);
+  return res;
+}
+
+
+/**
+  Remember when and with which settings engine-independent statistics
+  of a table were collected, for eits_stats_up_to_date()
+*/
+
+static void eits_stats_collected(THD *thd, TABLE *table, time_t collect_time,
+                                 ha_rows records)
+{
+  TABLE_SHARE *share= table->s;
+  mysql_mutex_lock(&share->LOCK_share);
+  share->eits_collect_time= collect_time;
+  share->eits_collect_records= records;
+  share->eits_histogram_size= thd->variables.histogram_size;
+  share->eits_histogram_type= thd->variables.histogram_type;
+  share->eits_ndv_sketch= thd->variables.analyze_ndv_sketch;
+  mysql_mutex_unlock(&share->LOCK_share);
+}
+
+
 /**
   Collect field names of result set that will be sent to a client
 
@@ -612,6 +660,7 @@ static bool mysql_admin_table(THD* thd, TABLE_LIST* tables,
     bool open_error= 0, recreate_used= 0;
     bool require_data_conversion= 0, require_alter_table= 0;
     bool collect_eis=  FALSE;
+    bool eis_up_to_date= FALSE;
     bool open_for_modify= org_open_for_modify;
     Recreate_info recreate_info;
     int compl_result_code, result_code;
@@ -1079,16 +1128,27 @@ static bool mysql_admin_table(THD* thd, TABLE_LIST* tables,
           }
         }
         /* Ensure that number of records are updated */
-        tab->file->info(HA_STATUS_VARIABLE);
-        memroot_block= get_last_memroot_block(thd->mem_root);
-        if (!(compl_result_code=
-              alloc_statistics_for_table(thd, tab,
-                                         &tab->has_value_set)) &&
-            !(compl_result_code=
-              collect_statistics_for_table(thd, tab)))
-          compl_result_code= update_statistics_for_table(thd, tab);
-        free_statistics_for_table(tab);
-        free_all_new_blocks(thd->mem_root, memroot_block);
+        tab->file->info(HA_STATUS_VARIABLE | HA_STATUS_TIME);
+        bool all_stats= !lex->column_list && !lex->index_list;
+        if (all_stats && thd->variables.analyze_skip_unchanged &&
+            !compl_result_code && eits_stats_up_to_date(thd, tab))
+          eis_up_to_date= true;
+        else
+        {
+          time_t collect_time= my_time(0);
+          ha_rows records= tab->file->stats.records;
+          memroot_block= get_last_memroot_block(thd->mem_root);
+          if (!(compl_result_code=
+                alloc_statistics_for_table(thd, tab,
+                                           &tab->has_value_set)) &&
+              !(compl_result_code=
+                collect_statistics_for_table(thd, tab)) &&
+              !(compl_result_code= update_statistics_for_table(thd, tab)) &&
+              all_stats)
+            eits_stats_collected(thd, tab, collect_time, records);
+          free_statistics_for_table(tab);
+          free_all_new_blocks(thd->mem_root, memroot_block);
+        }
       }
       else
         compl_result_code= HA_ADMIN_FAILED;
@@ -1101,8 +1161,13 @@ static bool mysql_admin_table(THD* thd, TABLE_LIST* tables,
         protocol->store(&table_name, system_charset_info);
         protocol->store(operator_name, system_charset_info);
         protocol->store(&msg_status, system_charset_info);
-	protocol->store(STRING_WITH_LEN("Engine-independent statistics collected"), 
-                        system_charset_info);
+        if (eis_up_to_date)
+          protocol->store(STRING_WITH_LEN("Engine-independent statistics "
+                                          "are up to date"),
+                          system_charset_info);
+        else
+	  protocol->store(STRING_WITH_LEN("Engine-independent statistics collected"), 
+                          system_charset_info);
         if (protocol->write())
           goto err;
       }
@@ -1407,6 +1407,15 @@ void Query_cache::store_query(THD *thd, TABLE_LIST *tables_used)
   DBUG_ASSERT(thd->base_query.is_alloced() ||
               thd->base_query.ptr() == thd->query());
 
+#ifndef EMBEDDED_LIBRARY
+  /*
+    Responses held back by net_flush_response() must not become a part
+    of the cached result.
+  */
+  if (net_flush(&thd->net))
+    DBUG_VOID_RETURN;
+#endif
+
   tables_type= 0;
   if ((local_tables= is_cacheable(thd, thd->lex, tables_used,
 				  &tables_type)))
@@ -1638,6 +1647,10 @@ send_data_in_chunks(NET *net, const uchar *packet, size_t len)
   */
   static const size_t MAX_CHUNK_LENGTH= 1024*1024;
 
+  /* Send responses held back by net_flush_response() first */
+  if (net_flush(net))
+    return TRUE;
+
   while (len > MAX_CHUNK_LENGTH)
   {
     if (net_real_write(net, packet, MAX_CHUNK_LENGTH))
@@ -1720,6 +1733,8 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
   size_t tot_length;
   Query_cache_query_flags flags;
   const char *sql, *sql_end, *found_brace= 0;
+  Query_cache_block *query_block;
+  my_hash_value_type hash_value;
   DBUG_ENTER("Query_cache::send_result_to_client");
 
   /*
@@ -1876,22 +1891,10 @@ Query_cache::send_result_to_client(THD *thd, char *org_sql, uint query_length)
     }
   }
   /*
-    Try to obtain an exclusive lock on the query cache. If the cache is
-    disabled or if a full cache flush is in progress, the attempt to
-    get the lock is aborted.
-
-    The TIMEOUT parameter indicate that the lock is allowed to timeout.
+    The key of the query and its hash value only depend on this
+    connection, so they are computed before structure_guard_mutex is
+    taken to keep the time that the mutex is held short.
   */
-  if (try_lock(thd, Query_cache::TIMEOUT))
-    goto err;
-
-  if (query_cache_size == 0)
-  {
-    thd->query_cache_is_applicable= 0;            // Query can't be cached
-    goto err_unlock;
-  }
-
-  Query_cache_block *query_block;
   if (thd->variables.query_cache_strip_comments)
   {
     if (found_brace)
@@ -1980,6 +1983,23 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
                           (int)flags.autocommit));
   memcpy((uchar *)(sql + (tot_length - QUERY_CACHE_FLAGS_SIZE)),
 	 (uchar*) &flags, QUERY_CACHE_FLAGS_SIZE);
+  hash_value= my_calc_hash(&queries, (uchar*) sql, tot_length);
+
+  /*
+    Try to obtain an exclusive lock on the query cache. If the cache is
+    disabled or if a full cache flush is in progress, the attempt to
+    get the lock is aborted.
+
+    The TIMEOUT parameter indicate that the lock is allowed to timeout.
+  */
+  if (try_lock(thd, Query_cache::TIMEOUT))
+    goto err;
+
+  if (query_cache_size == 0)
+  {
+    thd->query_cache_is_applicable= 0;            // Query can't be cached
+    goto err_unlock;
+  }
 
 #ifdef WITH_WSREP
   bool once_more;
@@ -1987,8 +2007,9 @@ def_week_frmt: %zu, in_trans: %d, autocommit: %d",
 lookup:
 #endif /* WITH_WSREP */
 
-  query_block = (Query_cache_block *)  my_hash_search(&queries, (uchar*) sql,
-                                                      tot_length);
+  query_block= (Query_cache_block *)
+    my_hash_search_using_hash_value(&queries, hash_value, (uchar*) sql,
+                                    tot_length);
   /* Quick abort on unlocked data */
   if (query_block == 0 ||
       query_block->query()->result() == 0 ||
@@ -2655,8 +2676,9 @@ size_t Query_cache::init_cache()
     goto err;
   query_cache_size -= additional_data_size;
 
-  if (!(cache= (uchar *)
-        my_malloc_lock(query_cache_size+additional_data_size, MYF(0))))
+  /* The cache is one big block that is accessed randomly, use large pages */
+  cache_mem_size= query_cache_size + additional_data_size;
+  if (!(cache= my_large_malloc(&cache_mem_size, MYF(0))))
     goto err;
 #if defined(DBUG_OFF) && defined(HAVE_MADVISE) &&  defined(MADV_DONTDUMP)
   if (madvise(cache, query_cache_size+additional_data_size, MADV_DONTDUMP))
@@ -2780,6 +2802,7 @@ void Query_cache::make_disabled()
   bins= 0;
   steps= 0;
   cache= 0;
+  cache_mem_size= 0;
   mem_bin_num= mem_bin_steps= 0;
   queries_in_cache= 0;
   first_block= 0;
@@ -2832,7 +2855,8 @@ void Query_cache::free_cache()
 			 strerror(errno)));
   }
 #endif
-  my_free(cache);
+  if (cache)
+    my_large_free(cache, cache_mem_size);
   make_disabled();
   my_hash_free(&queries);
   my_hash_free(&tables);
@@ -339,6 +339,7 @@ class Query_cache
   mysql_mutex_t structure_guard_mutex;
   size_t additional_data_size;
   uchar *cache;					// cache memory
+  size_t cache_mem_size;			// allocated size of cache
   Query_cache_block *first_block;		// physical location block list
   Query_cache_block *queries_blocks;		// query list (LIFO)
   Query_cache_block *tables_blocks;
@@ -853,14 +853,18 @@ THD::THD(my_thread_id id, bool is_wsrep_applier)
   profiling.set_thd(this);
 #endif
   user_connect=(USER_CONN *)0;
-  my_hash_init(key_memory_user_var_entry, &user_vars,
-               Lex_ident_user_var::charset_info(),
-               USER_VARS_HASH_SIZE, 0, 0, (my_hash_get_key) get_var_key,
-               (my_hash_free_key) free_user_var, HASH_THREAD_SPECIFIC);
-  my_hash_init(PSI_INSTRUMENT_ME, &sequences, Lex_ident_fs::charset_info(),
-               SEQUENCES_HASH_SIZE, 0, 0, (my_hash_get_key)
-               get_sequence_last_key, (my_hash_free_key) free_sequence_last,
-               HASH_THREAD_SPECIFIC);
+  /*
+    Most connections never use user variables or sequences, so the
+    hashes allocate their memory only on the first insert.
+  */
+  my_hash_init2(key_memory_user_var_entry, &user_vars, USER_VARS_HASH_SIZE,
+                Lex_ident_user_var::charset_info(),
+                0, 0, 0, (my_hash_get_key) get_var_key, 0,
+                (my_hash_free_key) free_user_var, HASH_THREAD_SPECIFIC);
+  my_hash_init2(PSI_INSTRUMENT_ME, &sequences, SEQUENCES_HASH_SIZE,
+                Lex_ident_fs::charset_info(),
+                0, 0, 0, (my_hash_get_key) get_sequence_last_key, 0,
+                (my_hash_free_key) free_sequence_last, HASH_THREAD_SPECIFIC);
 
   /* For user vars replication*/
   if (opt_bin_log)
@@ -1493,15 +1497,14 @@ void THD::change_user(void)
 
   init();
   stmt_map.reset();
-  my_hash_init(key_memory_user_var_entry, &user_vars,
-               Lex_ident_user_var::charset_info(),
-               USER_VARS_HASH_SIZE, 0, 0, (my_hash_get_key) get_var_key,
-               (my_hash_free_key) free_user_var, HASH_THREAD_SPECIFIC);
-  my_hash_init(key_memory_user_var_entry, &sequences,
-               Lex_ident_fs::charset_info(),
-               SEQUENCES_HASH_SIZE, 0, 0, (my_hash_get_key)
-               get_sequence_last_key, (my_hash_free_key) free_sequence_last,
-               HASH_THREAD_SPECIFIC);
+  my_hash_init2(key_memory_user_var_entry, &user_vars, USER_VARS_HASH_SIZE,
+                Lex_ident_user_var::charset_info(),
+                0, 0, 0, (my_hash_get_key) get_var_key, 0,
+                (my_hash_free_key) free_user_var, HASH_THREAD_SPECIFIC);
+  my_hash_init2(key_memory_user_var_entry, &sequences, SEQUENCES_HASH_SIZE,
+                Lex_ident_fs::charset_info(),
+                0, 0, 0, (my_hash_get_key) get_sequence_last_key, 0,
+                (my_hash_free_key) free_sequence_last, HASH_THREAD_SPECIFIC);
   sp_caches_clear();
   opt_trace.delete_traces();
 }
@@ -4228,14 +4231,15 @@ Statement_map::Statement_map() :
     START_STMT_HASH_SIZE = 16,
     START_NAME_HASH_SIZE = 16
   };
-  my_hash_init(key_memory_prepared_statement_map, &st_hash, &my_charset_bin,
-               START_STMT_HASH_SIZE, 0, 0, get_statement_id_as_hash_key,
-               delete_statement_as_hash_key, MYF(0));
-  my_hash_init(key_memory_prepared_statement_map, &names_hash,
-               Lex_ident_ps::charset_info(),
-               START_NAME_HASH_SIZE, 0, 0,
-               (my_hash_get_key) get_stmt_name_hash_key,
-               NULL, MYF(0));
+  /* Allocated on the first prepared statement, most connections have none */
+  my_hash_init2(key_memory_prepared_statement_map, &st_hash,
+                START_STMT_HASH_SIZE, &my_charset_bin, 0, 0, 0,
+                get_statement_id_as_hash_key, 0,
+                delete_statement_as_hash_key, MYF(0));
+  my_hash_init2(key_memory_prepared_statement_map, &names_hash,
+                START_NAME_HASH_SIZE, Lex_ident_ps::charset_info(), 0, 0, 0,
+                (my_hash_get_key) get_stmt_name_hash_key, 0,
+                NULL, MYF(0));
 }
 
 
@@ -4550,6 +4554,7 @@ void TMP_TABLE_PARAM::init()
   materialized_subquery= 0;
   force_not_null_cols= 0;
   skip_create_table= 0;
+  last_group_found= 0;
   tmp_name= "temptable";                        // Name of temp table on disk
   DBUG_VOID_RETURN;
 }
@@ -8205,6 +8210,7 @@ wait_for_commit::wait_for_prior_commit2(THD *thd, bool allow_kill)
     thd->backup_commit_lock->ticket= 0;
   }
 
+  const ulonglong wait_start= microsecond_interval_timer();
   mysql_mutex_lock(&LOCK_wait_commit);
   DEBUG_SYNC(thd, "wait_for_prior_commit_waiting");
   thd->ENTER_COND(&COND_wait_commit, &LOCK_wait_commit,
@@ -8260,6 +8266,8 @@ wait_for_commit::wait_for_prior_commit2(THD *thd, bool allow_kill)
 
 end:
   thd->EXIT_COND(&old_stage);
+  if (thd->rgi_slave)
+    thd->rgi_slave->add_prior_commit_wait_time(wait_start);
   if (unlikely(backup_lock_released))
     thd->mdl_context.acquire_lock(thd->backup_commit_lock,
                                   thd->variables.lock_wait_timeout);
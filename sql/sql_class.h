@@ -743,6 +743,8 @@ typedef struct system_variables
   double optimizer_where_cost, optimizer_scan_setup_cost;
   double long_query_time_double, max_statement_time_double;
   double sample_percentage;
+  my_bool analyze_ndv_sketch;
+  my_bool analyze_skip_unchanged;
 
   ha_rows select_limit;
   ha_rows max_join_size;
@@ -804,6 +806,7 @@ typedef struct system_variables
   ulong range_alloc_block_size;
   ulong query_alloc_block_size;
   ulong query_prealloc_size;
+  ulong query_alloc_keep_size;
   ulong trans_alloc_block_size;
   ulong trans_prealloc_size;
   ulong log_warnings;
@@ -869,6 +872,8 @@ typedef struct system_variables
   my_bool binlog_direct_non_trans_update;
   my_bool column_compression_zlib_wrap;
   my_bool sysdate_is_now;
+  my_bool optimizer_join_order_cache;
+  my_bool optimizer_vcol_substitution;
   my_bool wsrep_on;
   my_bool wsrep_dirty_reads;
   my_bool pseudo_slave_mode;
@@ -1001,6 +1006,8 @@ typedef struct system_status_var
   ulong filesort_scan_count_;
   ulong filesort_pq_sorts_;
   ulong optimizer_join_prefixes_check_calls;
+  ulong optimizer_join_order_cache_hits;
+  ulong optimizer_join_order_cache_misses;
 
   /* Features used */
   ulong feature_custom_aggregate_functions; /* +1 when custom aggregate
@@ -5857,6 +5864,19 @@ class THD: public THD_count, /* this must be first */
       thr_timer_end(&query_timer);
 #endif
   }
+  /**
+    Limit the size of a buffer that can spill to disk (sort buffer, join
+    buffer, in-memory temporary table) to half of the memory the session
+    may still allocate before it reaches max_session_mem_used, so that a
+    big query spills early instead of being killed.
+  */
+  ulonglong limit_spill_buffer_size(ulonglong size) const
+  {
+    ulonglong used= (ulonglong) MY_MAX(status_var.local_memory_used, 0);
+    ulonglong left= variables.max_mem_used > used ?
+                    variables.max_mem_used - used : 0;
+    return MY_MIN(size, left / 2);
+  }
   bool restore_set_statement_var()
   {
     return main_lex.restore_set_statement_var();
@@ -6673,6 +6693,8 @@ class TMP_TABLE_PARAM :public Sql_alloc
   List<Item> copy_funcs;
   Copy_field *copy_field, *copy_field_end;
   uchar	    *group_buff;
+  /* Copy of group_buff for the group that end_update() updated last */
+  uchar	    *last_group_buff;
   const char *tmp_name;
   Item	    **items_to_copy;			/* Fields in tmp table */
   TMP_ENGINE_COLUMNDEF *recinfo, *start_recinfo;
@@ -6747,6 +6769,11 @@ class TMP_TABLE_PARAM :public Sql_alloc
     TRUE <=> create_tmp_table will create only the TABLE structure.
   */
   bool skip_create_table;
+  /*
+    TRUE <=> the handler is positioned on the group in last_group_buff and
+    table->record[1] holds its contents (see end_update()).
+  */
+  bool last_group_found;
 
   TMP_TABLE_PARAM()
     :copy_field(0), group_parts(0),
@@ -265,6 +265,7 @@ class With_element : public Sql_alloc
   bool is_hanging_recursive() { return is_recursive && !rec_outer_references; }
 
   void inc_references() { references++; }
+  uint get_references() { return references; }
 
   bool process_columns_of_derived_unit(THD *thd, st_select_lex_unit *unit);
 
@@ -1173,6 +1173,140 @@ bool TABLE_LIST::fill_recursive(THD *thd)
 }
 
 
+/*
+  @brief
+    Check if the rows of a CTE or view reference do not depend on how it
+    is used
+
+  @details
+    The rows of a materialized reference to a non-recursive CTE or to a
+    view are the same for all references unless conditions have been pushed
+    into the specification, the reference is split-materialized or its
+    specification depends on the outer query.
+*/
+
+static bool derived_rows_are_shareable(TABLE_LIST *tbl)
+{
+  if ((!tbl->with && !tbl->is_view()) || tbl->is_recursive_with_table() ||
+      tbl->is_nonrecursive_derived_with_rec_ref() ||
+      !tbl->is_materialized_derived() || tbl->pushdown_derived ||
+      !tbl->table || !tbl->table->is_created() ||
+      tbl->table->is_splittable())
+    return false;
+
+  SELECT_LEX_UNIT *unit= tbl->get_unit();
+  if (unit->uncacheable || unit->describe)
+    return false;
+  for (SELECT_LEX *sl= unit->first_select(); sl; sl= sl->next_select())
+  {
+    if (sl->cond_pushed_into_where || sl->cond_pushed_into_having)
+      return false;
+  }
+  return true;
+}
+
+
+/*
+  @brief
+    Check if two derived tables are references to the same CTE or view
+*/
+
+static bool same_derived_spec(TABLE_LIST *t1, TABLE_LIST *t2)
+{
+  if (t1->with || t2->with)
+    return t1->with == t2->with;
+  return t1->is_view() && t2->is_view() &&
+         !cmp(&t1->view_db, &t2->view_db) &&
+         !cmp(&t1->view_name, &t2->view_name);
+}
+
+
+/*
+  @brief
+    Check if two materialized tables have the same record format
+*/
+
+static bool same_record_format(TABLE *t1, TABLE *t2)
+{
+  if (t1->s->fields != t2->s->fields || t1->s->reclength != t2->s->reclength)
+    return false;
+  for (uint i= 0; i < t1->s->fields; i++)
+  {
+    Field *f1= t1->field[i], *f2= t2->field[i];
+    if (f1->type_handler() != f2->type_handler() ||
+        f1->pack_length() != f2->pack_length() ||
+        f1->offset(t1->record[0]) != f2->offset(t2->record[0]) ||
+        f1->null_bit != f2->null_bit ||
+        (f1->null_ptr ? f1->null_ptr - t1->record[0] : -1) !=
+        (f2->null_ptr ? f2->null_ptr - t2->record[0] : -1) ||
+        f1->charset() != f2->charset())
+      return false;
+  }
+  return true;
+}
+
+
+/*
+  @brief
+    Reset the field translation of a derived table to its materialized table
+*/
+
+static bool reset_derived_field_translation(THD *thd, TABLE_LIST *derived)
+{
+  Field_iterator_table field_iterator;
+  field_iterator.set_table(derived->table);
+  for (uint i= 0;
+       !field_iterator.end_of_fields();
+       field_iterator.next(), i= i + 1)
+  {
+    Item *item;
+
+    if (!(item= field_iterator.create_item(thd)))
+      return true;
+    thd->change_item_tree(&derived->field_translation[i].item, item);
+  }
+  return false;
+}
+
+
+/*
+  @brief
+    Copy the rows of a just materialized CTE or view reference to other
+    references
+
+  @details
+    A non-recursive CTE or a view that is referenced several times has a
+    copy of its specification for every reference. Instead of executing
+    each copy, the rows of the first materialized reference are copied into
+    the tables of the other references that have already been created, so
+    the specification is executed only once.
+*/
+
+static bool share_derived_rows_with_other_refs(THD *thd, TABLE_LIST *derived)
+{
+  for (TABLE_LIST *tbl= thd->lex->query_tables; tbl; tbl= tbl->next_global)
+  {
+    SELECT_LEX_UNIT *unit;
+    if (tbl == derived || !same_derived_spec(derived, tbl) ||
+        !derived_rows_are_shareable(tbl) ||
+        (unit= tbl->get_unit())->executed ||
+        !same_record_format(derived->table, tbl->table))
+      continue;
+
+    if (derived->table->insert_all_rows_into_tmp_table(thd, tbl->table,
+                                        &tbl->derived_result->tmp_table_param,
+                                        false))
+      return true;
+    derived->table->file->ha_rnd_end();
+    unit->executed= TRUE;
+    if (tbl->field_translation && reset_derived_field_translation(thd, tbl))
+      return true;
+    unit->cleanup();
+  }
+  return false;
+}
+
+
 /*
   Execute subquery of a materialized derived table/view and fill the result
   table.
@@ -1200,7 +1334,6 @@ bool TABLE_LIST::fill_recursive(THD *thd)
 static
 bool mysql_derived_fill(THD *thd, LEX *lex, TABLE_LIST *derived)
 {
-  Field_iterator_table field_iterator;
   SELECT_LEX_UNIT *unit= derived->get_unit();
   bool derived_is_recursive= derived->is_recursive_with_table();
   bool res= FALSE;
@@ -1300,24 +1433,17 @@ bool mysql_derived_fill(THD *thd, LEX *lex, TABLE_LIST *derived)
       res= TRUE;
     unit->executed= TRUE;
 
-    if (derived->field_translation)
-    {
-      /* reset translation table to materialized table */
-      field_iterator.set_table(derived->table);
-      for (uint i= 0;
-           !field_iterator.end_of_fields();
-           field_iterator.next(), i= i + 1)
-      {
-        Item *item;
+    /* reset translation table to materialized table */
+    if (derived->field_translation &&
+        reset_derived_field_translation(thd, derived))
+      res= TRUE;
 
-        if (!(item= field_iterator.create_item(thd)))
-        {
-          res= TRUE;
-          break;
-        }
-        thd->change_item_tree(&derived->field_translation[i].item, item);
-      }
-    }
+    if (!res && !lex->describe && !lex->analyze_stmt &&
+        (derived->with ? derived->with->get_references() > 1 :
+                         derived->is_view()) &&
+        derived_rows_are_shareable(derived) &&
+        share_derived_rows_with_other_refs(thd, derived))
+      res= TRUE;
   }
 err:
   if (res || (!derived_is_recursive && !lex->describe && !unit->uncacheable))
@@ -1937,6 +1937,9 @@ static void trace_engine_stats(handler *file, Json_writer *writer)
       writer->add_member("pages_prefetch_read_count").add_ull(hs->pages_prefetched);
     if (hs->undo_records_read)
       writer->add_member("old_rows_read").add_ull(hs->undo_records_read);
+    if (hs->lock_wait_time)
+      writer->add_member("lock_wait_time_ms").
+        add_double(hs->lock_wait_time * 1000. / timer_tracker_frequency());
     writer->end_object();
   }
 }
@@ -16,13 +16,9 @@
 #include "mariadb.h"
 #include "sql_base.h"
 #include "sql_select.h"
+#include "key.h"
 #include "sql_expression_cache.h"
 
-/**
-  Minimum hit ration to proceed on disk if in memory table overflowed.
-  hit_rate = hit / (miss + hit);
-*/
-#define EXPCACHE_MIN_HIT_RATE_FOR_DISK_TABLE 0.7
 /**
   Minimum hit ratio to keep in memory table (do not switch cache off)
   hit_rate = hit / (miss + hit);
@@ -33,6 +29,10 @@
   impact in the case when the cache is not applicable)
 */
 #define EXPCACHE_CHECK_HIT_RATIO_AFTER 200
+/**
+  Initial number of hash buckets
+*/
+#define EXPCACHE_INITIAL_BUCKETS 64
 
 /*
   Expression cache is used only for caching subqueries now, so its statistic
@@ -43,10 +43,14 @@ ulong subquery_cache_miss, subquery_cache_hit;
 Expression_cache_tmptable::Expression_cache_tmptable(THD *thd,
                                                      List<Item> &dependants,
                                                      Item *value)
-  :cache_table(NULL), table_thd(thd), tracker(NULL), items(dependants), val(value),
+  :cache_table(NULL), table_thd(thd), tracker(NULL),
+   buckets(NULL), n_buckets(0), n_entries(0), used_memory(0),
+   last_key_valid(0), items(dependants), val(value),
    hit(0), miss(0), inited (0)
 {
   DBUG_ENTER("Expression_cache_tmptable::Expression_cache_tmptable");
+  init_sql_alloc(PSI_INSTRUMENT_ME, &entries_root, 8192, 0,
+                 MYF(MY_THREAD_SPECIFIC));
   DBUG_VOID_RETURN;
 };
 
@@ -57,16 +61,66 @@ Expression_cache_tmptable::Expression_cache_tmptable(THD *thd,
 
 void Expression_cache_tmptable::disable_cache()
 {
-  if (cache_table->file->inited)
-    cache_table->file->ha_index_end();
   free_tmp_table(table_thd, cache_table);
   cache_table= NULL;
+  my_free(buckets);
+  buckets= NULL;
+  n_buckets= n_entries= 0;
+  used_memory= 0;
+  free_root(&entries_root, MYF(0));
   update_tracker();
   if (tracker)
     tracker->detach_from_cache();
 }
 
 
+/**
+  Remove all entries from the hash
+*/
+
+void Expression_cache_tmptable::clear_hash()
+{
+  bzero(buckets, n_buckets * sizeof(*buckets));
+  n_entries= 0;
+  used_memory= 0;
+  free_root(&entries_root, MYF(MY_MARK_BLOCKS_FREE));
+}
+
+
+/**
+  Double the number of hash buckets
+
+  @retval FALSE OK
+  @retval TRUE  Out of memory
+*/
+
+bool Expression_cache_tmptable::grow_hash()
+{
+  ulong new_n_buckets= n_buckets ? n_buckets * 2 : EXPCACHE_INITIAL_BUCKETS;
+  Entry **new_buckets= (Entry**) my_malloc(PSI_INSTRUMENT_ME,
+                                           new_n_buckets * sizeof(Entry*),
+                                           MYF(MY_THREAD_SPECIFIC |
+                                               MY_ZEROFILL));
+  if (!new_buckets)
+    return TRUE;
+  for (ulong i= 0; i < n_buckets; i++)
+  {
+    Entry *next;
+    for (Entry *entry= buckets[i]; entry; entry= next)
+    {
+      next= entry->next;
+      Entry **bucket= new_buckets + (entry->hash_value & (new_n_buckets - 1));
+      entry->next= *bucket;
+      *bucket= entry;
+    }
+  }
+  my_free(buckets);
+  buckets= new_buckets;
+  n_buckets= new_n_buckets;
+  return FALSE;
+}
+
+
 /**
   Field enumerator for TABLE::add_tmp_key
 
@@ -132,7 +186,11 @@ void Expression_cache_tmptable::init()
     DBUG_VOID_RETURN;
   }
 
-  if (cache_table->s->db_type() != heap_hton)
+  /*
+    Records are copied into the hash as they are, so they must not refer
+    to blobs.
+  */
+  if (cache_table->s->db_type() != heap_hton || cache_table->s->blob_fields)
   {
     DBUG_PRINT("error", ("we need only heap table"));
     goto error;
@@ -156,10 +214,11 @@ void Expression_cache_tmptable::init()
   ref.has_record= 0;
   ref.use_count= 0;
 
-
-  if (open_tmp_table(cache_table))
+  max_memory= (size_t) MY_MIN(table_thd->variables.tmp_memory_table_size,
+                              table_thd->variables.max_heap_table_size);
+  if (grow_hash())
   {
-    DBUG_PRINT("error", ("Opening (creating) temporary table failed"));
+    DBUG_PRINT("error", ("Allocating the hash failed"));
     goto error;
   }
 
@@ -194,6 +253,7 @@ Expression_cache_tmptable::~Expression_cache_tmptable()
       tracker->detach_from_cache();
     tracker= NULL;
   }
+  free_root(&entries_root, MYF(0));
 }
 
 
@@ -214,17 +274,31 @@ Expression_cache_tmptable::~Expression_cache_tmptable()
 
 Expression_cache::result Expression_cache_tmptable::check_value(Item **value)
 {
-  int res;
   DBUG_ENTER("Expression_cache_tmptable::check_value");
 
   if (cache_table)
   {
-    DBUG_PRINT("info", ("status: %u  has_record %u",
-                        (uint)cache_table->status, (uint)ref.has_record));
-    if ((res= join_read_key2(table_thd, NULL, cache_table, &ref)) == 1)
-      DBUG_RETURN(ERROR);
+    Entry *entry= NULL;
+    /* A NULL in the first parameter is never found, as in a ref access */
+    if (!(last_key_valid= !cp_buffer_from_ref(table_thd, cache_table, &ref)))
+    {
+      if (table_thd->is_error())
+        DBUG_RETURN(ERROR);
+    }
+    else
+    {
+      KEY *key_info= cache_table->key_info;
+      last_hash_value= key_hashnr(key_info, ref.key_parts, ref.key_buff);
+      for (entry= buckets[last_hash_value & (n_buckets - 1)];
+           entry &&
+           (entry->hash_value != last_hash_value ||
+            key_buf_cmp(key_info, ref.key_parts, entry_key(entry),
+                        ref.key_buff));
+           entry= entry->next)
+      {}
+    }
 
-    if (res)
+    if (!entry)
     {
       if (((++miss) == EXPCACHE_CHECK_HIT_RATIO_AFTER) &&
           ((double)hit / ((double)hit + miss)) <
@@ -239,6 +313,8 @@ Expression_cache::result Expression_cache_tmptable::check_value(Item **value)
     }
 
     hit++;
+    memcpy(cache_table->record[0], entry_record(entry),
+           cache_table->s->reclength);
     *value= cached_result;
     DBUG_RETURN(Expression_cache::HIT);
   }
@@ -261,7 +337,8 @@ Expression_cache::result Expression_cache_tmptable::check_value(Item **value)
 
 my_bool Expression_cache_tmptable::put_value(Item *value)
 {
-  int error;
+  Entry *entry, **bucket;
+  size_t entry_size;
   DBUG_ENTER("Expression_cache_tmptable::put_value");
   DBUG_ASSERT(inited);
 
@@ -275,51 +352,48 @@ my_bool Expression_cache_tmptable::put_value(Item *value)
   fill_record(table_thd, cache_table, cache_table->field, items, true, true,
               true);
   if (unlikely(table_thd->is_error()))
-    goto err2;
+    goto err;
 
-  if (unlikely((error=
-                cache_table->file->ha_write_tmp_row(cache_table->record[0]))))
+  if (!last_key_valid)
   {
-    /* create_myisam_from_heap will generate error if needed */
-    if (cache_table->file->is_fatal_error(error, HA_CHECK_DUP) &&
-        error != HA_ERR_RECORD_FILE_FULL)
-      goto err;
-    else
+    DBUG_PRINT("info", ("the entry could never be found"));
+    DBUG_RETURN(FALSE);
+  }
+
+  entry_size= sizeof(Entry) + ALIGN_SIZE(ref.key_length) +
+              cache_table->s->reclength;
+  if (used_memory + n_buckets * sizeof(Entry*) + entry_size > max_memory)
+  {
+    double hit_rate= ((double)hit / ((double)hit + miss));
+    DBUG_ASSERT(miss > 0);
+    if (hit_rate < EXPCACHE_MIN_HIT_RATE_FOR_MEM_TABLE)
     {
-      double hit_rate= ((double)hit / ((double)hit + miss));
-      DBUG_ASSERT(miss > 0);
-      if (hit_rate < EXPCACHE_MIN_HIT_RATE_FOR_MEM_TABLE)
-      {
-        DBUG_PRINT("info", ("hit rate is not so good to keep the cache"));
-        disable_cache();
-        DBUG_RETURN(FALSE);
-      }
-      else if (hit_rate < EXPCACHE_MIN_HIT_RATE_FOR_DISK_TABLE)
-      {
-        DBUG_PRINT("info", ("hit rate is not so good to go to disk"));
-        if (cache_table->file->ha_delete_all_rows() ||
-            cache_table->file->ha_write_tmp_row(cache_table->record[0]))
-          goto err;
-      }
-      else
-      {
-        if (create_internal_tmp_table_from_heap(table_thd, cache_table,
-                                                cache_table_param.start_recinfo,
-                                                &cache_table_param.recinfo,
-                                                error, 1, NULL))
-          goto err2;
-      }
+      DBUG_PRINT("info", ("hit rate is not so good to keep the cache"));
+      disable_cache();
+      DBUG_RETURN(FALSE);
     }
+    DBUG_PRINT("info", ("the cache is full, start over"));
+    clear_hash();
   }
-  cache_table->status= 0; /* cache_table->record contains an existed record */
-  ref.has_record= TRUE; /* the same as above */
-  DBUG_PRINT("info", ("has_record: TRUE  status: 0"));
+  else if (n_entries >= n_buckets && grow_hash())
+    goto err;
+
+  if (!(entry= (Entry*) alloc_root(&entries_root, entry_size)))
+    goto err;
+  entry->hash_value= last_hash_value;
+  memcpy(entry_key(entry), ref.key_buff, ref.key_length);
+  memcpy(entry_record(entry), cache_table->record[0],
+         cache_table->s->reclength);
+  bucket= buckets + (last_hash_value & (n_buckets - 1));
+  entry->next= *bucket;
+  *bucket= entry;
+  n_entries++;
+  used_memory+= entry_size;
+  last_key_valid= FALSE;
 
   DBUG_RETURN(FALSE);
 
 err:
-  cache_table->file->print_error(error, MYF(0));
-err2:
   disable_cache();
   DBUG_RETURN(TRUE);
 }
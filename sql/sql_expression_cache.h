@@ -106,6 +106,12 @@ class Expression_cache_tracker :public Sql_alloc
 
 /**
   Implementation of expression cache over a temporary table
+
+  @details
+  The temporary table is only used to describe the record and the key built
+  from the parameters. Its rows are kept in an in-memory hash of key images
+  rather than written into the table, so that probes do not go through the
+  storage engine.
 */
 
 class Expression_cache_tmptable :public Expression_cache
@@ -137,7 +143,19 @@ class Expression_cache_tmptable :public Expression_cache
   }
 
 private:
+  /* Hash entry: followed by the key image and the record image */
+  struct Entry
+  {
+    Entry *next;
+    ulong hash_value;
+  };
+
   void disable_cache();
+  uchar *entry_key(Entry *entry) { return (uchar*) (entry + 1); }
+  uchar *entry_record(Entry *entry)
+  { return entry_key(entry) + ALIGN_SIZE(ref.key_length); }
+  bool grow_hash();
+  void clear_hash();
 
   /* tmp table parameters */
   TMP_TABLE_PARAM cache_table_param;
@@ -151,6 +169,19 @@ class Expression_cache_tmptable :public Expression_cache
   struct st_table_ref ref;
   /* Cached result */
   Item_field *cached_result;
+  /* Memory for the hash entries */
+  MEM_ROOT entries_root;
+  /* Hash buckets, n_buckets is a power of 2 */
+  Entry **buckets;
+  ulong n_buckets, n_entries;
+  /* Memory used by the hash entries */
+  size_t used_memory;
+  /* Memory limit for the hash, the same as for in-memory temporary tables */
+  size_t max_memory;
+  /* Hash value of the key of the last check_value() that missed */
+  ulong last_hash_value;
+  /* Whether put_value() can add an entry for the last check_value() */
+  bool last_key_valid;
   /* List of parameter items */
   List<Item> &items;
   /* Value Item example */
@@ -969,10 +969,21 @@ bool mysql_insert(THD *thd, TABLE_LIST *table_list,
       same table in the same connection.
     */
     if (thd->locked_tables_mode <= LTM_LOCK_TABLES &&
-        !table->s->long_unique_table && values_list.elements > 1)
+        !table->s->long_unique_table &&
+        (values_list.elements > 1 || thd->is_bulk_op()))
     {
       using_bulk_insert= 1;
-      table->file->ha_start_bulk_insert(values_list.elements);
+      if (thd->is_bulk_op())
+        /*
+          With array binding the number of parameter sets is not known
+          in advance. Unless errors are ignored, a failed row fails the
+          whole statement, like it does for a replicated Write_rows event.
+        */
+        table->file->ha_start_bulk_insert(0, duplic == DUP_ERROR && !ignore
+                                          ? HA_BULK_INSERT_ABORT_ON_ERROR
+                                          : 0);
+      else
+        table->file->ha_start_bulk_insert(values_list.elements);
     }
     else
       table->file->ha_reset_copy_info();
@@ -846,6 +846,10 @@ size_t JOIN_CACHE::get_max_join_buffer_size(bool optimize_buff_size,
     return max_buff_size;                       // use cached value
 
   size_t limit_sz= (size_t) join->thd->variables.join_buff_size;
+  /* Use less memory when the session gets close to max_session_mem_used */
+  set_if_smaller(limit_sz,
+                 MY_MAX((size_t) join->thd->limit_spill_buffer_size(limit_sz),
+                        min_sz));
 
   if (!optimize_buff_size)
     return max_buff_size= limit_sz;
@@ -1533,6 +1537,34 @@ uint JOIN_CACHE::write_record_data(uchar * link, bool *is_full)
 }
 
 
+/*
+  Free the join buffer and the file with the saved records of join_tab
+*/
+
+void JOIN_CACHE::free()
+{
+  my_free(buff);
+  buff= 0;
+  if (join_tab_scan)
+    join_tab_scan->free_spill();
+}
+
+
+/*
+  Discard the records of join_tab saved for the refills of the join buffer
+
+  DESCRIPTION
+    The function is called when the current execution of the join has
+    finished, or before the join is executed again.
+*/
+
+void JOIN_CACHE::discard_spilled_rows()
+{
+  if (join_tab_scan)
+    join_tab_scan->discard_spill();
+}
+
+
 /* 
   Reset the join buffer for reading/writing: default implementation
 
@@ -2820,6 +2852,8 @@ int JOIN_CACHE_HASHED::init(bool for_explain)
 
   hash_table= 0;
   key_entries= 0;
+  key_filter= 0;
+  key_filter_words= 0;
 
   key_length= ref->key_length;
 
@@ -2849,7 +2883,7 @@ int JOIN_CACHE_HASHED::init(bool for_explain)
   ref_key_info= join_tab->get_keyinfo_by_key_no(join_tab->ref.key);
   ref_used_key_parts= join_tab->ref.key_parts;
 
-  hash_func= &JOIN_CACHE_HASHED::get_hash_idx_simple;
+  hash_func= &JOIN_CACHE_HASHED::get_hash_value_simple;
   hash_cmp_func= &JOIN_CACHE_HASHED::equal_keys_simple;
 
   KEY_PART_INFO *key_part= ref_key_info->key_part;
@@ -2858,14 +2892,31 @@ int JOIN_CACHE_HASHED::init(bool for_explain)
   {
     if (!key_part->field->eq_cmp_as_binary())
     {
-      hash_func= &JOIN_CACHE_HASHED::get_hash_idx_complex;
+      hash_func= &JOIN_CACHE_HASHED::get_hash_value_complex;
       hash_cmp_func= &JOIN_CACHE_HASHED::equal_keys_complex;
       break;
     }
   }
-      
+
   init_hash_table();
 
+  if (get_join_alg() == BNLH_JOIN_ALG)
+  {
+    /*
+      About 8 bits of the filter per hash entry, that is about 11 bits per
+      key, with 3 bits set per key give a false positive rate below 3%.
+      The filter is allocated once: if the buffer is reallocated later
+      it only gets smaller.
+    */
+    key_filter_words= 1;
+    while (key_filter_words < hash_entries / 8 &&
+           key_filter_words < (UINT_MAX32 >> 1))
+      key_filter_words*= 2;
+    if (!(key_filter= (ulonglong*) join->thd->calloc(key_filter_words *
+                                                     sizeof(ulonglong))))
+      DBUG_RETURN(1);
+  }
+
   rec_fields_offset= get_size_of_rec_offset()+get_size_of_rec_length()+
                      (prev_cache ? prev_cache->get_size_of_rec_offset() : 0);
 
@@ -3089,7 +3140,8 @@ bool JOIN_CACHE_HASHED::put_record()
   }
 
   /* Look for the key in the hash table */
-  if (key_search(key, key_len, &key_ref_ptr))
+  ulong hash_value= (this->*hash_func)(key, key_len);
+  if (key_search(key, key_len, hash_value, &key_ref_ptr))
   {
     uchar *last_next_ref_ptr;
     /* 
@@ -3133,6 +3185,7 @@ bool JOIN_CACHE_HASHED::put_record()
     }
     last_key_entry= cp;
     DBUG_ASSERT(last_key_entry >= end_pos);
+    add_to_key_filter(hash_value);
     /* Increment the counter of key_entries in the hash table */ 
     key_entries++;
   }  
@@ -3228,6 +3281,7 @@ bool JOIN_CACHE_HASHED::skip_if_not_needed_match()
     key_search()
       key             pointer to the key value
       key_len         key value length
+      hash_value      hash value of the key, as returned by hash_func
       key_ref_ptr OUT position of the reference to the next key from 
                       the hash element for the found key , or
                       a position where the reference to the the hash 
@@ -3247,10 +3301,10 @@ bool JOIN_CACHE_HASHED::skip_if_not_needed_match()
 */
 
 bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len,
-                                   uchar **key_ref_ptr) 
+                                   ulong hash_value, uchar **key_ref_ptr)
 {
   bool is_found= FALSE;
-  uint idx= (this->*hash_func)(key, key_length);
+  uint idx= (uint) (hash_value % hash_entries);
   uchar *ref_ptr= hash_table+size_of_key_ofs*idx;
   while (!is_null_key_ref(ref_ptr))
   {
@@ -3274,32 +3328,27 @@ bool JOIN_CACHE_HASHED::key_search(uchar *key, uint key_len,
   Hash function that considers a key in the hash table as byte array
 
   SYNOPSIS
-    get_hash_idx_simple()
+    get_hash_value_simple()
       key             pointer to the key value
       key_len         key value length
       
   DESCRIPTION
-    The function calculates an index of the hash entry in the hash table
-    of the join buffer for the given key. It considers the key just as
-    a sequence of bytes of the length key_len.
+    The function calculates the hash value for the given key. It considers
+    the key just as a sequence of bytes of the length key_len.
+    The index of the hash entry in the hash table of the join buffer is
+    the hash value modulo the number of entries.
+    The hash table exists only in memory, so the hash function can be
+    changed freely. CRC-32C hashes 8 bytes at a time wherever the CPU
+    has an instruction for it, see my_crc32c().
 
   RETURN VALUE
-    the calculated index of the hash entry for the given key  
+    the calculated hash value for the given key
 */
 
 inline
-uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
+ulong JOIN_CACHE_HASHED::get_hash_value_simple(uchar* key, uint key_len)
 {
-  ulong nr= 1;
-  ulong nr2= 4;
-  uchar *pos= key;
-  uchar *end= key+key_len;
-  for (; pos < end ; pos++)
-  {
-    nr^= (ulong) ((((uint) nr & 63)+nr2)*((uint) *pos))+ (nr << 8);
-    nr2+= 3;
-  }
-  return nr % hash_entries;
+  return my_crc32c(0, key, key_len);
 }
 
 
@@ -3307,14 +3356,14 @@ uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
   Hash function that takes into account collations of the components of the key  
 
   SYNOPSIS
-    get_hash_idx_complex()
+    get_hash_value_complex()
       key             pointer to the key value
       key_len         key value length
       
   DESCRIPTION
-    The function calculates an index of the hash entry in the hash table
-    of the join buffer for the given key. It takes into account that the
-    components of the key may be of a varchar type with different collations.
+    The function calculates the hash value for the given key. It takes into
+    account that the components of the key may be of a varchar type with
+    different collations.
     The function guarantees that the same hash value for any two equal
     keys that may differ as byte sequences.
     The function takes the info about the components of the key, their
@@ -3323,14 +3372,13 @@ uint JOIN_CACHE_HASHED::get_hash_idx_simple(uchar* key, uint key_len)
     operation.
 
   RETURN VALUE
-    the calculated index of the hash entry for the given key  
+    the calculated hash value for the given key
 */
 
 inline
-uint JOIN_CACHE_HASHED::get_hash_idx_complex(uchar *key, uint key_len)
+ulong JOIN_CACHE_HASHED::get_hash_value_complex(uchar *key, uint key_len)
 {
-  return 
-    (uint) (key_hashnr(ref_key_info, ref_used_key_parts, key) % hash_entries);
+  return key_hashnr(ref_key_info, ref_used_key_parts, key);
 }
 
 
@@ -3410,6 +3458,8 @@ void JOIN_CACHE_HASHED:: cleanup_hash_table()
 {
   last_key_entry= hash_table;
   bzero(hash_table, (buff+buff_size)-hash_table);
+  if (key_filter)
+    bzero(key_filter, key_filter_words * sizeof(ulonglong));
   key_entries= 0;
 }
 
@@ -3502,10 +3552,107 @@ int JOIN_TAB_SCAN::open()
   save_or_restore_used_tabs(join_tab, FALSE);
   is_first_record= TRUE;
   join_tab->tracker->r_scans++;
+
+  if (spill_state == SPILL_COMPLETE)
+  {
+    if (!reinit_io_cache(&spill, READ_CACHE, 0L, 0, 0))
+    {
+      spill_state= SPILL_READING;
+      /* Account for the records rejected by the pushed condition */
+      join_tab->tracker->r_rows+= spill_rows_read - spill_rows;
+      return 0;
+    }
+    discard_spill();
+  }
+  else if (spill_state == SPILL_NONE && cache->more_refills && can_spill())
+  {
+    if ((my_b_inited(&spill) ||
+         !open_cached_file(&spill, mysql_tmpdir, TEMP_PREFIX,
+                           DISK_CHUNK_SIZE, MYF(MY_TRACK_WITH_LIMIT))) &&
+        !reinit_io_cache(&spill, WRITE_CACHE, 0L, 0, 0))
+    {
+      spill_state= SPILL_WRITING;
+      spill_rows= 0;
+      spill_rows_read= join_tab->tracker->r_rows;
+    }
+  }
   return join_init_read_record(join_tab);
 }
 
 
+/*
+  Check whether the records of the joined table can be saved to a file
+
+  DESCRIPTION
+    The records are saved as images of table->record[0]. This is not
+    possible if the record refers to memory outside of it (blobs), or if
+    the position of the handler is needed for the current record.
+    Only base tables are considered, because the contents of a temporary
+    table may change between the refills of the join buffer.
+    Dynamic range access may return different records on each scan.
+
+  RETURN VALUE
+    TRUE   the records can be saved
+    FALSE  otherwise
+*/
+
+bool JOIN_TAB_SCAN::can_spill()
+{
+  TABLE *table= join_tab->table;
+  return !table->s->blob_fields && table->s->tmp_table == NO_TMP_TABLE &&
+         !join_tab->keep_current_rowid && join_tab->use_quick != 2;
+}
+
+
+/*
+  Read the next record saved by an earlier scan into table->record[0]
+
+  RETURN VALUE
+    0    the record has been read
+    -1   there are no more records
+*/
+
+int JOIN_TAB_SCAN::read_spilled_record()
+{
+  TABLE *table= join_tab->table;
+  if (my_b_read(&spill, table->record[0], table->s->reclength))
+    return -1;
+  table->status= 0;
+  table->null_row= 0;
+  join_tab->tracker->r_rows++;
+  join_tab->tracker->r_rows_after_where++;
+  return 0;
+}
+
+
+/*
+  Forget the records saved to the file by the scans over the joined table
+
+  DESCRIPTION
+    This is called when the join has been executed, so that the records
+    are not reused by another execution of the join, e.g. for another
+    value of an outer reference of a subquery. The file is kept open for
+    the next execution.
+*/
+
+void JOIN_TAB_SCAN::discard_spill()
+{
+  spill_state= SPILL_NONE;
+  /* The temporary file is created when the IO_CACHE is first flushed */
+  if (my_b_inited(&spill) && spill.file >= 0)
+    truncate_io_cache(&spill);
+}
+
+
+/* Close and remove the file with the records saved by the scans */
+
+void JOIN_TAB_SCAN::free_spill()
+{
+  spill_state= SPILL_NONE;
+  close_cached_file(&spill);
+}
+
+
 /* 
   Read the next record that can match while scanning the joined table
 
@@ -3535,6 +3682,13 @@ int JOIN_TAB_SCAN::next()
   SQL_SELECT *select= join_tab->cache_select;
   THD *thd= join->thd;
 
+  if (spill_state == SPILL_READING)
+  {
+    if (unlikely(thd->check_killed()))
+      return 1;
+    return read_spilled_record();
+  }
+
   if (is_first_record)
     is_first_record= FALSE;
   else
@@ -3562,6 +3716,24 @@ int JOIN_TAB_SCAN::next()
 
   if (!err)
     join_tab->tracker->r_rows_after_where++;
+
+  if (spill_state == SPILL_WRITING)
+  {
+    if (err)
+    {
+      if (err < 0)
+      {
+        /* All records of the scan have been saved */
+        spill_state= SPILL_COMPLETE;
+        spill_rows_read= join_tab->tracker->r_rows - spill_rows_read;
+      }
+    }
+    else if (my_b_write(&spill, join_tab->table->record[0],
+                        join_tab->table->s->reclength))
+      discard_spill();
+    else
+      spill_rows++;
+  }
   return err; 
 }
 
@@ -3626,6 +3798,13 @@ static void save_or_restore_used_tabs(JOIN_TAB *join_tab, bool save)
 void JOIN_TAB_SCAN::close()
 {
   save_or_restore_used_tabs(join_tab, TRUE);
+  if (spill_state == SPILL_READING)
+    spill_state= SPILL_COMPLETE;
+  else if (spill_state == SPILL_WRITING)
+  {
+    /* The scan was not completed: the saved records cannot be used */
+    discard_spill();
+  }
 }
 
 
@@ -3809,8 +3988,12 @@ uchar *JOIN_CACHE_BNLH::get_matching_chain_by_join_key()
   KEY *keyinfo= join_tab->get_keyinfo_by_key_no(ref->key);
   /* Build the join key value out of the record in the record buffer */
   key_copy(key_buff, table->record[0], keyinfo, key_length, TRUE);
+  ulong hash_value= (this->*hash_func)(key_buff, key_length);
+  /* Most keys that are not in the join buffer are rejected by the filter */
+  if (!key_filter_may_contain(hash_value))
+    return 0;
   /* Look for this key in the join buffer */
-  if (!key_search(key_buff, key_length, &key_ref_ptr))
+  if (!key_search(key_buff, key_length, hash_value, &key_ref_ptr))
     return 0;
   return key_ref_ptr+get_size_of_key_offset();
 }
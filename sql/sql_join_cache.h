@@ -357,6 +357,13 @@ class JOIN_CACHE :public Sql_alloc
   */
   JOIN_TAB_SCAN *join_tab_scan;
 
+  /*
+    TRUE if the join buffer is being flushed because it is full and
+    more records are to be put into it, that is, join_tab is going to
+    be scanned again for the same execution of the join.
+  */
+  bool more_refills;
+
   void calc_record_fields();     
   void collect_info_on_key_args();
   int alloc_fields();
@@ -543,6 +550,8 @@ class JOIN_CACHE :public Sql_alloc
     buff= 0;
     min_buff_size= max_buff_size= 0;            // Caches
     not_exists_opt_is_applicable= false;
+    join_tab_scan= 0;
+    more_refills= false;
   }
 
   /* 
@@ -559,6 +568,8 @@ class JOIN_CACHE :public Sql_alloc
     prev_cache= prev;
     buff= 0;
     min_buff_size= max_buff_size= 0;            // Caches
+    join_tab_scan= 0;
+    more_refills= false;
     if (prev)
       prev->next_cache= this;
   }
@@ -680,11 +691,11 @@ class JOIN_CACHE :public Sql_alloc
 
   virtual ~JOIN_CACHE() = default;
   void reset_join(JOIN *j) { join= j; }
-  void free()
-  { 
-    my_free(buff);
-    buff= 0;
-  }   
+  /* Note whether the join buffer is going to be refilled after a flush */
+  void set_more_refills(bool more) { more_refills= more; }
+  /* Discard the rows of join_tab saved for the refills of the join buffer */
+  void discard_spilled_rows();
+  void free();
   
   friend class JOIN_CACHE_HASHED;
   friend class JOIN_CACHE_BNL;
@@ -775,7 +786,7 @@ class JOIN_CACHE :public Sql_alloc
 class JOIN_CACHE_HASHED: public JOIN_CACHE
 {
 
-  typedef uint (JOIN_CACHE_HASHED::*Hash_func) (uchar *key, uint key_len);
+  typedef ulong (JOIN_CACHE_HASHED::*Hash_func) (uchar *key, uint key_len);
   typedef bool (JOIN_CACHE_HASHED::*Hash_cmp_func) (uchar *key1, uchar *key2,
                                                     uint key_len);
   
@@ -803,8 +814,36 @@ class JOIN_CACHE_HASHED: public JOIN_CACHE
   /* The offset of the data fields from the beginning of the record fields */
   uint data_fields_offset;
 
-  inline uint get_hash_idx_simple(uchar *key, uint key_len);
-  inline uint get_hash_idx_complex(uchar *key, uint key_len);
+  /*
+    Bloom filter over the hash values of the keys in the hash table.
+    It is built only for BNLH caches, where most probes of the hash table
+    are expected to fail. The filter is much smaller than the hash table
+    and the key entries, so a failing probe usually touches only one
+    cached word of it.
+  */
+  ulonglong *key_filter;
+  /* Number of words in key_filter, a power of 2 */
+  uint key_filter_words;
+
+  inline ulong get_hash_value_simple(uchar *key, uint key_len);
+  inline ulong get_hash_value_complex(uchar *key, uint key_len);
+
+  /* Get the bits set in a word of key_filter for a hash value */
+  static ulonglong key_filter_mask(ulonglong h)
+  {
+    return (1ULL << (h >> 58)) | (1ULL << ((h >> 52) & 63)) |
+           (1ULL << ((h >> 46) & 63));
+  }
+  /* Get the word of key_filter for a hash value */
+  ulonglong *key_filter_word(ulonglong h)
+  {
+    return key_filter + ((h >> 14) & (key_filter_words - 1));
+  }
+  /* Scramble a hash value before deriving the filter bits from it */
+  static ulonglong key_filter_hash(ulong hash_value)
+  {
+    return (ulonglong) hash_value * 0x9E3779B97F4A7C15ULL;
+  }
 
   inline bool equal_keys_simple(uchar *key1, uchar *key2, uint key_len);
   inline bool equal_keys_complex(uchar *key1, uchar *key2, uint key_len);
@@ -982,7 +1021,31 @@ class JOIN_CACHE_HASHED: public JOIN_CACHE
   bool skip_if_not_needed_match() override;
 
   /* Search for a key in the hash table of the join buffer */
-  bool key_search(uchar *key, uint key_len, uchar **key_ref_ptr);
+  bool key_search(uchar *key, uint key_len, ulong hash_value,
+                  uchar **key_ref_ptr);
+
+  /* Add the hash value of a new key to the key filter */
+  void add_to_key_filter(ulong hash_value)
+  {
+    if (key_filter)
+    {
+      ulonglong h= key_filter_hash(hash_value);
+      *key_filter_word(h)|= key_filter_mask(h);
+    }
+  }
+
+  /*
+    Check whether a key with the given hash value may be found in the hash
+    table. FALSE means that it is certainly not there.
+  */
+  bool key_filter_may_contain(ulong hash_value)
+  {
+    if (!key_filter)
+      return TRUE;
+    ulonglong h= key_filter_hash(hash_value);
+    ulonglong mask= key_filter_mask(h);
+    return (*key_filter_word(h) & mask) == mask;
+  }
 
   /* Reallocate the join buffer of a hashed join cache */
   int realloc_buffer() override;
@@ -1054,6 +1117,31 @@ class JOIN_TAB_SCAN: public Sql_alloc
   /* TRUE if this is the first record from the joined table to iterate over */
   bool is_first_record;
 
+  /*
+    When the join buffer has to be refilled, the records of join_tab that
+    satisfy the condition pushed to join_tab are written to the file 'spill'
+    during the first scan. The following scans for the same execution of
+    the join read the records back from the file instead of scanning
+    join_tab again.
+  */
+  enum Spill_state
+  {
+    SPILL_NONE,      /* no records have been saved */
+    SPILL_WRITING,   /* the current scan is writing the records */
+    SPILL_COMPLETE,  /* all records have been saved */
+    SPILL_READING    /* the current scan is reading the saved records */
+  };
+  enum Spill_state spill_state;
+  /* The file with the saved records */
+  IO_CACHE spill;
+  /* The number of records in the file */
+  ha_rows spill_rows;
+  /* The number of records read from join_tab when the file was written */
+  ha_rows spill_rows_read;
+
+  bool can_spill();
+  int read_spilled_record();
+
 protected:
 
   /* The joined table to be iterated over */
@@ -1073,6 +1161,8 @@ class JOIN_TAB_SCAN: public Sql_alloc
     join= j;
     join_tab= tab;
     cache= join_tab->cache;
+    spill_state= SPILL_NONE;
+    my_b_clear(&spill);
   }
 
   virtual ~JOIN_TAB_SCAN() = default;
@@ -1096,6 +1186,10 @@ class JOIN_TAB_SCAN: public Sql_alloc
   */ 
   virtual void close();
 
+  /* Forget the records saved in the file, keeping the file open */
+  void discard_spill();
+  /* Close and remove the file with the saved records */
+  void free_spill();
 };
 
 /*
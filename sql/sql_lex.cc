@@ -3095,6 +3095,7 @@ void st_select_lex::init_query()
   tvc= 0;
   versioned_tables= 0;
   pushdown_select= 0;
+  join_order_cache= 0;
   orig_names_of_item_list_elems= 0;
 }
 
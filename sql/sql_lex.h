@@ -311,6 +311,7 @@ class With_clause;
 class my_var;
 class select_handler;
 class Pushdown_select;
+class Join_order_cache;
 
 #define ALLOC_ROOT_SET 1024
 
@@ -1152,6 +1153,8 @@ class st_select_lex: public st_select_lex_node
 
   /* The object used to organize execution of the query by a foreign engine */
   select_handler *pushdown_select;
+  /* Join order of the previous execution, see optimizer_join_order_cache */
+  Join_order_cache *join_order_cache;
   List<TABLE_LIST> *join_list;    /* list for the currently parsed join  */
   st_select_lex *merged_into; /* select which this select is merged into */
                               /* (not 0 only for views/derived tables)   */
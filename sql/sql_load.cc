@@ -27,6 +27,7 @@
 #include "sql_cache.h"                          // query_cache_*
 #include "sql_base.h"          // fill_record_n_invoke_before_triggers
 #include <my_dir.h>
+#include <mysys_err.h>                          // EE_READ
 #include "sql_view.h"                           // check_key_in_view
 #include "sql_insert.h" // check_that_all_fields_are_given_values,
                         // write_record
@@ -153,6 +154,195 @@ class Wsrep_load_data_split
 };
 #endif /* WITH_WSREP */
 
+/**
+  Read ahead of the parser when loading a regular file.
+
+  A helper thread reads the next block of the file while the rows of the
+  current block are parsed, converted and written, so that the file reads
+  overlap with the rest of LOAD DATA.
+*/
+class Load_file_prefetch
+{
+  File file;
+  size_t block_size;
+  uchar *block[2];
+  /** bytes in block[i]; 0 at end of file, MY_FILE_ERROR on error */
+  size_t length[2];
+  /** whether block[i] was read and not yet released by get() */
+  bool filled[2];
+  /** the block that get() will return next */
+  uint next;
+  /** whether get() returned block[next ^ 1], which is still in use */
+  bool held;
+  /** whether the reader thread must stop */
+  bool stop;
+  /** my_errno of a failed read */
+  int read_errno;
+  mysql_mutex_t mutex;
+  mysql_cond_t cond;
+  pthread_t thread;
+
+  void reader();
+  static void *reader_thread(void *arg)
+  {
+    static_cast<Load_file_prefetch*>(arg)->reader();
+    return NULL;
+  }
+
+public:
+  Load_file_prefetch(File file_arg, size_t block_size_arg)
+    : file(file_arg), block_size(block_size_arg), next(0), held(false),
+      stop(false), read_errno(0)
+  {
+    block[0]= block[1]= NULL;
+    length[0]= length[1]= 0;
+    filled[0]= filled[1]= false;
+  }
+  ~Load_file_prefetch();
+
+  /** Start the reader thread.
+  @return whether the thread was started */
+  bool start();
+  /** Release the block that was returned before and wait for the next one.
+  @param data  the block
+  @return number of bytes in the block
+  @retval 0 at end of file
+  @retval MY_FILE_ERROR on error */
+  size_t get(uchar **data);
+  /** @return my_errno of the failed read */
+  int get_errno() const { return read_errno; }
+};
+
+
+bool Load_file_prefetch::start()
+{
+  if (!(block[0]= (uchar*) my_malloc(PSI_INSTRUMENT_ME, 2 * block_size,
+                                     MYF(MY_THREAD_SPECIFIC))))
+    return false;
+  block[1]= block[0] + block_size;
+  mysql_mutex_init(PSI_NOT_INSTRUMENTED, &mutex, MY_MUTEX_INIT_FAST);
+  mysql_cond_init(PSI_NOT_INSTRUMENTED, &cond, NULL);
+  if (mysql_thread_create(0, /* Not instrumented */
+                          &thread, NULL, reader_thread, this))
+  {
+    mysql_cond_destroy(&cond);
+    mysql_mutex_destroy(&mutex);
+    my_free(block[0]);
+    block[0]= NULL;
+    return false;
+  }
+  return true;
+}
+
+
+Load_file_prefetch::~Load_file_prefetch()
+{
+  if (!block[0])
+    return;
+  mysql_mutex_lock(&mutex);
+  stop= true;
+  mysql_cond_broadcast(&cond);
+  mysql_mutex_unlock(&mutex);
+  pthread_join(thread, NULL);
+  mysql_cond_destroy(&cond);
+  mysql_mutex_destroy(&mutex);
+  my_free(block[0]);
+}
+
+
+void Load_file_prefetch::reader()
+{
+  my_thread_init();
+  for (uint i= 0;; i^= 1)
+  {
+    mysql_mutex_lock(&mutex);
+    while (filled[i] && !stop)
+      mysql_cond_wait(&cond, &mutex);
+    bool done= stop;
+    mysql_mutex_unlock(&mutex);
+    if (done)
+      break;
+
+    size_t n= my_read(file, block[i], block_size, MYF(0));
+    mysql_mutex_lock(&mutex);
+    length[i]= n;
+    filled[i]= true;
+    if (n == MY_FILE_ERROR)
+      read_errno= my_errno;
+    mysql_cond_broadcast(&cond);
+    mysql_mutex_unlock(&mutex);
+    if (!n || n == MY_FILE_ERROR)
+      break;
+  }
+  my_thread_end();
+}
+
+
+size_t Load_file_prefetch::get(uchar **data)
+{
+  mysql_mutex_lock(&mutex);
+  if (held)
+  {
+    filled[next ^ 1]= false;
+    held= false;
+    mysql_cond_broadcast(&cond);
+  }
+  while (!filled[next])
+    mysql_cond_wait(&cond, &mutex);
+  size_t n= length[next];
+  *data= block[next];
+  /* The end of file or the error is returned again by any further call. */
+  if (n && n != MY_FILE_ERROR)
+  {
+    next^= 1;
+    held= true;
+  }
+  mysql_mutex_unlock(&mutex);
+  return n;
+}
+
+
+/** The IO_CACHE of READ_INFO */
+struct Load_file_cache : public LOAD_FILE_IO_CACHE
+{
+  /** the read ahead of the file, or NULL */
+  Load_file_prefetch *prefetch;
+};
+
+
+/**
+  Read the next block of a file from Load_file_prefetch.
+  Like _my_b_net_read(), this sets up the IO_CACHE for my_b_get().
+
+  @retval 1   at end of file, or on error
+  @retval 0   if the first byte was read
+*/
+
+static int load_prefetch_read(IO_CACHE *info, uchar *Buffer, size_t)
+{
+  Load_file_prefetch *prefetch= static_cast<Load_file_cache*>(info)->prefetch;
+  uchar *data;
+  size_t read_length= prefetch->get(&data);
+
+  if (unlikely(read_length == MY_FILE_ERROR))
+  {
+    info->error= -1;
+    my_error(EE_READ, MYF(0), my_filename(info->file), prefetch->get_errno());
+    return 1;
+  }
+  if (!read_length)
+    return 1;
+
+  info->read_end= (info->read_pos= data) + read_length;
+  Buffer[0]= info->read_pos[0];                 /* length is always 1 */
+  /* for log_loaded_block() */
+  info->pos_in_file+= read_length;
+  info->request_pos= info->read_pos;
+  info->read_pos++;
+  return 0;
+}
+
+
 class READ_INFO: public Load_data_param
 {
   File	file;
@@ -241,7 +431,7 @@ class READ_INFO: public Load_data_param
   bool error,line_cuted,found_null,enclosed;
   uchar	*row_start,			/* Found row starts here */
 	*row_end;			/* Found row ends here */
-  LOAD_FILE_IO_CACHE cache;
+  Load_file_cache cache;
 
   READ_INFO(THD *thd, File file, const Load_data_param &param,
 	    String &field_term,String &line_start,String &line_term,
@@ -1424,6 +1614,7 @@ READ_INFO::READ_INFO(THD *thd, File file_par,
    error(false), line_cuted(false), found_null(false)
 {
   data.set_thread_specific();
+  cache.prefetch= NULL;
   /*
     Field and line terminators must be interpreted as sequence of unsigned char.
     Otherwise, non-ascii terminators will be negative on some platforms,
@@ -1457,6 +1648,24 @@ READ_INFO::READ_INFO(THD *thd, File file_par,
     }
     else
     {
+      /*
+        Read large regular files ahead. The block size is the size of
+        the IO_CACHE buffer, which is based on read_buffer_size.
+      */
+      MY_STAT stat_info;
+      if (!get_it_from_net && !is_fifo &&
+          !my_fstat(file, &stat_info, MYF(0)) &&
+          (ulonglong) stat_info.st_size > 2 * cache.buffer_length)
+      {
+        cache.prefetch= new Load_file_prefetch(file, cache.buffer_length);
+        if (cache.prefetch && cache.prefetch->start())
+          cache.read_function= load_prefetch_read;
+        else
+        {
+          delete cache.prefetch;
+          cache.prefetch= NULL;
+        }
+      }
 #ifndef EMBEDDED_LIBRARY
       if (get_it_from_net)
 	cache.read_function = _my_b_net_read;
@@ -1474,6 +1683,7 @@ READ_INFO::READ_INFO(THD *thd, File file_par,
 
 READ_INFO::~READ_INFO()
 {
+  delete cache.prefetch;
   ::end_io_cache(&cache);
   List_iterator<XML_TAG> xmlit(taglist);
   XML_TAG *t;
@@ -1258,6 +1258,10 @@ dispatch_command_return do_command(THD *thd, bool blocking)
   */
   DEBUG_SYNC(thd, "before_do_command_net_read");
 
+  /* Don't wait for the next command with a held back response */
+  if (net->vio && !net->vio->has_data(net->vio))
+    (void) net_flush(net);
+
   packet_length= my_net_read_packet(net, 1);
 
   if (unlikely(packet_length == packet_error))
@@ -2114,6 +2118,7 @@ dispatch_command_return dispatch_command(enum enum_server_command command, THD *
     thd->variables.max_mem_used= LONGLONG_MAX;
     general_log_print(thd, command, NullS);
     net->error=0;				// Don't give 'abort' message
+    (void) net_flush(net);                      // Responses held back
     thd->get_stmt_da()->disable_status();       // Don't send anything back
     error=TRUE;					// End server
     break;
@@ -2467,6 +2472,12 @@ dispatch_command_return dispatch_command(enum enum_server_command command, THD *
   thd->m_digest= NULL;
 
   thd->packet.shrink(thd->variables.net_buffer_length); // Reclaim some memory
+  /*
+    Keep a buffer that is as large as the last command, so that a series
+    of big commands does not reallocate it every time.
+  */
+  net_shrink(&thd->net, MY_MAX(thd->variables.net_buffer_length,
+                               (size_t) packet_length + 1));
 
   thd->reset_kill_query();  /* Ensure that killed_errmsg is released */
   /*
@@ -2474,7 +2485,7 @@ dispatch_command_return dispatch_command(enum enum_server_command command, THD *
     Unlink it now, before freeing the root.
   */
   thd->lex->m_sql_cmd= NULL;
-  free_root(thd->mem_root,MYF(MY_KEEP_PREALLOC));
+  free_root_keep_blocks(thd->mem_root, thd->variables.query_alloc_keep_size);
   DBUG_EXECUTE_IF("print_allocated_thread_memory",
                   SAFEMALLOC_REPORT_MEMORY(sf_malloc_dbug_id()););
 
@@ -49,6 +49,13 @@ static int binlog_dump_count = 0;
 
 extern TYPELIB binlog_checksum_typelib;
 
+/*
+  Size of the network write buffer of a binlog dump thread. Events are
+  sent in batches of this size, and with the compressed protocol each
+  batch is compressed as a whole, which compresses better.
+*/
+#define BINLOG_DUMP_NET_BUFFER_LENGTH (256*1024)
+
 
 static int
 fake_event_header(String* packet, Log_event_type event_type, ulong extra_len,
@@ -1374,14 +1381,23 @@ gtid_check_binlog_file(slave_connection_state *state,
   }
   statistic_increment(binlog_gtid_index_miss, &LOCK_status);
 
-  bzero((char*) &cache, sizeof(cache));
-  if (unlikely((file= open_binlog(&cache, buf, out_errormsg)) == (File)-1))
-    goto end;
-  *out_errormsg= get_gtid_list_event(&cache, &glev);
-  end_io_cache(&cache);
-  mysql_file_close(file, MYF(MY_WME));
-  if (unlikely(*out_errormsg))
-    goto end;
+  /*
+    The Gtid_list_log_event at the start of a binlog file never changes, so
+    it is only read from the file once.
+  */
+  if (!mysql_bin_log.get_cached_gtid_list(buf, &glev))
+  {
+    bzero((char*) &cache, sizeof(cache));
+    if (unlikely((file= open_binlog(&cache, buf, out_errormsg)) == (File)-1))
+      goto end;
+    *out_errormsg= get_gtid_list_event(&cache, &glev);
+    end_io_cache(&cache);
+    mysql_file_close(file, MYF(MY_WME));
+    if (unlikely(*out_errormsg))
+      goto end;
+    if (glev)
+      mysql_bin_log.cache_gtid_list(buf, glev);
+  }
 
   if (!glev || contains_all_slave_gtid(state, glev))
   {
@@ -3084,6 +3100,11 @@ void mysql_binlog_send(THD* thd, char* log_ident, my_off_t pos,
 
   has_transmit_started= true;
 
+  if (thd->net.max_packet < BINLOG_DUMP_NET_BUFFER_LENGTH &&
+      thd->net.max_packet_size > BINLOG_DUMP_NET_BUFFER_LENGTH &&
+      thd->net.write_pos == thd->net.buff)
+    net_realloc(&thd->net, BINLOG_DUMP_NET_BUFFER_LENGTH);
+
   /* Check if the dump thread is created by a slave with semisync enabled. */
   thd->semi_sync_slave = is_semi_sync_slave();
 
@@ -4484,6 +4505,9 @@ bool mysql_show_binlog_events(THD* thd)
 
     linfo.index_file_offset = 0;
 
+    if (binary_log->is_relay_log)
+      binary_log->flush_for_readers();
+
     if (binary_log->find_log_pos(&linfo, name, 1))
     {
       errmsg = "Could not find target log";
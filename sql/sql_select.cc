@@ -483,6 +483,7 @@ void JOIN::init(THD *thd_arg, List<Item> &fields_arg,
   const_tables= 0;
   const_table_map= found_const_table_map= not_usable_rowid_map= 0;
   aggr_tables= 0;
+  access_path_cache= 0;
   eliminated_tables= 0;
   join_list= 0;
   implicit_grouping= FALSE;
@@ -1431,6 +1432,7 @@ JOIN::prepare(TABLE_LIST *tables_init, COND *conds_init, uint og_num,
   Json_writer_object trace_wrapper(thd);
   Json_writer_object trace_prepare(thd, "join_preparation");
   trace_prepare.add_select_number(select_lex->select_number);
+  Opt_trace_timing trace_time(thd, &trace_prepare);
   Json_writer_array trace_steps(thd, "steps");
 
   // simple check that we got usable conds
@@ -2181,6 +2183,7 @@ JOIN::optimize_inner()
   Json_writer_object trace_wrapper(thd);
   Json_writer_object trace_prepare(thd, "join_optimization");
   trace_prepare.add_select_number(select_lex->select_number);
+  Opt_trace_timing trace_time(thd, &trace_prepare);
   Json_writer_array trace_steps(thd, "steps");
 
   /*
@@ -2400,6 +2403,9 @@ JOIN::optimize_inner()
           thd, &Item::varchar_upper_cmp_transformer);
   }
 
+  if (thd->variables.optimizer_vcol_substitution)
+    transform_all_conds_and_on_exprs(thd, &Item::vcol_subst_transformer);
+
   conds= optimize_cond(this, conds, join_list, ignore_on_expr,
                        &cond_value, &cond_equal, OPT_LINK_EQUAL_FIELDS);
 
@@ -4657,6 +4663,9 @@ JOIN::reinit()
          tab= next_linear_tab(this, tab, WITH_BUSH_ROOTS))
     {
       tab->ref.key_err= TRUE;
+      /* Records saved by an earlier execution must not be reused */
+      if (tab->cache)
+        tab->cache->discard_spilled_rows();
     }
   }
 
@@ -4836,6 +4845,7 @@ int JOIN::exec_inner()
   Json_writer_object trace_wrapper(thd);
   Json_writer_object trace_exec(thd, "join_execution");
   trace_exec.add_select_number(select_lex->select_number);
+  Opt_trace_timing trace_time(thd, &trace_exec);
   Json_writer_array trace_steps(thd, "steps");
 
   if (!select_lex->outer_select() &&                            // (1)
@@ -6102,6 +6112,7 @@ make_join_statistics(JOIN *join, List<TABLE_LIST> &tables_list,
   */
   {
     Json_writer_object rows_estimation_wrapper(thd);
+    Opt_trace_timing trace_time(thd, &rows_estimation_wrapper);
     Json_writer_array rows_estimation(thd, "rows_estimation");
 
     for (s=stat ; s < stat_end ; s++)
@@ -8300,6 +8311,36 @@ apply_filter(THD *thd, TABLE *table, ALL_READ_COST *cost,
 }
 
 
+/*
+  @brief
+    Compute the cost of one scan over the rows of a table that were saved
+    to a temporary file for the refills of a join buffer
+
+  @param thd   Thread handle
+  @param table The joined table
+  @param rows  Number of rows that satisfy the condition pushed to the table
+
+  @detail
+    When a BNL or BNLH join buffer has to be refilled, the rows of the joined
+    table are saved to a file during the first scan and read back for the
+    following refills (see JOIN_TAB_SCAN::can_spill()).
+
+  @return
+    The cost of writing or reading the rows once, or 0 if the rows of the
+    table cannot be saved.
+*/
+
+static double join_cache_spill_cost(THD *thd, TABLE *table, double rows)
+{
+  if (table->s->blob_fields || table->s->tmp_table != NO_TMP_TABLE)
+    return 0.0;
+  return (rows * ROW_COPY_COST_THD(thd) *
+          JOIN_CACHE_SPILL_ROW_COPY_COST_FACTOR(thd) +
+          ceil(rows * table->s->reclength / IO_SIZE) *
+          DISK_READ_COST_THD(thd));
+}
+
+
 /*
   @brief
     Compute the fanout of hash join operation using EITS data
@@ -9381,7 +9422,16 @@ best_access_path(JOIN      *join,
     refills= (1.0 + floor((double) cache_record_length(join,idx) *
                           record_count /
                           (double) thd->variables.join_buff_size));
-    cur_cost= COST_MULT(cur_cost, refills);
+    /*
+      If the rows of the table can be saved to a file during the first
+      scan, the following refills read them from the file.
+    */
+    if (double spill_cost= refills > 1.0 ?
+        join_cache_spill_cost(thd, table, rnd_records) : 0.0)
+      cur_cost= COST_ADD(COST_ADD(cur_cost, TMPFILE_CREATE_COST),
+                         COST_MULT(spill_cost, refills));
+    else
+      cur_cost= COST_MULT(cur_cost, refills);
 
 
     /*
@@ -9696,8 +9746,19 @@ best_access_path(JOIN      *join,
       tmp_refills= (1.0 + floor((double) cache_record_length(join,idx) *
                                 (record_count /
                                  (double) thd->variables.join_buff_size)));
-      cur_cost= file->cost_for_reading_multiple_times(tmp_refills,
-                                                      &cost);
+      /*
+        If the rows of the table can be saved to a file during the first
+        scan, the following refills read them from the file.
+      */
+      if (double spill_cost= tmp_refills > 1.0 ?
+          join_cache_spill_cost(thd, table, records_after_filter) : 0.0)
+        cur_cost= COST_ADD(COST_ADD(file->cost_for_reading_multiple_times(
+                                      1.0, &cost),
+                                    TMPFILE_CREATE_COST),
+                           COST_MULT(spill_cost, tmp_refills));
+      else
+        cur_cost= file->cost_for_reading_multiple_times(tmp_refills,
+                                                        &cost);
       refills= double_to_ulonglong(ceil(tmp_refills));
 
       /* We come here only if there are already rows in the join cache */
@@ -9960,6 +10021,125 @@ static void choose_initial_table_order(JOIN *join)
 }
 
 
+/*
+  Check if the join order of the previous execution may be saved and reused
+
+  Only statements whose SELECT_LEX survives between executions (prepared
+  statements and stored routines) are handled. Semi-join nests are not
+  supported as their materialization plans are chosen separately.
+*/
+
+static bool join_order_cache_usable(JOIN *join)
+{
+  THD *thd= join->thd;
+  return (thd->variables.optimizer_join_order_cache &&
+          !thd->stmt_arena->is_conventional() &&
+          !join->select_lex->sj_nests.elements &&
+          join->table_count - join->const_tables > 1);
+}
+
+
+static inline bool join_order_rows_close(double cached, double rows)
+{
+  return rows + 1 <= (cached + 1) * 2 && cached + 1 <= (rows + 1) * 2;
+}
+
+
+/*
+  Put the tables into the join order of the previous execution
+
+  @return
+    false  Order restored in join->best_ref
+    true   The saved order can't be used, join->best_ref is not changed
+*/
+
+static bool restore_join_order(JOIN *join)
+{
+  Join_order_cache *cache= join->select_lex->join_order_cache;
+  JOIN_TAB **ref= join->best_ref + join->const_tables;
+  uint n_tables= join->table_count - join->const_tables;
+
+  if (!cache || cache->n_tables != n_tables)
+    return true;
+
+  /* Check first that all tables are there with similar row estimates */
+  for (uint i= 0; i < n_tables; i++)
+  {
+    const Join_order_cache::Table *t= cache->tables + i;
+    JOIN_TAB *s= 0;
+    for (uint j= 0; j < n_tables; j++)
+    {
+      if (ref[j]->table->pos_in_table_list == t->tl)
+      {
+        s= ref[j];
+        break;
+      }
+    }
+    if (!s ||
+        !join_order_rows_close((double) t->records, (double) s->records) ||
+        !join_order_rows_close((double) t->found_records,
+                               (double) s->found_records))
+      return true;
+  }
+
+  for (uint i= 0; i < n_tables; i++)
+  {
+    uint j= i;
+    while (ref[j]->table->pos_in_table_list != cache->tables[i].tl)
+      j++;
+    swap_variables(JOIN_TAB*, ref[i], ref[j]);
+  }
+  return false;
+}
+
+
+/*
+  Remember the join order in join->best_positions for the next execution
+*/
+
+static void save_join_order(JOIN *join)
+{
+  THD *thd= join->thd;
+  SELECT_LEX *select_lex= join->select_lex;
+  Join_order_cache *cache= select_lex->join_order_cache;
+  uint n_tables= join->table_count - join->const_tables;
+  MEM_ROOT *mem_root= thd->stmt_arena->mem_root;
+
+  if (!cache)
+  {
+    if (!(cache= new (mem_root) Join_order_cache))
+      return;
+    cache->tables= 0;
+    cache->max_tables= 0;
+    select_lex->join_order_cache= cache;
+  }
+
+  /* Re-allocation is rare as the number of tables seldom grows */
+  if (cache->max_tables < n_tables)
+  {
+    Join_order_cache::Table *tables= (Join_order_cache::Table*)
+      alloc_root(mem_root, sizeof(Join_order_cache::Table) * n_tables);
+    if (!tables)
+    {
+      cache->n_tables= 0;
+      return;
+    }
+    cache->tables= tables;
+    cache->max_tables= n_tables;
+  }
+
+  POSITION *pos= join->best_positions + join->const_tables;
+  for (uint i= 0; i < n_tables; i++)
+  {
+    JOIN_TAB *s= pos[i].table;
+    cache->tables[i].tl= s->table->pos_in_table_list;
+    cache->tables[i].records= s->records;
+    cache->tables[i].found_records= s->found_records;
+  }
+  cache->n_tables= n_tables;
+}
+
+
 /**
   Selects and invokes a search strategy for an optimal query plan.
 
@@ -9987,6 +10167,7 @@ choose_plan(JOIN *join, table_map join_tables, TABLE_LIST *emb_sjm_nest)
   uint use_cond_selectivity= 
          join->thd->variables.optimizer_use_condition_selectivity;
   bool straight_join= MY_TEST(join->select_options & SELECT_STRAIGHT_JOIN);
+  bool use_join_order_cache= false;
   THD *thd= join->thd;
   qsort2_cmp jtab_sort_func;
   DBUG_ENTER("choose_plan");
@@ -10036,6 +10217,7 @@ choose_plan(JOIN *join, table_map join_tables, TABLE_LIST *emb_sjm_nest)
             jtab_sort_func, (void*) emb_sjm_nest);
 
   Json_writer_object wrapper(thd);
+  Opt_trace_timing trace_time(thd, &wrapper);
   Json_writer_array trace_plan(thd,"considered_execution_plans");
 
   if (!emb_sjm_nest)
@@ -10052,6 +10234,13 @@ choose_plan(JOIN *join, table_map join_tables, TABLE_LIST *emb_sjm_nest)
   {
     optimize_straight_join(join, join_tables);
   }
+  else if ((use_join_order_cache= !emb_sjm_nest &&
+            join_order_cache_usable(join)) &&
+           !restore_join_order(join))
+  {
+    status_var_increment(thd->status_var.optimizer_join_order_cache_hits);
+    optimize_straight_join(join, join_tables);
+  }
   else
   {
     DBUG_ASSERT(search_depth <= MAX_TABLES + 1);
@@ -10067,6 +10256,12 @@ choose_plan(JOIN *join, table_map join_tables, TABLE_LIST *emb_sjm_nest)
 
     if (greedy_search(join, join_tables, search_depth, use_cond_selectivity))
       DBUG_RETURN(TRUE);
+
+    if (use_join_order_cache)
+    {
+      status_var_increment(thd->status_var.optimizer_join_order_cache_misses);
+      save_join_order(join);
+    }
   }
 
   join->emb_sjm_nest= 0;
@@ -10430,6 +10625,78 @@ optimize_straight_join(JOIN *join, table_map remaining_tables)
 }
 
 
+/*
+  Cache of best_access_path() results, used by greedy_search()
+
+  When search_depth is smaller than the number of tables to join, each
+  step of greedy_search() explores again most of the partial plans that
+  the previous step already costed below the table that it picked. For
+  a given table the result of best_access_path() only depends on the
+  ordered join prefix and on record_count, so it can be reused.
+  The cache is direct mapped; a colliding entry is simply overwritten.
+*/
+
+struct Best_access_path_cache
+{
+  static constexpr uint SIZE= 1024;
+  struct Entry
+  {
+    const JOIN_TAB *tab= nullptr;
+    double record_count;
+    uint idx;
+    uchar prefix[MAX_TABLES];
+    POSITION pos, loose_scan_pos;
+  };
+  Entry entries[SIZE];
+
+  /* Join prefix of the current get_costs_for_tables() call */
+  uchar prefix[MAX_TABLES];
+  uint prefix_start, prefix_end;
+  ulonglong prefix_hash;
+
+  void set_prefix(const JOIN *join, uint idx)
+  {
+    prefix_start= join->const_tables;
+    prefix_end= idx;
+    prefix_hash= idx;
+    for (uint i= prefix_start; i < idx; i++)
+    {
+      prefix[i]= (uchar) join->positions[i].table->table->tablenr;
+      prefix_hash= prefix_hash * 0x100000001b3ULL + prefix[i] + 1;
+    }
+  }
+
+  Entry *entry(const JOIN_TAB *tab, double record_count)
+  {
+    ulonglong nr;
+    memcpy(&nr, &record_count, sizeof nr);
+    nr^= prefix_hash * 31 + tab->table->tablenr;
+    nr*= 0x9e3779b97f4a7c15ULL;
+    return &entries[(nr >> 32) % SIZE];
+  }
+
+  bool matches(const Entry *e, const JOIN_TAB *tab, double record_count) const
+  {
+    return e->tab == tab && e->idx == prefix_end &&
+      e->record_count == record_count &&
+      !memcmp(e->prefix + prefix_start, prefix + prefix_start,
+              prefix_end - prefix_start);
+  }
+
+  void store(Entry *e, const JOIN_TAB *tab, double record_count,
+             const POSITION *pos)
+  {
+    e->tab= tab;
+    e->idx= prefix_end;
+    e->record_count= record_count;
+    memcpy(e->prefix + prefix_start, prefix + prefix_start,
+           prefix_end - prefix_start);
+    e->pos= pos[0];
+    e->loose_scan_pos= pos[1];
+  }
+};
+
+
 /**
   Find a good, possibly optimal, query execution plan (QEP) by a greedy search.
 
@@ -10527,6 +10794,7 @@ greedy_search(JOIN      *join,
   JOIN_TAB  *best_table; // the next plan node to be added to the curr QEP
   // ==join->tables or # tables in the sj-mat nest we're optimizing
   uint      n_tables __attribute__((unused));
+  bool      res;
   DBUG_ENTER("greedy_search");
   DBUG_ASSERT(!(remaining_tables & join->const_table_map));
 
@@ -10538,6 +10806,19 @@ greedy_search(JOIN      *join,
   n_tables= size_remain= my_count_bits(usable_tables);
 
   join->next_sort_position= join->sort_positions;
+
+  /*
+    The cache is only useful if more than one call of
+    best_extension_by_limited_search() will be done. It is not used
+    with the optimizer trace, as that would omit the cached access paths.
+  */
+  DBUG_ASSERT(!join->access_path_cache);
+  if (search_depth < size_remain && !join->thd->trace_started())
+  {
+    if (void *buf= my_malloc(PSI_INSTRUMENT_ME,
+                             sizeof(Best_access_path_cache), MYF(0)))
+      join->access_path_cache= new (buf) Best_access_path_cache;
+  }
   do {
     /*
       Find the extension of the current QEP with the lowest cost
@@ -10552,7 +10833,10 @@ greedy_search(JOIN      *join,
                                                use_cond_selectivity,
                                                &eq_ref_tables) <
         (int) SEARCH_OK)
-      DBUG_RETURN(TRUE);
+    {
+      res= TRUE;
+      break;
+    }
     /*
       'best_read < DBL_MAX' means that optimizer managed to find
       some plan and updated 'best_positions' array accordingly.
@@ -10568,7 +10852,8 @@ greedy_search(JOIN      *join,
       DBUG_EXECUTE("opt", print_plan(join, n_tables,
                                      record_count, read_time, read_time,
                                      "optimal"););
-      DBUG_RETURN(FALSE);
+      res= FALSE;
+      break;
     }
 
     /* select the first table in the optimal extension as most promising */
@@ -10627,6 +10912,10 @@ greedy_search(JOIN      *join,
                                    record_count, read_time, read_time,
                                    "extended"););
   } while (TRUE);
+
+  my_free(join->access_path_cache);
+  join->access_path_cache= 0;
+  DBUG_RETURN(res);
 }
 
 
@@ -11299,8 +11588,12 @@ get_costs_for_tables(JOIN *join, table_map remaining_tables, uint idx,
   table_map found_tables= 0;
   bool found_eq_ref= 0;
   bool disable_jbuf= join->thd->variables.join_cache_level == 0;
+  Best_access_path_cache *cache= join->access_path_cache;
   DBUG_ENTER("get_plans_for_tables");
 
+  if (cache)
+    cache->set_prefix(join, idx);
+
   s= *pos;
   do
   {
@@ -11317,10 +11610,28 @@ get_costs_for_tables(JOIN *join, table_map remaining_tables, uint idx,
 
 
       Json_writer_object wrapper(thd);
-      /* Find the best access method from 's' to the current partial plan */
-      best_access_path(join, s, remaining_tables, join->positions, idx,
-                       disable_jbuf, record_count,
-                       sort_position, sort_position + 1);
+      /*
+        choose_best_splitting() depends on join->best_positions, which
+        changes between the steps of greedy_search()
+      */
+      Best_access_path_cache::Entry *entry= (cache &&
+                                             !s->table->is_splittable() ?
+                                             cache->entry(s, record_count) :
+                                             nullptr);
+      if (entry && cache->matches(entry, s, record_count))
+      {
+        sort_position[0]= entry->pos;
+        sort_position[1]= entry->loose_scan_pos;
+      }
+      else
+      {
+        /* Find the best access method from 's' to the current partial plan */
+        best_access_path(join, s, remaining_tables, join->positions, idx,
+                         disable_jbuf, record_count,
+                         sort_position, sort_position + 1);
+        if (entry)
+          cache->store(entry, s, record_count, sort_position);
+      }
       found_tables|= s->table->map;
       sort_end++;
       sort_position+= 2;
@@ -21265,6 +21576,9 @@ TABLE *Create_tmp_table::start(THD *thd,
                         &tmpname, (uint) strlen(path)+1,
                         &m_group_buff, (m_group && ! m_using_unique_constraint ?
                                       param->group_length : 0),
+                        &param->last_group_buff,
+                        (m_group && ! m_using_unique_constraint ?
+                         param->group_length : 0),
                         &m_bitmaps, bitmap_buffer_size(field_count)*6,
                         &const_key_parts, sizeof(*const_key_parts),
                         NullS))
@@ -21548,9 +21862,13 @@ bool Create_tmp_table::choose_engine(THD *thd, TABLE *table,
   /*
     If result table is small; use a heap, otherwise TMP_TABLE_HTON (Aria)
     In the future we should try making storage engine selection more dynamic
+
+    A heap table can store blobs but not index them, so blobs are only
+    allowed when there is no GROUP BY and no DISTINCT key over them.
   */
 
-  if (share->blob_fields || m_using_unique_constraint ||
+  if ((share->blob_fields && (m_group || m_blobs_count[distinct])) ||
+      m_using_unique_constraint ||
       (thd->variables.big_tables &&
        !(m_select_options & SELECT_SMALL_RESULT)) ||
       (m_select_options & TMP_TABLE_FORCE_MYISAM) ||
@@ -21770,8 +22088,9 @@ bool Create_tmp_table::finalize(THD *thd,
     share->max_rows= ~(ha_rows) 0;
   else
     share->max_rows= (ha_rows) (((share->db_type() == heap_hton) ?
-                                 MY_MIN(thd->variables.tmp_memory_table_size,
-                                     thd->variables.max_heap_table_size) :
+                                 thd->limit_spill_buffer_size(
+                                   MY_MIN(thd->variables.tmp_memory_table_size,
+                                          thd->variables.max_heap_table_size)) :
                                  thd->variables.tmp_disk_table_size) /
                                 share->reclength);
   set_if_bigger(share->max_rows,1);		// For dummy start options
@@ -22501,11 +22820,18 @@ bool create_internal_tmp_table(TABLE *table, KEY *org_keyinfo,
     we first write the row, then check for key conflicts and then we have to
     delete the row.  The cases when this can happen is when there is
     a group by and no sum functions or if distinct is used.
+    DYNAMIC_RECORD is also used for a table without keys that is only
+    appended to and scanned, like a UNION ALL result or a derived table.
+    Its rows are written through a write cache in large sequential writes
+    and don't go through bitmap pages or the page cache, which are of no
+    use when the rows are never looked up or updated.
   */
   {
     enum data_file_type file_type= table->no_rows ? NO_RECORD :
         (share->reclength < 64 && !share->blob_fields ? STATIC_RECORD :
-         table->used_for_duplicate_elimination ? DYNAMIC_RECORD : BLOCK_RECORD);
+         (table->used_for_duplicate_elimination ||
+          (table->append_only && !share->keys && !use_unique)) ?
+         DYNAMIC_RECORD : BLOCK_RECORD);
     uint create_flags= HA_CREATE_TMP_TABLE | HA_CREATE_INTERNAL_TABLE |
         (table->keep_row_order ? HA_PRESERVE_INSERT_ORDER : 0);
 
@@ -22811,6 +23137,9 @@ create_internal_tmp_table_from_heap(THD *thd, TABLE *table,
   }
   if (!new_table.no_rows && (write_err= new_table.file->ha_end_bulk_insert()))
     goto err;
+  /* The following rows are appended as well, use a write cache for them */
+  if (new_table.append_only && !new_table.no_rows && !new_table.s->keys)
+    new_table.file->extra(HA_EXTRA_WRITE_CACHE);
   /* copy row that filled HEAP table */
   if (unlikely((write_err=new_table.file->ha_write_tmp_row(table->record[0]))))
   {
@@ -23396,7 +23725,9 @@ sub_select_cache(JOIN *join, JOIN_TAB *join_tab, bool end_of_records)
 
   if (end_of_records)
   {
+    cache->set_more_refills(false);
     rc= cache->join_records(FALSE);
+    cache->discard_spilled_rows();
     if (rc == NESTED_LOOP_OK || rc == NESTED_LOOP_NO_MORE_ROWS ||
         rc == NESTED_LOOP_QUERY_LIMIT)
       rc= sub_select(join, join_tab, end_of_records);
@@ -23418,6 +23749,7 @@ sub_select_cache(JOIN *join, JOIN_TAB *join_tab, bool end_of_records)
       won't add any more records. Now try to find all the matching 
       extensions for all records in the buffer.
     */ 
+    cache->set_more_refills(true);
     rc= cache->join_records(FALSE);
     DBUG_RETURN(rc);
   }
@@ -23429,6 +23761,7 @@ sub_select_cache(JOIN *join, JOIN_TAB *join_tab, bool end_of_records)
      TODO: Check whether we really need the call below and we can't do
            without it. If it's not the case remove it.
   */ 
+  cache->set_more_refills(true);
   rc= cache->join_records(TRUE);
   if (rc == NESTED_LOOP_OK || rc == NESTED_LOOP_NO_MORE_ROWS ||
       rc == NESTED_LOOP_QUERY_LIMIT)
@@ -25299,15 +25632,20 @@ end_update(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
 	   bool end_of_records)
 {
   TABLE *const table= join_tab->table;
+  TMP_TABLE_PARAM *const param= join_tab->tmp_table_param;
   ORDER   *group;
   int	  error;
+  bool    found;
   DBUG_ENTER("end_update");
 
   if (end_of_records)
+  {
+    param->last_group_found= false;
     DBUG_RETURN(NESTED_LOOP_OK);
+  }
 
   join->found_records++;
-  copy_fields(join_tab->tmp_table_param);	// Groups are copied twice.
+  copy_fields(param);				// Groups are copied twice.
   /* Make a key of group index */
   for (group=table->group ; group ; group=group->next)
   {
@@ -25326,10 +25664,26 @@ end_update(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
     if (item->maybe_null())
       group->buff[-1]= (char) group->field->is_null();
   }
-  if (!table->file->ha_index_read_map(table->record[1],
-                                      join_tab->tmp_table_param->group_buff,
+  /*
+    Rows often arrive in runs of the same group, e.g. when the join is
+    driven by an index on a prefix of the GROUP BY columns. If the row
+    belongs to the group that was updated last, the handler is still
+    positioned on it and record[1] holds its current contents, so the
+    index lookup can be skipped.
+  */
+  found= (param->last_group_found &&
+          !memcmp(param->last_group_buff, param->group_buff,
+                  param->group_length));
+  if (!found &&
+      !table->file->ha_index_read_map(table->record[1],
+                                      param->group_buff,
                                       HA_WHOLE_KEY,
                                       HA_READ_KEY_EXACT))
+  {
+    memcpy(param->last_group_buff, param->group_buff, param->group_length);
+    found= true;
+  }
+  if (found)
   {						/* Update old record */
     restore_record(table,record[1]);
     update_tmptable_sum_func(join->sum_funcs,table);
@@ -25339,18 +25693,20 @@ end_update(JOIN *join, JOIN_TAB *join_tab __attribute__((unused)),
       table->file->print_error(error,MYF(0));	/* purecov: inspected */
       DBUG_RETURN(NESTED_LOOP_ERROR);            /* purecov: inspected */
     }
+    store_record(table,record[1]);
+    param->last_group_found= true;
     goto end;
   }
+  param->last_group_found= false;
 
   init_tmptable_sum_functions(join->sum_funcs);
-  if (unlikely(copy_funcs(join_tab->tmp_table_param->items_to_copy,
-                          join->thd)))
+  if (unlikely(copy_funcs(param->items_to_copy, join->thd)))
     DBUG_RETURN(NESTED_LOOP_ERROR);           /* purecov: inspected */
   if (unlikely((error= table->file->ha_write_tmp_row(table->record[0]))))
   {
     if (create_internal_tmp_table_from_heap(join->thd, table,
-                                       join_tab->tmp_table_param->start_recinfo,
-                                            &join_tab->tmp_table_param->recinfo,
+                                            param->start_recinfo,
+                                            &param->recinfo,
                                             error, 0, NULL))
       DBUG_RETURN(NESTED_LOOP_ERROR);            // Not a table_is_full error
     /* Change method to update rows */
@@ -27084,6 +27440,31 @@ test_if_skip_sort_order(JOIN_TAB *tab,ORDER *order,ha_rows select_limit,
 }
 
 
+/*
+  Check if the rows before OFFSET may be dropped from the sorted result
+  of a table without reading them.
+
+  This is the case when the rows are fetched by their row ids and every
+  sorted row would be passed to end_send() unfiltered: a single table,
+  no temporary table, HAVING, PROCEDURE, WITH TIES or ROWNUM. ANALYZE
+  is excluded so that it reports the same row counts as before.
+*/
+
+static bool sorted_offset_can_be_skipped(JOIN *join, JOIN_TAB *tab,
+                                         SORT_INFO *file_sort)
+{
+  return join->unit->lim.get_offset_limit() &&
+         file_sort->record_pointers && !file_sort->using_addon_fields() &&
+         tab == join->join_tab + join->const_tables &&
+         join->top_join_tab_count == join->const_tables + 1 &&
+         !join->aggr_tables && !tab->bush_children &&
+         tab->next_select == end_send && !tab->select_cond &&
+         !join->having && !join->procedure &&
+         !join->unit->lim.is_with_ties() &&
+         !join->thd->lex->with_rownum && !join->thd->lex->analyze_stmt;
+}
+
+
 /*
   If not selecting by given key, create an index how records should be read
 
@@ -27188,6 +27569,23 @@ create_sort_index(THD *thd, JOIN *join, JOIN_TAB *tab, Filesort *fsort)
   {
     tab->records= join->select_options & OPTION_FOUND_ROWS ?
       file_sort->found_rows : file_sort->return_rows;
+
+    if (sorted_offset_can_be_skipped(join, tab, file_sort))
+    {
+      /*
+        Do not fetch the rows before OFFSET from the table; end_send()
+        would discard them. Count them as sent instead.
+      */
+      const ha_rows skip= MY_MIN(join->unit->lim.get_offset_limit(),
+                                 file_sort->return_rows);
+      const size_t ref_length= table->file->ref_length;
+      file_sort->return_rows-= skip;
+      memmove(file_sort->record_pointers,
+              file_sort->record_pointers + skip * ref_length,
+              (size_t) file_sort->return_rows * ref_length);
+      join->send_records+= skip;
+      join->accepted_rows+= skip;
+    }
   }
 
   if (quick_created)
@@ -27354,8 +27752,8 @@ JOIN_TAB::remove_duplicates()
   table->file->info(HA_STATUS_VARIABLE);
   table->reginfo.lock_type=TL_WRITE;
 
-  if (table->s->db_type() == heap_hton ||
-      (!table->s->blob_fields &&
+  if (!table->s->blob_fields &&
+      (table->s->db_type() == heap_hton ||
        ((ALIGN_SIZE(keylength) + HASH_OVERHEAD) * table->file->stats.records <
 	thd->variables.sortbuff_size)))
     error= remove_dup_with_hash_index(join->thd, table, field_count,
@@ -32633,6 +33031,7 @@ AGGR_OP::prepare_tmp_table()
       return true;
     (void) table->file->extra(HA_EXTRA_WRITE_CACHE);
   }
+  join_tab->tmp_table_param->last_group_found= false;
   /* If it wasn't already, start index scan for grouping using table index. */
   if (!table->file->inited && table->group &&
       join_tab->tmp_table_param->sum_func_count && table->s->keys)
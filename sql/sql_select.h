@@ -1155,6 +1155,27 @@ class JOIN_TAB_RANGE: public Sql_alloc
 
 class Pushdown_query;
 
+/*
+  Join order that was chosen by an earlier execution of a prepared
+  statement or a stored routine statement (see optimizer_join_order_cache).
+  It lives on the statement arena and is reused by choose_plan() as long
+  as the row estimates of the tables stay close to the ones stored here.
+*/
+
+class Join_order_cache :public Sql_alloc
+{
+public:
+  struct Table
+  {
+    TABLE_LIST *tl;
+    /* JOIN_TAB::records and JOIN_TAB::found_records when the order was saved */
+    ha_rows records, found_records;
+  };
+  Table *tables;        /* In join order, const tables excluded */
+  uint n_tables;
+  uint max_tables;      /* Number of allocated elements in tables */
+};
+
 /**
   @brief
     Class to perform postjoin aggregation operations
@@ -1425,6 +1446,8 @@ class JOIN :public Sql_alloc
   POSITION *best_positions;
   POSITION *sort_positions;    /* Temporary space used by greedy_search */
   POSITION *next_sort_position; /* Next free space in sort_positions */
+  /* best_access_path() results reused across greedy_search() steps */
+  struct Best_access_path_cache *access_path_cache;
 
   Pushdown_query *pushdown_query;
   JOIN_TAB *original_join_tab;
@@ -900,7 +900,27 @@ longlong SEQUENCE::next_value(TABLE *table, bool second_round, int *error)
 
   *error= 0;
   if (!second_round)
+  {
+    /*
+      Hand out a cached value under a shared lock, so that concurrent
+      NEXT VALUE FOR do not serialize while the cache lasts. Everything
+      else that changes next_free_value holds the exclusive lock.
+    */
+    mysql_rwlock_rdlock(&mutex);
+    res_value= my_atomic_load64(&next_free_value);
+    while (within_bound(res_value, reserved_until, reserved_until,
+                        real_increment > 0))
+    {
+      if (my_atomic_cas64(&next_free_value, &res_value,
+                          increment_value(res_value, real_increment)))
+      {
+        mysql_rwlock_unlock(&mutex);
+        DBUG_RETURN(res_value);
+      }
+    }
+    mysql_rwlock_unlock(&mutex);
     write_lock(table);
+  }
 
   res_value= next_free_value;
   next_free_value= increment_value(next_free_value, real_increment);
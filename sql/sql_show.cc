@@ -5593,7 +5593,14 @@ int get_all_tables(THD *thd, TABLE_LIST *tables, COND *cond)
                                               db_name, table_name,
                                               &open_tables_state_backup,
                                               can_deadlock))
+              {
+                /*
+                  Do not let the memory used for the processed tables
+                  accumulate when there are many of them.
+                */
+                free_root(&tmp_mem_root, MY_MARK_BLOCKS_FREE);
                 continue;
+              }
             }
 
             if (thd->killed == ABORT_QUERY)
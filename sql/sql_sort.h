@@ -571,6 +571,11 @@ class Sort_param {
   Addon_fields *addon_fields;     // Descriptors for companion fields.
   Sort_keys *sort_keys;
   ha_rows *accepted_rows;         /* For ROWNUM */
+  /*
+    If not NULL, a buffer for the sort key of a row, used to check the row
+    against a full priority queue before the WHERE condition is evaluated
+  */
+  uchar *pq_precheck_key;
   bool using_pq;
   bool set_all_read_bits;
 
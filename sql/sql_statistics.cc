@@ -351,7 +351,7 @@ class Column_statistics_collected :public Column_statistics
 
 public:
 
-  inline void init(THD *thd, Field * table_field);
+  inline void init(THD *thd, Field * table_field, double sample_fraction);
   inline bool add();
   inline bool finish(MEM_ROOT *mem_root, ha_rows rows, double sample_fraction);
   inline void cleanup();
@@ -1806,7 +1806,7 @@ class Count_distinct_field: public Sql_alloc
     @brief
     Check whether the Unique object tree has been successfully created
   */
-  bool exists()
+  virtual bool exists()
   {
     return (tree != NULL);
   }
@@ -1825,7 +1825,7 @@ class Count_distinct_field: public Sql_alloc
     @brief
     Calculate the number of elements accumulated in the container of 'tree'
   */
-  void walk_tree()
+  virtual void walk_tree()
   {
     Basic_stats_collector stats_collector;
     tree->walk(table_field->table, basic_stats_collector_walk,
@@ -1916,6 +1916,86 @@ class Count_distinct_field_bit: public Count_distinct_field
 };
 
 
+/*
+  The class Count_distinct_field_sketch is derived from the class
+  Count_distinct_field to estimate the number of distinct values of a column
+  with a HyperLogLog sketch instead of collecting the values in a Unique
+  object. The sketch takes a fixed amount of memory and is never flushed
+  to disk, and the estimate is usually within 1-2% of the exact number.
+  A sketch cannot tell how many values occur only once, so it is used only
+  when all rows are read and no histogram is to be built for the column.
+*/
+
+class Count_distinct_field_sketch: public Count_distinct_field
+{
+  /* The number of bits of the hash value that select a register */
+  static constexpr uint INDEX_BITS= 14;
+  static constexpr uint REGISTERS= 1U << INDEX_BITS;
+
+  /*
+    For every register the maximum position of the first 1 bit in the
+    remaining bits of the hash values falling into it
+  */
+  uchar *registers;
+  /* The number of values added to the sketch */
+  ulonglong values;
+
+public:
+
+  Count_distinct_field_sketch(THD *thd, Field *field)
+  {
+    table_field= field;
+    tree= NULL;
+    tree_key_length= 0;
+    values= 0;
+    registers= (uchar*) thd->calloc(REGISTERS);
+  }
+
+  bool exists() override
+  {
+    return (registers != NULL);
+  }
+
+  bool add() override
+  {
+    Hasher hasher;
+    table_field->hash_not_null(&hasher);
+    /* Spread the bits of the hash value over 64 bits */
+    ulonglong h= (ulonglong) hasher.finalize() * 0x9E3779B97F4A7C15ULL;
+    h^= h >> 29;
+    h*= 0xBF58476D1CE4E5B9ULL;
+    h^= h >> 32;
+    uint idx= (uint) (h >> (64 - INDEX_BITS));
+    ulonglong rest= h << INDEX_BITS;
+    uchar rank= rest ? (uchar) (64 - my_bit_log2_uint64(rest)) :
+                       (uchar) (64 - INDEX_BITS + 1);
+    if (rank > registers[idx])
+      registers[idx]= rank;
+    values++;
+    return 0;
+  }
+
+  void walk_tree() override
+  {
+    double sum= 0;
+    uint zeros= 0;
+    for (uint i= 0; i < REGISTERS; i++)
+    {
+      sum+= ldexp(1.0, -(int) registers[i]);
+      if (!registers[i])
+        zeros++;
+    }
+    double m= REGISTERS;
+    double estimate= 0.7213 / (1 + 1.079 / m) * m * m / sum;
+    /* Use linear counting for small cardinalities */
+    if (estimate <= 2.5 * m && zeros)
+      estimate= m * log(m / zeros);
+    distincts= MY_MIN((ulonglong) (estimate + 0.5), values);
+    distincts_single_occurence= 0;
+  }
+};
+
+
 /* 
   The class Index_prefix_calc is a helper class used to calculate the values
   for the column 'avg_frequency' of the statistical table index_stats.
@@ -2426,7 +2506,8 @@ alloc_engine_independent_statistics(THD *thd, const TABLE_SHARE *table_share,
 */
 
 inline
-void Column_statistics_collected::init(THD *thd, Field *table_field)
+void Column_statistics_collected::init(THD *thd, Field *table_field,
+                                        double sample_fraction)
 {
   size_t max_heap_table_size= (size_t)thd->variables.max_heap_table_size;
   TABLE *table= table_field->table;
@@ -2448,6 +2529,10 @@ void Column_statistics_collected::init(THD *thd, Field *table_field)
   if (!is_single_pk_col && !(table_field->flags & BLOB_FLAG))
   {
     count_distinct=
+      thd->variables.analyze_ndv_sketch && sample_fraction >= 1 &&
+      (thd->variables.histogram_size == 0 ||
+       thd->variables.histogram_type == INVALID_HISTOGRAM) ?
+      new (thd->mem_root) Count_distinct_field_sketch(thd, table_field) :
       table_field->type() == MYSQL_TYPE_BIT ?
       new (thd->mem_root) Count_distinct_field_bit(table_field,
                                                    max_heap_table_size) :
@@ -2770,7 +2855,14 @@ int collect_statistics_for_table(THD *thd, TABLE *table)
 
   if (thd->variables.sample_percentage == 0)
   {
-    if (file->records() < MIN_THRESHOLD_FOR_SAMPLING)
+    /*
+      An estimate is good enough for choosing the sample size.
+      handler::records() may count the rows exactly, which would
+      defeat the purpose of sampling.
+    */
+    file->info(HA_STATUS_VARIABLE | HA_STATUS_NO_LOCK);
+    const ha_rows n_rows= file->stats.records;
+    if (n_rows < MIN_THRESHOLD_FOR_SAMPLING)
     {
       sample_fraction= 1;
     }
@@ -2778,7 +2870,7 @@ int collect_statistics_for_table(THD *thd, TABLE *table)
     {
       sample_fraction= std::fmin(
                   (MIN_THRESHOLD_FOR_SAMPLING + 4096 *
-                   log(200 * file->records())) / file->records(), 1);
+                   log(200 * n_rows)) / n_rows, 1);
     }
   }
 
@@ -2787,7 +2879,7 @@ int collect_statistics_for_table(THD *thd, TABLE *table)
     table_field= *field_ptr;   
     if (!table_field->collected_stats)
       continue; 
-    table_field->collected_stats->init(thd, table_field);
+    table_field->collected_stats->init(thd, table_field, sample_fraction);
   }
 
   restore_record(table, s->default_values);
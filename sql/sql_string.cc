@@ -847,7 +847,11 @@ bool Binary_string::copy_printable_hhhh(CHARSET_INFO *to_cs,
 
 int sortcmp(const Binary_string *s, const Binary_string *t, CHARSET_INFO *cs)
 {
- return cs->strnncollsp(s->ptr(), s->length(), t->ptr(), t->length());
+  /* Identical strings are equal in any collation */
+  if (s->length() == t->length() &&
+      !memcmp(s->ptr(), t->ptr(), s->length()))
+    return 0;
+  return cs->strnncollsp(s->ptr(), s->length(), t->ptr(), t->length());
 }
 
 
@@ -359,6 +359,7 @@ select_unit::create_result_table(THD *thd_arg, List<Item> *column_types,
     return TRUE;
 
   table->keys_in_use_for_query.clear_all();
+  table->append_only= true;
 
   if (create_table)
   {
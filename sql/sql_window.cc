@@ -2872,21 +2872,42 @@ bool compute_window_func(THD *thd,
   while ((cursor_manager= iter_cursor_managers++))
     cursor_manager->initialize_cursors(&info);
 
-  /* One partition tracker for each window function. */
+  /*
+    One partition tracker for each window function. The functions are
+    ordered by their window specifications, so adjacent functions with the
+    same PARTITION BY list share a tracker and the partition bound is only
+    checked once per row for them.
+  */
   List<Group_bound_tracker> partition_trackers;
-  Item_window_func *win_func;
+  Item_window_func *win_func, *prev_win_func= NULL;
+  Group_bound_tracker *tracker= NULL;
   while ((win_func= iter_win_funcs++))
   {
-    Group_bound_tracker *tracker= new Group_bound_tracker(thd,
-                                        win_func->window_spec->partition_list);
-    // TODO(cvicentiu) This should be removed and placed in constructor.
-    tracker->init();
+    if (!prev_win_func ||
+        compare_order_lists(prev_win_func->window_spec->partition_list,
+                            prev_win_func->window_spec->win_spec_number,
+                            win_func->window_spec->partition_list,
+                            win_func->window_spec->win_spec_number) != CMP_EQ)
+    {
+      tracker= new Group_bound_tracker(thd,
+                                       win_func->window_spec->partition_list);
+      // TODO(cvicentiu) This should be removed and placed in constructor.
+      tracker->init();
+    }
     partition_trackers.push_back(tracker);
+    prev_win_func= win_func;
   }
 
   List_iterator_fast<Group_bound_tracker> iter_part_trackers(partition_trackers);
   ha_rows rownum= 0;
   uchar *rowid_buf= (uchar*) my_malloc(PSI_INSTRUMENT_ME, tbl->file->ref_length, MYF(0));
+  /*
+    Without blobs the record image does not point into handler buffers, so
+    a copy of it can be used to return to the current row instead of
+    reading it again after each window function.
+  */
+  uchar *row_buf= tbl->s->blob_fields ? NULL :
+    (uchar*) my_malloc(PSI_INSTRUMENT_ME, tbl->s->reclength, MYF(0));
 
   while (true)
   {
@@ -2897,17 +2918,25 @@ bool compute_window_func(THD *thd,
        each window function. */
     tbl->file->position(tbl->record[0]);
     memcpy(rowid_buf, tbl->file->ref, tbl->file->ref_length);
+    if (row_buf)
+      memcpy(row_buf, tbl->record[0], tbl->s->reclength);
 
     iter_win_funcs.rewind();
     iter_part_trackers.rewind();
     iter_cursor_managers.rewind();
 
-    Group_bound_tracker *tracker;
+    Group_bound_tracker *prev_tracker= NULL;
+    bool next_partition= false;
     while ((win_func= iter_win_funcs++) &&
            (tracker= iter_part_trackers++) &&
            (cursor_manager= iter_cursor_managers++))
     {
-      if (tracker->check_if_next_group() || (rownum == 0))
+      if (tracker != prev_tracker)
+      {
+        next_partition= tracker->check_if_next_group() || (rownum == 0);
+        prev_tracker= tracker;
+      }
+      if (next_partition)
       {
         /* TODO(cvicentiu)
            Clearing window functions should happen through cursors. */
@@ -2928,8 +2957,11 @@ bool compute_window_func(THD *thd,
       }
 
       /* Return to current row after notifying cursors for each window
-         function. */
-      if (tbl->file->ha_rnd_pos(tbl->record[0], rowid_buf))
+         function. The handler itself is positioned back on the row by
+         save_window_function_values(). */
+      if (row_buf)
+        memcpy(tbl->record[0], row_buf, tbl->s->reclength);
+      else if (tbl->file->ha_rnd_pos(tbl->record[0], rowid_buf))
       {
         ret= true;
         break;
@@ -2946,8 +2978,18 @@ bool compute_window_func(THD *thd,
     rownum++;
   }
 
+  my_free(row_buf);
   my_free(rowid_buf);
-  partition_trackers.delete_elements();
+  /* Shared trackers are adjacent in the list, delete each of them once. */
+  iter_part_trackers.rewind();
+  Group_bound_tracker *prev_tracker= NULL;
+  while ((tracker= iter_part_trackers++))
+  {
+    if (tracker != prev_tracker)
+      delete tracker;
+    prev_tracker= tracker;
+  }
+  partition_trackers.empty();
   end_read_record(&info);
 
   return ret;
@@ -417,6 +417,15 @@ static Sys_var_long Sys_pfs_max_sql_text_length(
        CMD_LINE(REQUIRED_ARG), VALID_RANGE(0, 1024 * 1024),
        DEFAULT(1024), BLOCK_SIZE(1));
 
+static Sys_var_uint Sys_pfs_wait_sampling_interval(
+       "performance_schema_wait_sampling_interval",
+       "Instrument only one out of this many mutex, rwlock and condition"
+       " waits of each instrumented thread. The wait events and summaries"
+       " then contain a sample of these waits",
+       PARSED_EARLY READ_ONLY GLOBAL_VAR(pfs_param.m_wait_sampling_interval),
+       CMD_LINE(REQUIRED_ARG), VALID_RANGE(1, 1024 * 1024),
+       DEFAULT(1), BLOCK_SIZE(1));
+
 #endif /* WITH_PERFSCHEMA_STORAGE_ENGINE */
 
 #ifdef WITH_WSREP
@@ -455,6 +464,23 @@ static Sys_var_double Sys_analyze_sample_percentage(
        CMD_LINE(REQUIRED_ARG), VALID_RANGE(0, 100),
        DEFAULT(100));
 
+static Sys_var_mybool Sys_analyze_ndv_sketch(
+       "analyze_ndv_sketch",
+       "Let ANALYZE TABLE estimate the number of distinct values in a "
+       "column with a HyperLogLog sketch instead of counting them exactly. "
+       "Used when all rows are read and no histogram is collected",
+       SESSION_VAR(analyze_ndv_sketch), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
+static Sys_var_mybool Sys_analyze_skip_unchanged(
+       "analyze_skip_unchanged",
+       "Let ANALYZE TABLE ... PERSISTENT FOR ALL skip collecting "
+       "engine-independent statistics for a table that has not been "
+       "changed since they were last collected with the same settings. "
+       "Requires a storage engine that reports the last update time",
+       SESSION_VAR(analyze_skip_unchanged), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
 static Sys_var_ulong Sys_auto_increment_increment(
        "auto_increment_increment",
        "Auto-increment columns are incremented by this",
@@ -2922,6 +2948,23 @@ static Sys_var_ulong Sys_optimizer_search_depth(
        SESSION_VAR(optimizer_search_depth), CMD_LINE(REQUIRED_ARG),
        VALID_RANGE(0, MAX_TABLES+1), DEFAULT(MAX_TABLES+1), BLOCK_SIZE(1));
 
+static Sys_var_mybool Sys_optimizer_join_order_cache(
+       "optimizer_join_order_cache",
+       "Reuse the join order that was chosen by the previous execution of "
+       "a prepared statement or a stored routine statement, as long as the "
+       "estimated number of rows of each table differs by no more than a "
+       "factor of 2",
+       SESSION_VAR(optimizer_join_order_cache), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
+static Sys_var_mybool Sys_optimizer_vcol_substitution(
+       "optimizer_vcol_substitution",
+       "Replace expressions in WHERE and ON clauses that are the definition "
+       "of an indexed virtual column with a reference to the column, so that "
+       "the index can be used",
+       SESSION_VAR(optimizer_vcol_substitution), CMD_LINE(OPT_ARG),
+       DEFAULT(FALSE));
+
 static Sys_var_ulong Sys_optimizer_extra_pruning_depth(
        "optimizer_extra_pruning_depth",
        "If the optimizer needs to enumerate join prefix of this size or "
@@ -2987,7 +3030,7 @@ static Sys_var_flagset Sys_optimizer_trace(
     "optimizer_trace",
     "Controls tracing of the Optimizer:"
     " optimizer_trace=option=val[,option=val...], where option is one of"
-    " {enabled}"
+    " {enabled, timings}"
     " and val is one of {on, off, default}",
     SESSION_VAR(optimizer_trace), CMD_LINE(REQUIRED_ARG),
     Opt_trace_context::flag_names, DEFAULT(Opt_trace_context::FLAG_DEFAULT));
@@ -3206,6 +3249,14 @@ static Sys_var_ulong Sys_query_prealloc_size(
        BLOCK_SIZE(1024), NO_MUTEX_GUARD, NOT_IN_BINLOG, ON_CHECK(0),
        ON_UPDATE(fix_thd_mem_root));
 
+static Sys_var_ulong Sys_query_alloc_keep_size(
+       "query_alloc_keep_size",
+       "Memory, in addition to query_prealloc_size, that is kept after a "
+       "statement for the following statements of the connection instead "
+       "of being freed",
+       SESSION_VAR(query_alloc_keep_size), CMD_LINE(REQUIRED_ARG),
+       VALID_RANGE(0, UINT_MAX), DEFAULT(0), BLOCK_SIZE(1024));
+
 // this has to be NO_CMD_LINE as the command-line option has a different name
 static Sys_var_mybool Sys_skip_external_locking(
        "skip_external_locking", "Don't use system (external) locking",
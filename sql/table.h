@@ -752,6 +752,17 @@ struct TABLE_SHARE
   */
   TABLE_STATISTICS_CB *stats_cb;
 
+  /*
+    When EITS statistics were last collected for all columns and indexes
+    of the table, the number of rows at that time and the histogram and
+    analyze_ndv_sketch settings that were used. Protected by LOCK_share.
+    See analyze_skip_unchanged.
+  */
+  time_t eits_collect_time;
+  ha_rows eits_collect_records;
+  ulong eits_histogram_size, eits_histogram_type;
+  my_bool eits_ndv_sketch;
+
   uchar	*default_values;		/* row with default values */
   LEX_CSTRING comment;			/* Comment about table */
   CHARSET_INFO *table_charset;		/* Default charset of string fields */
@@ -1534,6 +1545,12 @@ struct TABLE
     Forces DYNAMIC Aria row format for internal temporary tables.
   */
   bool keep_row_order;
+  /**
+    Rows are only appended to the table and read back by table scans.
+    Lets a disk-based internal temporary table use a format that is written
+    sequentially through a write cache (see create_internal_tmp_table()).
+  */
+  bool append_only;
 
   bool no_keyread;
   /**
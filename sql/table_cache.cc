@@ -51,6 +51,9 @@
 #include "table.h"
 #include "sql_base.h"
 #include "aligned.h"
+#ifdef HAVE_SCHED_GETCPU
+#include <sched.h>
+#endif
 
 
 /** Configuration. */
@@ -325,6 +328,25 @@ void tc_purge()
 }
 
 
+/**
+  Pick the table cache instance to be used by the current thread.
+
+  Threads that run on the same CPU use the same instance. Such threads
+  rarely compete for LOCK_table_cache, and the instance data stays in
+  the cache of that CPU. The thread id is used if the CPU is unknown.
+*/
+
+static inline uint32_t tc_instance(THD *thd, uint32_t n_instances)
+{
+#ifdef HAVE_SCHED_GETCPU
+  int cpu= sched_getcpu();
+  if (cpu >= 0)
+    return uint32_t(cpu) % n_instances;
+#endif
+  return uint32_t(thd->thread_id % n_instances);
+}
+
+
 /**
   Add new TABLE object to table cache.
 
@@ -344,7 +366,7 @@ void tc_purge()
 void tc_add_table(THD *thd, TABLE *table)
 {
   uint32_t i=
-    thd->thread_id % tc_active_instances.load(std::memory_order_relaxed);
+    tc_instance(thd, tc_active_instances.load(std::memory_order_relaxed));
   TABLE *LRU_table= 0;
   TDC_element *element= table->s->tdc;
 
@@ -398,7 +420,7 @@ void tc_add_table(THD *thd, TABLE *table)
 TABLE *tc_acquire_table(THD *thd, TDC_element *element)
 {
   uint32_t n_instances= tc_active_instances.load(std::memory_order_relaxed);
-  uint32_t i= thd->thread_id % n_instances;
+  uint32_t i= tc_instance(thd, n_instances);
   TABLE *table;
 
   tc[i].lock_and_check_contention(n_instances, i);
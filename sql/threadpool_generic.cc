@@ -118,6 +118,7 @@ static void queue_put(thread_group_t *thread_group, TP_connection_generic *conne
 static void queue_put(thread_group_t *thread_group, native_event *ev, int cnt);
 static int  wake_thread(thread_group_t *thread_group,bool due_to_stall);
 static int  wake_or_create_thread(thread_group_t *thread_group, bool due_to_stall=false);
+static void wake_idle_neighbour(thread_group_t *thread_group);
 static int  create_worker(thread_group_t *thread_group, bool due_to_stall);
 static void *worker_main(void *param);
 static void check_stall(thread_group_t *thread_group);
@@ -465,6 +466,10 @@ static TP_connection_generic* queue_get(thread_group_t* group, operation_origin
   if (ret)
   {
     TP_INCREMENT_GROUP_COUNTER(group, dequeues[(int)origin]);
+    if (MYSQL_THREADPOOL_DEQUEUE_ENABLED())
+    {
+      MYSQL_THREADPOOL_DEQUEUE(microsecond_interval_timer() - ret->enqueue_time);
+    }
   }
   return ret;
 }
@@ -496,6 +501,7 @@ static void queue_put(thread_group_t *thread_group, native_event *ev, int cnt)
     TP_connection_generic *c = (TP_connection_generic *)native_event_get_userdata(&ev[i]);
     c->enqueue_time= now;
     thread_group->queues[c->priority].push_back(c);
+    MYSQL_THREADPOOL_ENQUEUE(c->priority);
   }
 }
 
@@ -616,18 +622,26 @@ void check_stall(thread_group_t *thread_group)
   /*
    Bump priority for the low priority connections that spent too much
    time in low prio queue.
+
+   Connections with thread_pool_priority=low that are not inside a
+   transaction keep their priority. This lets the administrator demote
+   e.g reporting users, so that they only get the threads that high
+   priority connections leave over. Inside a transaction they are bumped,
+   as they might hold locks that high priority connections wait for.
   */
-  TP_connection_generic *c;
-  for (;;)
+  TP_connection_generic *c, *next;
+  for (c= thread_group->queues[TP_PRIORITY_LOW].front();
+       c && pool_timer.current_microtime - c->enqueue_time >
+            1000ULL * threadpool_prio_kickup_timer;
+       c= next)
   {
-    c= thread_group->queues[TP_PRIORITY_LOW].front();
-    if (c && pool_timer.current_microtime - c->enqueue_time > 1000ULL * threadpool_prio_kickup_timer)
-    {
-      thread_group->queues[TP_PRIORITY_LOW].remove(c);
-      thread_group->queues[TP_PRIORITY_HIGH].push_back(c);
-    }
-    else
-      break;
+    next= c->next_in_queue;
+    if (c->thd &&
+        c->thd->variables.threadpool_priority == TP_PRIORITY_LOW &&
+        !c->thd->transaction->is_active())
+      continue;
+    thread_group->queues[TP_PRIORITY_LOW].remove(c);
+    thread_group->queues[TP_PRIORITY_HIGH].push_back(c);
   }
 
   /*
@@ -826,6 +840,8 @@ static TP_connection_generic * listener(worker_thread_t *current_thread,
         }
       }
     }
+    else
+      wake_idle_neighbour(thread_group);
     mysql_mutex_unlock(&thread_group->mutex);
   }
 
@@ -1120,6 +1136,7 @@ static void queue_put(thread_group_t *thread_group, TP_connection_generic *conne
 
   connection->enqueue_time= threadpool_exact_stats?microsecond_interval_timer():pool_timer.current_microtime;
   thread_group->queues[connection->priority].push_back(connection);
+  MYSQL_THREADPOOL_ENQUEUE(connection->priority);
 
   if (thread_group->active_thread_count == 0)
     wake_or_create_thread(thread_group);
@@ -1140,6 +1157,104 @@ static bool too_many_threads(thread_group_t *thread_group)
 }
 
 
+/*
+  Work stealing between groups.
+
+  Connections are bound to a group by thread_id % group_count, so a group
+  may have a long queue while all of its threads are busy, and the threads
+  of other groups sleep. Therefore, a worker that found nothing to do in
+  its own group takes a queued event from a group that cannot handle it
+  itself, i.e has too many active threads or is stalled.
+
+  To preserve cache affinity, only the nearest groups are checked, and
+  the stolen connection returns to its home group in start_io(), once the
+  request is handled.
+
+  Mutex of the current group is held by the caller, mutex of the other
+  group is only tried, so that two groups stealing from each other can't
+  deadlock.
+*/
+
+#define TP_STEAL_MAX_NEIGHBOURS 4
+
+static bool group_needs_help(thread_group_t *thread_group)
+{
+  return !thread_group->shutdown && !is_queue_empty(thread_group) &&
+    (thread_group->stalled ||
+     thread_group->active_thread_count >= 1+(int)threadpool_oversubscribe);
+}
+
+
+static TP_connection_generic *steal_event(thread_group_t *thread_group)
+{
+  DBUG_ENTER("steal_event");
+  uint count= group_count;
+  uint group_id= (uint) (thread_group - all_groups);
+  uint n_neighbours= MY_MIN(count - 1, TP_STEAL_MAX_NEIGHBOURS);
+
+  for (uint i= 1; i <= n_neighbours; i++)
+  {
+    thread_group_t *victim= &all_groups[(group_id + i) % count];
+    if (victim == thread_group || mysql_mutex_trylock(&victim->mutex))
+      continue;
+
+    TP_connection_generic *c= NULL;
+    if (group_needs_help(victim) && (c= queue_get(victim)))
+    {
+      /* Detach the connection from the victim, like change_group() does */
+      if (c->bound_to_poll_descriptor)
+      {
+        io_poll_disassociate_fd(victim->pollfd, c->fd);
+        c->bound_to_poll_descriptor= false;
+      }
+      victim->connection_count--;
+      TP_INCREMENT_GROUP_COUNTER(victim, stolen);
+    }
+    mysql_mutex_unlock(&victim->mutex);
+
+    if (c)
+    {
+      c->thread_group= thread_group;
+      c->fix_group= true;
+      thread_group->connection_count++;
+      TP_INCREMENT_GROUP_COUNTER(thread_group, steals);
+      DBUG_RETURN(c);
+    }
+  }
+  DBUG_RETURN(NULL);
+}
+
+
+/*
+  Called by the listener that queued events, which no thread of its own
+  group is going to handle soon. Wake an idle worker in a neighbour group,
+  it will steal the event.
+*/
+
+static void wake_idle_neighbour(thread_group_t *thread_group)
+{
+  if (!group_needs_help(thread_group))
+    return;
+
+  uint count= group_count;
+  uint group_id= (uint) (thread_group - all_groups);
+  uint n_neighbours= MY_MIN(count - 1, TP_STEAL_MAX_NEIGHBOURS);
+
+  for (uint i= 1; i <= n_neighbours; i++)
+  {
+    thread_group_t *neighbour= &all_groups[(count + group_id - i) % count];
+    if (neighbour == thread_group || mysql_mutex_trylock(&neighbour->mutex))
+      continue;
+
+    bool woken= !neighbour->shutdown && !too_many_threads(neighbour) &&
+      is_queue_empty(neighbour) && !wake_thread(neighbour, false);
+    mysql_mutex_unlock(&neighbour->mutex);
+    if (woken)
+      return;
+  }
+}
+
+
 /**
   Retrieve a connection with pending event.
 
@@ -1220,6 +1335,10 @@ TP_connection_generic *get_event(worker_thread_t *current_thread,
       }
     }
 
+    /* Help an overloaded group before going to sleep */
+    if (!oversubscribed && (connection= steal_event(thread_group)))
+      break;
+
 
     /* And now, finally sleep */
     current_thread->woken = false; /* wake() sets this to true */
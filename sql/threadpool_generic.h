@@ -126,6 +126,8 @@ struct thread_group_counters_t
   ulonglong stalls;
   ulonglong dequeues[2];
   ulonglong polls[2];
+  ulonglong steals;
+  ulonglong stolen;
 };
 
 struct thread_group_t
@@ -44,6 +44,11 @@ class Unique :public Sql_alloc
                             it to be written to record_pointers.
                             always 0 for unions, > 0 for intersections */
   bool with_counters;
+  /*
+    The key of the element that was added last, or NULL.
+    Points into the tree, and is reset when the tree is emptied.
+  */
+  void *last_key;
 
   bool merge(TABLE *table, uchar *buff, size_t size, bool without_last_merge);
   bool flush();
@@ -60,10 +65,22 @@ class Unique :public Sql_alloc
   {
     DBUG_ENTER("unique_add");
     DBUG_PRINT("info", ("tree %u - %lu", tree.elements_in_tree, max_elements));
+    /*
+      Input that is sorted or clustered on the key is common. A repeated
+      key can be recognized without searching the tree, unless the
+      duplicates have to be counted.
+    */
+    if (last_key && !tree.compare(tree.custom_arg, last_key, ptr))
+      DBUG_RETURN(0);
     if (!(tree.flag & TREE_ONLY_DUPS) && 
         tree.elements_in_tree >= max_elements && flush())
       DBUG_RETURN(1);
-    DBUG_RETURN(!tree_insert(&tree, ptr, 0, tree.custom_arg));
+    TREE_ELEMENT *element= tree_insert(&tree, ptr, 0, tree.custom_arg);
+    if (!element)
+      DBUG_RETURN(1);
+    if (!with_counters && element != TREE_ELEMENT_UNIQUE)
+      last_key= ELEMENT_KEY((&tree), element);
+    DBUG_RETURN(0);
   }
 
   bool is_in_memory() { return (my_b_tell(&file) == 0); }
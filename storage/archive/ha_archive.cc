@@ -1303,6 +1303,37 @@ bool ha_archive::fix_rec_buff(unsigned int length)
   DBUG_RETURN(0);
 }
 
+/*
+  Skip a packed VARCHAR or BLOB value that is not in the read set.
+
+  RETURN
+    end of the packed value, or 0 if the row is damaged
+*/
+
+static const uchar *skip_packed_string(Field *field, const uchar *ptr,
+                                       const uchar *end)
+{
+  size_t length;
+  if (field->flags & BLOB_FLAG)
+  {
+    uint packlength= ((Field_blob*) field)->pack_length_no_ptr();
+    if (ptr + packlength > end)
+      return 0;
+    length= packlength + ((Field_blob*) field)->get_length(ptr, packlength);
+  }
+  else
+  {
+    uint length_bytes= ((Field_varstring*) field)->length_bytes;
+    if (ptr + length_bytes > end)
+      return 0;
+    length= length_bytes + (length_bytes == 1 ? (uint) *ptr : uint2korr(ptr));
+  }
+  if (length > (size_t) (end - ptr))
+    return 0;
+  return ptr + length;
+}
+
+
 int ha_archive::unpack_row(azio_stream *file_to_read, uchar *record)
 {
   DBUG_ENTER("ha_archive::unpack_row");
@@ -1349,8 +1380,19 @@ int ha_archive::unpack_row(azio_stream *file_to_read, uchar *record)
   {
     if (!((*field)->is_null_in_record(record)))
     {
-      if (!(ptr= (*field)->unpack(record + (*field)->offset(table->record[0]),
-                                  ptr, end)))
+      /*
+        Strings that are not read are skipped, like in get_row_version2().
+        Their packed length is known without unpacking them.
+      */
+      if (((*field)->flags & BLOB_FLAG ||
+           (*field)->real_type() == MYSQL_TYPE_VARCHAR ||
+           (*field)->real_type() == MYSQL_TYPE_VARCHAR_COMPRESSED) &&
+          !bitmap_is_set(table->read_set, (*field)->field_index))
+        ptr= skip_packed_string(*field, ptr, end);
+      else
+        ptr= (*field)->unpack(record + (*field)->offset(table->record[0]),
+                              ptr, end);
+      if (!ptr)
         DBUG_RETURN(HA_ERR_WRONG_IN_RECORD);
     }
   }
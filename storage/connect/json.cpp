@@ -150,8 +150,11 @@ PVL AllocVal(PGLOBAL g, JTYP type)
 /***********************************************************************/
 /* Parse a json string.                                                */
 /* Note: when pretty is not known, the caller set pretty to 3.         */
+/* When prj is not NULL, it is a NULL terminated list of the keys of   */
+/* the top object to parse; the values of other keys are skipped.      */
 /***********************************************************************/
-PJSON ParseJson(PGLOBAL g, char* s, size_t len, int* ptyp, bool* comma)
+PJSON ParseJson(PGLOBAL g, char* s, size_t len, int* ptyp, bool* comma,
+                PCSZ* prj)
 {
   int   i, pretty = (ptyp) ? *ptyp : 3;
   bool  b = false, pty[3] = { true,true,true };
@@ -189,8 +192,13 @@ PJSON ParseJson(PGLOBAL g, char* s, size_t len, int* ptyp, bool* comma)
       case '{':
         if (jsp)
           jsp = jdp->ParseAsArray(g, i, pretty, ptyp);
-        else if (!(jsp = jdp->ParseObject(g, ++i)))
-          throw 2;
+        else {
+          jdp->prj = prj;
+
+          if (!(jsp = jdp->ParseObject(g, ++i)))
+            throw 2;
+
+        } // endif jsp
 
         break;
       case ' ':
@@ -621,16 +629,30 @@ PJAR JDOC::ParseArray(PGLOBAL g, int& i)
 PJOB JDOC::ParseObject(PGLOBAL g, int& i)
 {
   PSZ   key;
+  PCSZ *keys = prj;
   int   level = -1;
   PJOB  jobp = new(g) JOBJECT;
   PJPR  jpp = NULL;
 
+  prj = NULL;                  // Inner objects are entirely parsed
+
   for (; i < len; i++)
     switch (s[i]) {
       case '"':
         if (level < 2) {
           key = ParseString(g, ++i);
-          jpp = jobp->AddPair(g, key);
+          jpp = NULL;
+
+          if (keys) {
+            for (PCSZ *kp = keys; *kp; kp++)
+              if (!strcmp(*kp, key)) {
+                jpp = jobp->AddPair(g, key);
+                break;
+              } // endif strcmp
+
+          } else
+            jpp = jobp->AddPair(g, key);
+
           level = 1;
         } else {
           snprintf(g->Message, sizeof(g->Message), "misplaced string near %.*s", ARGS);
@@ -640,7 +662,11 @@ PJOB JDOC::ParseObject(PGLOBAL g, int& i)
         break;
       case ':':
         if (level == 1) {
-          jpp->Val = ParseValue(g, ++i);
+          if (jpp)
+            jpp->Val = ParseValue(g, ++i);
+          else
+            SkipValue(g, ++i);
+
           level = 2;
         } else {
           snprintf(g->Message, sizeof(g->Message), "Unexpected ':' near %.*s", ARGS);
@@ -679,6 +705,67 @@ PJOB JDOC::ParseObject(PGLOBAL g, int& i)
   throw 2;
 } // end of ParseObject
 
+/***********************************************************************/
+/* Skip a JSON value that is not projected. The value is not checked   */
+/* nor allocated; on return i is on its last character.                */
+/***********************************************************************/
+void JDOC::SkipValue(PGLOBAL g, int& i)
+{
+  int level = 0;
+
+  for (; i < len; i++)
+    if (s[i] != ' ' && s[i] != '\t' && s[i] != '\r' && s[i] != '\n')
+      break;
+
+  for (; i < len; i++)
+    switch (s[i]) {
+      case '"':
+        for (i++; i < len && s[i] != '"'; i++)
+          if (s[i] == '\\')
+            i++;
+
+        if (i >= len)
+          throw("Unexpected EOF in String");
+        else if (!level)
+          return;
+
+        break;
+      case '[':
+      case '{':
+        level++;
+        break;
+      case ']':
+      case '}':
+        if (!level) {
+          i--;                 // End of the containing object
+          return;
+        } else if (!--level)
+          return;
+
+        break;
+      case ',':
+      case ' ':
+      case '\t':
+      case '\r':
+      case '\n':
+        if (!level) {
+          i--;                 // End of a scalar value
+          return;
+        } // endif level
+
+        break;
+      default:
+        break;
+    } // endswitch s[i]
+
+  if (level) {
+    snprintf(g->Message, sizeof(g->Message), "Unexpected EOF in Object");
+    throw 2;
+  } // endif level
+
+  i--;
+} // end of SkipValue
+
 /***********************************************************************/
 /* Parse a JSON Value.                                                 */
 /***********************************************************************/
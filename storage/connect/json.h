@@ -63,7 +63,8 @@ char *NextChr(PSZ s, char sep);
 char *GetJsonNull(void);
 const char* GetFmt(int type, bool un);
 
-PJSON ParseJson(PGLOBAL g, char* s, size_t n, int* prty = NULL, bool* b = NULL);
+PJSON ParseJson(PGLOBAL g, char* s, size_t n, int* prty = NULL, bool* b = NULL,
+                PCSZ* prj = NULL);
 PSZ   Serialize(PGLOBAL g, PJSON jsp, char *fn, int pretty);
 DllExport bool IsNum(PSZ s);
 bool  IsArray(PSZ s);
@@ -73,10 +74,10 @@ bool  Stringified(PCSZ strfy, char *colname);
 /* Class JDOC. The class for parsing and serializing json documents.   */
 /***********************************************************************/
 class JDOC: public BLOCK {
-	friend PJSON ParseJson(PGLOBAL, char*, size_t, int*, bool*);
+	friend PJSON ParseJson(PGLOBAL, char*, size_t, int*, bool*, PCSZ*);
 	friend PSZ Serialize(PGLOBAL, PJSON, char*, int);
 public:
-	JDOC(void) : js(NULL), s(NULL), len(0), dfp(0), pty(NULL) {}
+	JDOC(void) : js(NULL), s(NULL), len(0), dfp(0), pty(NULL), prj(NULL) {}
 
 	void  SetJp(JOUT* jp) { js = jp; }
 
@@ -86,6 +87,7 @@ class JDOC: public BLOCK {
 	PJVAL ParseValue(PGLOBAL g, int& i);
 	char *ParseString(PGLOBAL g, int& i);
 	void  ParseNumeric(PGLOBAL g, int& i, PJVAL jvp);
+	void  SkipValue(PGLOBAL g, int& i);
 	PJAR  ParseAsArray(PGLOBAL g, int& i, int pretty, int *ptyp);
 	bool  SerializeArray(PJAR jarp, bool b);
 	bool  SerializeObject(PJOB jobp);
@@ -97,6 +99,7 @@ class JDOC: public BLOCK {
 	char *s;
 	int   len, dfp;
 	bool *pty;
+	PCSZ *prj;          // Top object keys to parse, NULL for all
 }; // end of class JDOC
 
 /***********************************************************************/
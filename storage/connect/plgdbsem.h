@@ -18,6 +18,7 @@
 
 #define DOS_MAX_PATH    144   /* Must be the same across systems       */
 #define DOS_BUFF_LEN    100   /* Number of lines in binary file buffer */
+#define DOS_READ_BUFSIZE 65536 /* Stream buffer size for table scans */
 #undef  DOMAIN                /* For Unix version                      */
 
 enum BLKTYP {TYPE_TABLE      = 50,    /* Table Name/Srcdef/... Block   */
@@ -841,6 +841,7 @@ TDBJSN::TDBJSN(PJDEF tdp, PTXF txfp) : TDBDOS(tdp, txfp)
     Strict = false;
   } // endif tdp
 
+  Prj = NULL;
   Fpos = -1;
   N = M = 0;
   NextSame = 0;
@@ -859,6 +860,7 @@ TDBJSN::TDBJSN(TDBJSN* tdbp) : TDBDOS(NULL, tdbp)
 	Jmode = tdbp->Jmode;
 	Objname = tdbp->Objname;
 	Xcol = tdbp->Xcol;
+	Prj = tdbp->Prj;
 	Fpos = tdbp->Fpos;
 	N = tdbp->N;
 	M = tdbp->M;
@@ -1086,9 +1088,45 @@ bool TDBJSN::OpenDB(PGLOBAL g)
   if (Xcol)
     To_Filter = NULL;              // Imcompatible
 
+  Prj = MakeProjection(g);
   return false;
 } // end of OpenDB
 
+/***********************************************************************/
+/*  Make the list of the row keys used by the columns, so that only    */
+/*  their values are parsed in each line. This is only done when       */
+/*  reading one object per line whose keys are all directly used.      */
+/***********************************************************************/
+PCSZ *TDBJSN::MakeProjection(PGLOBAL g)
+{
+  PCSZ *prj;
+  int   n = 0;
+
+  if (Mode != MODE_READ || Pretty != 0 || Jmode != MODE_OBJECT || Objname)
+    return NULL;
+
+  for (PCOL cp = Columns; cp; cp = cp->GetNext())
+    if (cp->IsSpecial())
+      continue;
+    else if (((PJCOL)cp)->Nod < 1 || ((PJCOL)cp)->Nodes[0].Op != OP_EXIST)
+      return NULL;
+    else
+      n++;
+
+  if (!n)
+    return NULL;                   // E.g. column discovery
+
+  prj = (PCSZ*)PlugSubAlloc(g, NULL, (n + 1) * sizeof(PCSZ));
+  n = 0;
+
+  for (PCOL cp = Columns; cp; cp = cp->GetNext())
+    if (!cp->IsSpecial())
+      prj[n++] = ((PJCOL)cp)->Nodes[0].Key;
+
+  prj[n] = NULL;
+  return prj;
+} // end of MakeProjection
+
 /***********************************************************************/
 /*  SkipHeader: Physically skip first header line if applicable.       */
 /*  This is called from TDBDOS::OpenDB and must be executed before     */
@@ -1137,7 +1175,8 @@ int TDBJSN::ReadDB(PGLOBAL g) {
 			// Recover the memory used for parsing
 			PlugSubSet(G->Sarea, G->Sarea_Size);
 
-			if ((Row = ParseJson(G, To_Line, strlen(To_Line), &Pretty, &Comma))) {
+			if ((Row = ParseJson(G, To_Line, strlen(To_Line), &Pretty, &Comma,
+			                     Prj))) {
 				Row = FindRow(g);
 				SameRow = 0;
 				Fpos++;
@@ -171,6 +171,7 @@ class DllExport TDBJSN : public TDBDOS {
 protected:
           PJSON FindRow(PGLOBAL g);
           bool  MakeTopTree(PGLOBAL g, PJSON jsp);
+          PCSZ *MakeProjection(PGLOBAL g);
 
   // Members
 	PGLOBAL G;											 // Support of parse memory
@@ -181,6 +182,7 @@ class DllExport TDBJSN : public TDBDOS {
 	JMODE   Jmode;                   // MODE_OBJECT by default
 	PCSZ    Objname;                 // The table object name
 	PCSZ    Xcol;                    // Name of expandable column
+	PCSZ   *Prj;                     // Row keys to parse, NULL for all
 	int     Fpos;                    // The current row index
 	int     N;                       // The current Rownum
 	int     M;                       // Index of multiple value
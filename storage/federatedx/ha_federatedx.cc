@@ -322,6 +322,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "sql_show.h"                           // append_identifier()
 #include "tztime.h"                             // my_tz_find()
 #include "sql_select.h"
+#include "key.h"                                // key_cmp()
 
 #ifdef I_AM_PARANOID
 #define MIN_PORT 1023
@@ -860,7 +861,7 @@ static int parse_url(MEM_ROOT *mem_root, FEDERATEDX_SHARE *share,
 ha_federatedx::ha_federatedx(handlerton *hton,
                            TABLE_SHARE *table_arg)
   :handler(hton, table_arg),
-   txn(0), io(0), stored_result(0)
+   txn(0), io(0), stored_result(0), mrr_batched(FALSE)
 {
   bzero(&bulk_insert, sizeof(bulk_insert));
 }
@@ -1822,6 +1823,8 @@ int ha_federatedx::open(const char *name, int mode, uint test_if_locked)
   DBUG_PRINT("info", ("ref_length: %u", ref_length));
 
   my_init_dynamic_array(PSI_INSTRUMENT_ME, &results, sizeof(FEDERATEDX_IO_RESULT*), 4, 4, MYF(0));
+  my_init_dynamic_array(PSI_INSTRUMENT_ME, &mrr_ranges, sizeof(mrr_range),
+                        FEDERATEDX_MRR_BATCH_SIZE, 0, MYF(0));
 
   reset();
 
@@ -1864,6 +1867,8 @@ int ha_federatedx::close(void)
   reset();
 
   delete_dynamic(&results);
+  delete_dynamic(&mrr_ranges);
+  mrr_keys.free();
 
   /* Disconnect from mysql */
   if (!thd || !(txn= get_txn(thd, true)))
@@ -2765,6 +2770,180 @@ int ha_federatedx::read_range_next()
 }
 
 
+/*
+  Multi-range read for Batched Key Access.
+
+  Without MRR, every outer row of a join causes a separate
+  SELECT ... WHERE key = value round trip to the remote server.
+  For single-point ranges we instead send up to FEDERATEDX_MRR_BATCH_SIZE
+  keys in one query, OR'ing the conditions of the ranges, and match each
+  returned row against the keys of the batch with key_cmp() to find the
+  range(s) it belongs to. A row that matches several ranges (duplicate
+  keys in the join buffer) is returned once for each of them.
+*/
+
+ha_rows ha_federatedx::multi_range_read_info(uint keyno, uint n_ranges,
+                                             uint keys, uint key_parts,
+                                             uint *bufsz, uint *mrr_mode,
+                                             Cost_estimate *cost)
+{
+  ha_rows rows= handler::multi_range_read_info(keyno, n_ranges, keys,
+                                               key_parts, bufsz, mrr_mode,
+                                               cost);
+  if ((*mrr_mode & HA_MRR_SINGLE_POINT) && !(*mrr_mode & HA_MRR_SORTED))
+    *mrr_mode&= ~HA_MRR_USE_DEFAULT_IMPL;
+  return rows;
+}
+
+
+int ha_federatedx::multi_range_read_init(RANGE_SEQ_IF *seq,
+                                         void *seq_init_param,
+                                         uint n_ranges, uint mrr_mode,
+                                         HANDLER_BUFFER *buf)
+{
+  DBUG_ENTER("ha_federatedx::multi_range_read_init");
+
+  mrr_batched= !(mrr_mode & (HA_MRR_USE_DEFAULT_IMPL | HA_MRR_SORTED)) &&
+               (mrr_mode & HA_MRR_SINGLE_POINT);
+  if (!mrr_batched)
+    DBUG_RETURN(handler::multi_range_read_init(seq, seq_init_param,
+                                               n_ranges, mrr_mode, buf));
+
+  mrr_iter= seq->init(seq_init_param, n_ranges, mrr_mode);
+  mrr_funcs= *seq;
+  mrr_no_association= MY_TEST(mrr_mode & HA_MRR_NO_ASSOCIATION);
+  mrr_row_pending= FALSE;
+  mrr_seq_eof= FALSE;
+  /* The key columns are needed to match the rows against the ranges */
+  KEY *key_info= &table->key_info[active_index];
+  for (uint i= 0; i < key_info->user_defined_key_parts; i++)
+    bitmap_set_bit(table->read_set, key_info->key_part[i].field->field_index);
+  if (stored_result)
+    (void) free_result();
+  DBUG_RETURN(0);
+}
+
+
+/*
+  Send the next batch of ranges to the remote server
+
+  RETURN VALUE
+    0                    a result set was stored
+    HA_ERR_END_OF_FILE   the range sequence is exhausted
+    other                error
+*/
+
+int ha_federatedx::mrr_read_batch()
+{
+  char sql_query_buffer[FEDERATEDX_QUERY_BUFFER_SIZE];
+  char cond_buffer[FEDERATEDX_QUERY_BUFFER_SIZE];
+  String sql_query(sql_query_buffer, sizeof(sql_query_buffer), &my_charset_bin);
+  String cond(cond_buffer, sizeof(cond_buffer), &my_charset_bin);
+  KEY *key_info= &table->key_info[active_index];
+  const size_t where_length= sizeof(" WHERE ") - 1;
+  int retval;
+  DBUG_ENTER("ha_federatedx::mrr_read_batch");
+
+  if (stored_result)
+    (void) free_result();
+  reset_dynamic(&mrr_ranges);
+  mrr_keys.length(0);
+
+  sql_query.length(0);
+  sql_query.append(share->select_query);
+  sql_query.append(STRING_WITH_LEN(" WHERE "));
+  while (mrr_ranges.elements < FEDERATEDX_MRR_BATCH_SIZE)
+  {
+    if (mrr_funcs.next(mrr_iter, &mrr_cur_range))
+    {
+      mrr_seq_eof= TRUE;
+      break;
+    }
+    const key_range *key= &mrr_cur_range.start_key;
+    mrr_range range= { mrr_keys.length(), key->length, mrr_cur_range.ptr };
+
+    cond.length(0);
+    if (create_where_from_key(&cond, key_info, key, NULL, FALSE) ||
+        (mrr_ranges.elements && sql_query.append(STRING_WITH_LEN(" OR "))) ||
+        sql_query.append('(') ||
+        sql_query.append(cond.ptr() + where_length,
+                         cond.length() - where_length) ||
+        sql_query.append(')') ||
+        mrr_keys.append((const char*) key->key, key->length) ||
+        insert_dynamic(&mrr_ranges, (uchar*) &range))
+      DBUG_RETURN(HA_ERR_OUT_OF_MEM);
+  }
+
+  if (!mrr_ranges.elements)
+    DBUG_RETURN(HA_ERR_END_OF_FILE);
+
+  if ((retval= txn->acquire(share, ha_thd(), TRUE, &io)))
+    DBUG_RETURN(retval);
+
+  if (io->query(sql_query.ptr(), sql_query.length()))
+  {
+    char error_buffer[FEDERATEDX_QUERY_BUFFER_SIZE];
+    snprintf(error_buffer, sizeof(error_buffer), "error: %d '%s'",
+             io->error_code(), io->error_str());
+    my_error(ER_QUERY_ON_FOREIGN_DATA_SOURCE, MYF(0), error_buffer);
+    DBUG_RETURN(ER_QUERY_ON_FOREIGN_DATA_SOURCE);
+  }
+
+  if (!(stored_result= io->store_result()))
+    DBUG_RETURN(HA_ERR_END_OF_FILE);
+
+  DBUG_RETURN(0);
+}
+
+
+int ha_federatedx::multi_range_read_next(range_id_t *range_info)
+{
+  KEY_PART_INFO *key_part= table->key_info[active_index].key_part;
+  int retval;
+  DBUG_ENTER("ha_federatedx::multi_range_read_next");
+
+  if (!mrr_batched)
+    DBUG_RETURN(handler::multi_range_read_next(range_info));
+
+  for (;;)
+  {
+    /* Return the current row once for each range that it matches */
+    while (mrr_row_pending && mrr_range_no < mrr_ranges.elements)
+    {
+      mrr_range *range= dynamic_element(&mrr_ranges, mrr_range_no++,
+                                        mrr_range*);
+      if (mrr_no_association ||
+          !key_cmp(key_part, (const uchar*) mrr_keys.ptr() + range->key_offset,
+                   range->key_length))
+      {
+        if (mrr_no_association)
+          mrr_row_pending= FALSE;
+        *range_info= range->ptr;
+        DBUG_RETURN(0);
+      }
+    }
+    mrr_row_pending= FALSE;
+
+    if (stored_result)
+    {
+      retval= read_next(table->record[0], stored_result);
+      if (!retval)
+      {
+        mrr_row_pending= TRUE;
+        mrr_range_no= 0;
+        continue;
+      }
+      if (retval != HA_ERR_END_OF_FILE)
+        DBUG_RETURN(retval);
+    }
+    if (mrr_seq_eof)
+      DBUG_RETURN(HA_ERR_END_OF_FILE);
+    if ((retval= mrr_read_batch()))
+      DBUG_RETURN(retval);
+  }
+}
+
+
 /* Used to read forward through the index.  */
 int ha_federatedx::index_next(uchar *buf)
 {
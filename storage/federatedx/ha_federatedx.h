@@ -90,6 +90,8 @@ typedef struct st_fedrated_server {
 #define FEDERATEDX_QUERY_BUFFER_SIZE STRING_BUFFER_USUAL_SIZE * 5
 #define FEDERATEDX_RECORDS_IN_RANGE 2
 #define FEDERATEDX_MAX_KEY_LENGTH 3500 // Same as innodb
+/* Maximum number of keys sent to the remote server in one MRR query */
+#define FEDERATEDX_MRR_BATCH_SIZE 100
 
 /*
   FEDERATEDX_SHARE is a structure that will be shared amoung all open handlers
@@ -280,6 +282,21 @@ class ha_federatedx final : public handler
   bool ignore_duplicates, replace_duplicates;
   bool insert_dup_update, table_will_be_deleted;
   DYNAMIC_STRING bulk_insert;
+  /*
+    Batched multi-range read: the keys of the ranges whose rows are
+    fetched by the current remote query, and the position in mrr_ranges
+    of the next range to match against the current row.
+  */
+  struct mrr_range
+  {
+    size_t key_offset;
+    uint key_length;
+    range_id_t ptr;
+  };
+  DYNAMIC_ARRAY mrr_ranges;
+  String mrr_keys;
+  uint mrr_range_no;
+  bool mrr_batched, mrr_no_association, mrr_row_pending, mrr_seq_eof;
 
 private:
   /*
@@ -306,6 +323,7 @@ class ha_federatedx final : public handler
   bool append_stmt_insert(String *query);
 
   int read_next(uchar *buf, FEDERATEDX_IO_RESULT *result);
+  int mrr_read_batch();
   int index_read_idx_with_result_set(uchar *buf, uint index,
                                      const uchar *key,
                                      uint key_len,
@@ -413,6 +431,13 @@ class ha_federatedx final : public handler
                                const key_range *end_key,
                                bool eq_range, bool sorted) override;
   int read_range_next() override;
+  ha_rows multi_range_read_info(uint keyno, uint n_ranges, uint keys,
+                                uint key_parts, uint *bufsz,
+                                uint *mrr_mode, Cost_estimate *cost) override;
+  int multi_range_read_init(RANGE_SEQ_IF *seq, void *seq_init_param,
+                            uint n_ranges, uint mrr_mode,
+                            HANDLER_BUFFER *buf) override;
+  int multi_range_read_next(range_id_t *range_info) override;
   /*
     unlike index_init(), rnd_init() can be called two times
     without rnd_end() in between (it only makes sense if scan=1).
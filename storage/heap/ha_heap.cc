@@ -651,6 +651,7 @@ static int heap_prepare_hp_create_info(TABLE *table_arg, bool internal_table,
   ha_rows max_rows;
   HP_KEYDEF *keydef;
   HA_KEYSEG *seg;
+  HP_BLOB_DESC *blob_descs;
   bool found_real_auto_increment= 0;
 
   bzero(hp_create_info, sizeof(*hp_create_info));
@@ -662,8 +663,15 @@ static int heap_prepare_hp_create_info(TABLE *table_arg, bool internal_table,
                        MYF(MY_WME | MY_THREAD_SPECIFIC),
                        &keydef, keys * sizeof(HP_KEYDEF),
                        &seg, parts * sizeof(HA_KEYSEG),
+                       &blob_descs, share->blob_fields * sizeof(HP_BLOB_DESC),
                        NULL))
     return my_errno;
+  for (uint i= 0; i < share->blob_fields; i++)
+  {
+    Field_blob *field= (Field_blob*) table_arg->field[share->blob_field[i]];
+    blob_descs[i].offset= (uint) (field->ptr - table_arg->record[0]);
+    blob_descs[i].packlength= field->pack_length_no_ptr();
+  }
   for (key= 0; key < keys; key++)
   {
     KEY *pos= table_arg->key_info+key;
@@ -692,6 +700,13 @@ static int heap_prepare_hp_create_info(TABLE *table_arg, bool internal_table,
     {
       Field *field= key_part->field;
 
+      if (field->flags & BLOB_FLAG)
+      {
+        /* Blobs are stored outside of the record and can't be indexed */
+        my_free(keydef);
+        return HA_WRONG_CREATE_OPTION;
+      }
+
       if (pos->algorithm == HA_KEY_ALG_BTREE)
 	seg->type= field->key_type();
       else
@@ -768,6 +783,8 @@ static int heap_prepare_hp_create_info(TABLE *table_arg, bool internal_table,
   hp_create_info->keys= share->keys;
   hp_create_info->reclength= share->reclength;
   hp_create_info->keydef= keydef;
+  hp_create_info->blobs= share->blob_fields;
+  hp_create_info->blob_descs= blob_descs;
   return 0;
 }
 
@@ -57,6 +57,16 @@ typedef struct {
   uint key_length;
   uint search_flag;
 } heap_rb_param;
+
+/*
+  A blob value is stored in its own chunk; the record keeps the length
+  and a pointer to the data after the chunk header.
+*/
+typedef struct st_hp_blob_chunk
+{
+  struct st_hp_blob_chunk *prev, *next;
+  size_t alloc_length;
+} HP_BLOB_CHUNK;
       
 	/* Prototypes for intern functions */
 
@@ -100,6 +110,12 @@ extern void hp_clear(HP_SHARE *info);
 extern void hp_clear_keys(HP_SHARE *info);
 extern uint hp_rb_pack_key(HP_KEYDEF *keydef, uchar *key, const uchar *old,
                            key_part_map keypart_map);
+extern int hp_copy_blobs(HP_SHARE *share, const uchar *record,
+                         uchar **blob_ptrs);
+extern void hp_store_blobs(HP_SHARE *share, uchar *pos, uchar **blob_ptrs);
+extern void hp_free_blob_copies(HP_SHARE *share, uchar **blob_ptrs);
+extern void hp_free_blobs(HP_SHARE *share, const uchar *pos);
+extern void hp_free_all_blobs(HP_SHARE *share);
 
 extern mysql_mutex_t THR_LOCK_heap;
 
@@ -107,6 +123,7 @@ extern PSI_memory_key hp_key_memory_HP_SHARE;
 extern PSI_memory_key hp_key_memory_HP_INFO;
 extern PSI_memory_key hp_key_memory_HP_PTRS;
 extern PSI_memory_key hp_key_memory_HP_KEYDEF;
+extern PSI_memory_key hp_key_memory_HP_BLOB;
 
 #ifdef HAVE_PSI_INTERFACE
 void init_heap_psi_keys();
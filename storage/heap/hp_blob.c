@@ -0,0 +1,172 @@
+/* Copyright (c) 2026, MariaDB
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+/*
+  Storage of blob columns
+
+  A record holds a blob as its length followed by a pointer to the data.
+  When a record is written, every non-empty blob value is copied to a chunk
+  owned by the table and the pointer in the stored record is changed to
+  point to the copy. The chunks are linked in the share so that they can
+  be freed when the table is emptied. Blob columns can't be part of a key.
+*/
+
+#include "heapdef.h"
+
+
+static inline size_t hp_blob_length(const HP_BLOB_DESC *desc,
+                                    const uchar *record)
+{
+  const uchar *pos= record + desc->offset;
+  switch (desc->packlength) {
+  case 1: return *pos;
+  case 2: return uint2korr(pos);
+  case 3: return uint3korr(pos);
+  default: return uint4korr(pos);
+  }
+}
+
+
+static inline uchar **hp_blob_data(const HP_BLOB_DESC *desc, uchar *record)
+{
+  return (uchar**) (record + desc->offset + desc->packlength);
+}
+
+
+/*
+  Copy the blob values of a record to new chunks
+
+  SYNOPSIS
+    hp_copy_blobs()
+    share	Heap table share
+    record	Record with blob pointers to the caller's data
+    blob_ptrs	Gets a pointer to each copy, or 0 for an empty value
+
+  RETURN
+    0		ok
+    #		error number; nothing is allocated
+*/
+
+int hp_copy_blobs(HP_SHARE *share, const uchar *record, uchar **blob_ptrs)
+{
+  HP_BLOB_DESC *desc, *end;
+  uint i;
+  int error;
+  DBUG_ENTER("hp_copy_blobs");
+
+  for (desc= share->blob_descs, end= desc + share->blobs, i= 0; desc < end;
+       desc++, i++)
+  {
+    size_t length= hp_blob_length(desc, record);
+    size_t alloc_length= sizeof(HP_BLOB_CHUNK) + length;
+    HP_BLOB_CHUNK *chunk;
+
+    blob_ptrs[i]= 0;
+    if (!length)
+      continue;
+    if (share->data_length + share->index_length + alloc_length >=
+        share->max_table_size)
+    {
+      my_errno= HA_ERR_RECORD_FILE_FULL;
+      goto err;
+    }
+    if (!(chunk= (HP_BLOB_CHUNK*) my_malloc(hp_key_memory_HP_BLOB,
+                                            alloc_length,
+                                            MYF(share->internal ?
+                                                MY_THREAD_SPECIFIC : 0))))
+    {
+      my_errno= HA_ERR_OUT_OF_MEM;
+      goto err;
+    }
+    chunk->alloc_length= alloc_length;
+    chunk->prev= 0;
+    if ((chunk->next= share->blob_chunks))
+      chunk->next->prev= chunk;
+    share->blob_chunks= chunk;
+    share->data_length+= alloc_length;
+    blob_ptrs[i]= (uchar*) (chunk + 1);
+    memcpy(blob_ptrs[i], *hp_blob_data(desc, (uchar*) record), length);
+  }
+  DBUG_RETURN(0);
+
+err:
+  error= my_errno;
+  while (++i < share->blobs)
+    blob_ptrs[i]= 0;
+  hp_free_blob_copies(share, blob_ptrs);
+  DBUG_RETURN(my_errno= error);
+}
+
+
+static void hp_free_chunk(HP_SHARE *share, HP_BLOB_CHUNK *chunk)
+{
+  if (chunk->prev)
+    chunk->prev->next= chunk->next;
+  else
+    share->blob_chunks= chunk->next;
+  if (chunk->next)
+    chunk->next->prev= chunk->prev;
+  share->data_length-= chunk->alloc_length;
+  my_free(chunk);
+}
+
+
+/* Free the copies made by hp_copy_blobs() of a record that was not stored */
+
+void hp_free_blob_copies(HP_SHARE *share, uchar **blob_ptrs)
+{
+  uint i;
+  for (i= 0; i < share->blobs; i++)
+    if (blob_ptrs[i])
+      hp_free_chunk(share, ((HP_BLOB_CHUNK*) blob_ptrs[i]) - 1);
+}
+
+
+/* Point the blobs of a stored record to the copies made by hp_copy_blobs() */
+
+void hp_store_blobs(HP_SHARE *share, uchar *pos, uchar **blob_ptrs)
+{
+  HP_BLOB_DESC *desc, *end;
+  for (desc= share->blob_descs, end= desc + share->blobs; desc < end; desc++)
+    *hp_blob_data(desc, pos)= *blob_ptrs++;
+}
+
+
+/* Free the blob values of a stored record */
+
+void hp_free_blobs(HP_SHARE *share, const uchar *pos)
+{
+  HP_BLOB_DESC *desc, *end;
+  for (desc= share->blob_descs, end= desc + share->blobs; desc < end; desc++)
+  {
+    if (hp_blob_length(desc, pos))
+      hp_free_chunk(share, ((HP_BLOB_CHUNK*) *hp_blob_data(desc, (uchar*) pos))
+                    - 1);
+  }
+}
+
+
+/* Free all blob values of the table */
+
+void hp_free_all_blobs(HP_SHARE *share)
+{
+  HP_BLOB_CHUNK *chunk, *next;
+  for (chunk= share->blob_chunks; chunk; chunk= next)
+  {
+    next= chunk->next;
+    my_free(chunk);
+  }
+  share->blob_chunks= 0;
+}
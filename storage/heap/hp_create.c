@@ -162,7 +162,8 @@ int heap_create(const char *name, HP_CREATE_INFO *create_info,
     if (!(share= (HP_SHARE*) my_malloc(hp_key_memory_HP_SHARE,
                                        sizeof(HP_SHARE)+
 				       keys*sizeof(HP_KEYDEF)+
-				       key_segs*sizeof(HA_KEYSEG),
+				       key_segs*sizeof(HA_KEYSEG)+
+				       create_info->blobs*sizeof(HP_BLOB_DESC),
 				       MYF(MY_ZEROFILL |
                                            (create_info->internal_table ?
                                             MY_THREAD_SPECIFIC : 0)))))
@@ -216,6 +217,10 @@ int heap_create(const char *name, HP_CREATE_INFO *create_info,
     share->blength= 1;
     share->keys= keys;
     share->max_key_length= max_length;
+    share->blobs= create_info->blobs;
+    share->blob_descs= (HP_BLOB_DESC*) keyseg;
+    memcpy(share->blob_descs, create_info->blob_descs,
+           create_info->blobs * sizeof(HP_BLOB_DESC));
     share->changed= 0;
     share->auto_key= create_info->auto_key;
     share->auto_key_type= create_info->auto_key_type;
@@ -119,15 +119,20 @@ uchar *hp_search(HP_INFO *info, HP_KEYDEF *keyinfo, const uchar *key,
 
   if (share->records)
   {
-    ulong search_pos=
-      hp_mask(hp_hashnr(keyinfo, key), share->blength, share->records);
+    ulong hashnr= hp_hashnr(keyinfo, key);
+    ulong search_pos= hp_mask(hashnr, share->blength, share->records);
     pos=hp_find_hash(&keyinfo->block, search_pos);
     if (search_pos !=
         hp_mask(pos->hash_of_key, share->blength, share->records))
       goto not_found;                           /* Wrong link */
     do
     {
-      if (!hp_key_cmp(keyinfo, pos->ptr_to_rec, key))
+      /*
+        Compare the stored hash value first, to not touch the record of
+        every key in the chain
+      */
+      if (pos->hash_of_key == hashnr &&
+          !hp_key_cmp(keyinfo, pos->ptr_to_rec, key))
       {
 	switch (nextflag) {
 	case 0:					/* Search after key */
@@ -184,11 +189,14 @@ uchar *hp_search(HP_INFO *info, HP_KEYDEF *keyinfo, const uchar *key,
 uchar *hp_search_next(HP_INFO *info, HP_KEYDEF *keyinfo, const uchar *key,
 		      HASH_INFO *pos)
 {
+  /* The last found key has the same hash value as the searched one */
+  ulong hashnr= pos->hash_of_key;
   DBUG_ENTER("hp_search_next");
 
   while ((pos= pos->next_key))
   {
-    if (! hp_key_cmp(keyinfo, pos->ptr_to_rec, key))
+    if (pos->hash_of_key == hashnr &&
+        ! hp_key_cmp(keyinfo, pos->ptr_to_rec, key))
     {
       info->current_hash_ptr=pos;
       DBUG_RETURN (info->current_ptr= pos->ptr_to_rec);
@@ -27,6 +27,7 @@ LIST *heap_open_list=0,*heap_share_list=0;
 PSI_memory_key hp_key_memory_HP_SHARE;
 PSI_memory_key hp_key_memory_HP_INFO;
 PSI_memory_key hp_key_memory_HP_PTRS;
+PSI_memory_key hp_key_memory_HP_BLOB;
 PSI_memory_key hp_key_memory_HP_KEYDEF;
 
 #ifdef HAVE_PSI_INTERFACE
@@ -36,6 +37,7 @@ static PSI_memory_info all_heap_memory[]=
   { & hp_key_memory_HP_SHARE, "HP_SHARE", 0},
   { & hp_key_memory_HP_INFO, "HP_INFO", 0},
   { & hp_key_memory_HP_PTRS, "HP_PTRS", 0},
+  { & hp_key_memory_HP_BLOB, "HP_BLOB", 0},
   { & hp_key_memory_HP_KEYDEF, "HP_KEYDEF", 0}
 };
 
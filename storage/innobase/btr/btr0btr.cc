@@ -485,6 +485,9 @@ btr_page_create(
 				   level);
     mtr->write<8,mtr_t::MAYBE_NOP>(*block, index_id, index->id);
   }
+
+  if (block->page.id().space() != SRV_TMP_SPACE_ID)
+    buf_pool.index_stats_add(block, index->id, false);
 }
 
 buf_block_t *
@@ -929,6 +932,9 @@ static void btr_root_page_init(buf_block_t *block, index_id_t index_id,
         *block, PAGE_HEADER + PAGE_LEVEL + block->page.frame, 0U);
     mtr->write<8,mtr_t::MAYBE_NOP>(*block, page_index_id, index_id);
   }
+
+  if (block->page.id().space() != SRV_TMP_SPACE_ID)
+    buf_pool.index_stats_add(block, index_id, false);
 }
 
 /** Create the root node for a new index tree.
@@ -92,6 +92,11 @@ PageBulk::init()
 							+ new_page, m_level);
 			m_mtr.write<8>(*new_block, index_id, m_index->id);
 		}
+
+		if (!m_index->table->is_temporary()) {
+			buf_pool.index_stats_add(new_block, m_index->id,
+						 false);
+		}
 	} else {
 		new_block = btr_block_get(*m_index, m_page_no, RW_X_LATCH,
 					  &m_mtr);
@@ -112,6 +117,9 @@ PageBulk::init()
 	if (!m_level && !m_index->is_primary()) {
 		page_update_max_trx_id(new_block, m_page_zip, m_trx_id,
 				       &m_mtr);
+		/* The records will not be inserted by
+		page_cur_insert_rec_low(). */
+		page_sec_untrack(new_block);
 	}
 
 	m_block = new_block;
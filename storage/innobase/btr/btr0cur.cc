@@ -2229,6 +2229,107 @@ static void btr_cur_prefetch_siblings(const buf_block_t *block,
                              block->zip_size());
 }
 
+/** Read asynchronously the first leaf pages of an index scan.
+This is invoked by ha_partition before the partitions are read one after
+another, so that the page reads for all partitions can be in flight
+at the same time.
+@param index   B-tree index
+@param tuple   start key of an ascending scan, or nullptr to start
+               from either end of the index
+@param last    whether the scan starts from the end of the index
+@param n       maximum number of pages to read */
+void btr_cur_prefetch_scan(dict_index_t *index, const dtuple_t *tuple,
+                           bool last, ulint n)
+{
+  ut_ad(index->is_btree());
+  ut_ad(!tuple || !last);
+
+  fil_space_t *space= index->table->space;
+  if (!space || index->page == FIL_NULL)
+    return;
+
+  uint32_t page_nos[64];
+  ulint n_pages= 0;
+  n= std::min<ulint>(n, array_elements(page_nos));
+  const ulint zip_size= space->zip_size();
+  mem_heap_t *heap= nullptr;
+  rec_offs offsets_[REC_OFFS_NORMAL_SIZE];
+  rec_offs *offsets= offsets_;
+  rec_offs_init(offsets_);
+
+  mtr_t mtr;
+  mtr.start();
+  mtr_s_lock_index(index, &mtr);
+  dberr_t err;
+  buf_block_t *block= btr_root_block_get(index, RW_S_LATCH, &mtr, &err);
+
+  /* Descend to the level above the leaf pages, and collect the child
+  page numbers of the node pointers where the scan would start. */
+  while (block && !page_is_leaf(block->page.frame))
+  {
+    page_cur_t cur;
+    cur.index= index;
+    cur.block= block;
+
+    if (tuple)
+    {
+      ulint up_match= 0, low_match= 0;
+      if (page_cur_search_with_match(tuple, PAGE_CUR_L, &up_match,
+                                     &low_match, &cur, nullptr))
+        break;
+      if (page_rec_is_infimum(cur.rec) && !page_cur_move_to_next(&cur))
+        break;
+    }
+    else if (last)
+    {
+      page_cur_set_after_last(block, &cur);
+      if (!page_cur_move_to_prev(&cur))
+        break;
+    }
+    else
+    {
+      page_cur_set_before_first(block, &cur);
+      if (!page_cur_move_to_next(&cur))
+        break;
+    }
+
+    if (!page_rec_is_user_rec(cur.rec))
+      break;
+
+    if (btr_page_get_level(block->page.frame) == 1)
+    {
+      do
+      {
+        offsets= rec_get_offsets(cur.rec, index, offsets, 0,
+                                 ULINT_UNDEFINED, &heap);
+        page_nos[n_pages++]= btr_node_ptr_get_child_page_no(cur.rec, offsets);
+      }
+      while (n_pages < n &&
+             (last ? page_cur_move_to_prev(&cur)
+              : page_cur_move_to_next(&cur)) &&
+             page_rec_is_user_rec(cur.rec));
+      break;
+    }
+
+    offsets= rec_get_offsets(cur.rec, index, offsets, 0, ULINT_UNDEFINED,
+                             &heap);
+    block= buf_page_get_gen(page_id_t(space->id,
+                                      btr_node_ptr_get_child_page_no(cur.rec,
+                                                                     offsets)),
+                            zip_size, RW_S_LATCH, nullptr, BUF_GET, &mtr,
+                            &err);
+  }
+
+  mtr.commit();
+  if (UNIV_LIKELY_NULL(heap))
+    mem_heap_free(heap);
+
+  for (ulint i= 0; i < n_pages; i++)
+    if (space->acquire())
+      buf_read_page_background(space, page_id_t(space->id, page_nos[i]),
+                               zip_size);
+}
+
 /*************************************************************//**
 Tries to perform an insert to a page in an index tree, next to cursor.
 It is assumed that mtr holds an x-latch on the page. The operation does
@@ -2472,7 +2573,7 @@ btr_cur_optimistic_insert(
 		ut_ad(flags == BTR_NO_LOCKING_FLAG);
 	} else if (index->table->is_temporary()) {
 	} else {
-		srw_spin_lock* ahi_latch = btr_search_sys.get_latch(*index);
+		btr_search_latch* ahi_latch = btr_search_sys.get_latch(*index);
 		if (!reorg && cursor->flag == BTR_CUR_HASH) {
 			btr_search_update_hash_node_on_insert(
 				cursor, ahi_latch);
@@ -2921,6 +3022,10 @@ void btr_cur_upd_rec_in_place(rec_t *rec, const dict_index_t *index,
 	ut_ad(!index->table->skip_alter_undo);
 	ut_ad(!block->page.zip.data || index->table->not_redundant());
 
+	if (!index->is_clust()) {
+		page_sec_rec_modified(block, page_rec_get_heap_no(rec));
+	}
+
 #ifdef UNIV_DEBUG
 	if (rec_offs_comp(offsets)) {
 		switch (rec_get_status(rec)) {
@@ -3200,7 +3305,7 @@ btr_cur_update_in_place(
 
 #ifdef BTR_CUR_HASH_ADAPT
 	{
-		srw_spin_lock* ahi_latch = block->index
+		btr_search_latch* ahi_latch = block->index
 			? btr_search_sys.get_latch(*index) : NULL;
 		if (ahi_latch) {
 			/* TO DO: Can we skip this if none of the fields
@@ -4122,6 +4227,9 @@ btr_cur_pessimistic_update(
 template<bool flag>
 void btr_rec_set_deleted(buf_block_t *block, rec_t *rec, mtr_t *mtr)
 {
+  if (page_is_leaf(block->page.frame))
+    page_sec_rec_modified(block, page_rec_get_heap_no(rec));
+
   if (page_rec_is_comp(rec))
   {
     byte *b= &rec[-REC_NEW_INFO_BITS];
@@ -6378,6 +6486,37 @@ btr_rec_free_updated_extern_fields(
 	}
 }
 
+/** Read ahead the pages that the rest of an uncompressed BLOB is expected
+to occupy. btr_store_big_rec_extern_fields() allocates the pages of a BLOB
+in ascending order, so that they are usually contiguous. The read-ahead
+window is extended when the reader has reached its middle.
+@param id         the next BLOB page
+@param remaining  number of bytes that remain to be copied
+@param begin      start of the read-ahead window
+@param end        end of the read-ahead window */
+static void btr_blob_read_ahead(const page_id_t id, ulint remaining,
+                                uint32_t &begin, uint32_t &end)
+{
+  const uint32_t area= buf_pool.read_ahead_area;
+  const uint32_t page_no= id.page_no();
+
+  if (page_no < begin || page_no >= end)
+    begin= end= page_no;
+  else if (end - page_no > area / 2)
+    return;
+
+  const ulint payload= srv_page_size - FIL_PAGE_DATA - BTR_BLOB_HDR_SIZE -
+    FIL_PAGE_DATA_END;
+  const uint32_t n= uint32_t(std::min<ulint>((remaining + payload - 1) /
+                                             payload, area));
+  /* Reading the last page synchronously costs no more. */
+  if (n > 1 && page_no + n > end)
+  {
+    buf_read_ahead_blob(page_id_t{id.space(), end}, page_no + n - end, 0);
+    end= page_no + n;
+  }
+}
+
 /*******************************************************************//**
 Copies the prefix of an uncompressed BLOB.  The clustered index record
 that points to this BLOB must be protected by a lock or a page latch.
@@ -6392,7 +6531,9 @@ btr_copy_blob_prefix(
 	page_id_t	id,	/*!< in: page identifier of the first BLOB page */
 	uint32_t	offset)	/*!< in: offset on the first BLOB page */
 {
-	ulint	copied_len	= 0;
+	ulint		copied_len	= 0;
+	uint32_t	ra_begin	= FIL_NULL;
+	uint32_t	ra_end		= FIL_NULL;
 
 	for (;;) {
 		mtr_t		mtr;
@@ -6432,6 +6573,8 @@ btr_copy_blob_prefix(
 			return(copied_len);
 		}
 
+		btr_blob_read_ahead(id, len - copied_len, ra_begin, ra_end);
+
 		/* On other BLOB pages except the first the BLOB header
 		always is at the page data start: */
 
@@ -537,6 +537,7 @@ btr_pcur_move_to_next_page(
 		buf_read_ahead_linear(next_block->page.id(),
 				      next_block->zip_size());
 	}
+	buf_read_ahead_sibling(*next_block, true);
 	return DB_SUCCESS;
 }
 
@@ -600,6 +601,7 @@ btr_pcur_move_backward_from_page(
 			/* Release the right sibling. */
 			mtr->rollback_to_savepoint(0, 1);
 			block = left_block;
+			buf_read_ahead_sibling(*block, false);
 		}
 	}
 
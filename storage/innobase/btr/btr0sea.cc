@@ -55,6 +55,31 @@ mysql_pfs_key_t	btr_search_latch_key;
 /** The adaptive hash index */
 btr_search_sys_t btr_search_sys;
 
+/** Number of threads that have been assigned a reader slot */
+static std::atomic<uint32_t> btr_search_n_readers;
+/** The reader slot of the current thread, or ~0U if not assigned yet */
+static thread_local uint32_t btr_search_reader_slot= ~0U;
+
+/** @return the reader slot of the current thread */
+btr_search_sys_t::reader_slot &btr_search_sys_t::reader()
+{
+  if (UNIV_UNLIKELY(btr_search_reader_slot == ~0U))
+    btr_search_reader_slot=
+      btr_search_n_readers.fetch_add(1, std::memory_order_relaxed) % N_READERS;
+  return readers[btr_search_reader_slot];
+}
+
+/** Wait for latch-free readers to finish, after btr_search_enabled
+was cleared */
+void btr_search_sys_t::wait_for_readers() const
+{
+  ut_ad(!btr_search_enabled);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  for (const reader_slot &r : readers)
+    while (r.n.load(std::memory_order_acquire))
+      std::this_thread::yield();
+}
+
 /** If the number of records on the page divided by this parameter
 would have been successfully accessed using a hash index, the index
 is then built on the page, assuming the global limit has been reached */
@@ -251,6 +276,10 @@ void btr_search_disable()
 
 	dict_sys.unfreeze();
 
+	/* Ensure that no btr_search_guess_on_hash() is accessing
+	the hash tables without holding a latch. */
+	btr_search_sys.wait_for_readers();
+
 	/* Set all block->index = NULL. */
 	buf_pool.clear_hash_index();
 
@@ -1015,6 +1044,46 @@ inline buf_block_t* buf_pool_t::block_from_ahi(const byte *ptr) const
   return block;
 }
 
+/** Look up a record in an adaptive hash index partition without
+acquiring the latch. The caller must have invoked reader_slot::enter().
+Because writers may be modifying the hash chain concurrently, the
+sequence number is validated before following any pointer.
+@param part   adaptive hash index partition
+@param fold   folded value of the search tuple
+@param seq    sequence number for read_validate(), or odd if the lookup
+              failed due to a concurrent modification
+@return the record
+@retval nullptr if not found */
+static const rec_t *btr_search_guess_latch_free(
+  const btr_search_sys_t::partition &part, ulint fold, uint32_t &seq)
+{
+  seq= part.latch.read_begin();
+  if (seq & 1)
+    return nullptr;
+
+  const ha_node_t *node= static_cast<const ha_node_t*>
+    (part.table.array[part.table.calc_hash(fold)].node);
+
+  while (node)
+  {
+    const ulint node_fold= node->fold;
+    const rec_t *data= node->data;
+    const ha_node_t *next= node->next;
+    if (!part.latch.read_validate(seq))
+    {
+      seq= 1;
+      return nullptr;
+    }
+    if (node_fold == fold)
+      return data;
+    node= next;
+  }
+
+  if (!part.latch.read_validate(seq))
+    seq= 1;
+  return nullptr;
+}
+
 /** Tries to guess the right search position based on the hash search info
 of the index. Note that if mode is PAGE_CUR_LE, which is used in inserts,
 and the function returns TRUE, then cursor->up_match and cursor->low_match
@@ -1078,20 +1147,37 @@ btr_search_guess_on_hash(
 	cursor->flag = BTR_CUR_HASH;
 
 	auto part = btr_search_sys.get_part(*index);
-	const rec_t* rec;
+	auto& reader = btr_search_sys.reader();
+	const rec_t* rec = nullptr;
+	/* The sequence number of a latch-free lookup, or 1 if
+	part->latch is being held */
+	uint32_t seq = 1;
 
-	part->latch.rd_lock(SRW_LOCK_CALL);
-
-	if (!btr_search_enabled) {
-		goto ahi_release_and_fail;
+	if (reader.enter()) {
+		rec = btr_search_guess_latch_free(*part, fold, seq);
 	}
 
-	rec = static_cast<const rec_t*>(
-		ha_search_and_get_data(&part->table, fold));
+	if (seq & 1) {
+		/* A concurrent modification prevented the latch-free
+		lookup. */
+		reader.exit();
+		part->latch.rd_lock(SRW_LOCK_CALL);
+
+		if (!btr_search_enabled) {
+			goto ahi_release_and_fail;
+		}
+
+		rec = static_cast<const rec_t*>(
+			ha_search_and_get_data(&part->table, fold));
+	}
 
 	if (!rec) {
 ahi_release_and_fail:
-		part->latch.rd_unlock();
+		if (seq & 1) {
+			part->latch.rd_unlock();
+		} else {
+			reader.exit();
+		}
 fail:
 		btr_search_failure(info, cursor);
 		return false;
@@ -1114,24 +1200,40 @@ btr_search_guess_on_hash(
 		goto ahi_release_and_fail;
 	}
 
-	const auto state = block->page.state();
-	if (UNIV_UNLIKELY(state < buf_page_t::UNFIXED)) {
-		ut_ad(state == buf_page_t::REMOVE_HASH);
+	{
+		const dict_index_t* block_index = block->index;
+		const bool stale = index != block_index
+			&& (!block_index || index_id == block_index->id);
+
+		if (!(seq & 1) && !part->latch.read_validate(seq)) {
+			/* The block may have been evicted or block_index
+			freed since the lookup; our latch on it does not
+			prevent that. */
+			goto block_and_ahi_release_and_fail;
+		}
+
+		uint32_t state;
+		state = block->page.state();
+		if (UNIV_UNLIKELY(state < buf_page_t::UNFIXED)) {
+			ut_ad(state == buf_page_t::REMOVE_HASH);
 block_and_ahi_release_and_fail:
-		if (latch_mode == BTR_SEARCH_LEAF) {
-			block->page.lock.s_unlock();
-		} else {
-			block->page.lock.x_unlock();
+			if (latch_mode == BTR_SEARCH_LEAF) {
+				block->page.lock.s_unlock();
+			} else {
+				block->page.lock.x_unlock();
+			}
+			goto ahi_release_and_fail;
 		}
-		goto ahi_release_and_fail;
-	}
 
-	ut_ad(state < buf_page_t::READ_FIX || state >= buf_page_t::WRITE_FIX);
-	ut_ad(state < buf_page_t::READ_FIX || latch_mode == BTR_SEARCH_LEAF);
+		ut_ad(state < buf_page_t::READ_FIX
+		      || state >= buf_page_t::WRITE_FIX);
+		ut_ad(state < buf_page_t::READ_FIX
+		      || latch_mode == BTR_SEARCH_LEAF);
 
-	if (index != block->index && index_id == block->index->id) {
-		ut_a(block->index->freed());
-		goto block_and_ahi_release_and_fail;
+		if (stale) {
+			ut_a(block_index->freed());
+			goto block_and_ahi_release_and_fail;
+		}
 	}
 
 	block->page.fix();
@@ -1141,7 +1243,11 @@ btr_search_guess_on_hash(
 	static_assert(ulint{MTR_MEMO_PAGE_X_FIX} == ulint{BTR_MODIFY_LEAF},
 		      "");
 
-	part->latch.rd_unlock();
+	if (seq & 1) {
+		part->latch.rd_unlock();
+	} else {
+		reader.exit();
+	}
 
 	++buf_pool.stat.n_page_gets;
 
@@ -1427,7 +1533,7 @@ void
 btr_search_build_page_hash_index(
 	dict_index_t*	index,
 	buf_block_t*	block,
-	srw_spin_lock*	ahi_latch,
+	btr_search_latch*	ahi_latch,
 	uint16_t	n_fields,
 	uint16_t	n_bytes,
 	bool		left_side)
@@ -1624,7 +1730,7 @@ btr_search_build_page_hash_index(
 @param[in,out]	cursor	cursor which was just positioned */
 void btr_search_info_update_slow(btr_search_t *info, btr_cur_t *cursor)
 {
-	srw_spin_lock*	ahi_latch = &btr_search_sys.get_part(*cursor->index())
+	btr_search_latch*	ahi_latch = &btr_search_sys.get_part(*cursor->index())
 		->latch;
 	buf_block_t*	block = btr_cur_get_block(cursor);
 
@@ -1691,7 +1797,7 @@ btr_search_move_or_delete_hash_entries(
 	assert_block_ahi_valid(block);
 	assert_block_ahi_valid(new_block);
 
-	srw_spin_lock* ahi_latch = index
+	btr_search_latch* ahi_latch = index
 		? &btr_search_sys.get_part(*index)->latch
 		: nullptr;
 
@@ -1816,7 +1922,7 @@ void btr_search_update_hash_on_delete(btr_cur_t *cursor)
 			inserted next to the cursor.
 @param[in]	ahi_latch	the adaptive hash index latch */
 void btr_search_update_hash_node_on_insert(btr_cur_t *cursor,
-                                           srw_spin_lock *ahi_latch)
+                                           btr_search_latch *ahi_latch)
 {
 	buf_block_t*	block;
 	dict_index_t*	index;
@@ -1891,7 +1997,7 @@ void btr_search_update_hash_node_on_insert(btr_cur_t *cursor,
 				to the cursor
 @param[in]	ahi_latch	the adaptive hash index latch */
 void btr_search_update_hash_on_insert(btr_cur_t *cursor,
-                                      srw_spin_lock *ahi_latch)
+                                      btr_search_latch *ahi_latch)
 {
 	buf_block_t*	block;
 	dict_index_t*	index;
@@ -44,6 +44,7 @@ Created 11/5/1995 Heikki Tuuri
 #include "buf0flu.h"
 #include "buf0buddy.h"
 #include "buf0dblwr.h"
+#include "buf0sec.h"
 #include "lock0lock.h"
 #include "btr0sea.h"
 #include "trx0undo.h"
@@ -108,6 +109,41 @@ struct set_numa_interleave_t
 };
 
 #define NUMA_MEMPOLICY_INTERLEAVE_IN_SCOPE set_numa_interleave_t scoped_numa
+
+/** The NUMA node to try first in the next buf_numa_bind_chunk() */
+static unsigned buf_numa_next_node;
+
+/** Bind a buffer pool chunk to the next allowed NUMA node (innodb_numa_local).
+@param mem   start of the chunk
+@param size  size of the chunk in bytes
+@return the NUMA node that the chunk was bound to */
+static uint8_t buf_numa_bind_chunk(void *mem, size_t size)
+{
+  struct bitmask *numa_mems_allowed= numa_get_mems_allowed();
+  MEM_MAKE_DEFINED(numa_mems_allowed, sizeof *numa_mems_allowed);
+  const unsigned n_nodes= unsigned(numa_max_node()) + 1;
+  unsigned node= 0;
+  for (unsigned i= 0; i < n_nodes; i++)
+  {
+    node= (buf_numa_next_node + i) % n_nodes;
+    if (numa_bitmask_isbitset(numa_mems_allowed, node))
+      break;
+  }
+  buf_numa_next_node= node + 1;
+
+  numa_bitmask_clearall(numa_mems_allowed);
+  numa_bitmask_setbit(numa_mems_allowed, node);
+  /* MPOL_PREFERRED rather than MPOL_BIND, so that an exhausted node
+  will not cause an allocation failure. */
+  if (mbind(mem, size, MPOL_PREFERRED,
+            numa_mems_allowed->maskp, numa_mems_allowed->size,
+            MPOL_MF_MOVE))
+    ib::warn() << "Failed to set NUMA memory policy of"
+            " buffer pool page frames to MPOL_PREFERRED node " << node
+            << " (error: " << strerror(errno) << ").";
+  numa_bitmask_free(numa_mems_allowed);
+  return uint8_t(node);
+}
 #else
 #define NUMA_MEMPOLICY_INTERLEAVE_IN_SCOPE
 #endif /* HAVE_LIBNUMA */
@@ -431,8 +467,11 @@ static bool buf_page_decrypt_after_read(buf_page_t *bpage,
 		slot->allocate();
 
 decompress_with_slot:
+		if (!slot->comp_ctx) {
+			slot->comp_ctx = fil_page_compress_ctx_create();
+		}
 		ulint write_size = fil_page_decompress(
-			slot->crypt_buf, dst_frame, flags);
+			slot->crypt_buf, dst_frame, flags, slot->comp_ctx);
 		slot->release();
 		ut_ad(node.space->referenced());
 		return write_size != 0;
@@ -1029,6 +1068,12 @@ buf_block_init(buf_block_t* block, byte* frame)
 
 	MEM_MAKE_DEFINED(&block->modify_clock, sizeof block->modify_clock);
 	ut_ad(!block->modify_clock);
+	MEM_MAKE_DEFINED(&block->dir_prefix, sizeof block->dir_prefix);
+	ut_ad(!block->dir_prefix);
+	MEM_MAKE_DEFINED(&block->stats_index_id, sizeof block->stats_index_id);
+	ut_ad(!block->stats_index_id);
+	MEM_MAKE_DEFINED(&block->sec_max_trx_id, sizeof block->sec_max_trx_id);
+	ut_ad(!block->sec_max_trx_id);
 	MEM_MAKE_DEFINED(&block->page.lock, sizeof block->page.lock);
 	block->page.init(buf_page_t::NOT_USED, page_id_t(~0ULL));
 #ifdef BTR_CUR_HASH_ADAPT
@@ -1061,7 +1106,10 @@ inline bool buf_pool_t::chunk_t::create(size_t bytes)
   MEM_UNDEFINED(mem, mem_size());
 
 #ifdef HAVE_LIBNUMA
-  if (srv_numa_interleave)
+  uint8_t numa_node= 0;
+  if (srv_numa_local && !srv_numa_interleave)
+    numa_node= buf_numa_bind_chunk(mem, mem_size());
+  else if (srv_numa_interleave)
   {
     struct bitmask *numa_mems_allowed= numa_get_mems_allowed();
     MEM_MAKE_DEFINED(numa_mems_allowed, sizeof *numa_mems_allowed);
@@ -1115,6 +1163,9 @@ inline bool buf_pool_t::chunk_t::create(size_t bytes)
 
   for (auto i= size; i--; ) {
     buf_block_init(block, frame);
+#ifdef HAVE_LIBNUMA
+    block->numa_node= numa_node;
+#endif
     MEM_UNDEFINED(block->page.frame, srv_page_size);
     /* Add the block to the free list */
     UT_LIST_ADD_LAST(buf_pool.free, &block->page);
@@ -1272,10 +1323,12 @@ bool buf_pool_t::create()
 
   page_hash.create(2 * curr_size);
   zip_hash.create(2 * curr_size);
+  buf_LRU_ghost_create(curr_size);
   last_printout_time= time(NULL);
 
   mysql_mutex_init(flush_list_mutex_key, &flush_list_mutex,
                    MY_MUTEX_INIT_FAST);
+  index_stats_mutex.init();
 
   pthread_cond_init(&done_flush_LRU, nullptr);
   pthread_cond_init(&done_flush_list, nullptr);
@@ -1319,6 +1372,8 @@ void buf_pool_t::close()
 
   mysql_mutex_destroy(&mutex);
   mysql_mutex_destroy(&flush_list_mutex);
+  index_stats_mutex.destroy();
+  index_stats.clear();
 
   for (buf_page_t *bpage= UT_LIST_GET_LAST(LRU), *prev_bpage= nullptr; bpage;
        bpage= prev_bpage)
@@ -1346,7 +1401,10 @@ void buf_pool_t::close()
     buf_block_t *block= chunk->blocks;
 
     for (auto i= chunk->size; i--; block++)
+    {
+      block->discard_dir_prefix();
       block->page.lock.free();
+    }
 
     allocator.deallocate_large_dodump(chunk->mem, &chunk->mem_pfx);
   }
@@ -1360,6 +1418,7 @@ void buf_pool_t::close()
   chunks= nullptr;
   page_hash.free();
   zip_hash.free();
+  buf_LRU_ghost_free();
 
   io_buf.close();
   UT_DELETE(chunk_t::map_reg);
@@ -1406,6 +1465,8 @@ inline bool buf_pool_t::realloc(buf_block_t *block)
 		new_block->page.lock.free();
 		new (&new_block->page) buf_page_t(block->page);
 		new_block->page.frame = frame;
+		new_block->stats_index_id = block->stats_index_id;
+		block->stats_index_id = 0;
 
 		/* relocate LRU list */
 		if (buf_page_t*	prev_b = buf_pool.LRU_remove(&block->page)) {
@@ -1501,6 +1562,7 @@ void buf_pool_t::io_buf_t::close()
   {
     aligned_free(s->crypt_buf);
     aligned_free(s->comp_buf);
+    fil_page_compress_ctx_free(s->comp_ctx);
   }
   ut_free(slots);
   slots= nullptr;
@@ -2329,6 +2391,8 @@ void buf_page_free(fil_space_t *space, uint32_t page, mtr_t *mtr)
     btr_search_drop_page_hash_index(block, false);
 #endif /* BTR_CUR_HASH_ADAPT */
   block->page.set_freed(block->page.state());
+  if (page_id.space() >= SRV_TMP_SPACE_ID)
+    buf_page_make_old(&block->page);
   mtr->memo_push(block, MTR_MEMO_PAGE_X_MODIFY);
 }
 
@@ -3113,6 +3177,10 @@ static buf_block_t *buf_page_create_low(page_id_t page_id, ulint zip_size,
 retry:
   mysql_mutex_lock(&buf_pool.mutex);
 
+  if (buf_sec.is_created())
+    /* Discard any copy that buf_LRU_free_page() may have cached. */
+    buf_sec.forget(page_id);
+
   buf_page_t *bpage= buf_pool.page_hash.get(page_id, chain);
 
   if (bpage)
@@ -3421,12 +3489,13 @@ static dberr_t buf_page_check_corrupt(buf_page_t *bpage,
 	      node.space->full_crc32());
 
 	/* If traditional checksums match, we assume that page is
-	not anymore encrypted. */
+	not anymore encrypted. Check for an all-zero page last,
+	because it has to read the whole page. */
 	if (node.space->full_crc32()
-	    && !buf_is_zeroes(span<const byte>(dst_frame,
-					       node.space->physical_size()))
 	    && (key_version || node.space->is_compressed()
-		|| node.space->purpose == FIL_TYPE_TEMPORARY)) {
+		|| node.space->purpose == FIL_TYPE_TEMPORARY)
+	    && !buf_is_zeroes(span<const byte>(dst_frame,
+					       node.space->physical_size()))) {
 		if (buf_page_full_crc32_is_corrupted(
 			    bpage->id().space(), dst_frame,
 			    node.space->is_compressed())) {
@@ -3564,6 +3633,11 @@ dberr_t buf_page_t::read_complete(const fil_node_t &node)
     buf_page_monitor(*this, true);
   DBUG_PRINT("ib_buf", ("read page %u:%u", id().space(), id().page_no()));
 
+  if (frame && fil_page_index_page_check(frame) &&
+      node.space->id != SRV_TMP_SPACE_ID)
+    buf_pool.index_stats_add(reinterpret_cast<buf_block_t*>(this),
+                             btr_page_get_index_id(frame), true);
+
   if (!recovery)
   {
     ut_d(auto f=) zip.fix.fetch_sub(READ_FIX - UNFIXED);
@@ -415,6 +415,82 @@ buf_dump(
 	export_vars.innodb_buffer_pool_load_incomplete = 0;
 }
 
+/** Start a buffer pool dump if innodb_buffer_pool_dump_interval has
+elapsed since the previous one and pages have been read since then. */
+void buf_dump_at_interval()
+{
+	static time_t	last_dump;
+	static ulint	last_reads;
+
+	if (!srv_buf_pool_dump_interval || SHUTTING_DOWN()
+	    || export_vars.innodb_buffer_pool_load_incomplete) {
+		return;
+	}
+
+	const time_t	now = time(nullptr);
+
+	if (!last_dump) {
+		last_dump = now;
+		return;
+	}
+
+	if (now - last_dump < time_t(srv_buf_pool_dump_interval)) {
+		return;
+	}
+
+	last_dump = now;
+
+	const ulint	reads = buf_pool.stat.n_pages_read
+		+ buf_pool.stat.n_pages_created;
+
+	/* If no pages were added to the buffer pool, the previous dump
+	is still good enough: only the LRU order could have changed. */
+	if (reads != last_reads) {
+		last_reads = reads;
+		buf_dump_start();
+	}
+}
+
+/** Number of pages in a batch of buf_load(). The dump file lists
+the pages in LRU order, hottest first. Each batch is sorted by page
+identifier, so that the hottest pages are loaded first, yet most reads
+within a batch are sequential. */
+static constexpr ulint BUF_LOAD_BATCH = 8192;
+
+/** Throttle buf_load(), so that it will not submit more than
+innodb_io_capacity page reads per second while the server is
+processing other requests. If the server is idle, the load will
+proceed at full speed.
+@param last_check_time		time of the previous check, in ms
+@param last_activity_count	srv_get_activity_count() at that time
+@param n_io			number of page reads submitted so far */
+static void buf_load_throttle_if_needed(ulint *last_check_time,
+					ulint *last_activity_count,
+					ulint n_io)
+{
+	if (n_io % srv_io_capacity < srv_io_capacity - 1) {
+		return;
+	}
+
+	if (!*last_check_time || !*last_activity_count) {
+		*last_check_time = ut_time_ms();
+		*last_activity_count = srv_get_activity_count();
+		return;
+	}
+
+	if (srv_get_activity_count() != *last_activity_count) {
+		/* The server is busy; do not exceed innodb_io_capacity. */
+		const ulint elapsed = ut_time_ms() - *last_check_time;
+		if (elapsed < 1000) {
+			std::this_thread::sleep_for(
+				std::chrono::milliseconds(1000 - elapsed));
+		}
+	}
+
+	*last_check_time = ut_time_ms();
+	*last_activity_count = srv_get_activity_count();
+}
+
 /*****************************************************************//**
 Perform a buffer pool load from the file specified by
 innodb_buffer_pool_filename. If any errors occur then the value of
@@ -561,7 +637,10 @@ buf_load()
 	}
 
 	if (!SHUTTING_DOWN()) {
-		std::sort(dump, dump + dump_n);
+		for (ulint b = 0; b < dump_n; b += BUF_LOAD_BATCH) {
+			std::sort(dump + b,
+				  dump + std::min(dump_n, b + BUF_LOAD_BATCH));
+		}
 		std::set<uint32_t> missing;
 		for (const page_id_t id : st_::span<const page_id_t>
 		       (dump, dump_n)) {
@@ -581,8 +660,9 @@ buf_load()
 	}
 
 	/* Avoid calling the expensive fil_space_t::get() for each
-	page within the same tablespace. dump[] is sorted by (space, page),
-	so all pages from a given tablespace are consecutive. */
+	page within the same tablespace. Each BUF_LOAD_BATCH of dump[] is
+	sorted by (space, page), so pages from a given tablespace are
+	mostly consecutive. */
 	uint32_t	cur_space_id = dump[0].space();
 	fil_space_t*	space = fil_space_t::get(cur_space_id);
 	ulint		zip_size = space ? space->zip_size() : 0;
@@ -592,6 +672,9 @@ buf_load()
 	mysql_stage_set_work_estimated(pfs_stage_progress, dump_n);
 	mysql_stage_set_work_completed(pfs_stage_progress, 0);
 
+	ulint		last_check_time = 0;
+	ulint		last_activity_cnt = 0;
+
 	for (i = 0; i < dump_n && !SHUTTING_DOWN(); i++) {
 
 		/* space_id for this iteration of the loop */
@@ -634,6 +717,13 @@ buf_load()
 		space->reacquire();
 		buf_read_page_background(space, dump[i], zip_size);
 
+		if (!(i % BUF_LOAD_BATCH)) {
+			mysql_stage_set_work_completed(pfs_stage_progress, i);
+		}
+
+		buf_load_throttle_if_needed(
+			&last_check_time, &last_activity_cnt, i);
+
 		if (buf_load_abort_flag) {
 			if (space) {
 				space->release();
@@ -34,6 +34,7 @@ Created 11/11/1995 Heikki Tuuri
 #include "buf0buf.h"
 #include "buf0checksum.h"
 #include "buf0dblwr.h"
+#include "buf0trk.h"
 #include "srv0start.h"
 #include "page0zip.h"
 #include "fil0fil.h"
@@ -42,6 +43,7 @@ Created 11/11/1995 Heikki Tuuri
 #include "fil0pagecompress.h"
 #include "lzo/lzo1x.h"
 #include "snappy-c.h"
+#include "probes_mysql.h"
 
 /** Number of pages flushed via LRU. Protected by buf_pool.mutex.
 Also included in buf_pool.stat.n_pages_written. */
@@ -332,12 +334,19 @@ void buf_page_write_complete(const IORequest &request, bool error)
     buf_page_monitor(*bpage, false);
   DBUG_PRINT("ib_buf", ("write page %u:%u",
                         bpage->id().space(), bpage->id().page_no()));
+  MYSQL_INNODB_PAGE_FLUSH_DONE(bpage->id().space(), bpage->id().page_no(),
+                               error);
 
   mysql_mutex_assert_not_owner(&buf_pool.mutex);
   mysql_mutex_assert_not_owner(&buf_pool.flush_list_mutex);
 
   const bool persistent= bpage->oldest_modification() != 2;
 
+  /* Note the write before the page can be removed from
+  buf_pool.flush_list and a checkpoint be made past it. */
+  if (persistent && buf_track.is_enabled())
+    buf_track.page_written(bpage->id());
+
   if (UNIV_UNLIKELY(!persistent) && UNIV_LIKELY(!error))
   {
     /* We must hold buf_pool.mutex while releasing the block, so that
@@ -530,6 +539,8 @@ buf_flush_init_for_writing(
 @param[in,out]  slot    reserved slot */
 static void buf_tmp_reserve_compression_buf(buf_tmp_buffer_t* slot)
 {
+  if (!slot->comp_ctx)
+    slot->comp_ctx= fil_page_compress_ctx_create();
   if (slot->comp_buf)
     return;
   /* Both Snappy and LZO compression methods require that the output
@@ -658,7 +669,7 @@ static byte *buf_page_encrypt(fil_space_t* space, buf_page_t* bpage, byte* s,
     byte *tmp= (*slot)->comp_buf;
     ulint len= fil_page_compress(s, tmp, space->flags,
                                  fil_space_get_block_size(space, page_no),
-                                 encrypted);
+                                 encrypted, (*slot)->comp_ctx);
 
     if (!len)
       goto not_compressed;
@@ -843,6 +854,8 @@ bool buf_page_t::flush(fil_space_t *space)
     write_frame= page;
   }
 
+  MYSQL_INNODB_PAGE_FLUSH_START(id().space(), id().page_no());
+
   if ((s & LRU_MASK) == REINIT || !space->use_doublewrite())
   {
     if (UNIV_LIKELY(space->purpose == FIL_TYPE_TABLESPACE) &&
@@ -1783,6 +1796,7 @@ inline void log_t::write_checkpoint(lsn_t end_lsn) noexcept
       header_write(resize_buf, resizing, is_encrypted());
       pmem_persist(resize_buf, resize_target);
     }
+    buf_track.checkpoint(next_checkpoint_lsn);
     pmem_persist(c, 64);
   }
   else
@@ -1790,8 +1804,10 @@ inline void log_t::write_checkpoint(lsn_t end_lsn) noexcept
   {
     ut_ad(!checkpoint_pending);
     checkpoint_pending= true;
+    const lsn_t checkpoint_lsn{next_checkpoint_lsn};
     latch.wr_unlock();
     log_write_and_flush_prepare();
+    buf_track.checkpoint(checkpoint_lsn);
     resizing= resize_lsn.load(std::memory_order_relaxed);
     /* FIXME: issue an asynchronous write */
     ut_ad(ut_is_2pow(write_size));
@@ -2122,6 +2138,32 @@ ATTRIBUTE_COLD void buf_flush_ahead(lsn_t lsn, bool furious)
   }
 }
 
+/** Run an LRU eviction batch on behalf of buf_flush_sync_for_checkpoint(),
+so that the page cleaner can keep writing out buf_pool.flush_list. */
+static void buf_flush_LRU_callback(void*)
+{
+  mysql_mutex_lock(&buf_pool.mutex);
+  /* Confirm that eviction is needed after acquiring buffer pool mutex. */
+  if (buf_pool.need_LRU_eviction())
+    /* We intend to only evict pages keeping maximum flush bandwidth for
+    flush list pages advancing checkpoint. However, if the LRU tail is full
+    of dirty pages, we might need some flushing. */
+    std::ignore= buf_flush_LRU(srv_io_capacity);
+  mysql_mutex_unlock(&buf_pool.mutex);
+  buf_dblwr.flush_buffered_writes();
+
+  mysql_mutex_lock(&buf_pool.flush_list_mutex);
+  buf_pool.n_flush_dec();
+  mysql_mutex_unlock(&buf_pool.flush_list_mutex);
+}
+
+/** LRU eviction that runs concurrently with checkpoint flushing.
+It is only submitted by the page cleaner thread, which will wait for
+it before running any LRU batch of its own (buf_pool.lru_hp is not
+designed for concurrent LRU batches). */
+static tpool::waitable_task buf_flush_LRU_task(buf_flush_LRU_callback,
+                                               nullptr);
+
 /** Conduct checkpoint-related flushing for innodb_flush_sync=ON,
 and try to initiate checkpoints until the target is met.
 @param lsn   minimum value of buf_pool.get_oldest_modification(LSN_MAX) */
@@ -2140,26 +2182,19 @@ static void buf_flush_sync_for_checkpoint(lsn_t lsn)
   of today. It is a quick and dirty read of the LRU and free list length.
   Atomic read of try_LRU_scan should eventually let us do the eviction.
   Correcting the inaccuracy would need more consideration to avoid any possible
-  performance regression. */
-  if (buf_pool.need_LRU_eviction())
+  performance regression.
+
+  The eviction is submitted to a separate thread, so that it will not
+  delay the writes of buf_pool.flush_list that advance the checkpoint.
+  If the previous eviction batch is still running, there is no need
+  to submit another one. */
+  if (buf_pool.need_LRU_eviction() && !buf_flush_LRU_task.is_running())
   {
     mysql_mutex_lock(&buf_pool.flush_list_mutex);
     buf_pool.page_cleaner_set_idle(false);
     buf_pool.n_flush_inc();
     mysql_mutex_unlock(&buf_pool.flush_list_mutex);
-
-    mysql_mutex_lock(&buf_pool.mutex);
-    /* Confirm that eviction is needed after acquiring buffer pool mutex. */
-    if (buf_pool.need_LRU_eviction())
-      /* We intend to only evict pages keeping maximum flush bandwidth for
-      flush list pages advancing checkpoint. However, if the LRU tail is full
-      of dirty pages, we might need some flushing. */
-      std::ignore= buf_flush_LRU(srv_io_capacity);
-    mysql_mutex_unlock(&buf_pool.mutex);
-
-    mysql_mutex_lock(&buf_pool.flush_list_mutex);
-    buf_pool.n_flush_dec();
-    mysql_mutex_unlock(&buf_pool.flush_list_mutex);
+    srv_thread_pool->submit_task(&buf_flush_LRU_task);
   }
 
   if (ulint n_flushed= buf_flush_list(srv_max_io_capacity, lsn))
@@ -2268,6 +2303,8 @@ static ulint page_cleaner_flush_pages_recommendation(ulint last_pages_in,
 	static	ulint		avg_page_rate = 0;
 	static	ulint		n_iterations = 0;
 	static	time_t		prev_time;
+	static	lsn_t		last_lsn = 0;
+	static	time_t		last_time;
 	lsn_t			lsn_rate;
 	ulint			n_pages = 0;
 
@@ -2277,6 +2314,15 @@ static ulint page_cleaner_flush_pages_recommendation(ulint last_pages_in,
 	time_t curr_time = time(nullptr);
 	const double max_pct = srv_max_buf_pool_modified_pct;
 
+	/* The redo generation rate since the previous invocation,
+	for reacting to write bursts before lsn_avg_rate catches up. */
+	const lsn_t cur_rate = last_lsn && cur_lsn > last_lsn
+		? (cur_lsn - last_lsn)
+		/ std::max<ulint>(ulint(curr_time - last_time), 1)
+		: 0;
+	last_lsn = cur_lsn;
+	last_time = curr_time;
+
 	if (!prev_lsn || !pct_for_lsn) {
 		prev_time = curr_time;
 		prev_lsn = cur_lsn;
@@ -2341,9 +2387,19 @@ static ulint page_cleaner_flush_pages_recommendation(ulint last_pages_in,
 
 	MONITOR_SET(MONITOR_FLUSH_PCT_FOR_DIRTY, ulint(total_ratio * 100));
 
+	/* If the checkpoint age would reach the asynchronous flushing
+	threshold within the averaging period at the current redo
+	generation rate, do not wait for lsn_avg_rate to catch up.
+	Reaching the threshold would make user threads wait in
+	buf_flush_wait_flushed(). */
+	const lsn_t rate = std::max(lsn_avg_rate, cur_rate);
+	const bool ahead = cur_rate > lsn_avg_rate
+		&& cur_lsn - oldest_lsn + rate * srv_flushing_avg_loops
+		>= log_sys.max_modified_age_async;
+
 	/* Estimate pages to be flushed for the lsn progress */
 	lsn_t	target_lsn = oldest_lsn
-		+ lsn_avg_rate * buf_flush_lsn_scan_factor;
+		+ (ahead ? rate : lsn_avg_rate) * buf_flush_lsn_scan_factor;
 	ulint	pages_for_lsn = 0;
 
 	mysql_mutex_lock(&buf_pool.flush_list_mutex);
@@ -2368,6 +2424,14 @@ static ulint page_cleaner_flush_pages_recommendation(ulint last_pages_in,
 	n_pages = (ulint(double(srv_io_capacity) * total_ratio)
 		   + avg_page_rate + pages_for_lsn) / 3;
 
+	if (ahead) {
+		/* Flush the pages that will be in the way of the
+		checkpoint right away, instead of averaging them with
+		the rate of the previous period. */
+		n_pages = std::max(n_pages, pages_for_lsn);
+		MONITOR_INC(MONITOR_FLUSH_AHEAD);
+	}
+
 	if (n_pages > srv_max_io_capacity) {
 		n_pages = srv_max_io_capacity;
 	}
@@ -2378,6 +2442,7 @@ static ulint page_cleaner_flush_pages_recommendation(ulint last_pages_in,
 
 	MONITOR_SET(MONITOR_FLUSH_AVG_PAGE_RATE, avg_page_rate);
 	MONITOR_SET(MONITOR_FLUSH_LSN_AVG_RATE, lsn_avg_rate);
+	MONITOR_SET(MONITOR_FLUSH_LSN_CUR_RATE, cur_rate);
 
 	goto func_exit;
 }
@@ -2432,6 +2497,10 @@ static void buf_flush_page_cleaner()
       continue;
     }
 
+    /* Any LRU batch below must not run concurrently with
+    one that buf_flush_sync_for_checkpoint() submitted. */
+    buf_flush_LRU_task.wait();
+
     mysql_mutex_lock(&buf_pool.flush_list_mutex);
     if (!buf_pool.need_LRU_eviction())
     {
@@ -2628,6 +2697,7 @@ static void buf_flush_page_cleaner()
   }
 
   mysql_mutex_unlock(&buf_pool.flush_list_mutex);
+  buf_flush_LRU_task.wait();
 
   if (srv_fast_shutdown != 2)
   {
@@ -31,6 +31,7 @@ Created 11/5/1995 Heikki Tuuri
 #include "buf0buf.h"
 #include "buf0flu.h"
 #include "buf0rea.h"
+#include "buf0sec.h"
 #include "btr0sea.h"
 #include "os0file.h"
 #include "page0zip.h"
@@ -38,6 +39,10 @@ Created 11/5/1995 Heikki Tuuri
 #include "srv0srv.h"
 #include "srv0mon.h"
 #include "my_cpu.h"
+#ifdef HAVE_LIBNUMA
+# include <numa.h>
+# include <sched.h>
+#endif
 
 /** Flush this many pages in buf_LRU_get_free_block() */
 size_t innodb_lru_flush_size;
@@ -100,8 +105,61 @@ buf_LRU_stat_t	buf_LRU_stat_sum;
 /** Move blocks to "new" LRU list only if the first access was at
 least this many milliseconds ago.  Not protected by any mutex or latch. */
 uint	buf_LRU_old_threshold_ms;
+
+/** innodb_lru_policy */
+ulong	buf_LRU_policy;
+
+/** The ghost list of BUF_LRU_2Q: a direct-mapped table of the
+page_id_t::raw() of recently evicted pages; protected by buf_pool.mutex */
+static uint64_t*	buf_LRU_ghost;
+/** Number of elements in buf_LRU_ghost[], minus 1 (a power of 2 minus 1) */
+static size_t		buf_LRU_ghost_mask;
 /* @} */
 
+/** Allocate the ghost list of recently evicted pages.
+@param n_pages  number of pages in the buffer pool */
+void buf_LRU_ghost_create(size_t n_pages)
+{
+  ut_ad(!buf_LRU_ghost);
+  /* Like 2Q, remember about half as many pages as fit in the pool. */
+  size_t n= 1024;
+  while (n < n_pages / 2)
+    n<<= 1;
+  buf_LRU_ghost= static_cast<uint64_t*>(ut_malloc_nokey(n * sizeof(uint64_t)));
+  memset(buf_LRU_ghost, 0xff, n * sizeof(uint64_t));
+  buf_LRU_ghost_mask= n - 1;
+}
+
+/** Free the ghost list of recently evicted pages. */
+void buf_LRU_ghost_free()
+{
+  ut_free(buf_LRU_ghost);
+  buf_LRU_ghost= nullptr;
+}
+
+/** @return the buf_LRU_ghost[] slot of a page */
+static uint64_t &buf_LRU_ghost_slot(const page_id_t id)
+{
+  return buf_LRU_ghost[size_t((id.raw() * 0x9e3779b97f4a7c15ULL) >> 32) &
+                       buf_LRU_ghost_mask];
+}
+
+/** Look up and remove a page from the ghost list when it is to be read.
+@param id  page identifier
+@return whether the page should be added to the young end of buf_pool.LRU */
+bool buf_LRU_ghost_hit(const page_id_t id)
+{
+  mysql_mutex_assert_owner(&buf_pool.mutex);
+  if (buf_LRU_policy != BUF_LRU_2Q)
+    return false;
+  uint64_t &slot= buf_LRU_ghost_slot(id);
+  if (slot != id.raw())
+    return false;
+  slot= ~0ULL;
+  MONITOR_INC(MONITOR_LRU_GHOST_HITS);
+  return true;
+}
+
 /** Remove bpage from buf_pool.LRU and buf_pool.page_hash.
 
 If !bpage->frame && bpage->oldest_modification() <= 1,
@@ -262,6 +320,37 @@ static bool buf_LRU_free_from_common_LRU_list(ulint limit)
 	return(freed);
 }
 
+#ifdef HAVE_LIBNUMA
+/** Number of buf_pool.free entries to inspect for a block that is
+local to the NUMA node of the current thread (innodb_numa_local) */
+static constexpr unsigned BUF_LRU_FREE_NUMA_SCAN= 16;
+#endif
+
+/** @return the preferred block on buf_pool.free
+@retval nullptr if the free list is empty */
+static buf_block_t *buf_LRU_free_first()
+{
+  buf_page_t *bpage= UT_LIST_GET_FIRST(buf_pool.free);
+#ifdef HAVE_LIBNUMA
+  if (srv_numa_local && !srv_numa_interleave && bpage)
+  {
+    const int cpu= sched_getcpu();
+    const int node= cpu < 0 ? -1 : numa_node_of_cpu(cpu);
+    unsigned n= BUF_LRU_FREE_NUMA_SCAN;
+    for (buf_page_t *b= bpage; b && n--; b= UT_LIST_GET_NEXT(list, b))
+    {
+      if (reinterpret_cast<buf_block_t*>(b)->numa_node == node)
+      {
+        MONITOR_INC(MONITOR_LRU_GET_FREE_NUMA_LOCAL);
+        return reinterpret_cast<buf_block_t*>(b);
+      }
+    }
+    MONITOR_INC(MONITOR_LRU_GET_FREE_NUMA_REMOTE);
+  }
+#endif
+  return reinterpret_cast<buf_block_t*>(bpage);
+}
+
 /** @return a buffer block from the buf_pool.free list
 @retval	NULL	if the free list is empty */
 buf_block_t* buf_LRU_get_free_only()
@@ -270,8 +359,7 @@ buf_block_t* buf_LRU_get_free_only()
 
 	mysql_mutex_assert_owner(&buf_pool.mutex);
 
-	block = reinterpret_cast<buf_block_t*>(
-		UT_LIST_GET_FIRST(buf_pool.free));
+	block = buf_LRU_free_first();
 
 	while (block != NULL) {
 		ut_ad(block->page.in_free_list);
@@ -298,8 +386,7 @@ buf_block_t* buf_LRU_get_free_only()
 		UT_LIST_ADD_LAST(buf_pool.withdraw, &block->page);
 		ut_d(block->in_withdraw_list = true);
 
-		block = reinterpret_cast<buf_block_t*>(
-			UT_LIST_GET_FIRST(buf_pool.free));
+		block = buf_LRU_free_first();
 	}
 
 	return(block);
@@ -360,6 +447,25 @@ static void buf_LRU_check_size_of_non_data_objects()
   }
 }
 
+/** Get a block from buf_pool.free while it holds more than
+innodb_lru_scan_depth/2 blocks, that is, when buf_LRU_get_free_block()
+would neither wait nor wake up the page cleaner.
+@return a free control block, in state BUF_BLOCK_MEMORY
+@retval nullptr if buf_LRU_get_free_block() must be invoked instead */
+buf_block_t *buf_LRU_get_free_plenty()
+{
+  mysql_mutex_assert_owner(&buf_pool.mutex);
+  if (UT_LIST_GET_LEN(buf_pool.free) <= srv_LRU_scan_depth / 2)
+    return nullptr;
+  buf_block_t *block= buf_LRU_get_free_only();
+  if (block)
+  {
+    MONITOR_INC(MONITOR_LRU_GET_FREE_SEARCH);
+    block->page.zip.clear();
+  }
+  return block;
+}
+
 /** Get a block from the buf_pool.free list.
 If the list is empty, blocks will be moved from the end of buf_pool.LRU
 to buf_pool.free.
@@ -761,6 +867,35 @@ void buf_page_make_young(buf_page_t *bpage)
   mysql_mutex_unlock(&buf_pool.mutex);
 }
 
+/** Move a freed page of the temporary tablespace to the end of
+buf_pool.LRU, so that it will be reclaimed before any other page.
+Such pages will not be written back to the file, see buf_page_t::flush().
+@param bpage  buffer pool page */
+void buf_page_make_old(buf_page_t *bpage)
+{
+  ut_ad(bpage->in_file());
+  ut_ad(fsp_is_system_temporary(bpage->id().space()));
+  ut_ad(!bpage->zip.data);
+
+  mysql_mutex_lock(&buf_pool.mutex);
+
+  /* For a short list, buf_pool.LRU_old would be undefined. */
+  if (UT_LIST_GET_LEN(buf_pool.LRU) > BUF_LRU_OLD_MIN_LEN &&
+      bpage != UT_LIST_GET_LAST(buf_pool.LRU))
+  {
+    buf_LRU_remove_block(bpage);
+    ut_ad(buf_pool.LRU_old);
+    UT_LIST_ADD_LAST(buf_pool.LRU, bpage);
+    ut_d(bpage->in_LRU_list= true);
+    incr_LRU_size_in_bytes(bpage);
+    buf_pool.LRU_old_len++;
+    bpage->set_old(true);
+    buf_LRU_old_adjust_len();
+  }
+
+  mysql_mutex_unlock(&buf_pool.mutex);
+}
+
 bool buf_page_make_young_if_needed(buf_page_t *bpage)
 {
   const bool not_first{bpage->set_accessed()};
@@ -855,6 +990,17 @@ bool buf_LRU_free_page(buf_page_t *bpage, bool zip)
 
 	ut_ad(bpage->can_relocate());
 
+	if (!b && buf_LRU_policy == BUF_LRU_2Q && !bpage->is_freed()) {
+		/* Remember the evicted page, in case it is read again soon. */
+		buf_LRU_ghost_slot(id) = id.raw();
+	}
+
+	if (!b && bpage->frame && !bpage->zip.data && !bpage->is_freed()
+	    && buf_sec.is_created()) {
+		/* Keep a copy of the clean page in the secondary cache. */
+		buf_sec.evicted(id, bpage->frame);
+	}
+
 	if (!buf_LRU_block_remove_hashed(bpage, id, chain, zip)) {
 		ut_ad(!b);
 		mysql_mutex_assert_not_owner(&buf_pool.flush_list_mutex);
@@ -995,6 +1141,11 @@ buf_LRU_block_free_non_file_page(
 	ut_ad(!block->page.hash);
 
 	block->page.set_state(buf_page_t::NOT_USED);
+	block->discard_dir_prefix();
+
+	if (block->stats_index_id) {
+		buf_pool.index_stats_remove(block);
+	}
 
 	MEM_UNDEFINED(block->page.frame, srv_page_size);
 	data = block->page.zip.data;
@@ -1038,6 +1189,81 @@ ATTRIBUTE_COLD void buf_pool_t::free_block(buf_block_t *block)
   mysql_mutex_unlock(&mutex);
 }
 
+/** Count an index page in index_stats.
+@param block     page that is x-latched or read-fixed
+@param index_id  PAGE_INDEX_ID of the page
+@param read      whether the page was read from a data file */
+void buf_pool_t::index_stats_add(buf_block_t *block, index_id_t index_id,
+                                 bool read)
+{
+  ut_ad(this == &buf_pool);
+  const index_id_t old_id= block->stats_index_id;
+  if (old_id == index_id)
+    return;
+  block->stats_index_id= index_id;
+
+  index_stats_mutex.wr_lock();
+  if (old_id)
+  {
+    /* The page was freed and allocated for another index. */
+    auto i= index_stats.find(old_id);
+    if (i != index_stats.end() && i->second.resident)
+      i->second.resident--;
+  }
+  buf_index_stat_t &stat= index_stats[index_id];
+  stat.space_id= block->page.id().space();
+  stat.resident++;
+  stat.reads+= read;
+  index_stats_mutex.wr_unlock();
+}
+
+/** Note that a page counted by index_stats_add() is being freed.
+@param block    page that is not accessible to other threads */
+void buf_pool_t::index_stats_remove(buf_block_t *block)
+{
+  ut_ad(this == &buf_pool);
+  const index_id_t index_id= block->stats_index_id;
+  ut_ad(index_id);
+  block->stats_index_id= 0;
+  const bool unused= !block->page.is_accessed();
+
+  index_stats_mutex.wr_lock();
+  /* The statistics are missing if the tablespace was deleted. After
+  DISCARD TABLESPACE and IMPORT TABLESPACE, the same index_id may be
+  counted again, starting from 0. */
+  auto i= index_stats.find(index_id);
+  if (i != index_stats.end())
+  {
+    if (i->second.resident)
+      i->second.resident--;
+    i->second.evicted++;
+    i->second.evicted_unused+= unused;
+  }
+  index_stats_mutex.wr_unlock();
+}
+
+/** Discard the statistics of the indexes in a deleted tablespace.
+@param space_id  tablespace identifier */
+void buf_pool_t::index_stats_discard(uint32_t space_id)
+{
+  index_stats_mutex.wr_lock();
+  for (auto i= index_stats.begin(); i != index_stats.end(); )
+    if (i->second.space_id == space_id)
+      i= index_stats.erase(i);
+    else
+      ++i;
+  index_stats_mutex.wr_unlock();
+}
+
+/** @return a copy of index_stats */
+buf_index_stats_t buf_pool_t::index_stats_snapshot()
+{
+  index_stats_mutex.wr_lock();
+  buf_index_stats_t snapshot(index_stats);
+  index_stats_mutex.wr_unlock();
+  return snapshot;
+}
+
 
 /** Remove bpage from buf_pool.LRU and buf_pool.page_hash.
 
@@ -35,6 +35,7 @@ Created 11/5/1995 Heikki Tuuri
 #include "buf0lru.h"
 #include "buf0buddy.h"
 #include "buf0dblwr.h"
+#include "buf0sec.h"
 #include "page0zip.h"
 #include "log0recv.h"
 #include "trx0sys.h"
@@ -43,6 +44,7 @@ Created 11/5/1995 Heikki Tuuri
 #include "srv0srv.h"
 #include "log.h"
 #include "mariadb_stats.h"
+#include "probes_mysql.h"
 
 TRANSACTIONAL_TARGET
 bool buf_pool_t::page_hash_contains(const page_id_t page_id, hash_chain &chain)
@@ -69,13 +71,16 @@ and the lock released later.
                   bitwise-ORed with 1 in recovery
 @param chain      buf_pool.page_hash cell for page_id
 @param block      preallocated buffer block (set to nullptr if consumed)
+@param refill     whether to replace a consumed block while holding
+                  buf_pool.mutex, if buf_pool.free contains plenty of blocks
 @return pointer to the block
 @retval	nullptr in case of an error */
 TRANSACTIONAL_TARGET
 static buf_page_t *buf_page_init_for_read(const page_id_t page_id,
                                           ulint zip_size,
                                           buf_pool_t::hash_chain &chain,
-                                          buf_block_t *&block)
+                                          buf_block_t *&block,
+                                          bool refill= false)
 {
   buf_page_t *bpage= nullptr;
   if (!zip_size || (zip_size & 1))
@@ -125,8 +130,9 @@ static buf_page_t *buf_page_init_for_read(const page_id_t page_id,
     buf_pool.page_hash.append(chain, bpage);
     hash_lock.unlock();
 
-    /* The block must be put to the LRU list, to the old blocks */
-    buf_LRU_add_block(bpage, true/* to old blocks */);
+    /* The block must be put to the LRU list, to the old blocks,
+    unless it was evicted recently (innodb_lru_policy=2q) */
+    buf_LRU_add_block(bpage, !buf_LRU_ghost_hit(page_id));
 
     if (UNIV_UNLIKELY(zip_size))
     {
@@ -143,6 +149,11 @@ static buf_page_t *buf_page_init_for_read(const page_id_t page_id,
       ut_ad(bpage->belongs_to_unzip_LRU());
       buf_unzip_LRU_add_block(reinterpret_cast<buf_block_t*>(bpage), TRUE);
     }
+
+    if (refill)
+      /* Spare the caller a buf_pool.mutex acquisition in
+      buf_read_acquire() for the next page of a read-ahead batch. */
+      block= buf_LRU_get_free_plenty();
   }
   else
   {
@@ -182,9 +193,10 @@ static buf_page_t *buf_page_init_for_read(const page_id_t page_id,
       buf_pool.page_hash.append(chain, bpage);
     }
 
-    /* The block must be put to the LRU list, to the old blocks.
+    /* The block must be put to the LRU list, to the old blocks,
+    unless it was evicted recently (innodb_lru_policy=2q).
     The zip size is already set into the page zip */
-    buf_LRU_add_block(bpage, true/* to old blocks */);
+    buf_LRU_add_block(bpage, !buf_LRU_ghost_hit(page_id));
   }
 
   buf_pool.stat.n_pages_read++;
@@ -207,6 +219,7 @@ flag is cleared and the x-lock released by an i/o-handler thread.
 @param[in,out] space	tablespace
 @param[in,out] block	preallocated buffer block
 @param[in] sync		true if synchronous aio is desired
+@param[in] refill	whether a consumed block may be replaced by a free one
 @return error code
 @retval DB_SUCCESS if the page was read
 @retval DB_SUCCESS_LOCKED_REC if the page exists in the buffer pool already */
@@ -218,7 +231,8 @@ buf_read_page_low(
 	buf_pool_t::hash_chain&	chain,
 	fil_space_t*		space,
 	buf_block_t*&		block,
-	bool			sync = false)
+	bool			sync = false,
+	bool			refill = false)
 {
 	buf_page_t*	bpage;
 
@@ -227,7 +241,8 @@ buf_read_page_low(
 		return DB_PAGE_CORRUPTED;
 	}
 
-	bpage = buf_page_init_for_read(page_id, zip_size, chain, block);
+	bpage = buf_page_init_for_read(page_id, zip_size, chain, block,
+				       refill);
 
 	if (!bpage) {
 		space->release();
@@ -249,10 +264,30 @@ buf_read_page_low(
 	DBUG_LOG("ib_buf",
 		 "read page " << page_id << " zip_size=" << zip_size
 		 << (sync ? " sync" : " async"));
+	MYSQL_INNODB_PAGE_READ_START(page_id.space(), page_id.page_no(),
+				     sync);
 
 	void* dst = zip_size > 1 ? bpage->zip.data : bpage->frame;
 	const ulint len = zip_size & ~1 ? zip_size & ~1 : srv_page_size;
 
+	if (zip_size <= 1 && buf_sec.is_created()
+	    && buf_sec.read(page_id, *space, bpage->frame)) {
+		/* The page was found in the secondary cache. */
+		dberr_t err = bpage->read_complete(
+			*UT_LIST_GET_FIRST(space->chain));
+		MYSQL_INNODB_PAGE_READ_DONE(page_id.space(),
+					    page_id.page_no(), err);
+		space->release();
+		if (sync) {
+			thd_wait_end(nullptr);
+			if (mariadb_timer) {
+				mariadb_increment_pages_read_time(
+					mariadb_timer);
+			}
+		}
+		return err == DB_FAIL ? DB_PAGE_CORRUPTED : err;
+	}
+
 	auto fio = space->io(IORequest(sync
 				       ? IORequest::READ_SYNC
 				       : IORequest::READ_ASYNC),
@@ -265,6 +300,8 @@ buf_read_page_low(
 		thd_wait_end(nullptr);
 		/* The i/o was already completed in space->io() */
 		fio.err = bpage->read_complete(*fio.node);
+		MYSQL_INNODB_PAGE_READ_DONE(page_id.space(),
+					    page_id.page_no(), fio.err);
 		space->release();
 		if (fio.err == DB_FAIL) {
 			fio.err = DB_PAGE_CORRUPTED;
@@ -370,11 +407,11 @@ ulint buf_read_ahead_random(const page_id_t page_id, ulint zip_size)
       break;
     buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(i.fold());
     space->reacquire();
-    if (buf_read_page_low(i, zip_size, chain, space, block) == DB_SUCCESS)
+    if (buf_read_page_low(i, zip_size, chain, space, block, false,
+                          i.page_no() + 1 < high.page_no()) == DB_SUCCESS)
     {
       count++;
-      ut_ad(!block);
-      if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) &&
+      if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) && !block &&
           UNIV_UNLIKELY(!(block= buf_read_acquire())))
         break;
     }
@@ -665,12 +702,11 @@ ulint buf_read_ahead_linear(const page_id_t page_id, ulint zip_size)
       break;
     buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(new_low.fold());
     space->reacquire();
-    if (buf_read_page_low(new_low, zip_size, chain, space, block) ==
-        DB_SUCCESS)
+    if (buf_read_page_low(new_low, zip_size, chain, space, block, false,
+                          new_low != new_high_1) == DB_SUCCESS)
     {
       count++;
-      ut_ad(!block);
-      if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) &&
+      if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) && !block &&
           UNIV_UNLIKELY(!(block= buf_read_acquire())))
         break;
     }
@@ -695,6 +731,126 @@ ulint buf_read_ahead_linear(const page_id_t page_id, ulint zip_size)
   return count;
 }
 
+/** Issue an asynchronous read of the sibling of an index leaf page that
+a range scan just moved to, unless the sibling is already in buf_pool.
+This lets the read overlap with the processing of the records in block,
+so that the scan will not stall at the next page boundary.
+@param block  index leaf page that is latched by the caller
+@param next   whether the scan is in ascending order */
+void buf_read_ahead_sibling(const buf_block_t &block, bool next)
+{
+  const page_id_t id{block.page.id()};
+  if (!srv_scan_read_ahead || id.space() >= SRV_TMP_SPACE_ID ||
+      srv_startup_is_before_trx_rollback_phase)
+    return;
+
+  const uint32_t page_no= mach_read_from_4(my_assume_aligned<4>
+                                           (block.page.frame +
+                                            (next
+                                             ? FIL_PAGE_NEXT
+                                             : FIL_PAGE_PREV)));
+  if (page_no == FIL_NULL || page_no == id.page_no())
+    return;
+
+  const page_id_t sibling{id.space(), page_no};
+  if (buf_pool.page_hash_contains(sibling,
+                                  buf_pool.page_hash.cell_get(sibling.fold())))
+    return;
+
+  if (os_aio_pending_reads_approx() >
+      buf_pool.curr_size / BUF_READ_AHEAD_PEND_LIMIT)
+    return;
+
+  fil_space_t *space= fil_space_t::get(id.space());
+  if (!space)
+    return;
+  if (page_no > space->last_page_number())
+  {
+    space->release();
+    return;
+  }
+
+  buf_read_page_background(space, sibling, block.zip_size());
+}
+
+/** Issue asynchronous reads of pages that are expected to belong to
+an externally stored column that is being read, unless the pages are
+already in buf_pool. Does not read any page if the read-ahead mechanism
+is not activated.
+@param page_id   the first page to read
+@param n         number of pages to read
+@param zip_size  ROW_FORMAT=COMPRESSED page size, or 0
+@return number of page read requests issued */
+ulint buf_read_ahead_blob(const page_id_t page_id, uint32_t n,
+                          ulint zip_size)
+{
+  if (!srv_read_ahead_threshold || page_id.space() >= SRV_TMP_SPACE_ID ||
+      srv_startup_is_before_trx_rollback_phase || !n)
+    return 0;
+
+  if (os_aio_pending_reads_approx() >
+      buf_pool.curr_size / BUF_READ_AHEAD_PEND_LIMIT)
+    return 0;
+
+  fil_space_t *space= fil_space_t::get(page_id.space());
+  if (!space)
+    return 0;
+
+  const uint32_t last= space->last_page_number();
+  if (page_id.page_no() > last)
+  {
+fail:
+    space->release();
+    return 0;
+  }
+  const page_id_t high_1{page_id.space(),
+                         uint32_t(std::min<uint64_t>(uint64_t{page_id.page_no()}
+                                                     + n - 1, last))};
+
+  buf_block_t *block= nullptr;
+  if (UNIV_LIKELY(!zip_size))
+  {
+  allocate_block:
+    if (UNIV_UNLIKELY(!(block= buf_read_acquire())))
+      goto fail;
+  }
+  else if (recv_recovery_is_on())
+  {
+    zip_size|= 1;
+    goto allocate_block;
+  }
+
+  ulint count= 0;
+  for (page_id_t i= page_id; i <= high_1; ++i)
+  {
+    if (space->is_stopping())
+      break;
+    buf_pool_t::hash_chain &chain= buf_pool.page_hash.cell_get(i.fold());
+    space->reacquire();
+    if (buf_read_page_low(i, zip_size, chain, space, block, false,
+                          i != high_1) == DB_SUCCESS)
+    {
+      count++;
+      if ((UNIV_LIKELY(!zip_size) || (zip_size & 1)) && !block &&
+          UNIV_UNLIKELY(!(block= buf_read_acquire())))
+        break;
+    }
+  }
+
+  if (count)
+  {
+    mariadb_increment_pages_prefetched(count);
+    mysql_mutex_lock(&buf_pool.mutex);
+    buf_LRU_stat_inc_io();
+    buf_pool.stat.n_ra_pages_read+= count;
+    mysql_mutex_unlock(&buf_pool.mutex);
+  }
+
+  space->release();
+  buf_read_release(block);
+  return count;
+}
+
 /** Schedule a page for recovery.
 @param space    tablespace
 @param page_id  page identifier
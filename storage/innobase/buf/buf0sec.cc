@@ -0,0 +1,310 @@
+/*****************************************************************************
+
+Copyright (c) 2026, MariaDB Corporation.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free Software
+Foundation; version 2 of the License.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA
+
+*****************************************************************************/
+
+/**************************************************//**
+@file buf/buf0sec.cc
+Secondary buffer pool cache on a local file
+*******************************************************/
+
+#include "buf0sec.h"
+#include "buf0buf.h"
+#include "fil0fil.h"
+#include "srv0srv.h"
+#include "log.h"
+
+/** The secondary buffer pool cache */
+buf_sec_t buf_sec;
+
+/** Open the cache file if innodb_buffer_pool_secondary_file is set.
+Failure is not fatal; the cache will not be used. */
+void buf_sec_t::create()
+{
+  ut_ad(!is_created());
+
+  const char *name= srv_buf_pool_secondary_file;
+  if (!name || !*name || srv_read_only_mode ||
+      srv_operation != SRV_OPERATION_NORMAL)
+    return;
+
+  const size_t n= size_t(srv_buf_pool_secondary_size >> srv_page_size_shift);
+  if (!n)
+  {
+    sql_print_warning("InnoDB: innodb_buffer_pool_secondary_size is too small;"
+                      " not using %s", name);
+    return;
+  }
+
+  bool success;
+  pfs_os_file_t fh= os_file_create(innodb_data_file_key, name,
+                                   OS_FILE_OPEN_SILENT, OS_FILE_NORMAL,
+                                   OS_DATA_FILE, false, &success);
+  if (!success)
+    fh= os_file_create(innodb_data_file_key, name, OS_FILE_CREATE,
+                       OS_FILE_NORMAL, OS_DATA_FILE, false, &success);
+  if (!success)
+  {
+    sql_print_warning("InnoDB: Cannot open innodb_buffer_pool_secondary_file"
+                      " %s", name);
+    return;
+  }
+
+  if (!os_file_set_size(name, fh, os_offset_t{n} << srv_page_size_shift,
+                        true))
+  {
+    sql_print_warning("InnoDB: Cannot extend innodb_buffer_pool_secondary_file"
+                      " %s", name);
+    os_file_close(fh);
+    return;
+  }
+
+  queue_frames= static_cast<byte*>
+    (aligned_malloc(QUEUE_SIZE << srv_page_size_shift, srv_page_size));
+  /* The contents of the file are not preserved across restarts. */
+  slot *s= static_cast<slot*>(ut_zalloc_nokey(n * sizeof *s));
+  for (size_t i= n; i--; )
+    s[i].id= ~0ULL;
+
+  mutex.init();
+  file= fh;
+  n_slots= n;
+  queue_first= queue_len= 0;
+  writer_active= false;
+  slots= s;
+
+  sql_print_information("InnoDB: Using %s as a secondary buffer pool"
+                        " cache of %zu pages", name, n);
+}
+
+/** Wait for pending writes and close the cache file. */
+void buf_sec_t::close()
+{
+  if (!is_created())
+    return;
+
+  mutex.wr_lock();
+  /* Prevent evicted() from submitting more writes. */
+  queue_len= 0;
+  slot *s= slots;
+  slots= nullptr;
+  mutex.wr_unlock();
+
+  write_task.wait();
+  mutex.destroy();
+  os_file_close(file);
+  file= OS_FILE_CLOSED;
+  ut_free(s);
+  aligned_free(queue_frames);
+  queue_frames= nullptr;
+  n_slots= 0;
+}
+
+/** Write queued pages to the file. */
+inline void buf_sec_t::write_queued()
+{
+  for (;;)
+  {
+    mutex.wr_lock();
+    if (!queue_len || !slots)
+    {
+      writer_active= false;
+      mutex.wr_unlock();
+      return;
+    }
+
+    const write_req req= write_queue[queue_first];
+    const page_id_t id{slots[req.n].id};
+    bool ok= slots[req.n].state == PENDING && slots[req.n].gen == req.gen;
+    mutex.wr_unlock();
+
+    if (!ok);
+    else if (fil_space_t *space= fil_space_t::get(id.space()))
+    {
+      /* Only pages whose file format is identical to the buffer pool
+      frame can be cached. */
+      ok= space->purpose == FIL_TYPE_TABLESPACE && !space->crypt_data &&
+        !space->is_compressed() && !space->zip_size();
+      space->release();
+      ok= ok && os_file_write(IORequestWrite, srv_buf_pool_secondary_file,
+                              file, req.frame,
+                              os_offset_t{req.n} << srv_page_size_shift,
+                              srv_page_size) == DB_SUCCESS;
+    }
+    else
+      ok= false;
+
+    mutex.wr_lock();
+    if (!slots)
+    {
+      /* close() is waiting for us */
+      writer_active= false;
+      mutex.wr_unlock();
+      return;
+    }
+    slot &s= slots[req.n];
+    if (s.state == PENDING && s.gen == req.gen)
+      s.state= ok ? VALID : EMPTY;
+    else
+      ok= false;
+    queue_first= (queue_first + 1) % QUEUE_SIZE;
+    queue_len--;
+    mutex.wr_unlock();
+
+    if (ok)
+      writes++;
+    else
+      skipped++;
+  }
+}
+
+/** Write queued pages to the file. */
+void buf_sec_t::write_callback(void*)
+{
+  buf_sec.write_queued();
+}
+
+/** Note that a clean page is being evicted from buf_pool.
+@param id     page identifier
+@param frame  uncompressed page frame */
+void buf_sec_t::evicted(const page_id_t id, const byte *frame)
+{
+  ut_ad(is_created());
+  mysql_mutex_assert_owner(&buf_pool.mutex);
+
+  if (id.space() == SRV_TMP_SPACE_ID)
+    return;
+
+  mutex.wr_lock();
+  if (!slots)
+  {
+    mutex.wr_unlock();
+    return;
+  }
+
+  const size_t n= slot_of(id);
+  slot &s= slots[n];
+  ut_ad(s.id != id.raw() || s.state == EMPTY);
+
+  if (s.state == READING || queue_len == QUEUE_SIZE)
+  {
+    mutex.wr_unlock();
+    skipped++;
+    return;
+  }
+
+  s.id= id.raw();
+  s.state= PENDING;
+  const size_t pos= (queue_first + queue_len++) % QUEUE_SIZE;
+  write_req &req= write_queue[pos];
+  req.n= n;
+  req.gen= ++s.gen;
+  req.frame= queue_frames + (pos << srv_page_size_shift);
+  memcpy_aligned<UNIV_PAGE_SIZE_MIN>(req.frame, frame, srv_page_size);
+
+  const bool submit= !writer_active;
+  writer_active= true;
+  mutex.wr_unlock();
+
+  if (submit)
+    srv_thread_pool->submit_task(&write_task);
+}
+
+/** Try to read a page from the cache and remove it from the cache.
+@param id     page identifier
+@param space  tablespace
+@param frame  page frame to read to
+@return whether the page was read */
+bool buf_sec_t::read(const page_id_t id, const fil_space_t &space, byte *frame)
+{
+  ut_ad(is_created());
+
+  mutex.wr_lock();
+  if (!slots)
+  {
+  not_found:
+    mutex.wr_unlock();
+    return false;
+  }
+
+  slot &s= slots[slot_of(id)];
+  if (s.id != id.raw())
+    goto not_found;
+
+  switch (s.state) {
+  case EMPTY:
+    goto not_found;
+  case PENDING:
+    /* Cancel the write; the caller will read the page from the data file. */
+    s.state= EMPTY;
+    goto not_found;
+  case READING:
+    ut_ad("concurrent read of the same page" == 0);
+    goto not_found;
+  case VALID:
+    break;
+  }
+
+  s.state= READING;
+  const size_t n= size_t(&s - slots);
+  mutex.wr_unlock();
+
+  bool ok= !space.crypt_data && !space.is_compressed() &&
+    os_file_read(IORequestRead, file, frame,
+                 os_offset_t{n} << srv_page_size_shift, srv_page_size,
+                 nullptr) == DB_SUCCESS &&
+    id == page_id_t(mach_read_from_4(frame + FIL_PAGE_SPACE_ID),
+                    mach_read_from_4(frame + FIL_PAGE_OFFSET)) &&
+    !buf_page_is_corrupted(false, frame, space.flags);
+
+  mutex.wr_lock();
+  ut_ad(s.state == READING);
+  s.state= EMPTY;
+  mutex.wr_unlock();
+
+  if (ok)
+    reads++;
+  return ok;
+}
+
+/** Remove a page from the cache, because it is being reinitialized.
+@param id     page identifier */
+void buf_sec_t::forget(const page_id_t id)
+{
+  ut_ad(is_created());
+  mutex.wr_lock();
+  if (slots)
+  {
+    slot &s= slots[slot_of(id)];
+    if (s.id == id.raw() && s.state != READING)
+      s.state= EMPTY;
+  }
+  mutex.wr_unlock();
+}
+
+/** Remove all pages of a tablespace from the cache.
+@param space_id   tablespace identifier */
+void buf_sec_t::discard(uint32_t space_id)
+{
+  ut_ad(is_created());
+  mutex.wr_lock();
+  if (slot *s= slots)
+    for (const slot *end= s + n_slots; s < end; s++)
+      if (s->state != EMPTY && s->state != READING &&
+          page_id_t{s->id}.space() == space_id)
+        s->state= EMPTY;
+  mutex.wr_unlock();
+}
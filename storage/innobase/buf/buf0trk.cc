@@ -0,0 +1,309 @@
+/*****************************************************************************
+
+Copyright (c) 2026, MariaDB Corporation.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free Software
+Foundation; version 2 of the License.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA
+
+*****************************************************************************/
+
+/**************************************************//**
+@file buf/buf0trk.cc
+Changed page tracking for incremental backup
+*******************************************************/
+
+#include "buf0trk.h"
+#include "fil0fil.h"
+#include "log0log.h"
+#include "log0recv.h"
+#include "srv0srv.h"
+#include "log.h"
+#include <algorithm>
+
+/** Changed page tracking */
+buf_track_t buf_track;
+
+/** Sort and remove duplicates.
+@param ids   page identifiers */
+static void buf_track_compact(std::vector<uint64_t> &ids)
+{
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+}
+
+/** Parse a record.
+@param rec   start of the record
+@param end   end of the file contents
+@return size of the record
+@retval 0 if the record is truncated or corrupted */
+static size_t buf_track_parse(const byte *rec, const byte *end)
+{
+  if (size_t(end - rec) < buf_track_t::HEADER_SIZE + 4)
+    return 0;
+  const uint32_t type= mach_read_from_4(rec);
+  if (type != buf_track_t::START && type != buf_track_t::PAGES)
+    return 0;
+  const size_t len= buf_track_t::HEADER_SIZE +
+    size_t{mach_read_from_4(rec + 4)} * 8;
+  if (size_t(end - rec) < len + 4 ||
+      my_crc32c(0, rec, len) != mach_read_from_4(rec + len))
+    return 0;
+  return len + 4;
+}
+
+/** Read the contents of a tracking file.
+@param file   the file
+@param buf    the file contents
+@return whether the file was read */
+static bool buf_track_read(pfs_os_file_t file, std::vector<byte> &buf)
+{
+  const os_offset_t size= os_file_get_size(file);
+  if (size == os_offset_t(-1) || size != size_t(size))
+    return false;
+  buf.resize(size_t(size));
+  return !size || os_file_read(IORequestRead, file, buf.data(), 0,
+                               size_t(size), nullptr) == DB_SUCCESS;
+}
+
+/** Open the file if innodb_track_changed_pages=ON.
+Failure is not fatal; nothing will be tracked. */
+void buf_track_t::create()
+{
+  ut_ad(!is_enabled());
+
+  if (!srv_track_changed_pages || srv_read_only_mode ||
+      srv_operation != SRV_OPERATION_NORMAL)
+    return;
+
+  char path[FN_REFLEN];
+  snprintf(path, sizeof path, "%s" FN_ROOTDIR "%s",
+           *srv_data_home ? srv_data_home : fil_path_to_mysql_datadir,
+           BUF_TRACK_FILE_NAME);
+
+  bool success;
+  pfs_os_file_t fh= os_file_create(innodb_data_file_key, path,
+                                   OS_FILE_OPEN_SILENT, OS_FILE_NORMAL,
+                                   OS_DATA_FILE_NO_O_DIRECT, false, &success);
+  if (!success)
+    fh= os_file_create(innodb_data_file_key, path, OS_FILE_CREATE,
+                       OS_FILE_NORMAL, OS_DATA_FILE_NO_O_DIRECT, false,
+                       &success);
+  if (!success)
+  {
+    sql_print_warning("InnoDB: Cannot open %s; not tracking changed pages",
+                      path);
+    return;
+  }
+
+  /* Find the end of the last complete record. The file can be continued
+  if no page was written after the last recorded checkpoint, that is,
+  if the server was shut down normally while tracking was enabled. */
+  std::vector<byte> buf;
+  size_t end= 0;
+  lsn_t last_checkpoint= 0;
+  if (buf_track_read(fh, buf))
+    for (size_t len;
+         (len= buf_track_parse(buf.data() + end,
+                                     buf.data() + buf.size())) != 0;
+         end+= len)
+      last_checkpoint= mach_read_from_8(&buf[end + 8]);
+
+  const bool cont= end && !recv_needed_recovery &&
+    last_checkpoint == log_sys.last_checkpoint_lsn;
+  if (!cont)
+    end= 0;
+
+  /* If nothing was logged after the latest checkpoint, no page can
+carry a newer FIL_PAGE_LSN and tracking can start from the checkpoint. */
+  const lsn_t checkpoint_lsn= log_sys.last_checkpoint_lsn;
+  lsn_t start_lsn= log_sys.get_lsn();
+  if (!recv_needed_recovery &&
+      start_lsn <= checkpoint_lsn + SIZE_OF_FILE_CHECKPOINT)
+    start_lsn= checkpoint_lsn;
+
+  file= fh;
+  size= end;
+  if (!os_file_truncate(path, fh, end, true) ||
+      (!cont && !write(START, checkpoint_lsn, start_lsn, {})))
+  {
+    sql_print_warning("InnoDB: Cannot write %s; not tracking changed pages",
+                      path);
+    os_file_close(fh);
+    file= OS_FILE_CLOSED;
+    return;
+  }
+
+  mutex.init();
+  enabled= true;
+  sql_print_information("InnoDB: %s changed page tracking in %s",
+                        cont ? "Continuing" : "Starting", path);
+}
+
+/** Close the file. */
+void buf_track_t::close()
+{
+  if (file == OS_FILE_CLOSED)
+    return;
+
+  if (is_enabled())
+  {
+    mutex.wr_lock();
+    enabled= false;
+    written.clear();
+    written.shrink_to_fit();
+    mutex.wr_unlock();
+  }
+  mutex.destroy();
+  os_file_close(file);
+  file= OS_FILE_CLOSED;
+}
+
+/** Append a record to the file.
+@param type            record type
+@param checkpoint_lsn  checkpoint LSN
+@param end_lsn         current LSN
+@param ids             sorted page identifiers
+@return whether the record was written */
+bool buf_track_t::write(record_type type, lsn_t checkpoint_lsn,
+                        lsn_t end_lsn, const std::vector<uint64_t> &ids)
+{
+  const size_t len= HEADER_SIZE + ids.size() * 8;
+  std::vector<byte> rec(len + 4);
+  mach_write_to_4(&rec[0], type);
+  mach_write_to_4(&rec[4], uint32_t(ids.size()));
+  mach_write_to_8(&rec[8], checkpoint_lsn);
+  mach_write_to_8(&rec[16], end_lsn);
+  byte *b= &rec[HEADER_SIZE];
+  for (uint64_t id : ids)
+  {
+    mach_write_to_8(b, id);
+    b+= 8;
+  }
+  mach_write_to_4(b, my_crc32c(0, rec.data(), len));
+
+  /* The file does not need to be durable, because it will be discarded
+  after a crash. */
+  if (os_file_write(IORequestWrite, BUF_TRACK_FILE_NAME, file, rec.data(),
+                    size, rec.size()) != DB_SUCCESS)
+    return false;
+  size+= rec.size();
+  return true;
+}
+
+/** Note that a page write completed.
+@param id   page identifier */
+void buf_track_t::page_written(const page_id_t id)
+{
+  if (!is_enabled())
+    return;
+  mutex.wr_lock();
+  if (is_enabled())
+  {
+    /* Get rid of duplicates before the vector would be extended. */
+    if (written.size() == written.capacity() && written.size() >= 65536)
+      buf_track_compact(written);
+    written.push_back(id.raw());
+  }
+  mutex.wr_unlock();
+}
+
+/** Note that a tablespace was created or that its pages are being
+written outside buf_pool.
+@param space_id   tablespace identifier */
+void buf_track_t::space_written(uint32_t space_id)
+{
+  page_written(page_id_t{space_id, FIL_NULL});
+}
+
+/** Append the pages that were written since the previous checkpoint.
+This must be invoked before the checkpoint header is written.
+@param checkpoint_lsn  the checkpoint LSN */
+void buf_track_t::checkpoint(lsn_t checkpoint_lsn)
+{
+  if (!is_enabled())
+    return;
+
+  std::vector<uint64_t> ids;
+  mutex.wr_lock();
+  ids.swap(written);
+  mutex.wr_unlock();
+  /* All pages in ids were written before this point; their
+  FIL_PAGE_LSN cannot exceed the current LSN. */
+  const lsn_t end_lsn= log_sys.get_lsn();
+  buf_track_compact(ids);
+
+  /* log_sys serializes the checkpoints, and close() is only invoked
+  after the last checkpoint. Therefore, we need no mutex for the file. */
+  if (!write(PAGES, checkpoint_lsn, end_lsn, ids))
+  {
+    sql_print_error("InnoDB: Cannot write " BUF_TRACK_FILE_NAME
+                    "; disabling changed page tracking");
+    mutex.wr_lock();
+    enabled= false;
+    written.clear();
+    mutex.wr_unlock();
+  }
+}
+
+/** Read the tracking file.
+@param path      file name
+@param from_lsn  the LSN of the previous backup
+@param to_lsn    the checkpoint LSN at the start of this backup
+@param pages     sorted page_id_t::raw() of the pages that may have
+                 been modified between from_lsn and to_lsn
+@return whether the file fully covers the changes since from_lsn */
+bool buf_track_t::read(const char *path, lsn_t from_lsn, lsn_t to_lsn,
+                       std::vector<uint64_t> &pages)
+{
+  pages.clear();
+
+  bool success;
+  pfs_os_file_t fh= os_file_create_simple_no_error_handling(
+    innodb_data_file_key, path, OS_FILE_OPEN, OS_FILE_READ_ONLY,
+    srv_read_only_mode, &success);
+  if (!success)
+    return false;
+
+  std::vector<byte> buf;
+  success= buf_track_read(fh, buf);
+  os_file_close(fh);
+  if (!success)
+    return false;
+
+  lsn_t start_lsn= LSN_MAX, last_checkpoint= 0;
+  const byte *end= buf.data() + buf.size();
+  for (const byte *rec= buf.data(); rec < end; )
+  {
+    const size_t len= buf_track_parse(rec, end);
+    if (!len)
+      break;
+    if (mach_read_from_4(rec) == START)
+    {
+      pages.clear();
+      start_lsn= mach_read_from_8(rec + 16);
+    }
+    else if (mach_read_from_8(rec + 16) > from_lsn)
+      for (const byte *b= rec + HEADER_SIZE, *e= rec + len - 4; b < e; b+= 8)
+        pages.push_back(mach_read_from_8(b));
+    last_checkpoint= mach_read_from_8(rec + 8);
+    rec+= len;
+  }
+
+  if (start_lsn > from_lsn || last_checkpoint < to_lsn)
+  {
+    pages.clear();
+    return false;
+  }
+
+  buf_track_compact(pages);
+  return true;
+}
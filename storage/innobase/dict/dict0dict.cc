@@ -1306,6 +1306,19 @@ dict_index_t *dict_index_t::clone_if_needed()
 }
 #endif /* BTR_CUR_HASH_ADAPT */
 
+/** @return the memory occupied by a table definition and its indexes */
+static ulint dict_table_mem_size(const dict_table_t &table)
+{
+	ulint size = mem_heap_get_size(table.heap);
+
+	for (const dict_index_t* index = UT_LIST_GET_FIRST(table.indexes);
+	     index; index = UT_LIST_GET_NEXT(indexes, index)) {
+		size += mem_heap_get_size(index->heap);
+	}
+
+	return size;
+}
+
 /** Evict unused, unlocked tables from table_LRU.
 @param half whether to consider half the tables only (instead of all)
 @return number of tables evicted */
@@ -1318,13 +1331,29 @@ ulint dict_sys_t::evict_table_LRU(bool half)
 	const ulint max_tables = tdc_size;
 #endif
 	ulint n_evicted = 0;
+	const size_t size_limit = srv_dict_size_limit;
+	size_t size = 0;
 
 	lock(SRW_LOCK_CALL);
 	ut_ad(dict_lru_validate());
 
 	const ulint len = UT_LIST_GET_LEN(table_LRU);
 
-	if (len < max_tables) {
+	/* Traversing all table definitions is not free; only do it
+	when innodb_dict_size_limit has been set. */
+	if (size_limit) {
+		for (const dict_table_t* table = UT_LIST_GET_FIRST(table_LRU);
+		     table; table = UT_LIST_GET_NEXT(table_LRU, table)) {
+			size += dict_table_mem_size(*table);
+		}
+		for (const dict_table_t* table
+			     = UT_LIST_GET_FIRST(table_non_LRU);
+		     table; table = UT_LIST_GET_NEXT(table_LRU, table)) {
+			size += dict_table_mem_size(*table);
+		}
+	}
+
+	if (len < max_tables && size <= size_limit) {
 func_exit:
 		unlock();
 		return(n_evicted);
@@ -1337,10 +1366,15 @@ ulint dict_sys_t::evict_table_LRU(bool half)
 	entire LRU list. Only scan pct_check list entries. */
 
 	for (dict_table_t *table = UT_LIST_GET_LAST(table_LRU);
-	     table && i > check_up_to && (len - n_evicted) > max_tables; --i) {
+	     table && i > check_up_to
+	     && ((len - n_evicted) > max_tables || size > size_limit); --i) {
 		dict_table_t* prev_table = UT_LIST_GET_PREV(table_LRU, table);
 
 		if (dict_table_can_be_evicted(table)) {
+			if (size_limit) {
+				size -= std::min<size_t>(
+					size, dict_table_mem_size(*table));
+			}
 			remove(table, true);
 			++n_evicted;
 		}
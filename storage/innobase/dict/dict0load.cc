@@ -884,6 +884,94 @@ static uint32_t dict_find_max_space_id(btr_pcur_t *pcur, mtr_t *mtr)
   return max_space_id;
 }
 
+namespace
+{
+/** Tablespace files to be opened by dict_load_tablespaces() */
+struct dict_tablespace_loader
+{
+  /** a tablespace file */
+  struct entry
+  {
+    /** databasename/tablename */
+    std::string name;
+    /** tablespace identifier */
+    uint32_t id;
+    /** FSP_SPACE_FLAGS */
+    uint32_t flags;
+    /** whether the SYS_TABLES record was not delete-marked */
+    bool not_dropped;
+  };
+
+  /** the files to open */
+  std::vector<entry> entries;
+  /** the next element of entries to process */
+  std::atomic<size_t> next{0};
+
+  /** Open a tablespace file.
+  @param e   the tablespace file */
+  static void open(const entry &e)
+  {
+    const span<const char> name{e.name.data(), e.name.size()};
+    char *filepath= fil_make_filepath(nullptr, name, IBD, false);
+
+    /* Check that the .ibd file exists. */
+    if (fil_ibd_open(e.not_dropped, FIL_TYPE_TABLESPACE, e.id, e.flags,
+                     name, filepath) || !e.not_dropped)
+    {
+    }
+    else if (srv_operation == SRV_OPERATION_NORMAL &&
+             srv_start_after_restore &&
+             srv_force_recovery < SRV_FORCE_NO_BACKGROUND &&
+             dict_table_t::is_temporary_name(filepath))
+    {
+      /* Mariabackup will not copy files whose names start with
+      #sql-. This table ought to be dropped by
+      drop_garbage_tables_after_restore() a little later. */
+    }
+    else
+      sql_print_warning("InnoDB: Ignoring tablespace for %.*s because it"
+                        " could not be opened.",
+                        int(e.name.size()), e.name.data());
+
+    ut_free(filepath);
+  }
+
+  /** Open files until all entries have been claimed. */
+  void run()
+  {
+    for (size_t i; (i= next.fetch_add(1, std::memory_order_relaxed)) <
+           entries.size(); )
+      open(entries[i]);
+  }
+
+  static void task(void *loader)
+  { static_cast<dict_tablespace_loader*>(loader)->run(); }
+
+  /** Open all files. Each file is opened by fil_ibd_open(), which
+  may read and validate the first page. The files have distinct
+  tablespace identifiers, so they can be opened concurrently. */
+  void open_all()
+  {
+    /* The calling thread takes part in the work, so that it will
+    complete even if the thread pool is busy. */
+    std::vector<tpool::waitable_task*> tasks;
+    if (srv_thread_pool && entries.size() > 32)
+      for (size_t i= std::min<size_t>(srv_n_read_io_threads,
+                                      entries.size() / 32); i-- > 1; )
+      {
+        tasks.push_back(new tpool::waitable_task(task, this));
+        srv_thread_pool->submit_task(tasks.back());
+      }
+    run();
+    for (tpool::waitable_task *t : tasks)
+    {
+      t->wait();
+      delete t;
+    }
+  }
+};
+}
+
 /** Check MAX(SPACE) FROM SYS_TABLES and store it in fil_system.
 Open each data file if an encryption plugin has been loaded.
 
@@ -894,6 +982,7 @@ void dict_load_tablespaces(const std::set<uint32_t> *spaces, bool upgrade)
 	uint32_t	max_space_id = 0;
 	btr_pcur_t	pcur;
 	mtr_t		mtr;
+	dict_tablespace_loader loader;
 
 	mtr.start();
 
@@ -961,41 +1050,20 @@ void dict_load_tablespaces(const std::set<uint32_t> *spaces, bool upgrade)
 			continue;
 		}
 
-		const span<const char> name{field, len};
-
-		char*	filepath = fil_make_filepath(nullptr, name,
-						     IBD, false);
-
-		const bool not_dropped{!rec_get_deleted_flag(rec, 0)};
-
-		/* Check that the .ibd file exists. */
-		if (fil_ibd_open(not_dropped, FIL_TYPE_TABLESPACE,
-				 space_id, dict_tf_to_fsp_flags(flags),
-				 name, filepath)) {
-		} else if (!not_dropped) {
-		} else if (srv_operation == SRV_OPERATION_NORMAL
-			   && srv_start_after_restore
-			   && srv_force_recovery < SRV_FORCE_NO_BACKGROUND
-			   && dict_table_t::is_temporary_name(filepath)) {
-			/* Mariabackup will not copy files whose
-			names start with #sql-. This table ought to
-			be dropped by drop_garbage_tables_after_restore()
-			a little later. */
-		} else {
-			sql_print_warning("InnoDB: Ignoring tablespace for"
-					  " %.*s because it"
-					  " could not be opened.",
-					  static_cast<int>(len), field);
-		}
+		/* The files will be opened after the scan, so that
+		no page latch of SYS_TABLES is held during the file I/O. */
+		loader.entries.push_back({std::string(field, len), space_id,
+					  dict_tf_to_fsp_flags(flags),
+					  !rec_get_deleted_flag(rec, 0)});
 
 		max_space_id = ut_max(max_space_id, space_id);
-
-		ut_free(filepath);
 	}
 
 done:
 	mtr.commit();
 
+	loader.open_all();
+
 	fil_set_max_space_id_if_bigger(max_space_id);
 
 	dict_sys.unlock();
@@ -2933,6 +2933,57 @@ static index_stats_t dict_stats_analyze_index(dict_index_t* index)
 	DBUG_RETURN(result);
 }
 
+/** Secondary indexes of a table that are being analyzed concurrently */
+struct dict_stats_analyze_t
+{
+  /** the indexes to analyze */
+  std::vector<dict_index_t*> indexes;
+  /** the statistics of indexes[] */
+  std::vector<index_stats_t> stats;
+  /** the next element of indexes[] that is not being analyzed yet */
+  std::atomic<size_t> next{0};
+
+  /** Add an index to be analyzed.
+  @param index  secondary index */
+  void add(dict_index_t *index)
+  {
+    indexes.push_back(index);
+    stats.emplace_back(ulint{index->n_uniq});
+  }
+
+  /** Analyze indexes until none are left. */
+  void run()
+  {
+    for (size_t i;
+         (i= next.fetch_add(1, std::memory_order_relaxed)) < indexes.size(); )
+      stats[i]= dict_stats_analyze_index(indexes[i]);
+  }
+
+  /** Analyze indexes in a thread pool task. */
+  static void task(void *arg) { static_cast<dict_stats_analyze_t*>(arg)->run(); }
+
+  /** Analyze all indexes, using up to innodb_stats_analyze_threads threads.
+  The calling thread takes part in the work, so that it will complete
+  even if the thread pool is busy. */
+  void analyze()
+  {
+    std::vector<tpool::waitable_task*> tasks;
+    if (srv_thread_pool)
+      for (size_t i= std::min<size_t>(srv_stats_analyze_threads,
+                                      indexes.size()); --i; )
+      {
+        tasks.push_back(new tpool::waitable_task(task, this));
+        srv_thread_pool->submit_task(tasks.back());
+      }
+    run();
+    for (tpool::waitable_task *t : tasks)
+    {
+      t->wait();
+      delete t;
+    }
+  }
+};
+
 /*********************************************************************//**
 Calculates new estimates for table and index statistics. This function
 is relatively slow and is used to calculate persistent statistics that
@@ -2995,6 +3046,8 @@ dict_stats_update_persistent(
 
 	table->stat_sum_of_other_index_sizes = 0;
 
+	dict_stats_analyze_t	secondary;
+
 	for (index = dict_table_get_next_index(index);
 	     index != NULL;
 	     index = dict_table_get_next_index(index)) {
@@ -3005,13 +3058,20 @@ dict_stats_update_persistent(
 
 		dict_stats_empty_index(index);
 
-		if (dict_stats_should_ignore_index(index)) {
-			continue;
+		if (!dict_stats_should_ignore_index(index)) {
+			secondary.add(index);
 		}
+	}
 
+	if (!secondary.indexes.empty()) {
 		table->stats_mutex_unlock();
-		stats = dict_stats_analyze_index(index);
+		secondary.analyze();
 		table->stats_mutex_lock();
+	}
+
+	for (size_t j = 0; j < secondary.indexes.size(); j++) {
+		index = secondary.indexes[j];
+		stats = std::move(secondary.stats[j]);
 
 		if (stats.is_bulk_operation()) {
 			table->stats_mutex_unlock();
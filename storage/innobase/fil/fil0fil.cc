@@ -46,7 +46,10 @@ Created 10/25/1995 Heikki Tuuri
 #include "trx0purge.h"
 #include "buf0lru.h"
 #include "buf0flu.h"
+#include "buf0sec.h"
+#include "buf0trk.h"
 #include "log.h"
+#include "probes_mysql.h"
 #ifdef __linux__
 # include <sys/types.h>
 # include <sys/sysmacros.h>
@@ -58,6 +61,7 @@ Created 10/25/1995 Heikki Tuuri
 #include "lzma.h"
 #include "bzlib.h"
 #include "snappy-c.h"
+#include "zstd.h"
 
 ATTRIBUTE_COLD void fil_space_t::set_corrupted() const
 {
@@ -277,6 +281,9 @@ bool fil_comp_algo_loaded(ulint comp_algo)
 
 	case PAGE_SNAPPY_ALGORITHM:
 		return provider_service_snappy->is_loaded;
+
+	case PAGE_ZSTD_ALGORITHM:
+		return provider_service_zstd->is_loaded;
 	}
 
 	return false;
@@ -1766,6 +1773,9 @@ fil_space_t *fil_space_t::drop(uint32_t id, pfs_os_file_t *detached_handle)
 
   pfs_os_file_t handle= fil_system.detach(space, true);
   mysql_mutex_unlock(&fil_system.mutex);
+  if (buf_sec.is_created())
+    buf_sec.discard(id);
+  buf_pool.index_stats_discard(id);
   if (detached_handle)
     *detached_handle = handle;
   else
@@ -2048,6 +2058,10 @@ fil_ibd_create(
 		return NULL;
 	}
 
+	/* Note the creation before any checkpoint can advance past
+	the FILE_CREATE record. */
+	buf_track.space_written(space_id);
+
 	mtr.start();
 	mtr.log_file_op(FILE_CREATE, space_id, path);
 	log_sys.latch.wr_lock(SRW_LOCK_CALL);
@@ -2181,7 +2195,8 @@ mysqld after the dictionary has been booted, and also in IMPORT TABLESPACE.
 
 NOTE that we assume this operation is used either at the database startup
 or under the protection of dict_sys.latch, so that two users cannot
-race here. This operation does not leave the file associated with the
+race here. At startup, dict_load_tablespaces() may invoke this concurrently
+for distinct tablespace identifiers. This operation does not leave the file associated with the
 tablespace open, but closes it after we have looked at the space id in it.
 
 If the validate boolean is set, we read the first page of the file and
@@ -3020,6 +3035,7 @@ void IORequest::read_complete(int io_error) const
                     io_error, id.page_no(), node->name);
     buf_pool.corrupted_evict(bpage, buf_page_t::READ_FIX);
   corrupted:
+    MYSQL_INNODB_PAGE_READ_DONE(id.space(), id.page_no(), 1);
     if (recv_recovery_is_on() && !srv_force_recovery)
     {
       mysql_mutex_lock(&recv_sys.mutex);
@@ -3034,6 +3050,10 @@ void IORequest::read_complete(int io_error) const
                   << " from file '" << node->name << "': " << err;
     goto corrupted;
   }
+  else
+  {
+    MYSQL_INNODB_PAGE_READ_DONE(id.space(), id.page_no(), 0);
+  }
 
   node->space->release();
 }
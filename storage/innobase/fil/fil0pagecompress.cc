@@ -54,6 +54,157 @@ Updated 14/02/2015
 #include "lzma.h"
 #include "bzlib.h"
 #include "snappy-c.h"
+#include "zstd.h"
+
+/** Compression and decompression library state. An instance is
+attached to each buf_pool.io_buf slot, so that the state is reused for
+all pages that are written or read through the slot, instead of being
+allocated and initialized for each page. */
+class fil_page_compress_ctx_t
+{
+	/** zlib compression stream */
+	z_stream	m_deflate;
+	/** compression level of m_deflate, or -1 if not initialized */
+	int		m_deflate_level = -1;
+	/** zlib decompression stream */
+	z_stream	m_inflate;
+	/** whether m_inflate has been initialized */
+	bool		m_inflate_init = false;
+	/** Zstandard compression context, or nullptr */
+	ZSTD_CCtx*	m_zstd_cctx = nullptr;
+	/** Zstandard decompression context, or nullptr */
+	ZSTD_DCtx*	m_zstd_dctx = nullptr;
+
+public:
+	~fil_page_compress_ctx_t()
+	{
+		if (m_deflate_level >= 0) {
+			deflateEnd(&m_deflate);
+		}
+		if (m_inflate_init) {
+			inflateEnd(&m_inflate);
+		}
+		if (m_zstd_cctx) {
+			ZSTD_freeCCtx(m_zstd_cctx);
+		}
+		if (m_zstd_dctx) {
+			ZSTD_freeDCtx(m_zstd_dctx);
+		}
+	}
+
+	/** Compress a page with zlib.
+	@param src	page to be compressed
+	@param dst	output buffer
+	@param dst_len	size of dst
+	@param level	compression level
+	@return length of the compressed data
+	@retval 0 if the page was not compressed */
+	ulint zlib_compress(const byte* src, byte* dst, ulint dst_len,
+			    int level)
+	{
+		if (m_deflate_level == level) {
+			if (deflateReset(&m_deflate) != Z_OK) {
+				return 0;
+			}
+		} else {
+			if (m_deflate_level >= 0) {
+				deflateEnd(&m_deflate);
+				m_deflate_level = -1;
+			}
+			memset(&m_deflate, 0, sizeof m_deflate);
+			if (deflateInit(&m_deflate, level) != Z_OK) {
+				return 0;
+			}
+			m_deflate_level = level;
+		}
+
+		m_deflate.next_in = const_cast<byte*>(src);
+		m_deflate.avail_in = uInt(srv_page_size);
+		m_deflate.next_out = dst;
+		m_deflate.avail_out = uInt(dst_len);
+
+		return deflate(&m_deflate, Z_FINISH) == Z_STREAM_END
+			? ulint(m_deflate.total_out) : 0;
+	}
+
+	/** Decompress a page with zlib.
+	@param src	compressed data
+	@param src_len	length of the compressed data
+	@param dst	output buffer of srv_page_size bytes
+	@return whether the page was decompressed */
+	bool zlib_decompress(const byte* src, ulint src_len, byte* dst)
+	{
+		if (m_inflate_init) {
+			if (inflateReset(&m_inflate) != Z_OK) {
+				return false;
+			}
+		} else {
+			memset(&m_inflate, 0, sizeof m_inflate);
+			if (inflateInit(&m_inflate) != Z_OK) {
+				return false;
+			}
+			m_inflate_init = true;
+		}
+
+		m_inflate.next_in = const_cast<byte*>(src);
+		m_inflate.avail_in = uInt(src_len);
+		m_inflate.next_out = dst;
+		m_inflate.avail_out = uInt(srv_page_size);
+
+		return inflate(&m_inflate, Z_FINISH) == Z_STREAM_END
+			&& m_inflate.total_out == srv_page_size;
+	}
+
+	/** Compress a page with Zstandard.
+	@param src	page to be compressed
+	@param dst	output buffer
+	@param dst_len	size of dst
+	@param level	compression level
+	@return length of the compressed data
+	@retval 0 if the page was not compressed */
+	ulint zstd_compress(const byte* src, byte* dst, ulint dst_len,
+			    int level)
+	{
+		if (!m_zstd_cctx && !(m_zstd_cctx = ZSTD_createCCtx())) {
+			return 0;
+		}
+
+		size_t len = ZSTD_compressCCtx(m_zstd_cctx, dst, dst_len,
+					       src, srv_page_size, level);
+		return ZSTD_isError(len) ? 0 : len;
+	}
+
+	/** Decompress a page with Zstandard.
+	@param src	compressed data
+	@param src_len	exact length of the compressed data
+	@param dst	output buffer of srv_page_size bytes
+	@return whether the page was decompressed */
+	bool zstd_decompress(const byte* src, ulint src_len, byte* dst)
+	{
+		if (!m_zstd_dctx && !(m_zstd_dctx = ZSTD_createDCtx())) {
+			return false;
+		}
+
+		size_t len = ZSTD_decompressDCtx(m_zstd_dctx,
+						 dst, srv_page_size,
+						 src, src_len);
+		return !ZSTD_isError(len) && len == srv_page_size;
+	}
+};
+
+/** Allocate compression library state that can be reused across pages.
+@return the allocated state */
+fil_page_compress_ctx_t *fil_page_compress_ctx_create()
+{
+	return UT_NEW_NOKEY(fil_page_compress_ctx_t());
+}
+
+/** Free fil_page_compress_ctx_create().
+@param ctx	compression library state, or nullptr */
+void fil_page_compress_ctx_free(fil_page_compress_ctx_t *ctx)
+{
+	UT_DELETE(ctx);
+}
 
 /** Compress a page for the given compression algorithm.
 @param[in]	buf		page to be compressed
@@ -61,6 +212,7 @@ Updated 14/02/2015
 @param[in]	header_len	header length of the page
 @param[in]	comp_algo	compression algorithm
 @param[in]	comp_level	compression level
+@param[in,out]	ctx		compression library state
 @return actual length of compressed page data
 @retval 0 if the page was not compressed */
 static ulint fil_page_compress_low(
@@ -68,7 +220,8 @@ static ulint fil_page_compress_low(
 	byte*		out_buf,
 	ulint		header_len,
 	ulint		comp_algo,
-	unsigned	comp_level)
+	unsigned	comp_level,
+	fil_page_compress_ctx_t& ctx)
 {
 	ulint write_size = srv_page_size - header_len;
 
@@ -80,15 +233,9 @@ static ulint fil_page_compress_low(
 		return 0;
 
 	case PAGE_ZLIB_ALGORITHM:
-		{
-			ulong len = uLong(write_size);
-			if (Z_OK == compress2(
-				    out_buf + header_len, &len, buf,
-				    uLong(srv_page_size), int(comp_level))) {
-				return len;
-			}
-		}
-		break;
+		return ctx.zlib_compress(
+			buf, out_buf + header_len, write_size,
+			int(comp_level));
 
 	case PAGE_LZ4_ALGORITHM:
 		write_size = LZ4_compress_default(
@@ -151,6 +298,11 @@ static ulint fil_page_compress_low(
 		}
 		break;
 	}
+
+	case PAGE_ZSTD_ALGORITHM:
+		return ctx.zstd_compress(
+			buf, out_buf + header_len, write_size,
+			int(comp_level));
 	}
 
 	return 0;
@@ -161,6 +313,7 @@ static ulint fil_page_compress_low(
 @param[out]	out_buf		compressed page
 @param[in]	flags		tablespace flags
 @param[in]	block_size	file system block size
+@param[in,out]	ctx		compression library state
 @return actual length of compressed page
 @retval 0 if the page was not compressed */
 static ulint fil_page_compress_for_full_crc32(
@@ -168,7 +321,8 @@ static ulint fil_page_compress_for_full_crc32(
 	byte*		out_buf,
 	uint32_t	flags,
 	ulint		block_size,
-	bool		encrypted)
+	bool		encrypted,
+	fil_page_compress_ctx_t& ctx)
 {
 	ulint comp_level = FSP_FLAGS_GET_PAGE_COMPRESSION_LEVEL(flags);
 	ulint comp_algo = fil_space_t::get_compression_algo(flags);
@@ -182,7 +336,7 @@ static ulint fil_page_compress_for_full_crc32(
 	ulint write_size = fil_page_compress_low(
 		buf, out_buf, header_len,
 		comp_algo,
-		static_cast<unsigned>(comp_level));
+		static_cast<unsigned>(comp_level), ctx);
 
 	if (write_size == 0) {
 fail:
@@ -237,6 +391,7 @@ static ulint fil_page_compress_for_full_crc32(
 @param[in]	flags		tablespace flags
 @param[in]	block_size	file system block size
 @param[in]	encrypted	whether the page will be subsequently encrypted
+@param[in,out]	ctx		compression library state
 @return actual length of compressed page
 @retval        0       if the page was not compressed */
 static ulint fil_page_compress_for_non_full_crc32(
@@ -244,7 +399,8 @@ static ulint fil_page_compress_for_non_full_crc32(
 	byte*		out_buf,
 	ulint		flags,
 	ulint		block_size,
-	bool		encrypted)
+	bool		encrypted,
+	fil_page_compress_ctx_t& ctx)
 {
 	uint comp_level = static_cast<uint>(
 		FSP_FLAGS_GET_PAGE_COMPRESSION_LEVEL(flags));
@@ -264,7 +420,7 @@ static ulint fil_page_compress_for_non_full_crc32(
 
 	ulint write_size = fil_page_compress_low(
 				buf, out_buf,
-				header_len, comp_algo, comp_level);
+				header_len, comp_algo, comp_level, ctx);
 
 	if (write_size == 0) {
 		if (comp_algo != PAGE_UNCOMPRESSED)
@@ -347,6 +503,7 @@ static ulint fil_page_compress_for_non_full_crc32(
 @param[in]	flags		tablespace flags
 @param[in]	block_size	file system block size
 @param[in]	encrypted	whether the page will be subsequently encrypted
+@param[in,out]	ctx		compression library state, or nullptr
 @return actual length of compressed page
 @retval	0	if the page was not compressed */
 ulint fil_page_compress(
@@ -354,7 +511,8 @@ ulint fil_page_compress(
 	byte*		out_buf,
 	uint32_t	flags,
 	ulint		block_size,
-	bool		encrypted)
+	bool		encrypted,
+	fil_page_compress_ctx_t* ctx)
 {
 	/* The full_crc32 page_compressed format assumes this. */
 	ut_ad(!(block_size & 255));
@@ -370,13 +528,20 @@ ulint fil_page_compress(
 		return 0;
 	}
 
+	if (!ctx) {
+		fil_page_compress_ctx_t local_ctx;
+		return fil_page_compress(buf, out_buf, flags, block_size,
+					 encrypted, &local_ctx);
+	}
+
 	if (fil_space_t::full_crc32(flags)) {
 		return fil_page_compress_for_full_crc32(
-				buf, out_buf, flags, block_size, encrypted);
+				buf, out_buf, flags, block_size, encrypted,
+				*ctx);
 	}
 
 	return fil_page_compress_for_non_full_crc32(
-			buf, out_buf, flags, block_size, encrypted);
+			buf, out_buf, flags, block_size, encrypted, *ctx);
 }
 
 /** Decompress a page that may be subject to page_compressed compression.
@@ -385,13 +550,15 @@ ulint fil_page_compress(
 @param[in]	comp_algo	compression algorithm
 @param[in]	header_len	header length of the page
 @param[in]	actual size	actual size of the page
+@param[in,out]	ctx		compression library state
 @retval true if the page is decompressed or false */
 static bool fil_page_decompress_low(
 	byte*		tmp_buf,
 	byte*		buf,
 	ulint		comp_algo,
 	ulint		header_len,
-	ulint		actual_size)
+	ulint		actual_size,
+	fil_page_compress_ctx_t& ctx)
 {
 	switch (comp_algo) {
 	default:
@@ -399,13 +566,8 @@ static bool fil_page_decompress_low(
 			    << comp_algo;
 		return false;
 	case PAGE_ZLIB_ALGORITHM:
-		{
-			uLong len = srv_page_size;
-			return (Z_OK == uncompress(tmp_buf, &len,
-					       buf + header_len,
-					       uLong(actual_size))
-				&& len == srv_page_size);
-		}
+		return ctx.zlib_decompress(
+			buf + header_len, actual_size, tmp_buf);
 
 	case PAGE_LZ4_ALGORITHM:
 		return LZ4_decompress_safe(
@@ -459,6 +621,10 @@ static bool fil_page_decompress_low(
 				reinterpret_cast<char*>(tmp_buf), &olen)
 				&& olen == srv_page_size;
 		}
+
+	case PAGE_ZSTD_ALGORITHM:
+		return ctx.zstd_decompress(
+			buf + header_len, actual_size, tmp_buf);
 	}
 
 	return false;
@@ -468,11 +634,13 @@ static bool fil_page_decompress_low(
 @param[in,out]	tmp_buf	temporary buffer (of innodb_page_size)
 @param[in,out]	buf	possibly compressed page buffer
 @param[in]	flags	tablespace flags
+@param[in,out]	ctx	compression library state
 @return size of the compressed data
 @retval	0		if decompression failed
 @retval	srv_page_size	if the page was not compressed */
 static size_t fil_page_decompress_for_full_crc32(byte *tmp_buf, byte *buf,
-                                                 uint32_t flags)
+                                                 uint32_t flags,
+                                                 fil_page_compress_ctx_t &ctx)
 {
 	ut_ad(fil_space_t::full_crc32(flags));
 	bool compressed = false;
@@ -502,7 +670,7 @@ static size_t fil_page_decompress_for_full_crc32(byte *tmp_buf, byte *buf,
 
 	if (!fil_page_decompress_low(tmp_buf, buf,
 				     fil_space_t::get_compression_algo(flags),
-				     header_len, size - header_len)) {
+				     header_len, size - header_len, ctx)) {
 		return 0;
 	}
 
@@ -514,10 +682,12 @@ static size_t fil_page_decompress_for_full_crc32(byte *tmp_buf, byte *buf,
 /** Decompress a page for non full crc32 format.
 @param[in,out] tmp_buf	temporary buffer (of innodb_page_size)
 @param[in,out] buf	possibly compressed page buffer
+@param[in,out] ctx	compression library state
 @return size of the compressed data
 @retval	0		if decompression failed
 @retval	srv_page_size	if the page was not compressed */
-static size_t fil_page_decompress_for_non_full_crc32(byte *tmp_buf, byte *buf)
+static size_t fil_page_decompress_for_non_full_crc32(
+	byte *tmp_buf, byte *buf, fil_page_compress_ctx_t &ctx)
 {
 	ulint header_len;
 	uint comp_algo;
@@ -552,7 +722,7 @@ static size_t fil_page_decompress_for_non_full_crc32(byte *tmp_buf, byte *buf)
 	}
 
 	if (!fil_page_decompress_low(tmp_buf, buf, comp_algo, header_len,
-				     actual_size)) {
+				     actual_size, ctx)) {
 		return 0;
 	}
 
@@ -565,14 +735,22 @@ static size_t fil_page_decompress_for_non_full_crc32(byte *tmp_buf, byte *buf)
 @param[in,out]	tmp_buf		temporary buffer (of innodb_page_size)
 @param[in,out]	buf		possibly compressed page buffer
 @param[in]	flags		tablespace flags
+@param[in,out]	ctx		compression library state, or nullptr
 @return size of the compressed data
 @retval	0		if decompression failed
 @retval	srv_page_size	if the page was not compressed */
-ulint fil_page_decompress(byte *tmp_buf, byte *buf, uint32_t flags)
+ulint fil_page_decompress(byte *tmp_buf, byte *buf, uint32_t flags,
+			  fil_page_compress_ctx_t *ctx)
 {
+	if (!ctx) {
+		fil_page_compress_ctx_t local_ctx;
+		return fil_page_decompress(tmp_buf, buf, flags, &local_ctx);
+	}
+
 	if (fil_space_t::full_crc32(flags)) {
-		return fil_page_decompress_for_full_crc32(tmp_buf, buf, flags);
+		return fil_page_decompress_for_full_crc32(tmp_buf, buf, flags,
+							  *ctx);
 	}
 
-	return fil_page_decompress_for_non_full_crc32(tmp_buf, buf);
+	return fil_page_decompress_for_non_full_crc32(tmp_buf, buf, *ctx);
 }
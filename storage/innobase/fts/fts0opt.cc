@@ -63,6 +63,10 @@ static ib_vector_t*  fts_slots;
 /** Default optimize interval in secs. */
 static const ulint FTS_OPTIMIZE_INTERVAL_IN_SECS = 300;
 
+/** Number of deleted doc ids that are purged in one transaction, so that
+the locks on the DELETED tables are not held for the whole purge. */
+static const ulint FTS_OPTIMIZE_PURGE_BATCH = 1000;
+
 /** Server is shutting down, so does we exiting the optimize thread */
 static bool fts_opt_start_shutdown = false;
 
@@ -2067,7 +2071,9 @@ fts_optimize_purge_deleted_doc_ids(
 
 	graph = fts_parse_sql(NULL, info, fts_delete_doc_ids_sql);
 
-	/* Delete the doc ids that were copied at the start. */
+	/* Delete the doc ids that were copied at the start. The doc ids
+	stay in the BEING_DELETED tables until all of them have been purged,
+	so an interrupted purge will be redone by the next optimize. */
 	for (i = 0; i < ib_vector_size(optim->to_delete->doc_ids); ++i) {
 
 		update = static_cast<doc_id_t*>(ib_vector_get(
@@ -2088,6 +2094,10 @@ fts_optimize_purge_deleted_doc_ids(
 			fts_sql_rollback(optim->trx);
 			break;
 		}
+
+		if ((i + 1) % FTS_OPTIMIZE_PURGE_BATCH == 0) {
+			fts_sql_commit(optim->trx);
+		}
 	}
 
 	que_graph_free(graph);
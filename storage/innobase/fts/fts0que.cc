@@ -3232,6 +3232,25 @@ fts_query_filter_doc_ids(
 	doc_id_t	doc_id = 0;
 	ulint		decoded = 0;
 	ib_rbt_t*	doc_freqs = word_freq->doc_freqs;
+	const ib_rbt_node_t* next_doc = NULL;
+
+	/* For '+a +b', only the documents in the current result set can
+	be in the intersection. Both the ilist and query->doc_ids are
+	ordered by doc id, so walk them in tandem in order to skip the
+	other documents without any look-up. */
+	const bool	multi_exist = query->oper == FTS_EXIST
+		&& query->multi_exist && !query->collect_positions
+		&& query->flags != FTS_OPT_RANKING
+		&& !rbt_empty(query->doc_ids);
+
+	if (multi_exist) {
+		ib_rbt_bound_t	parent;
+
+		next_doc = rbt_search(query->doc_ids, &parent,
+				      &node->first_doc_id) > 0
+			? rbt_next(query->doc_ids, parent.last)
+			: parent.last;
+	}
 
 	/* Decode the ilist and add the doc ids to the query doc_id set. */
 	while (decoded < len) {
@@ -3296,6 +3315,23 @@ fts_query_filter_doc_ids(
 			ib_vector_push(match->positions, &last_pos);
 		}
 
+		if (multi_exist) {
+			while (next_doc
+			       && rbt_value(fts_ranking_t, next_doc)->doc_id
+			       < doc_id) {
+				next_doc = rbt_next(query->doc_ids, next_doc);
+			}
+
+			if (!next_doc
+			    || rbt_value(fts_ranking_t, next_doc)->doc_id
+			    != doc_id) {
+				/* Skip the end of word position marker. */
+				++ptr;
+				decoded = ulint(ptr - (byte*) data);
+				continue;
+			}
+		}
+
 		/* Add the doc id to the doc freq rb tree, if the doc id
 		doesn't exist it will be created. */
 		doc_freq = fts_query_add_doc_freq(query, doc_freqs, doc_id);
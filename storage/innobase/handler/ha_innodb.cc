@@ -72,6 +72,8 @@ extern my_bool opt_readonly;
 #include "buf0buf.h"
 #include "buf0flu.h"
 #include "buf0lru.h"
+#include "buf0sec.h"
+#include "buf0trk.h"
 #include "dict0boot.h"
 #include "dict0load.h"
 #include "dict0crea.h"
@@ -115,6 +117,7 @@ simple_thread_local ha_handler_stats *mariadb_stats;
 #include "lzma.h"
 #include "bzlib.h"
 #include "snappy-c.h"
+#include "zstd.h"
 
 #include <limits>
 #include <myisamchk.h>                          // TT_FOR_UPGRADE
@@ -317,6 +320,21 @@ static TYPELIB innodb_stats_method_typelib = {
 	NULL
 };
 
+/** Possible values of the parameter innodb_lru_policy */
+static const char* innodb_lru_policy_names[] = {
+	"midpoint",
+	"2q",
+	NullS
+};
+
+/** Enumeration of innodb_lru_policy */
+static TYPELIB innodb_lru_policy_typelib = {
+	array_elements(innodb_lru_policy_names) - 1,
+	"innodb_lru_policy_typelib",
+	innodb_lru_policy_names,
+	NULL
+};
+
 /** Possible values of the parameter innodb_checksum_algorithm */
 const char* innodb_checksum_algorithm_names[] = {
 	"crc32",
@@ -971,6 +989,9 @@ static SHOW_VAR innodb_status_variables[]= {
   {"buffer_pool_read_requests",
    &export_vars.innodb_buffer_pool_read_requests, SHOW_SIZE_T},
   {"buffer_pool_reads", &buf_pool.stat.n_pages_read, SHOW_SIZE_T},
+  {"buffer_pool_secondary_reads", &buf_sec.reads, SHOW_SIZE_T},
+  {"buffer_pool_secondary_skipped", &buf_sec.skipped, SHOW_SIZE_T},
+  {"buffer_pool_secondary_writes", &buf_sec.writes, SHOW_SIZE_T},
   {"buffer_pool_wait_free", &buf_pool.stat.LRU_waits, SHOW_SIZE_T},
   {"buffer_pool_write_requests", &buf_pool.flush_list_requests, SHOW_SIZE_T},
   {"checkpoint_age", &export_vars.innodb_checkpoint_age, SHOW_SIZE_T},
@@ -1038,6 +1059,7 @@ static SHOW_VAR innodb_status_variables[]= {
   {"have_lzma",       &(provider_service_lzma->is_loaded),   SHOW_BOOL},
   {"have_bzip2",      &(provider_service_bzip2->is_loaded),  SHOW_BOOL},
   {"have_snappy",     &(provider_service_snappy->is_loaded), SHOW_BOOL},
+  {"have_zstd",       &(provider_service_zstd->is_loaded),   SHOW_BOOL},
   {"have_punch_hole", &innodb_have_punch_hole, SHOW_BOOL},
 
   {"instant_alter_column",
@@ -3732,7 +3754,8 @@ compression_algorithm_is_not_loaded(ulong compression_algorithm, myf flags)
 {
   bool is_loaded[PAGE_ALGORITHM_LAST+1]= { 1, 1, provider_service_lz4->is_loaded,
     provider_service_lzo->is_loaded, provider_service_lzma->is_loaded,
-    provider_service_bzip2->is_loaded, provider_service_snappy->is_loaded };
+    provider_service_bzip2->is_loaded, provider_service_snappy->is_loaded,
+    provider_service_zstd->is_loaded };
 
   DBUG_ASSERT(compression_algorithm <= PAGE_ALGORITHM_LAST);
 
@@ -5037,6 +5060,10 @@ ha_innobase::table_flags() const
 	THD*			thd = ha_thd();
 	handler::Table_flags	flags = m_int_table_flags;
 
+	if (srv_parallel_read_threads > 1) {
+		flags |= HA_HAS_RECORDS;
+	}
+
 	/* Need to use tx_isolation here since table flags is (also)
 	called before prebuilt is inited. */
 
@@ -7665,6 +7692,14 @@ ha_innobase::innobase_set_max_autoinc(
 {
 	dberr_t		error;
 
+	/* When a row is inserted with an explicit value, there is
+	no need to acquire autoinc_mutex or the AUTO-INC lock if the
+	counter is already larger. */
+	if (innobase_autoinc_lock_mode != AUTOINC_OLD_STYLE_LOCKING
+	    && auto_inc <= dict_table_autoinc_read(m_prebuilt->table)) {
+		return DB_SUCCESS;
+	}
+
 	error = innobase_lock_autoinc();
 
 	if (error == DB_SUCCESS) {
@@ -8466,6 +8501,35 @@ ATTRIBUTE_COLD bool wsrep_append_table_key(MYSQL_THD thd, const dict_table_t &ta
 }
 #endif /* WITH_WSREP */
 
+/** Prepare for inserting many rows.
+For LOAD DATA, for row events applied by a replica and for INSERT
+executed with array binding, inserts into non-unique secondary indexes
+will be buffered and sorted, so that they can be applied in index order.
+@param flags	HA_BULK_INSERT_ABORT_ON_ERROR if a failed row fails
+		the statement */
+void ha_innobase::start_bulk_insert(ha_rows, uint flags)
+{
+	if ((thd_sql_command(m_user_thd) == SQLCOM_LOAD
+	     || (flags & HA_BULK_INSERT_ABORT_ON_ERROR))
+	    && !table->triggers && !m_prebuilt->bulk_append) {
+		row_bulk_append_start(m_prebuilt);
+	}
+}
+
+/** Finish inserting many rows.
+@return error number or 0 */
+int ha_innobase::end_bulk_insert()
+{
+	dberr_t	error = row_bulk_append_end(m_prebuilt);
+	int	err = convert_error_code_to_mysql(
+		error, m_prebuilt->table->flags, m_user_thd);
+	if (err) {
+		/* mysql_load() reports my_errno */
+		my_errno = err;
+	}
+	return err;
+}
+
 /**
 Updates a row given as a parameter to a new value. Note that we are given
 whole rows, not just the fields which are updated: this incurs some
@@ -9391,6 +9455,116 @@ ha_innobase::rnd_init(
 	return(err);
 }
 
+/** Number of leaf pages to read ahead for each partition
+before an ordered index scan */
+static constexpr ulint PREFETCH_INDEX_PAGES = 8;
+
+/** Read asynchronously the first leaf pages of a scan that is about
+to start. ha_partition invokes the pre_ functions of all partitions
+before reading any of them, so that the first page reads overlap.
+This is only done on the first access to the table in a statement,
+so that repeated lookups in a join will not pay for it.
+@param key		start key of an ascending scan, or nullptr
+@param keypart_map	key parts that are present in key
+@param last		whether the scan starts from the end of the index
+@param n_pages		maximum number of leaf pages to read */
+void
+ha_innobase::prefetch_scan(
+	const uchar*	key,
+	key_part_map	keypart_map,
+	bool		last,
+	ulint		n_pages)
+{
+	dict_index_t*	index = m_prebuilt->index;
+
+	if (!m_prebuilt->sql_stat_start
+	    || !index || !m_prebuilt->index_usable || !index->is_btree()
+	    || index->is_corrupted() || !index->table->is_readable()) {
+		return;
+	}
+
+	const dtuple_t*	tuple = nullptr;
+
+	if (key) {
+		row_sel_convert_mysql_key_to_innobase(
+			m_prebuilt->search_tuple,
+			m_prebuilt->srch_key_val1,
+			m_prebuilt->srch_key_val_len,
+			index, key,
+			calculate_key_len(table, active_index, key,
+					  keypart_map));
+		tuple = m_prebuilt->search_tuple;
+	}
+
+	btr_cur_prefetch_scan(index, tuple, last, n_pages);
+}
+
+int
+ha_innobase::pre_index_read_map(
+	const uchar*		key,
+	key_part_map		keypart_map,
+	enum ha_rkey_function	find_flag,
+	bool			use_parallel)
+{
+	switch (find_flag) {
+	case HA_READ_KEY_EXACT:
+	case HA_READ_KEY_OR_NEXT:
+	case HA_READ_AFTER_KEY:
+		if (use_parallel) {
+			prefetch_scan(key, keypart_map, false,
+				      PREFETCH_INDEX_PAGES);
+		}
+		break;
+	default:
+		break;
+	}
+	return 0;
+}
+
+int
+ha_innobase::pre_index_first(bool use_parallel)
+{
+	if (use_parallel) {
+		prefetch_scan(nullptr, 0, false, PREFETCH_INDEX_PAGES);
+	}
+	return 0;
+}
+
+int
+ha_innobase::pre_index_last(bool use_parallel)
+{
+	if (use_parallel) {
+		prefetch_scan(nullptr, 0, true, PREFETCH_INDEX_PAGES);
+	}
+	return 0;
+}
+
+int
+ha_innobase::pre_read_range_first(
+	const key_range*	start_key,
+	const key_range*	,
+	bool			,
+	bool			,
+	bool			use_parallel)
+{
+	if (!start_key) {
+		return pre_index_first(use_parallel);
+	}
+	return pre_index_read_map(start_key->key, start_key->keypart_map,
+				  start_key->flag, use_parallel);
+}
+
+int
+ha_innobase::pre_rnd_next(bool use_parallel)
+{
+	/* A table scan covers the whole clustered index; read the first
+	read-ahead area, and let linear read-ahead take over. */
+	if (use_parallel) {
+		prefetch_scan(nullptr, 0, false, buf_pool.read_ahead_area);
+	}
+	return 0;
+}
+
 /*****************************************************************//**
 Ends a table scan.
 @return 0 or error number */
@@ -10215,12 +10389,21 @@ ha_innobase::wsrep_append_keys(
 					   table->s->table_name.str,
 					   key_info->name.str);
 			}
+			const bool fk_key = tab
+				? referenced_by_foreign_key2(tab, idx)
+				: referenced_by_foreign_key();
+
 			/* !hasPK == table with no PK,
 			   must append all non-unique keys */
-			if (!hasPK || key_info->flags & HA_NOSAME ||
-			    ((tab &&
-			      referenced_by_foreign_key2(tab, idx)) ||
-			     (!tab && referenced_by_foreign_key()))) {
+			if (!hasPK || key_info->flags & HA_NOSAME || fk_key) {
+				/* In a table without unique keys, the
+				row is identified by the hash of the full
+				row that is appended below. Appending the
+				non-unique keys as shared keeps unrelated
+				rows with equal key values from conflicting
+				in certification. */
+				const bool shared_key = !hasPK && !fk_key
+					&& wsrep_certify_nonPK;
 
 				bool is_null0;
 				auto len0 = wsrep_store_key_val_for_row(
@@ -10252,7 +10435,9 @@ ha_innobase::wsrep_append_keys(
 						    /* for len1+1 see keyval1
 						     initialization comment */
 							uint16_t(len1+1),
-							key_type);
+							shared_key
+							? WSREP_SERVICE_KEY_SHARED
+							: key_type);
 						    if (rcode)
 							DBUG_RETURN(rcode);
 						}
@@ -10265,7 +10450,9 @@ ha_innobase::wsrep_append_keys(
 						/* for len0+1 see keyval0
 						   initialization comment */
 						keyval0, uint16_t(len0+1),
-						key_type);
+						shared_key
+						? WSREP_SERVICE_KEY_SHARED
+						: key_type);
 					if (rcode)
 						DBUG_RETURN(rcode);
 
@@ -14316,6 +14503,50 @@ ha_innobase::records_in_range(
 	DBUG_RETURN((ha_rows) n_rows);
 }
 
+/** Count the rows for SELECT COUNT(*) without a WHERE condition.
+The clustered index is scanned by innodb_parallel_read_threads threads.
+@return number of rows visible to the transaction
+@retval HA_POS_ERROR if the rows must be counted by scanning an index */
+
+ha_rows
+ha_innobase::records()
+{
+	DBUG_ENTER("ha_innobase::records");
+
+	/* Locking reads must acquire their record locks in an index scan. */
+	if (srv_parallel_read_threads <= 1
+	    || m_prebuilt->select_lock_type != LOCK_NONE
+	    || !m_prebuilt->table->space
+	    || !m_prebuilt->table->is_readable()
+	    || dict_table_get_first_index(m_prebuilt->table)
+	    ->is_corrupted()) {
+		DBUG_RETURN(HA_POS_ERROR);
+	}
+
+	update_thd();
+
+	trx_t*	trx = m_prebuilt->trx;
+
+	trx_start_if_not_started_xa(trx, false);
+
+	if (trx->isolation_level != TRX_ISO_READ_UNCOMMITTED) {
+		trx->read_view.open(trx);
+	}
+
+	innobase_register_trx(ht, m_user_thd, trx);
+
+	trx->op_info = "counting rows";
+
+	ulint	n_rows;
+	dberr_t	err = row_count_parallel(m_prebuilt,
+					 srv_parallel_read_threads, &n_rows);
+
+	trx->op_info = "";
+
+	/* On error, let the SQL layer scan an index and report it. */
+	DBUG_RETURN(err == DB_SUCCESS ? ha_rows(n_rows) : HA_POS_ERROR);
+}
+
 /*********************************************************************//**
 Gives an UPPER BOUND to the number of rows in a table. This is used in
 filesort.cc.
@@ -19038,6 +19269,12 @@ static MYSQL_SYSVAR_ULONGLONG(stats_persistent_sample_pages,
   " statistics (by ANALYZE, default 20)",
   NULL, NULL, 20, 1, ~0ULL, 0);
 
+static MYSQL_SYSVAR_ULONG(stats_analyze_threads, srv_stats_analyze_threads,
+  PLUGIN_VAR_RQCMDARG,
+  "Maximum number of threads that analyze the secondary indexes of a table"
+  " concurrently when calculating persistent statistics",
+  NULL, NULL, 4, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONGLONG(stats_modified_counter, srv_stats_modified_counter,
   PLUGIN_VAR_RQCMDARG,
   "The number of rows modified before we calculate new statistics (default 0 = current limits)",
@@ -19088,6 +19325,26 @@ static MYSQL_SYSVAR_STR(buffer_pool_filename, srv_buf_dump_filename,
   "Filename to/from which to dump/load the InnoDB buffer pool",
   NULL, NULL, SRV_BUF_DUMP_FILENAME_DEFAULT);
 
+static MYSQL_SYSVAR_STR(buffer_pool_secondary_file,
+  srv_buf_pool_secondary_file,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "File on local storage that caches clean pages evicted from the"
+  " InnoDB buffer pool (default: none)",
+  NULL, NULL, NULL);
+
+static MYSQL_SYSVAR_ULONGLONG(buffer_pool_secondary_size,
+  srv_buf_pool_secondary_size,
+  PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+  "Size of innodb_buffer_pool_secondary_file in bytes",
+  NULL, NULL, 0, 0, ~0ULL, 0);
+
+static MYSQL_SYSVAR_BOOL(track_changed_pages, srv_track_changed_pages,
+  PLUGIN_VAR_OPCMDARG | PLUGIN_VAR_READONLY,
+  "Record the pages written at each log checkpoint in the file"
+  " " BUF_TRACK_FILE_NAME ", so that incremental backups"
+  " need not scan the data files",
+  NULL, NULL, FALSE);
+
 static MYSQL_SYSVAR_BOOL(buffer_pool_dump_now, innodb_buffer_pool_dump_now,
   PLUGIN_VAR_RQCMDARG,
   "Trigger an immediate dump of the buffer pool into a file named @@innodb_buffer_pool_filename",
@@ -19098,6 +19355,12 @@ static MYSQL_SYSVAR_BOOL(buffer_pool_dump_at_shutdown, srv_buffer_pool_dump_at_s
   "Dump the buffer pool into a file named @@innodb_buffer_pool_filename",
   NULL, NULL, TRUE);
 
+static MYSQL_SYSVAR_ULONG(buffer_pool_dump_interval, srv_buf_pool_dump_interval,
+  PLUGIN_VAR_RQCMDARG,
+  "Dump the buffer pool every N seconds if pages were read since the"
+  " previous dump (0=disable)",
+  NULL, NULL, 0, 0, 86400, 0);
+
 static MYSQL_SYSVAR_ULONG(buffer_pool_dump_pct, srv_buf_pool_dump_pct,
   PLUGIN_VAR_RQCMDARG,
   "Dump only the hottest N% of each buffer pool, defaults to 25",
@@ -19142,6 +19405,13 @@ static MYSQL_SYSVAR_SIZE_T(lru_flush_size, innodb_lru_flush_size,
   "How many pages to flush on LRU eviction",
   NULL, NULL, 32, 1, SIZE_T_MAX, 0);
 
+static MYSQL_SYSVAR_ENUM(lru_policy, buf_LRU_policy,
+  PLUGIN_VAR_RQCMDARG,
+  "Buffer pool replacement policy: midpoint (read pages into the old"
+  " sublist) or 2q (like midpoint, but read pages that were evicted"
+  " recently into the young sublist)",
+  NULL, NULL, BUF_LRU_MIDPOINT, &innodb_lru_policy_typelib);
+
 static MYSQL_SYSVAR_ULONG(flush_neighbors, srv_flush_neighbors,
   PLUGIN_VAR_OPCMDARG,
   "Set to 0 (don't flush neighbors from buffer pool),"
@@ -19242,6 +19512,12 @@ static MYSQL_SYSVAR_ULONG(sort_buffer_size, srv_sort_buf_size,
   "Memory buffer size for index creation",
   NULL, NULL, 1048576, 65536, 64<<20, 0);
 
+static MYSQL_SYSVAR_ULONG(sort_threads, srv_sort_threads,
+  PLUGIN_VAR_RQCMDARG,
+  "Number of threads for merge sorting and building non-unique secondary"
+  " indexes in parallel during index creation",
+  NULL, NULL, 1, 1, 64, 0);
+
 static MYSQL_SYSVAR_ULONGLONG(online_alter_log_max_size, srv_online_max_size,
   PLUGIN_VAR_RQCMDARG,
   "Maximum modification log file size for online index creation",
@@ -19358,6 +19634,13 @@ static MYSQL_SYSVAR_ULONG(open_files, innobase_open_files,
   "How many files at the maximum InnoDB keeps open at the same time",
   NULL, NULL, 0, 0, LONG_MAX, 0);
 
+static MYSQL_SYSVAR_SIZE_T(dict_size_limit, srv_dict_size_limit,
+  PLUGIN_VAR_RQCMDARG,
+  "Memory limit of the data dictionary cache in bytes, above which unused"
+  " table definitions will be evicted regardless of table_definition_cache"
+  " (0 = no limit)",
+  NULL, NULL, 0, 0, SIZE_T_MAX, 0);
+
 static MYSQL_SYSVAR_ULONG(sync_spin_loops, srv_n_spin_wait_rounds,
   PLUGIN_VAR_RQCMDARG,
   "Count of spin-loop rounds in InnoDB mutexes (30 by default)",
@@ -19473,6 +19756,13 @@ static MYSQL_SYSVAR_BOOL(numa_interleave, srv_numa_interleave,
   PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
   "Use NUMA interleave memory policy to allocate InnoDB buffer pool",
   NULL, NULL, FALSE);
+
+static MYSQL_SYSVAR_BOOL(numa_local, srv_numa_local,
+  PLUGIN_VAR_NOCMDARG | PLUGIN_VAR_READONLY,
+  "Bind InnoDB buffer pool chunks to NUMA nodes in a round-robin fashion"
+  " and prefer free blocks that are local to the requesting thread"
+  " (ignored if innodb_numa_interleave=ON)",
+  NULL, NULL, FALSE);
 #endif /* HAVE_LIBNUMA */
 
 static MYSQL_SYSVAR_ENUM(stats_method, srv_innodb_stats_method,
@@ -19495,6 +19785,24 @@ static MYSQL_SYSVAR_BOOL(random_read_ahead, srv_random_read_ahead,
   "Whether to use read ahead for random access within an extent",
   NULL, NULL, FALSE);
 
+static MYSQL_SYSVAR_BOOL(page_search_cache, srv_page_search_cache,
+  PLUGIN_VAR_NOCMDARG,
+  "Whether to cache the first key field of page directory slots"
+  " for searching index pages",
+  NULL, NULL, FALSE);
+
+static MYSQL_SYSVAR_ULONG(parallel_read_threads, srv_parallel_read_threads,
+  PLUGIN_VAR_RQCMDARG,
+  "Number of threads that count the rows of a table concurrently"
+  " for SELECT COUNT(*) without a WHERE condition (1=disable)",
+  NULL, NULL, 1, 1, 256, 0);
+
+static MYSQL_SYSVAR_BOOL(scan_read_ahead, srv_scan_read_ahead,
+  PLUGIN_VAR_OPCMDARG,
+  "Whether index range scans read the next leaf page asynchronously"
+  " while processing the current one",
+  NULL, NULL, TRUE);
+
 static MYSQL_SYSVAR_ULONG(read_ahead_threshold, srv_read_ahead_threshold,
   PLUGIN_VAR_RQCMDARG,
   "Number of pages that must be accessed sequentially for InnoDB to"
@@ -19622,7 +19930,7 @@ static MYSQL_SYSVAR_BOOL(force_primary_key,
   "Do not allow creating a table without primary key (off by default)",
   NULL, NULL, FALSE);
 
-const char *page_compression_algorithms[]= { "none", "zlib", "lz4", "lzo", "lzma", "bzip2", "snappy", 0 };
+const char *page_compression_algorithms[]= { "none", "zlib", "lz4", "lzo", "lzma", "bzip2", "snappy", "zstd", 0 };
 static TYPELIB page_compression_algorithms_typelib=
 {
   array_elements(page_compression_algorithms) - 1, 0,
@@ -19630,7 +19938,7 @@ static TYPELIB page_compression_algorithms_typelib=
 };
 static MYSQL_SYSVAR_ENUM(compression_algorithm, innodb_compression_algorithm,
   PLUGIN_VAR_OPCMDARG,
-  "Compression algorithm used on page compression. One of: none, zlib, lz4, lzo, lzma, bzip2, or snappy",
+  "Compression algorithm used on page compression. One of: none, zlib, lz4, lzo, lzma, bzip2, snappy, or zstd",
   innodb_compression_algorithm_validate, NULL,
   /* We use here the largest number of supported compression method to
   enable all those methods that are available. Availability of compression
@@ -19713,8 +20021,12 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(buffer_pool_size),
   MYSQL_SYSVAR(buffer_pool_chunk_size),
   MYSQL_SYSVAR(buffer_pool_filename),
+  MYSQL_SYSVAR(buffer_pool_secondary_file),
+  MYSQL_SYSVAR(buffer_pool_secondary_size),
+  MYSQL_SYSVAR(track_changed_pages),
   MYSQL_SYSVAR(buffer_pool_dump_now),
   MYSQL_SYSVAR(buffer_pool_dump_at_shutdown),
+  MYSQL_SYSVAR(buffer_pool_dump_interval),
   MYSQL_SYSVAR(buffer_pool_dump_pct),
 #ifdef UNIV_DEBUG
   MYSQL_SYSVAR(buffer_pool_evict),
@@ -19727,6 +20039,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(buffer_pool_load_at_startup),
   MYSQL_SYSVAR(lru_scan_depth),
   MYSQL_SYSVAR(lru_flush_size),
+  MYSQL_SYSVAR(lru_policy),
   MYSQL_SYSVAR(flush_neighbors),
   MYSQL_SYSVAR(checksum_algorithm),
   MYSQL_SYSVAR(compression_level),
@@ -19780,6 +20093,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(old_blocks_pct),
   MYSQL_SYSVAR(old_blocks_time),
   MYSQL_SYSVAR(open_files),
+  MYSQL_SYSVAR(dict_size_limit),
   MYSQL_SYSVAR(optimize_fulltext_only),
   MYSQL_SYSVAR(rollback_on_timeout),
   MYSQL_SYSVAR(ft_aux_table),
@@ -19792,6 +20106,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(stats_transient_sample_pages),
   MYSQL_SYSVAR(stats_persistent),
   MYSQL_SYSVAR(stats_persistent_sample_pages),
+  MYSQL_SYSVAR(stats_analyze_threads),
   MYSQL_SYSVAR(stats_auto_recalc),
   MYSQL_SYSVAR(stats_modified_counter),
   MYSQL_SYSVAR(stats_traditional),
@@ -19803,6 +20118,7 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(status_file),
   MYSQL_SYSVAR(strict_mode),
   MYSQL_SYSVAR(sort_buffer_size),
+  MYSQL_SYSVAR(sort_threads),
   MYSQL_SYSVAR(online_alter_log_max_size),
   MYSQL_SYSVAR(sync_spin_loops),
   MYSQL_SYSVAR(spin_wait_delay),
@@ -19813,8 +20129,12 @@ static struct st_mysql_sys_var* innobase_system_variables[]= {
   MYSQL_SYSVAR(use_native_aio),
 #ifdef HAVE_LIBNUMA
   MYSQL_SYSVAR(numa_interleave),
+  MYSQL_SYSVAR(numa_local),
 #endif /* HAVE_LIBNUMA */
   MYSQL_SYSVAR(random_read_ahead),
+  MYSQL_SYSVAR(page_search_cache),
+  MYSQL_SYSVAR(scan_read_ahead),
+  MYSQL_SYSVAR(parallel_read_threads),
   MYSQL_SYSVAR(read_ahead_threshold),
   MYSQL_SYSVAR(read_only),
   MYSQL_SYSVAR(read_only_compressed),
@@ -19902,6 +20222,7 @@ i_s_innodb_cmp_per_index_reset,
 i_s_innodb_buffer_page,
 i_s_innodb_buffer_page_lru,
 i_s_innodb_buffer_stats,
+i_s_innodb_buffer_index_stats,
 i_s_innodb_metrics,
 i_s_innodb_ft_default_stopword,
 i_s_innodb_ft_deleted,
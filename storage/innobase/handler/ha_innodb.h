@@ -107,6 +107,10 @@ class ha_innobase final : public handler
 #endif
 	int write_row(const uchar * buf) override;
 
+	void start_bulk_insert(ha_rows rows, uint flags) override;
+
+	int end_bulk_insert() override;
+
 	int update_row(const uchar * old_data, const uchar * new_data) override;
 
 	int delete_row(const uchar * buf) override;
@@ -153,6 +157,17 @@ class ha_innobase final : public handler
 
 	int rnd_pos(uchar * buf, uchar *pos) override;
 
+	int pre_index_read_map(const uchar *key, key_part_map keypart_map,
+			       enum ha_rkey_function find_flag,
+			       bool use_parallel) override;
+	int pre_index_first(bool use_parallel) override;
+	int pre_index_last(bool use_parallel) override;
+	int pre_read_range_first(const key_range *start_key,
+				 const key_range *end_key,
+				 bool eq_range, bool sorted,
+				 bool use_parallel) override;
+	int pre_rnd_next(bool use_parallel) override;
+
 	int ft_init() override;
 	void ft_end() override { rnd_end(); }
 	FT_INFO *ft_init_ext(uint flags, uint inx, String* key) override;
@@ -184,6 +199,8 @@ class ha_innobase final : public handler
 
 	ha_rows estimate_rows_upper_bound() override;
 
+	ha_rows records() override;
+
 	void update_create_info(HA_CREATE_INFO* create_info) override;
 
 	int create(
@@ -462,6 +479,8 @@ class ha_innobase final : public handler
 	void update_thd();
 
 	int general_fetch(uchar* buf, uint direction, uint match_mode);
+	void prefetch_scan(const uchar *key, key_part_map keypart_map,
+			   bool last, ulint n_pages);
 	int change_active_index(uint keynr);
 	/* @return true if it's necessary to switch current statement log
 	format from STATEMENT to ROW if binary log format is MIXED and
@@ -153,6 +153,10 @@ static const alter_table_operations INNOBASE_ALTER_INSTANT
 	| ALTER_RENAME_INDEX
 	| ALTER_DROP_VIRTUAL_COLUMN;
 
+/** Maximum number of rounds of applying the log of concurrent DML
+to indexes that were created online, before commit_inplace_alter_table() */
+static const uint ONLINE_LOG_CATCH_UP_ROUNDS = 4;
+
 /** Initialize instant->field_map.
 @param[in]	table	table definition to copy from */
 inline void dict_table_t::init_instant(const dict_table_t& table)
@@ -5893,7 +5897,7 @@ static bool innobase_instant_try(
 #ifdef BTR_CUR_HASH_ADAPT
 	/* Acquire the ahi latch to avoid a race condition
 	between ahi access and instant alter table */
-	srw_spin_lock* ahi_latch = btr_search_sys.get_latch(*index);
+	btr_search_latch* ahi_latch = btr_search_sys.get_latch(*index);
 	ahi_latch->wr_lock(SRW_LOCK_CALL);
 #endif /* BTR_CUR_HASH_ADAPT */
 	const bool metadata_changed = ctx->instant_column();
@@ -8837,6 +8841,43 @@ ha_innobase::inplace_alter_table(
 		error = row_log_table_apply(
 			ctx->thr, m_prebuilt->table, altered_table,
 			ctx->m_stage, ctx->new_table);
+	} else if (error == DB_SUCCESS && ctx->online) {
+		/* row_merge_build_indexes() applied the log of each
+		index right after building it, but the log of the
+		earlier indexes kept growing while the later ones were
+		being built. Catch up while concurrent DML is still
+		allowed, so that commit_inplace_alter_table() will only
+		have to apply the tail of the log while holding an
+		exclusive MDL. Each round should be shorter than the
+		previous one; the number of rounds is bounded in case
+		the DML is faster than the log apply. */
+		for (ulint i = 0; error == DB_SUCCESS
+		     && i < ctx->num_to_add_index; i++) {
+			dict_index_t* index = ctx->add_index[i];
+
+			for (uint round = 0; error == DB_SUCCESS
+			     && round < ONLINE_LOG_CATCH_UP_ROUNDS
+			     && index->online_log
+			     && !index->is_corrupted()
+			     && row_log_get_n_pending_blocks(index);
+			     round++) {
+				if (global_system_variables.log_warnings > 2) {
+					sql_print_information(
+						"InnoDB: Online DDL : Applying"
+						" log to index %s"
+						" (round %u)",
+						index->name(), round + 1);
+				}
+
+				error = row_log_apply(m_prebuilt->trx, index,
+						      altered_table,
+						      ctx->m_stage);
+				if (error != DB_SUCCESS) {
+					m_prebuilt->trx->error_key_num
+						= ctx->add_key_numbers[i];
+				}
+			}
+		}
 	}
 
 	/* Init online ddl status variables */
@@ -3547,6 +3547,172 @@ struct st_maria_plugin	i_s_innodb_buffer_stats =
 	MariaDB_PLUGIN_MATURITY_STABLE
 };
 
+namespace Show {
+/* Fields of the dynamic table INFORMATION_SCHEMA.INNODB_BUFFER_POOL_INDEX_STATS */
+static ST_FIELD_INFO i_s_innodb_buffer_index_fields_info[]=
+{
+#define IDX_BUF_INDEX_DATABASE_NAME	0
+  Column("database_name",	Varchar(NAME_CHAR_LEN), NULLABLE),
+
+#define IDX_BUF_INDEX_TABLE_NAME	1
+  Column("table_name",		Varchar(NAME_CHAR_LEN), NULLABLE),
+
+#define IDX_BUF_INDEX_INDEX_NAME	2
+  Column("index_name",		Varchar(NAME_CHAR_LEN), NOT_NULL),
+
+#define IDX_BUF_INDEX_PAGES_RESIDENT	3
+  Column("pages_resident",	ULonglong(), NOT_NULL),
+
+#define IDX_BUF_INDEX_PAGES_READ	4
+  Column("pages_read",		ULonglong(), NOT_NULL),
+
+#define IDX_BUF_INDEX_PAGES_EVICTED	5
+  Column("pages_evicted",	ULonglong(), NOT_NULL),
+
+#define IDX_BUF_INDEX_PAGES_EVICTED_UNUSED	6
+  Column("pages_evicted_unused",	ULonglong(), NOT_NULL),
+
+  CEnd()
+};
+} // namespace Show
+
+/** Fill INFORMATION_SCHEMA.INNODB_BUFFER_POOL_INDEX_STATS
+@param thd     connection
+@param tables  the table to fill
+@return 0 on success, 1 on failure */
+static int i_s_innodb_buffer_index_fill(THD *thd, TABLE_LIST *tables, Item *)
+{
+	TABLE*	table = tables->table;
+	Field**	fields = table->field;
+	int	status = 0;
+
+	DBUG_ENTER("i_s_innodb_buffer_index_fill");
+
+	/* deny access to non-superusers */
+	if (check_global_access(thd, PROCESS_ACL)) {
+		DBUG_RETURN(0);
+	}
+
+	RETURN_IF_INNODB_NOT_STARTED(tables->schema_table_name.str);
+
+	/* Copy the statistics, so that buf_pool.index_stats_mutex
+	will not be held while acquiring dict_sys.latch. */
+	const buf_index_stats_t snap(buf_pool.index_stats_snapshot());
+	ulint i = 0;
+
+	dict_sys.freeze(SRW_LOCK_CALL);
+
+	for (const auto& s : snap) {
+		if (dict_index_t* index
+		    = dict_index_get_if_in_cache_low(s.first)) {
+			char	db_utf8[MAX_DB_UTF8_LEN];
+			char	table_utf8[MAX_TABLE_UTF8_LEN];
+
+			dict_fs2utf8(index->table->name.m_name,
+				     db_utf8, sizeof(db_utf8),
+				     table_utf8, sizeof(table_utf8));
+
+			status = field_store_string(
+				fields[IDX_BUF_INDEX_DATABASE_NAME], db_utf8)
+				|| field_store_string(
+					fields[IDX_BUF_INDEX_TABLE_NAME],
+					table_utf8)
+				|| field_store_string(
+					fields[IDX_BUF_INDEX_INDEX_NAME],
+					index->name);
+		} else {
+			/* The table definition is not in the cache. */
+			char name[MY_INT64_NUM_DECIMAL_DIGITS
+				  + sizeof "index_id: "];
+			fields[IDX_BUF_INDEX_DATABASE_NAME]->set_null();
+			fields[IDX_BUF_INDEX_TABLE_NAME]->set_null();
+			status = fields[IDX_BUF_INDEX_INDEX_NAME]->store(
+				name,
+				uint(snprintf(name, sizeof name,
+					      "index_id: " IB_ID_FMT,
+					      s.first)),
+				system_charset_info);
+		}
+
+		if (status
+		    || fields[IDX_BUF_INDEX_PAGES_RESIDENT]->store(
+			    s.second.resident, true)
+		    || fields[IDX_BUF_INDEX_PAGES_READ]->store(
+			    s.second.reads, true)
+		    || fields[IDX_BUF_INDEX_PAGES_EVICTED]->store(
+			    s.second.evicted, true)
+		    || fields[IDX_BUF_INDEX_PAGES_EVICTED_UNUSED]->store(
+			    s.second.evicted_unused, true)
+		    || schema_table_store_record(thd, table)) {
+			status = 1;
+			break;
+		}
+
+		/* Let other threads acquire dict_sys.latch. */
+		if (++i == 1000) {
+			dict_sys.unfreeze();
+			i = 0;
+			dict_sys.freeze(SRW_LOCK_CALL);
+		}
+	}
+
+	dict_sys.unfreeze();
+
+	DBUG_RETURN(status);
+}
+
+/** Bind the dynamic table INFORMATION_SCHEMA.INNODB_BUFFER_POOL_INDEX_STATS
+@param p  table schema object
+@return 0 on success */
+static int i_s_innodb_buffer_index_init(void *p)
+{
+	DBUG_ENTER("i_s_innodb_buffer_index_init");
+	ST_SCHEMA_TABLE* schema = static_cast<ST_SCHEMA_TABLE*>(p);
+
+	schema->fields_info = Show::i_s_innodb_buffer_index_fields_info;
+	schema->fill_table = i_s_innodb_buffer_index_fill;
+
+	DBUG_RETURN(0);
+}
+
+struct st_maria_plugin	i_s_innodb_buffer_index_stats =
+{
+	/* the plugin type (a MYSQL_XXX_PLUGIN value) */
+	/* int */
+	MYSQL_INFORMATION_SCHEMA_PLUGIN,
+
+	/* pointer to type-specific plugin descriptor */
+	/* void* */
+	&i_s_info,
+
+	/* plugin name */
+	/* const char* */
+	"INNODB_BUFFER_POOL_INDEX_STATS",
+
+	/* plugin author (for SHOW PLUGINS) */
+	/* const char* */
+	maria_plugin_author,
+
+	/* general descriptive text (for SHOW PLUGINS) */
+	/* const char* */
+	"InnoDB Buffer Pool Statistics (per index)",
+
+	/* the plugin license (PLUGIN_LICENSE_XXX) */
+	/* int */
+	PLUGIN_LICENSE_GPL,
+
+	/* the function to invoke when plugin is loaded */
+	/* int (*)(void*); */
+	i_s_innodb_buffer_index_init,
+
+	/* the function to invoke when plugin is unloaded */
+	/* int (*)(void*); */
+	i_s_common_deinit,
+
+	i_s_version, nullptr, nullptr, PACKAGE_VERSION,
+	MariaDB_PLUGIN_MATURITY_STABLE
+};
+
 /** These must correspond to the first values of buf_page_state */
 static const LEX_CSTRING page_state_values[] =
 {
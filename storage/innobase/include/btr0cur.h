@@ -139,6 +139,15 @@ dberr_t btr_cur_search_to_nth_level(ulint level,
                                     rw_lock_type_t rw_latch,
                                     btr_cur_t *cursor, mtr_t *mtr);
 
+/** Read asynchronously the first leaf pages of an index scan.
+@param index   B-tree index
+@param tuple   start key of an ascending scan, or nullptr to start
+               from either end of the index
+@param last    whether the scan starts from the end of the index
+@param n       maximum number of pages to read */
+void btr_cur_prefetch_scan(dict_index_t *index, const dtuple_t *tuple,
+                           bool last, ulint n);
+
 /*************************************************************//**
 Tries to perform an insert to a page in an index tree, next to cursor.
 It is assumed that mtr holds an x-latch on the page. The operation does
@@ -36,6 +36,43 @@ Created 2/17/1996 Heikki Tuuri
 extern mysql_pfs_key_t btr_search_latch_key;
 #endif /* UNIV_PFS_RWLOCK */
 
+/** The latch of an adaptive hash index partition. Exclusive holders
+advance a sequence number, so that btr_search_guess_on_hash() can probe
+the hash table without acquiring the latch, and validate afterwards
+that no modification took place in the meantime. */
+class btr_search_latch : public srw_spin_lock
+{
+  /** sequence number; odd while the latch is exclusively held */
+  std::atomic<uint32_t> seq;
+public:
+  void wr_lock(SRW_LOCK_ARGS(const char *file, unsigned line))
+  {
+    srw_spin_lock::wr_lock(SRW_LOCK_ARGS(file, line));
+    seq.store(seq.load(std::memory_order_relaxed) + 1,
+              std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  }
+  void wr_unlock()
+  {
+    seq.store(seq.load(std::memory_order_relaxed) + 1,
+              std::memory_order_release);
+    srw_spin_lock::wr_unlock();
+  }
+
+  /** Start a latch-free read.
+  @return sequence number to pass to read_validate(); odd if the
+  read must not be attempted */
+  uint32_t read_begin() const { return seq.load(std::memory_order_acquire); }
+  /** Check that the data read since read_begin() was consistent.
+  @param s   return value of read_begin()
+  @return whether no exclusive latch was acquired since read_begin() */
+  bool read_validate(uint32_t s) const
+  {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return s == seq.load(std::memory_order_relaxed);
+  }
+};
+
 #define btr_search_sys_create() btr_search_sys.create()
 #define btr_search_sys_free() btr_search_sys.free()
 
@@ -110,7 +147,7 @@ void btr_search_drop_page_hash_when_freed(const page_id_t page_id);
 			inserted next to the cursor.
 @param[in]	ahi_latch	the adaptive hash index latch */
 void btr_search_update_hash_node_on_insert(btr_cur_t *cursor,
-                                           srw_spin_lock *ahi_latch);
+                                           btr_search_latch *ahi_latch);
 
 /** Updates the page hash index when a single record is inserted on a page.
 @param[in,out]	cursor		cursor which was positioned to the
@@ -119,7 +156,7 @@ void btr_search_update_hash_node_on_insert(btr_cur_t *cursor,
 				to the cursor
 @param[in]	ahi_latch	the adaptive hash index latch */
 void btr_search_update_hash_on_insert(btr_cur_t *cursor,
-                                      srw_spin_lock *ahi_latch);
+                                      btr_search_latch *ahi_latch);
 
 /** Updates the page hash index when a single record is deleted from a page.
 @param[in]	cursor	cursor which was positioned on the record to delete
@@ -237,11 +274,33 @@ struct btr_search_t{
 /** The hash index system */
 struct btr_search_sys_t
 {
+  /** Number of reader slots */
+  static constexpr size_t N_READERS= 64;
+
+  /** Count of btr_search_guess_on_hash() that are accessing the hash
+  tables without holding a latch. Each thread is assigned one slot,
+  so that readers on different cores do not share a cache line. */
+  struct alignas(CPU_LEVEL1_DCACHE_LINESIZE) reader_slot
+  {
+    std::atomic<uint32_t> n;
+
+    /** Start a latch-free access.
+    @return whether the adaptive hash index is enabled */
+    bool enter()
+    {
+      n.fetch_add(1);
+      /* Pairs with the store in btr_search_disable() */
+      return btr_search_enabled;
+    }
+    /** Finish a latch-free access */
+    void exit() { n.fetch_sub(1, std::memory_order_release); }
+  };
+
   /** Partition of the hash table */
   struct partition
   {
     /** latches protecting hash_table */
-    srw_spin_lock latch;
+    btr_search_latch latch;
     /** mapping of dtuple_fold() to rec_t* in buf_block_t::frame */
     hash_table_t table;
     /** memory heap for table */
@@ -310,9 +369,19 @@ struct btr_search_sys_t
   }
 
   /** Get the search latch for the adaptive hash index partition */
-  srw_spin_lock *get_latch(const dict_index_t &index) const
+  btr_search_latch *get_latch(const dict_index_t &index) const
   { return &get_part(index)->latch; }
 
+  /** Latch-free readers */
+  reader_slot readers[N_READERS];
+
+  /** @return the reader slot of the current thread */
+  reader_slot &reader();
+
+  /** Wait for latch-free readers to finish, after btr_search_enabled
+  was cleared */
+  void wait_for_readers() const;
+
   /** Create and initialize at startup */
   void create()
   {
@@ -355,7 +424,7 @@ TRANSACTIONAL_INLINE inline ulint dict_index_t::n_ahi_pages() const
 {
   if (!btr_search_enabled)
     return 0;
-  srw_spin_lock *latch= &btr_search_sys.get_part(*this)->latch;
+  btr_search_latch *latch= &btr_search_sys.get_part(*this)->latch;
 #if !defined NO_ELISION && !defined SUX_LOCK_GENERIC
   if (xbegin())
   {
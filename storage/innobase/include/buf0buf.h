@@ -127,6 +127,29 @@ struct buf_pool_info_t
 					pages decompressed in current
 					interval */
 };
+
+/** Buffer pool statistics of an index */
+struct buf_index_stat_t
+{
+  /** tablespace identifier */
+  uint32_t space_id;
+  /** number of pages that are in the buffer pool */
+  ulint resident;
+  /** number of pages that were read from the data files */
+  ulint reads;
+  /** number of pages that were removed from the buffer pool */
+  ulint evicted;
+  /** number of pages that were removed without ever being accessed */
+  ulint evicted_unused;
+};
+
+/** Buffer pool statistics, indexed by dict_index_t::id */
+typedef std::map<
+	index_id_t,
+	buf_index_stat_t,
+	std::less<index_id_t>,
+	ut_allocator<std::pair<const index_id_t, buf_index_stat_t> > >
+	buf_index_stats_t;
 #endif /* !UNIV_INNOCHECKSUM */
 
 /** Print the given page_id_t object.
@@ -430,6 +453,8 @@ void buf_flush_update_zip_checksum(buf_frame_t* page, ulint size);
 NOTE! The definition appears here only for other modules of this
 directory (buf) to see it. Do not use from outside! */
 
+class fil_page_compress_ctx_t;
+
 class buf_tmp_buffer_t
 {
   /** whether this slot is reserved */
@@ -444,6 +469,9 @@ class buf_tmp_buffer_t
   /** pointer to resulting buffer after encryption or compression;
   not separately allocated memory */
   byte *out_buf;
+  /** compression library state for fil_page_compress() and
+  fil_page_decompress(), or nullptr if not allocated yet */
+  fil_page_compress_ctx_t *comp_ctx;
 
   /** Release the slot */
   void release() { reserved.store(false, std::memory_order_relaxed); }
@@ -814,6 +842,9 @@ class buf_page_t
   unsigned is_accessed() const { ut_ad(in_file()); return access_time; }
 };
 
+/** Page directory search cache; see page0cur.cc */
+struct page_dir_prefix_t;
+
 /** The buffer control block structure */
 
 struct buf_block_t{
@@ -837,6 +868,14 @@ struct buf_block_t{
 #endif
   /** member of buf_pool.unzip_LRU (if belongs_to_unzip_LRU()) */
   UT_LIST_NODE_T(buf_block_t) unzip_LRU;
+#ifdef HAVE_LIBNUMA
+  /** NUMA node that the frame was bound to (innodb_numa_local) */
+  uint8_t numa_node;
+#endif
+  /** the index that buf_pool.index_stats counts this page for, or 0;
+  protected by an exclusive page latch, or by buf_pool.mutex when the
+  page is not accessible to other threads */
+  index_id_t stats_index_id;
 	/* @} */
 	/** @name Optimistic search field */
 	/* @{ */
@@ -853,6 +892,21 @@ struct buf_block_t{
 					bufferfixed, or (2) the thread has an
 					x-latch on the block */
 	/* @} */
+  /** PAGE_MAX_TRX_ID of a secondary index leaf page when
+  page_sec_track() started to track the page, or 0 if the page is
+  not being tracked; the tracking is only valid while
+  sec_modify_clock == modify_clock. Protected by an exclusive page latch */
+  trx_id_t sec_max_trx_id;
+  /** modify_clock when page_sec_track() started to track the page */
+  uint64_t sec_modify_clock;
+  /** groups of heap numbers of the records that were inserted or
+  modified since page_sec_track(); see page_sec_rec_modified() */
+  uint64_t sec_modified;
+  /** copy of the first key field of the records that are owned by
+  page directory slots (innodb_page_search_cache), or nullptr;
+  built by page_cur_search_with_match() while holding a shared latch,
+  and freed by discard_dir_prefix() */
+  std::atomic<page_dir_prefix_t*> dir_prefix;
 #ifdef BTR_CUR_HASH_ADAPT
 	/** @name Hash search fields (unprotected)
 	NOTE that these fields are NOT protected by any semaphore! */
@@ -956,6 +1010,17 @@ struct buf_block_t{
   @param zip_size ROW_FORMAT=COMPRESSED page size, or 0
   @param state    initial state() */
   void initialise(const page_id_t page_id, ulint zip_size, uint32_t state);
+
+  /** Free dir_prefix. The caller must hold an exclusive page latch,
+  or the page must not be accessible to other threads. */
+  void discard_dir_prefix()
+  {
+    if (page_dir_prefix_t *p= dir_prefix.load(std::memory_order_relaxed))
+    {
+      dir_prefix.store(nullptr, std::memory_order_relaxed);
+      ut_free(p);
+    }
+  }
 };
 
 /**********************************************************************//**
@@ -1299,6 +1364,20 @@ class buf_pool_t
   /** Release a memory block to the buffer pool. */
   ATTRIBUTE_COLD void free_block(buf_block_t *block);
 
+  /** Count an index page in index_stats.
+  @param block     page that is x-latched or read-fixed
+  @param index_id  PAGE_INDEX_ID of the page
+  @param read      whether the page was read from a data file */
+  void index_stats_add(buf_block_t *block, index_id_t index_id, bool read);
+  /** Note that a page counted by index_stats_add() is being freed.
+  @param block    page that is not accessible to other threads */
+  void index_stats_remove(buf_block_t *block);
+  /** Discard the statistics of the indexes in a deleted tablespace.
+  @param space_id  tablespace identifier */
+  void index_stats_discard(uint32_t space_id);
+  /** @return a copy of index_stats */
+  buf_index_stats_t index_stats_snapshot();
+
 #ifdef UNIV_DEBUG
   /** Find a block that points to a ROW_FORMAT=COMPRESSED page
   @param data  pointer to the start of a ROW_FORMAT=COMPRESSED page frame
@@ -1418,6 +1497,11 @@ class buf_pool_t
   /** old statistics; protected by mutex */
   buf_pool_stat_t old_stat;
 
+  /** protects index_stats */
+  srw_spin_mutex index_stats_mutex;
+  /** statistics of the pages of each index */
+  buf_index_stats_t index_stats;
+
 	/** @name General fields */
 	/* @{ */
 	ulint		curr_pool_size;	/*!< Current pool size in bytes */
@@ -62,6 +62,13 @@ bool buf_LRU_scan_and_free_block(ulint limit= ULINT_UNDEFINED);
 @retval	NULL	if the free list is empty */
 buf_block_t* buf_LRU_get_free_only();
 
+/** Get a block from buf_pool.free while it holds more than
+innodb_lru_scan_depth/2 blocks, that is, when buf_LRU_get_free_block()
+would neither wait nor wake up the page cleaner.
+@return a free control block, in state BUF_BLOCK_MEMORY
+@retval nullptr if buf_LRU_get_free_block() must be invoked instead */
+buf_block_t *buf_LRU_get_free_plenty();
+
 /** How to acquire a block */
 enum buf_LRU_get {
   /** The caller is not holding buf_pool.mutex */
@@ -124,6 +131,10 @@ buf_LRU_add_block(
 /** Move a block to the start of the buf_pool.LRU list.
 @param bpage  buffer pool page */
 void buf_page_make_young(buf_page_t *bpage);
+/** Move a freed page of the temporary tablespace to the end of
+buf_pool.LRU, so that it will be reclaimed before any other page.
+@param bpage  buffer pool page */
+void buf_page_make_old(buf_page_t *bpage);
 /** Flag a page accessed in buf_pool and move it to the start of buf_pool.LRU
 if it is too old.
 @param bpage  buffer pool page
@@ -190,8 +201,32 @@ The minimum must exceed
 /** Move blocks to "new" LRU list only if the first access was at
 least this many milliseconds ago.  Not protected by any mutex or latch. */
 extern uint	buf_LRU_old_threshold_ms;
+
+/** Possible values of innodb_lru_policy */
+enum buf_LRU_policy_t
+{
+  /** midpoint insertion: pages are read into the old sublist */
+  BUF_LRU_MIDPOINT= 0,
+  /** like BUF_LRU_MIDPOINT, but a page that is read again soon after
+  it was evicted (it is found in the ghost list, the A1out queue of
+  the 2Q algorithm) is read into the head of the LRU list */
+  BUF_LRU_2Q
+};
+
+/** innodb_lru_policy. Not protected by any mutex or latch. */
+extern ulong	buf_LRU_policy;
 /* @} */
 
+/** Allocate the ghost list of recently evicted pages.
+@param n_pages  number of pages in the buffer pool */
+void buf_LRU_ghost_create(size_t n_pages);
+/** Free the ghost list of recently evicted pages. */
+void buf_LRU_ghost_free();
+/** Look up and remove a page from the ghost list when it is to be read.
+@param id  page identifier
+@return whether the page should be added to the young end of buf_pool.LRU */
+bool buf_LRU_ghost_hit(const page_id_t id);
+
 /** @brief Statistics for selecting the LRU list for eviction.
 
 These statistics are not 'of' LRU but 'for' LRU.  We keep count of I/O
@@ -91,6 +91,25 @@ latches!
 @return number of page read requests issued */
 ulint buf_read_ahead_linear(const page_id_t page_id, ulint zip_size);
 
+/** Issue an asynchronous read of the sibling of an index leaf page that
+a range scan just moved to, unless the sibling is already in buf_pool.
+This lets the read overlap with the processing of the records in block,
+so that the scan will not stall at the next page boundary.
+@param block  index leaf page that is latched by the caller
+@param next   whether the scan is in ascending order */
+void buf_read_ahead_sibling(const buf_block_t &block, bool next);
+
+/** Issue asynchronous reads of pages that are expected to belong to
+an externally stored column that is being read, unless the pages are
+already in buf_pool. Does not read any page if the read-ahead mechanism
+is not activated.
+@param page_id   the first page to read
+@param n         number of pages to read
+@param zip_size  ROW_FORMAT=COMPRESSED page size, or 0
+@return number of page read requests issued */
+ulint buf_read_ahead_blob(const page_id_t page_id, uint32_t n,
+                          ulint zip_size);
+
 /** Schedule a page for recovery.
 @param space    tablespace
 @param page_id  page identifier
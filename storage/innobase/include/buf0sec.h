@@ -0,0 +1,151 @@
+/*****************************************************************************
+
+Copyright (c) 2026, MariaDB Corporation.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free Software
+Foundation; version 2 of the License.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA
+
+*****************************************************************************/
+
+/**************************************************//**
+@file include/buf0sec.h
+Secondary buffer pool cache on a local file
+
+Clean pages that are evicted from buf_pool are copied to a direct-mapped
+file (innodb_buffer_pool_secondary_file), which is typically located on
+a local NVMe device. buf_read_page_low() consults this cache before
+reading from the data file. The cache is exclusive: a page that is read
+back into buf_pool is removed from it, so that a stale copy can never be
+returned after the page has been modified in buf_pool.
+*******************************************************/
+
+#pragma once
+
+#include "os0file.h"
+#include "buf0types.h"
+#include "srw_lock.h"
+#include "tpool.h"
+
+struct fil_space_t;
+
+/** Secondary buffer pool cache */
+class buf_sec_t
+{
+  /** state of a slot */
+  enum slot_state : uint32_t
+  {
+    /** the slot contains no page */
+    EMPTY= 0,
+    /** a page write to the slot is queued or in progress */
+    PENDING,
+    /** the slot contains a valid copy of the page */
+    VALID,
+    /** the page is being read from the slot */
+    READING
+  };
+
+  /** metadata of a page-sized slot in the file */
+  struct slot
+  {
+    /** page_id_t::raw() of the page */
+    uint64_t id;
+    /** generation counter, to detect overwrites of PENDING slots */
+    uint32_t gen;
+    /** state of the slot */
+    slot_state state;
+  };
+
+  /** queued page write */
+  struct write_req
+  {
+    /** slot number */
+    size_t n;
+    /** expected slot::gen */
+    uint32_t gen;
+    /** copy of the page frame */
+    byte *frame;
+  };
+
+  /** maximum number of queued page writes */
+  static constexpr size_t QUEUE_SIZE= 64;
+
+  /** mutex protecting the data members below */
+  srw_mutex mutex;
+  /** the file handle */
+  pfs_os_file_t file= OS_FILE_CLOSED;
+  /** slot metadata; nullptr if the cache is not in use */
+  slot *slots= nullptr;
+  /** number of slots */
+  size_t n_slots= 0;
+  /** page frames for write_queue */
+  byte *queue_frames= nullptr;
+  /** queued page writes */
+  write_req write_queue[QUEUE_SIZE];
+  /** first element of write_queue */
+  size_t queue_first= 0;
+  /** number of elements in write_queue */
+  size_t queue_len= 0;
+  /** whether write_task has been submitted */
+  bool writer_active= false;
+
+  /** the page writer task */
+  tpool::waitable_task write_task{write_callback, nullptr};
+
+  /** @return the slot number for a page */
+  size_t slot_of(const page_id_t id) const
+  { return size_t((id.raw() * 0x9e3779b97f4a7c15ULL) >> 32) % n_slots; }
+
+  /** Write queued pages to the file. */
+  static void write_callback(void*);
+  /** Write queued pages to the file. */
+  inline void write_queued();
+
+public:
+  /** number of pages read from the cache */
+  Atomic_counter<ulint> reads;
+  /** number of pages written to the cache */
+  Atomic_counter<ulint> writes;
+  /** number of evicted pages that were not written to the cache */
+  Atomic_counter<ulint> skipped;
+
+  /** Open the cache file if innodb_buffer_pool_secondary_file is set.
+  Failure is not fatal; the cache will not be used. */
+  void create();
+  /** Wait for pending writes and close the cache file. */
+  void close();
+
+  /** @return whether the cache is in use */
+  bool is_created() const { return slots != nullptr; }
+
+  /** Note that a clean page is being evicted from buf_pool.
+  @param id     page identifier
+  @param frame  uncompressed page frame */
+  void evicted(const page_id_t id, const byte *frame);
+
+  /** Try to read a page from the cache and remove it from the cache.
+  @param id     page identifier
+  @param space  tablespace
+  @param frame  page frame to read to
+  @return whether the page was read */
+  bool read(const page_id_t id, const fil_space_t &space, byte *frame);
+
+  /** Remove a page from the cache, because it is being reinitialized.
+  @param id     page identifier */
+  void forget(const page_id_t id);
+
+  /** Remove all pages of a tablespace from the cache.
+  @param space_id   tablespace identifier */
+  void discard(uint32_t space_id);
+};
+
+/** The secondary buffer pool cache */
+extern buf_sec_t buf_sec;
@@ -0,0 +1,127 @@
+/*****************************************************************************
+
+Copyright (c) 2026, MariaDB Corporation.
+
+This program is free software; you can redistribute it and/or modify it under
+the terms of the GNU General Public License as published by the Free Software
+Foundation; version 2 of the License.
+
+This program is distributed in the hope that it will be useful, but WITHOUT
+ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along with
+this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1335 USA
+
+*****************************************************************************/
+
+/**************************************************//**
+@file include/buf0trk.h
+Changed page tracking for incremental backup
+
+If innodb_track_changed_pages=ON, the identifiers of the pages that were
+written by buf_page_write_complete() are appended to the file
+ib_modified_pages at each log checkpoint. mariadb-backup --incremental
+reads the file in order to copy only the pages that may have been
+modified since the previous backup, instead of scanning all data files.
+
+The file consists of records of the following format:
+(4 bytes) record type (START or PAGES)
+(4 bytes) number of page identifiers n
+(8 bytes) checkpoint LSN
+(8 bytes) current LSN when the record was written
+(n*8 bytes) sorted page_id_t::raw() of the written pages
+(4 bytes) CRC-32C of all of the above
+
+A START record is written when tracking starts or when the file could
+not be continued (after crash recovery, or when the server was run with
+innodb_track_changed_pages=OFF). A page_no of FIL_NULL stands for all
+pages of a tablespace that was created or written outside buf_pool.
+*******************************************************/
+
+#pragma once
+
+#include "os0file.h"
+#include "buf0types.h"
+#include "log0types.h"
+#include "srw_lock.h"
+#include <vector>
+
+/** The changed page tracking file name */
+#define BUF_TRACK_FILE_NAME "ib_modified_pages"
+
+/** Changed page tracking */
+class buf_track_t
+{
+public:
+  /** record type */
+  enum record_type : uint32_t
+  {
+    /** tracking was (re)started; no earlier page writes are known */
+    START= 1,
+    /** pages that were written before a checkpoint */
+    PAGES
+  };
+
+  /** size of the record header, in bytes */
+  static constexpr size_t HEADER_SIZE= 24;
+
+private:
+  /** mutex protecting written and file */
+  srw_mutex mutex;
+  /** the file handle */
+  pfs_os_file_t file= OS_FILE_CLOSED;
+  /** size of the file in bytes */
+  os_offset_t size= 0;
+  /** page_id_t::raw() of pages written since the last checkpoint */
+  std::vector<uint64_t> written;
+  /** whether tracking is enabled */
+  Atomic_relaxed<bool> enabled{false};
+
+  /** Append a record to the file.
+  @param type            record type
+  @param checkpoint_lsn  checkpoint LSN
+  @param end_lsn         current LSN
+  @param ids             sorted page identifiers
+  @return whether the record was written */
+  bool write(record_type type, lsn_t checkpoint_lsn, lsn_t end_lsn,
+             const std::vector<uint64_t> &ids);
+
+public:
+  /** Open the file if innodb_track_changed_pages=ON.
+  Failure is not fatal; nothing will be tracked. */
+  void create();
+  /** Close the file. */
+  void close();
+
+  /** @return whether tracking is enabled */
+  bool is_enabled() const { return enabled; }
+
+  /** Note that a page write completed.
+  @param id   page identifier */
+  void page_written(const page_id_t id);
+
+  /** Note that a tablespace was created or that its pages are being
+  written outside buf_pool.
+  @param space_id   tablespace identifier */
+  void space_written(uint32_t space_id);
+
+  /** Append the pages that were written since the previous checkpoint.
+  This must be invoked before the checkpoint header is written.
+  @param checkpoint_lsn  the checkpoint LSN */
+  void checkpoint(lsn_t checkpoint_lsn);
+
+  /** Read the tracking file.
+  @param path      file name
+  @param from_lsn  the LSN of the previous backup
+  @param to_lsn    the checkpoint LSN at the start of this backup
+  @param pages     sorted page_id_t::raw() of the pages that may have
+                   been modified between from_lsn and to_lsn
+  @return whether the file fully covers the changes since from_lsn */
+  static bool read(const char *path, lsn_t from_lsn, lsn_t to_lsn,
+                   std::vector<uint64_t> &pages);
+};
+
+/** Changed page tracking */
+extern buf_track_t buf_track;
@@ -2333,8 +2333,11 @@ struct dict_table_t {
 public:
   /** The next DB_ROW_ID value */
   Atomic_counter<uint64_t> row_id{0};
-  /** Autoinc counter value to give to the next inserted row. */
-  uint64_t autoinc;
+  /** Autoinc counter value to give to the next inserted row.
+  Protected by autoinc_mutex; it only grows while the table is open
+  for DML, so it may be read without the mutex in order to skip an
+  update. */
+  Atomic_relaxed<uint64_t> autoinc;
 
   /** The transaction that currently holds the the AUTOINC lock on this table.
   Protected by lock_latch.
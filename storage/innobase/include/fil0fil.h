@@ -751,6 +751,7 @@ struct fil_space_t final
     case PAGE_LZ4_ALGORITHM:
     case PAGE_LZO_ALGORITHM:
     case PAGE_SNAPPY_ALGORITHM:
+    case PAGE_ZSTD_ALGORITHM:
       return true;
     }
     return false;
@@ -29,12 +29,24 @@ atomic writes information to table space.
 Created 11/12/2013 Jan Lindström jan.lindstrom@skysql.com
 ***********************************************************************/
 
+/** Compression library state that can be reused across pages */
+class fil_page_compress_ctx_t;
+
+/** Allocate compression library state that can be reused across pages.
+@return the allocated state */
+fil_page_compress_ctx_t *fil_page_compress_ctx_create();
+
+/** Free fil_page_compress_ctx_create().
+@param ctx	compression library state, or nullptr */
+void fil_page_compress_ctx_free(fil_page_compress_ctx_t *ctx);
+
 /** Compress a page_compressed page before writing to a data file.
 @param[in]	buf		page to be compressed
 @param[out]	out_buf		compressed page
 @param[in]	flags		tablespace flags
 @param[in]	block_size	file system block size
 @param[in]	encrypted	whether the page will be subsequently encrypted
+@param[in,out]	ctx		compression library state, or nullptr
 @return actual length of compressed page
 @retval	0	if the page was not compressed */
 ulint fil_page_compress(
@@ -42,16 +54,19 @@ ulint fil_page_compress(
 	byte*		out_buf,
 	uint32_t	flags,
 	ulint		block_size,
-	bool		encrypted)
-	MY_ATTRIBUTE((nonnull, warn_unused_result));
+	bool		encrypted,
+	fil_page_compress_ctx_t* ctx = nullptr)
+	MY_ATTRIBUTE((nonnull(1,2), warn_unused_result));
 
 /** Decompress a page that may be subject to page_compressed compression.
 @param[in,out]	tmp_buf		temporary buffer (of innodb_page_size)
 @param[in,out]	buf		compressed page buffer
 @param[in]	flags		tablespace flags
+@param[in,out]	ctx		compression library state, or nullptr
 @return size of the compressed data
 @retval	0		if decompression failed
 @retval	srv_page_size	if the page was not compressed */
-ulint fil_page_decompress(byte *tmp_buf, byte *buf, uint32_t flags)
-  MY_ATTRIBUTE((nonnull, warn_unused_result));
+ulint fil_page_decompress(byte *tmp_buf, byte *buf, uint32_t flags,
+                          fil_page_compress_ctx_t *ctx= nullptr)
+  MY_ATTRIBUTE((nonnull(1,2), warn_unused_result));
 #endif
@@ -40,7 +40,8 @@ constexpr uint32_t SRV_TMP_SPACE_ID= 0xFFFFFFFEU;
 #define PAGE_LZMA_ALGORITHM		4
 #define PAGE_BZIP2_ALGORITHM	5
 #define PAGE_SNAPPY_ALGORITHM	6
-#define PAGE_ALGORITHM_LAST		PAGE_SNAPPY_ALGORITHM
+#define PAGE_ZSTD_ALGORITHM		7
+#define PAGE_ALGORITHM_LAST		PAGE_ZSTD_ALGORITHM
 
 extern const char *page_compression_algorithms[];
 
@@ -109,6 +109,9 @@ struct log_t;
 class log_file_t
 {
   friend log_t;
+#ifdef HAVE_URING
+  friend class log_uring_t;
+#endif
   os_file_t m_file{OS_FILE_CLOSED};
 public:
   log_file_t()= default;
@@ -553,8 +556,9 @@ struct log_t
 
   /** Write buf to ib_logfile0.
   @tparam release_latch whether to invoke latch.wr_unlock()
+  @param durable        whether flush() will be invoked next
   @return the current log sequence number */
-  template<bool release_latch> inline lsn_t write_buf() noexcept;
+  template<bool release_latch> inline lsn_t write_buf(bool durable) noexcept;
 
   /** Create the log. */
   void create(lsn_t lsn) noexcept;
@@ -428,6 +428,10 @@ struct recv_sys_t
   (the last report was at least 15 seconds ago) */
   bool report(time_t time);
 
+  /** @return the number of threads that may concurrently apply log
+  records in read completion callbacks */
+  static uint apply_threads();
+
   /** The alloc() memory alignment, in bytes */
   static constexpr size_t ALIGNMENT= sizeof(size_t);
 
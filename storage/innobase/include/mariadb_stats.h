@@ -116,6 +116,20 @@ inline void mariadb_increment_pages_read_time(ulonglong start_time)
   stats->pages_read_time+= (end_time - start_time);
 }
 
+/*
+  Call this only of start_time != 0, like mariadb_increment_pages_read_time()
+*/
+
+inline void mariadb_increment_lock_wait_time(ulonglong start_time)
+{
+  ha_handler_stats *stats= mariadb_stats;
+  ulonglong end_time= mariadb_measure();
+  DBUG_ASSERT(start_time);
+  DBUG_ASSERT(stats->active);
+
+  stats->lock_wait_time+= (end_time - start_time);
+}
+
 
 /*
   Helper class to set mariadb_stats temporarly for one call in handler.cc
@@ -1045,6 +1045,11 @@ int os_aio_init();
 Frees the asynchronous io system. */
 void os_aio_free();
 
+/** Set the maximum number of concurrently executing read completion
+callbacks, which apply the redo log during crash recovery.
+@param n  maximum number of callbacks */
+void os_aio_set_read_concurrency(uint n);
+
 /** Submit a fake read request during crash recovery.
 @param type   fake read request
 @param offset additional context */
@@ -460,6 +460,69 @@ page_update_max_trx_id(
 	trx_id_t	trx_id,	/*!< in: transaction id */
 	mtr_t*		mtr);	/*!< in/out: mini-transaction */
 
+/* Secondary index leaf pages only store PAGE_MAX_TRX_ID. When it is
+not visible in a read view, row_search_mvcc() has to look up the
+clustered index record of every record on the page. To avoid that for
+records that were not modified recently, buf_block_t remembers which
+groups of records were inserted or modified after the tracking of the
+page was started by page_sec_track(). The tracking is discarded with
+buf_block_modify_clock_inc(), that is, whenever records are removed
+from the page or the page is reorganized or evicted. */
+
+/** Start tracking the modifications of a secondary index leaf page,
+unless the page is already being tracked.
+@param block  X-latched index page */
+inline void page_sec_track(buf_block_t *block)
+{
+  if (block->sec_max_trx_id && block->sec_modify_clock == block->modify_clock)
+    return;
+  /* All records on the page were last modified by a transaction that
+  is not newer than PAGE_MAX_TRX_ID. */
+  block->sec_max_trx_id= page_get_max_trx_id(block->page.frame);
+  block->sec_modify_clock= block->modify_clock;
+  block->sec_modified= 0;
+}
+
+/** Stop tracking the modifications of a page, after records were
+copied to it without page_sec_rec_modified().
+@param block  X-latched index page */
+inline void page_sec_untrack(buf_block_t *block)
+{
+  block->sec_max_trx_id= 0;
+}
+
+/** @return the buf_block_t::sec_modified bit of a heap number */
+inline uint64_t page_sec_heap_no_bit(ulint heap_no)
+{
+  return uint64_t{1} << std::min<ulint>(heap_no >> (srv_page_size_shift - 9),
+                                        63);
+}
+
+/** Note that a record of a secondary index leaf page was inserted
+or modified.
+@param block    X-latched index page
+@param heap_no  heap number of the record */
+inline void page_sec_rec_modified(buf_block_t *block, ulint heap_no)
+{
+  page_sec_track(block);
+  block->sec_modified|= page_sec_heap_no_bit(heap_no);
+}
+
+/** Determine the maximum transaction identifier that can have
+modified a secondary index leaf page record.
+@param block    S or X latched index page
+@param heap_no  heap number of the record
+@return an upper bound of the DB_TRX_ID of the record that is more
+precise than PAGE_MAX_TRX_ID
+@retval 0 if none is known */
+inline trx_id_t page_sec_rec_max_trx_id(const buf_block_t &block,
+                                        ulint heap_no)
+{
+  return block.sec_modify_clock == block.modify_clock &&
+    !(block.sec_modified & page_sec_heap_no_bit(heap_no))
+    ? block.sec_max_trx_id : 0;
+}
+
 /** Persist the AUTO_INCREMENT value on a clustered index root page.
 @param[in,out]	block	clustered index root page
 @param[in]	autoinc	next available AUTO_INCREMENT value
@@ -47,6 +47,9 @@ page_update_max_trx_id(
 	ut_ad(trx_id);
 	ut_ad(page_is_leaf(buf_block_get_frame(block)));
 
+	/* Start the tracking before PAGE_MAX_TRX_ID is advanced. */
+	page_sec_track(block);
+
 	if (page_get_max_trx_id(buf_block_get_frame(block)) < trx_id) {
 
 		page_set_max_trx_id(block, page_zip, trx_id, mtr);
@@ -206,6 +206,18 @@ struct ins_node_t
 				entry_list and sys fields are stored here;
 				if this is NULL, entry list should be created
 				and buffers for sys fields in row allocated */
+	/** A foreign key value whose parent row was found and locked */
+	struct fk_checked_t
+	{
+		/** the foreign key constraint */
+		const dict_foreign_t*	foreign;
+		/** the transaction that holds the lock on the parent row */
+		trx_id_t		trx_id;
+		/** the lengths and bytes of the foreign key columns */
+		std::vector<byte>	key;
+	};
+	/** the last checked value of each foreign key of the table */
+	std::vector<fk_checked_t> fk_checked;
         void vers_update_end(row_prebuilt_t *prebuilt, bool history_row);
 };
 
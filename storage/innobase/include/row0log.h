@@ -227,6 +227,12 @@ unsigned row_log_get_n_core_fields(const dict_index_t *index);
 @return error code present in online log */
 dberr_t row_log_get_error(const dict_index_t *index);
 
+/** Get the number of complete blocks of the online log of a secondary
+index that have not been applied yet
+@param	index	secondary index that is being created online
+@return number of complete pending blocks */
+ulint row_log_get_n_pending_blocks(dict_index_t *index);
+
 #ifdef HAVE_PSI_STAGE_INTERFACE
 /** Estimate how much work is to be done by the log apply phase
 of an ALTER TABLE for this index.
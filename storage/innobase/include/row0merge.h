@@ -491,3 +491,57 @@ class row_merge_bulk_t
   /** Init temporary files for each index */
   void init_tmp_file();
 };
+
+/** Buffered secondary index inserts of LOAD DATA or of a replicated
+row event into a table that may be non-empty. The entries of each
+non-unique secondary index are collected in a sort buffer and inserted in
+index order when the buffer fills up or the statement or event ends.
+The clustered index and any unique secondary indexes are updated row by
+row. */
+class row_merge_bulk_append_t
+{
+  /** sort buffers of the buffered indexes */
+  row_merge_buf_t *m_merge_buf;
+  /** number of elements in m_merge_buf */
+  ulint m_n_index;
+  /** number of tuples of each m_merge_buf[] that were inserted
+  before a lock wait */
+  ulint *m_n_inserted;
+
+  /** Insert the buffered entries of an index.
+  @param i    index of the buffer in m_merge_buf[]
+  @param thr  query thread
+  @return error code */
+  dberr_t flush(ulint i, que_thr_t *thr);
+public:
+  /** Create the buffers.
+  @param table  table that undergoes LOAD DATA */
+  explicit row_merge_bulk_append_t(dict_table_t *table);
+  /** Free the buffers, discarding any buffered entries */
+  ~row_merge_bulk_append_t();
+
+  /** @return whether no index can be buffered */
+  bool empty() const { return !m_n_index; }
+
+  /** @return whether the inserts into an index are being buffered */
+  bool is_buffered(const dict_index_t *index) const
+  {
+    for (ulint i= 0; i < m_n_index; i++)
+      if (m_merge_buf[i].index == index)
+        return true;
+    return false;
+  }
+
+  /** Buffer an index entry. If the buffer fills up, insert the
+  buffered entries into the index first.
+  @param entry  secondary index entry
+  @param index  secondary index for which is_buffered() holds
+  @param thr    query thread
+  @return error code */
+  dberr_t insert(dtuple_t *entry, dict_index_t *index, que_thr_t *thr);
+
+  /** Insert all buffered entries into the indexes.
+  @param thr    query thread
+  @return error code */
+  dberr_t flush(que_thr_t *thr);
+};
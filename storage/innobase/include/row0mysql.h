@@ -40,6 +40,7 @@ Created 9/17/2000 Heikki Tuuri
 struct row_prebuilt_t;
 class ha_innobase;
 class ha_handler_stats;
+class row_merge_bulk_append_t;
 
 /*******************************************************************//**
 Frees the blob heap in prebuilt when no longer needed. */
@@ -237,6 +238,18 @@ row_insert_for_mysql(
 	ins_mode_t		ins_mode)
 	MY_ATTRIBUTE((warn_unused_result));
 
+/** Start buffering the secondary index inserts of LOAD DATA or
+of a replicated row event.
+@param[in,out]	prebuilt	prebuilt struct in MySQL handle */
+void row_bulk_append_start(row_prebuilt_t* prebuilt);
+
+/** Insert the buffered secondary index entries of LOAD DATA or
+of a replicated row event.
+@param[in,out]	prebuilt	prebuilt struct in MySQL handle
+@return error code or DB_SUCCESS */
+dberr_t row_bulk_append_end(row_prebuilt_t* prebuilt)
+	MY_ATTRIBUTE((warn_unused_result));
+
 /*********************************************************************//**
 Builds a dummy query graph used in selects. */
 void
@@ -440,7 +453,13 @@ struct mysql_row_templ_t {
 	ulint	is_virtual;		/*!< if a column is a virtual column */
 };
 
-#define MYSQL_FETCH_CACHE_SIZE		8
+/* Maximum number of rows in fetch_cache */
+#define MYSQL_FETCH_CACHE_SIZE		64
+/* Minimum number of rows to prefetch in one batch */
+#define MYSQL_FETCH_CACHE_MIN		8
+/* Unless MYSQL_FETCH_CACHE_MIN rows would exceed this, the rows in
+fetch_cache must fit in this many bytes */
+#define MYSQL_FETCH_CACHE_BYTES		16384
 /* After fetching this many rows, we start caching them in fetch_cache */
 #define MYSQL_FETCH_CACHE_THRESHOLD	4
 
@@ -523,6 +542,9 @@ struct row_prebuilt_t {
 	byte*		ins_upd_rec_buff;/*!< buffer for storing data converted
 					to the Innobase format from the MySQL
 					format */
+	row_merge_bulk_append_t*
+			bulk_append;	/*!< buffered secondary index inserts
+					of LOAD DATA, or NULL */
 	const byte*	default_rec;	/*!< the default values of all columns
 					(a "default row") in MySQL format */
 	ulint		hint_need_to_fetch_extra_cols;
@@ -621,7 +643,8 @@ struct row_prebuilt_t {
 					fetch many rows from the same cursor:
 					it saves CPU time to fetch them in a
 					batch; we reserve mysql_row_len
-					bytes for each such row; these
+					bytes for each of the
+					fetch_cache_capacity() rows; these
 					pointers point 4 bytes past the
 					allocated mem buf start, because
 					there is a 4 byte magic number at the
@@ -699,6 +722,27 @@ struct row_prebuilt_t {
 		}
 		return NULL;
 	}
+
+	/** @return the number of rows that fetch_cache can hold */
+	ulint fetch_cache_capacity() const
+	{
+		ut_ad(mysql_row_len);
+		return std::max<ulint>(MYSQL_FETCH_CACHE_MIN,
+				       std::min<ulint>(MYSQL_FETCH_CACHE_SIZE,
+						       MYSQL_FETCH_CACHE_BYTES
+						       / mysql_row_len));
+	}
+
+	/** @return the number of rows to prefetch in the current batch.
+	The batch grows with the number of rows that were fetched from
+	the cursor, so that a long scan of narrow rows will restore the
+	cursor less often, while a short LIMIT will not read much ahead. */
+	ulint fetch_batch_size() const
+	{
+		return std::min(fetch_cache_capacity(),
+				std::max<ulint>(MYSQL_FETCH_CACHE_MIN,
+						n_rows_fetched));
+	}
 };
 
 /** Callback for row_mysql_sys_index_iterate() */
@@ -178,6 +178,18 @@ current read view.
 dberr_t row_check_index(row_prebuilt_t *prebuilt, ulint *n_rows)
   MY_ATTRIBUTE((nonnull, warn_unused_result));
 
+/** Count the records of the clustered index that are visible in the
+read view of the transaction, for SELECT COUNT(*) without a WHERE clause.
+The index is divided into key ranges by the node pointers of the root page,
+and the ranges are scanned concurrently.
+@param prebuilt   table and transaction
+@param n_threads  maximum number of threads to use
+@param n_rows     number of records counted
+@return error code */
+dberr_t row_count_parallel(row_prebuilt_t *prebuilt, ulint n_threads,
+                           ulint *n_rows)
+  MY_ATTRIBUTE((nonnull, warn_unused_result));
+
 /** Read the max AUTOINC value from an index.
 @param[in] index	index starting with an AUTO_INCREMENT column
 @return	the largest AUTO_INCREMENT value
@@ -197,6 +197,8 @@ enum monitor_id_t {
 
 	MONITOR_FLUSH_AVG_PAGE_RATE,
 	MONITOR_FLUSH_LSN_AVG_RATE,
+	MONITOR_FLUSH_LSN_CUR_RATE,
+	MONITOR_FLUSH_AHEAD,
 	MONITOR_FLUSH_PCT_FOR_DIRTY,
 	MONITOR_FLUSH_PCT_FOR_LSN,
 	MONITOR_FLUSH_SYNC_WAITS,
@@ -215,6 +217,9 @@ enum monitor_id_t {
 	MONITOR_LRU_BATCH_FLUSH_TOTAL_PAGE,
 	MONITOR_LRU_BATCH_EVICT_TOTAL_PAGE,
 	MONITOR_LRU_GET_FREE_SEARCH,
+	MONITOR_LRU_GET_FREE_NUMA_LOCAL,
+	MONITOR_LRU_GET_FREE_NUMA_REMOTE,
+	MONITOR_LRU_GHOST_HITS,
 	MONITOR_LRU_SEARCH_SCANNED,
 	MONITOR_LRU_SEARCH_SCANNED_NUM_CALL,
 	MONITOR_LRU_SEARCH_SCANNED_PER_CALL,
@@ -280,6 +285,8 @@ enum monitor_id_t {
 	MONITOR_DML_PURGE_DELAY,
 	MONITOR_PURGE_STOP_COUNT,
 	MONITOR_PURGE_RESUME_COUNT,
+	MONITOR_PURGE_THREADS_ACTIVE,
+	MONITOR_PURGE_TABLE_SHARDS,
 
 	/* Recovery related counters */
 	MONITOR_MODULE_RECOVERY,
@@ -365,6 +372,13 @@ enum monitor_id_t {
 	MONITOR_ICP_OUT_OF_RANGE,
 	MONITOR_ICP_MATCH,
 
+	/* Latch (srw_lock, sux_lock) contention counters */
+	MONITOR_MODULE_LATCH,
+	MONITOR_OVLD_LATCH_SPIN_WAITS,
+	MONITOR_OVLD_LATCH_SPIN_SUCCESS,
+	MONITOR_OVLD_LATCH_OS_WAITS,
+	MONITOR_OVLD_LATCH_OS_WAIT_TIME,
+
 	/* This is used only for control system to turn
 	on/off and reset all monitor counters */
 	MONITOR_ALL_COUNTER,
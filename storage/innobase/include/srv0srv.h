@@ -119,6 +119,15 @@ struct srv_stats_t
 
 	/** Number of temporary tablespace blocks decrypted */
 	ulint_ctr_n_t		n_temp_blocks_decrypted;
+
+	/** Number of times a thread found a latch busy and started spinning */
+	ulint_ctr_n_t		latch_spin_waits;
+	/** Number of latch acquisitions that succeeded while spinning */
+	ulint_ctr_n_t		latch_spin_success;
+	/** Number of times a thread was suspended waiting for a latch */
+	ulint_ctr_n_t		latch_os_waits;
+	/** Total time spent suspended waiting for latches, in microseconds */
+	ulint_ctr_n_t		latch_os_wait_time;
 };
 
 extern const char*	srv_main_thread_op_info;
@@ -130,6 +139,14 @@ extern const char	srv_mysql50_table_name_prefix[10];
 #define SRV_BUF_DUMP_FILENAME_DEFAULT	"ib_buffer_pool"
 extern char*		srv_buf_dump_filename;
 
+/** The secondary buffer pool cache file, or NULL */
+extern char*		srv_buf_pool_secondary_file;
+/** Size of srv_buf_pool_secondary_file in bytes */
+extern ulonglong	srv_buf_pool_secondary_size;
+
+/** Whether to track changed pages for incremental backup */
+extern my_bool		srv_track_changed_pages;
+
 /** Boolean config knobs that tell InnoDB to dump the buffer pool at shutdown
 and/or load it during startup. */
 extern char		srv_buffer_pool_dump_at_shutdown;
@@ -170,6 +187,9 @@ extern my_bool	srv_file_per_table;
 
 /** Sort buffer size in index creation */
 extern ulong	srv_sort_buf_size;
+/** innodb_sort_threads: number of threads for building non-unique
+secondary indexes in parallel */
+extern ulong	srv_sort_threads;
 /** Maximum modification log file size for online index creation */
 extern unsigned long long	srv_online_max_size;
 
@@ -179,6 +199,8 @@ use simulated aio.
 Currently we support native aio on windows and linux */
 extern my_bool	srv_use_native_aio;
 extern my_bool	srv_numa_interleave;
+/** innodb_numa_local */
+extern my_bool	srv_numa_local;
 
 /* Use atomic writes i.e disable doublewrite buffer */
 extern my_bool srv_use_atomic_writes;
@@ -239,6 +261,8 @@ extern ulint	srv_buf_pool_base_size;
 extern ulint	srv_buf_pool_curr_size;
 /** Dump this % of each buffer pool during BP dump */
 extern ulong	srv_buf_pool_dump_pct;
+/** Interval between periodic BP dumps in seconds, or 0 */
+extern ulong	srv_buf_pool_dump_interval;
 #ifdef UNIV_DEBUG
 /** Abort load after this amount of pages */
 extern ulong srv_buf_pool_load_pages_abort;
@@ -246,9 +270,19 @@ extern ulong srv_buf_pool_load_pages_abort;
 /** Lock table size in bytes */
 extern ulint	srv_lock_table_size;
 
+/** innodb_dict_size_limit: the memory limit of the data dictionary cache,
+in bytes, or 0 for none */
+extern size_t	srv_dict_size_limit;
+
 /** the value of innodb_checksum_algorithm */
 extern ulong	srv_checksum_algorithm;
 extern my_bool	srv_random_read_ahead;
+/** innodb_page_search_cache */
+extern my_bool	srv_page_search_cache;
+/** innodb_scan_read_ahead */
+extern my_bool	srv_scan_read_ahead;
+/** innodb_parallel_read_threads */
+extern ulong	srv_parallel_read_threads;
 extern ulong	srv_read_ahead_threshold;
 extern uint	srv_n_read_io_threads;
 extern uint	srv_n_write_io_threads;
@@ -288,6 +322,8 @@ extern ibool	srv_innodb_status;
 extern unsigned long long	srv_stats_transient_sample_pages;
 extern my_bool			srv_stats_persistent;
 extern unsigned long long	srv_stats_persistent_sample_pages;
+/** innodb_stats_analyze_threads */
+extern ulong			srv_stats_analyze_threads;
 extern my_bool			srv_stats_auto_recalc;
 extern my_bool			srv_stats_include_delete_marked;
 extern unsigned long long	srv_stats_modified_counter;
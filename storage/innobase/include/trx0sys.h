@@ -873,6 +873,26 @@ class trx_sys_t
   /** False if there is no undo log to purge or rollback */
   bool undo_log_nonempty;
 public:
+  /** The most recent MVCC snapshot that was taken by
+  ReadViewBase::snapshot(). It can be copied by other read views for
+  as long as m_max_trx_id is unchanged, that is, no transaction has
+  been registered or been assigned a serialisation number since, and
+  no transaction has been removed from rw_trx_hash. */
+  struct snapshot_cache_t
+  {
+    /** number of deregister_rw() calls */
+    alignas(CPU_LEVEL1_DCACHE_LINESIZE) std::atomic<size_t> deregistered;
+    /** protects the members below */
+    alignas(CPU_LEVEL1_DCACHE_LINESIZE) srw_spin_lock_low latch;
+    /** m_max_trx_id at the time view was taken, or 0 */
+    trx_id_t version;
+    /** deregistered at the time view was taken */
+    size_t epoch;
+    /** the cached snapshot */
+    ReadViewBase view;
+  };
+  snapshot_cache_t snapshot_cache;
+
   /** List of all transactions. */
   thread_safe_trx_ilist_t trx_list;
 
@@ -1039,8 +1059,7 @@ class trx_sys_t
   {
     snapshot_ids_arg arg(ids);
 
-    while ((arg.m_id= get_rw_trx_hash_version()) != get_max_trx_id())
-      ut_delay(1);
+    arg.m_id= get_snapshot_version();
     arg.m_no= arg.m_id;
 
     ids->clear();
@@ -1052,6 +1071,24 @@ class trx_sys_t
   }
 
 
+  /**
+    Determines the m_max_trx_id that a MVCC snapshot would be taken at.
+
+    For details about get_rw_trx_hash_version() != get_max_trx_id() spin
+    @sa register_rw() and @sa assign_new_trx_no().
+
+    @return m_max_trx_id, after all transactions below it are available
+    through rw_trx_hash
+  */
+  trx_id_t get_snapshot_version()
+  {
+    trx_id_t id;
+    while ((id= get_rw_trx_hash_version()) != get_max_trx_id())
+      ut_delay(1);
+    return id;
+  }
+
+
   /** Initialiser for m_max_trx_id and m_rw_trx_hash_version. */
   void init_max_trx_id(trx_id_t value)
   {
@@ -1127,6 +1164,7 @@ class trx_sys_t
   void deregister_rw(trx_t *trx)
   {
     rw_trx_hash.erase(trx);
+    snapshot_cache.deregistered.fetch_add(1, std::memory_order_release);
   }
 
 
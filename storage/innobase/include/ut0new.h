@@ -843,12 +843,15 @@ constexpr const char* const auto_event_names[] =
   "buf0dump",
   "buf0lru",
   "buf0rea",
+  "buf0sec",
+  "buf0trk",
   "dict0dict",
   "dict0mem",
   "dict0stats",
   "eval0eval",
   "fil0crypt",
   "fil0fil",
+  "fil0pagecompress",
   "fsp0file",
   "fts0ast",
   "fts0blex",
@@ -869,6 +872,7 @@ constexpr const char* const auto_event_names[] =
   "lock0lock",
   "mem0mem",
   "os0file",
+  "page0cur",
   "pars0lex",
   "rem0rec",
   "row0ftsort",
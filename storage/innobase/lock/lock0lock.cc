@@ -46,8 +46,10 @@ Created 5/7/1996 Heikki Tuuri
 #include "srv0mon.h"
 #include "que0que.h"
 #include "scope.h"
+#include "mariadb_stats.h"
 #include <debug_sync.h>
 #include <mysql/service_thd_mdl.h>
+#include "probes_mysql.h"
 
 #include <set>
 
@@ -1834,6 +1836,39 @@ lock_rec_has_to_wait_in_queue(const hash_cell_t &cell, const lock_t *wait_lock)
 	return(NULL);
 }
 
+/** Cache of a conflicting lock, for granting the waiting locks of a
+record lock queue. When many transactions are waiting for the same
+record, the lock that blocked the previous waiting lock (or the
+previous lock itself, if it was granted) usually blocks the next one as
+well, and the queue need not be scanned from the start for each
+waiting lock. */
+class lock_rec_queue_cache
+{
+  /** heap number of the previously checked waiting lock */
+  ulint heap_no= ULINT_UNDEFINED;
+  /** a lock on heap_no that precedes the previously checked lock */
+  const lock_t *ahead= nullptr;
+public:
+  /** Check if a waiting record lock request still has to wait.
+  The waiting locks must be checked in the queue order.
+  @param cell       lock_sys.rec_hash cell
+  @param wait_lock  waiting lock
+  @return lock that is causing the wait */
+  const lock_t *has_to_wait(const hash_cell_t &cell, const lock_t *wait_lock)
+  {
+    if (wait_lock->type_mode & (LOCK_PREDICATE | LOCK_PRDT_PAGE))
+      return lock_rec_has_to_wait_in_queue(cell, wait_lock);
+    const ulint h= lock_rec_find_set_bit(wait_lock);
+    const lock_t *c= h == heap_no && lock_has_to_wait(wait_lock, ahead)
+      ? ahead : lock_rec_has_to_wait_in_queue(cell, wait_lock);
+    heap_no= h;
+    /* If the lock will be granted, it will precede and possibly block
+    the subsequent waiting locks. */
+    ahead= c ? c : wait_lock;
+    return c;
+  }
+};
+
 /** Note that a record lock wait started */
 inline void lock_sys_t::wait_start()
 {
@@ -1971,6 +2006,8 @@ dberr_t lock_wait(que_thr_t *thr)
   innodb_lock_wait_timeout, because trx->mysql_thd == NULL. */
   const ulong innodb_lock_wait_timeout= trx_lock_wait_timeout_get(trx);
   const my_hrtime_t suspend_time= my_hrtime_coarse();
+  const ulonglong stats_start_time=
+    mariadb_stats_active() ? mariadb_measure() : 0;
   ut_ad(!trx->dict_operation_lock_mode);
 
   /* The wait_lock can be cleared by another thread in lock_grant(),
@@ -2043,6 +2080,7 @@ dberr_t lock_wait(que_thr_t *thr)
      wait_lock->un_member.tab_lock.table->id <= DICT_FIELDS_ID);
   thd_wait_begin(trx->mysql_thd, (type_mode & LOCK_TABLE)
                  ? THD_WAIT_TABLE_LOCK : THD_WAIT_ROW_LOCK);
+  MYSQL_INNODB_LOCK_WAIT_START(trx->id, !!(type_mode & LOCK_TABLE));
 
   mysql_mutex_lock(&lock_sys.wait_mutex);
   /* Now that we are holding lock_sys.wait_mutex, we must reload
@@ -2165,6 +2203,8 @@ dberr_t lock_wait(que_thr_t *thr)
 end_loop:
   if (row_lock_wait)
     lock_sys.wait_resume(trx->mysql_thd, suspend_time, my_hrtime_coarse());
+  if (stats_start_time)
+    mariadb_increment_lock_wait_time(stats_start_time);
 
   ut_ad(!wait_lock == !trx->lock.wait_lock);
 
@@ -2185,6 +2225,7 @@ dberr_t lock_wait(que_thr_t *thr)
 	      my_sleep(20000);
       }
     });
+  MYSQL_INNODB_LOCK_WAIT_DONE(trx->error_state);
   thd_wait_end(trx->mysql_thd);
 
 #ifdef UNIV_DEBUG
@@ -2311,6 +2352,7 @@ static void lock_rec_dequeue_from_page(lock_t *in_lock, bool owns_wait_mutex)
 	MONITOR_DEC(MONITOR_NUM_RECLOCK);
 
 	bool acquired = false;
+	lock_rec_queue_cache queue;
 
 	/* Check if waiting locks in the queue can now be granted:
 	grant locks if there are no conflicting locks ahead. Stop at
@@ -2332,8 +2374,7 @@ static void lock_rec_dequeue_from_page(lock_t *in_lock, bool owns_wait_mutex)
 		ut_ad(lock->trx->lock.wait_trx);
 		ut_ad(lock->trx->lock.wait_lock);
 
-		if (const lock_t* c = lock_rec_has_to_wait_in_queue(
-			    cell, lock)) {
+		if (const lock_t* c = queue.has_to_wait(cell, lock)) {
 			trx_t* c_trx = c->trx;
 			lock->trx->lock.wait_trx = c_trx;
 			if (c_trx->lock.wait_trx
@@ -4170,6 +4211,7 @@ static void lock_rec_rebuild_waiting_queue(
     hash_cell_t &cell, lock_t *first_lock, ulint heap_no)
 {
   lock_sys.assert_locked(cell);
+  lock_rec_queue_cache queue;
 
   for (lock_t *lock= first_lock; lock != NULL;
        lock= lock_rec_get_next(heap_no, lock))
@@ -4180,7 +4222,7 @@ static void lock_rec_rebuild_waiting_queue(
     ut_ad(lock->trx->lock.wait_trx);
     ut_ad(lock->trx->lock.wait_lock);
 
-    if (const lock_t *c= lock_rec_has_to_wait_in_queue(cell, lock))
+    if (const lock_t *c= queue.has_to_wait(cell, lock))
       lock->trx->lock.wait_trx= c->trx;
     else
     {
@@ -45,6 +45,7 @@ Created 12/9/1995 Heikki Tuuri
 #include "buf0dump.h"
 #include "log0sync.h"
 #include "log.h"
+#include "probes_mysql.h"
 
 /*
 General philosophy of InnoDB redo-logs:
@@ -602,11 +603,160 @@ void log_t::resize_abort() noexcept
   log_resize_release();
 }
 
+#ifdef HAVE_URING
+# include <liburing.h>
+
+/** An io_uring that the write_lock holder uses for writing ib_logfile0.
+The writes are submitted from log_sys.buf and log_sys.flush_buf, which are
+registered with the kernel, so that the pages need not be pinned for
+each write. A durable write is followed by a linked fdatasync(), so that
+both complete in a single system call. */
+static class log_uring_t
+{
+  /** the ring */
+  io_uring ring;
+  /** the registered buffers (log_sys.buf and log_sys.flush_buf) */
+  const byte *registered[2];
+  /** whether the ring has been initialized */
+  bool initialized= false;
+  /** whether the ring is usable */
+  bool usable= false;
+
+  /** @return the index of the registered buffer that contains b
+  @retval -1 if the buffer is not registered */
+  int buf_index(const byte *b, size_t length) const noexcept
+  {
+    for (int i= 0; i < 2; i++)
+      if (registered[i] && b >= registered[i] &&
+          b + length <= registered[i] + log_sys.buf_size)
+        return i;
+    return -1;
+  }
+
+  /** Register log_sys.buf and log_sys.flush_buf, which could have been
+  replaced by log_t::resize_start() and log_t::write_checkpoint(). */
+  void register_buffers() noexcept
+  {
+    if ((registered[0] == log_sys.buf && registered[1] == log_sys.flush_buf)
+        || (registered[1] == log_sys.buf &&
+            registered[0] == log_sys.flush_buf))
+      return;
+    if (registered[0])
+      io_uring_unregister_buffers(&ring);
+    iovec iov[2]{{log_sys.buf, log_sys.buf_size},
+                 {log_sys.flush_buf, log_sys.buf_size}};
+    /* If the buffers cannot be registered (for example, due to
+    RLIMIT_MEMLOCK), we will submit normal writes. */
+    if (io_uring_register_buffers(&ring, iov, 2))
+      registered[0]= registered[1]= nullptr;
+    else
+    {
+      registered[0]= log_sys.buf;
+      registered[1]= log_sys.flush_buf;
+    }
+  }
+
+public:
+  /** @return whether the ring can be used */
+  bool init() noexcept
+  {
+    if (!initialized)
+    {
+      initialized= true;
+      registered[0]= registered[1]= nullptr;
+      usable= srv_use_native_aio && !io_uring_queue_init(4, &ring, 0);
+    }
+    return usable;
+  }
+
+  /** Free the ring. */
+  void close() noexcept
+  {
+    if (usable)
+      io_uring_queue_exit(&ring);
+    initialized= usable= false;
+  }
+
+  /** Write to ib_logfile0, and optionally make the write durable.
+  @param n       number of buffers (1 or 2)
+  @param buf     buffers to write
+  @param offset  file offsets of the buffers
+  @param sync    whether to invoke fdatasync() after the writes
+  @return whether the writes (and the fdatasync()) succeeded */
+  bool write(size_t n, const span<const byte> *buf, const lsn_t *offset,
+             bool sync) noexcept
+  {
+    ut_ad(usable);
+    ut_ad(n == 1 || n == 2);
+    register_buffers();
+
+    const int fd= log_sys.log.m_file;
+    for (size_t i= 0; i < n; i++)
+    {
+      io_uring_sqe *sqe= io_uring_get_sqe(&ring);
+      const int index= buf_index(buf[i].data(), buf[i].size());
+      if (index < 0)
+        io_uring_prep_write(sqe, fd, buf[i].data(), unsigned(buf[i].size()),
+                            offset[i]);
+      else
+        io_uring_prep_write_fixed(sqe, fd, buf[i].data(),
+                                  unsigned(buf[i].size()), offset[i], index);
+      if (sync || i + 1 < n)
+        sqe->flags|= IOSQE_IO_LINK;
+      io_uring_sqe_set_data(sqe, reinterpret_cast<void*>(buf[i].size()));
+    }
+
+    if (sync)
+    {
+      io_uring_sqe *sqe= io_uring_get_sqe(&ring);
+      io_uring_prep_fsync(sqe, fd, IORING_FSYNC_DATASYNC);
+      io_uring_sqe_set_data(sqe, nullptr);
+    }
+
+    const int submitted= int(n + sync);
+    const int r= io_uring_submit_and_wait(&ring, submitted);
+    bool ok= r == submitted;
+
+    for (int i= std::max(r, 0); i--; )
+    {
+      io_uring_cqe *cqe;
+      if (io_uring_wait_cqe(&ring, &cqe))
+      {
+        ok= false;
+        break;
+      }
+      /* A short write cancels the rest of the chain. */
+      ok= ok && cqe->res >= 0 &&
+        size_t(cqe->res) ==
+        reinterpret_cast<size_t>(io_uring_cqe_get_data(cqe));
+      io_uring_cqe_seen(&ring, cqe);
+    }
+
+    if (r != submitted)
+    {
+      /* Some requests may have been left in the submission queue.
+      Stop using the ring. */
+      io_uring_queue_exit(&ring);
+      usable= false;
+    }
+
+    return ok;
+  }
+} log_uring;
+#endif
+
+/** The log sequence number up to which log_write_buf() made the log
+durable */
+static Atomic_relaxed<lsn_t> log_synced_lsn;
+
 /** Write an aligned buffer to ib_logfile0.
 @param buf    buffer to be written
 @param length length of data to be written
-@param offset log file offset */
-static void log_write_buf(const byte *buf, size_t length, lsn_t offset)
+@param offset log file offset
+@param sync   whether to make the write durable, if possible
+@return whether the write was made durable */
+static bool log_write_buf(const byte *buf, size_t length, lsn_t offset,
+                          bool sync)
 {
   ut_ad(write_lock.is_owner());
   ut_ad(!recv_no_log_write);
@@ -619,15 +769,35 @@ static void log_write_buf(const byte *buf, size_t length, lsn_t offset)
   const lsn_t maximum_write_length{log_sys.file_size - offset};
   ut_ad(maximum_write_length <= log_sys.file_size - log_sys.START_OFFSET);
 
+  span<const byte> bufs[2];
+  lsn_t offsets[2];
+  size_t n= 0;
+
   if (UNIV_UNLIKELY(length > maximum_write_length))
   {
-    log_sys.log.write(offset, {buf, size_t(maximum_write_length)});
+    bufs[n]= {buf, size_t(maximum_write_length)};
+    offsets[n++]= offset;
     length-= size_t(maximum_write_length);
     buf+= size_t(maximum_write_length);
     ut_ad(log_sys.START_OFFSET + length < offset);
     offset= log_sys.START_OFFSET;
   }
-  log_sys.log.write(offset, {buf, length});
+  bufs[n]= {buf, length};
+  offsets[n++]= offset;
+
+#ifdef HAVE_URING
+  sync= sync && !log_sys.log_write_through;
+  if (log_uring.init())
+  {
+    if (log_uring.write(n, bufs, offsets, sync))
+      return sync;
+    /* Retry synchronously, to report any error. */
+  }
+#endif
+
+  for (size_t i= 0; i < n; i++)
+    log_sys.log.write(offsets[i], bufs[i]);
+  return false;
 }
 
 /** Invoke commit_checkpoint_notify_ha() to notify that outstanding
@@ -833,7 +1003,8 @@ void log_t::resize_write_buf(size_t length) noexcept
 /** Write buf to ib_logfile0.
 @tparam release_latch whether to invoke latch.wr_unlock()
 @return the current log sequence number */
-template<bool release_latch> inline lsn_t log_t::write_buf() noexcept
+template<bool release_latch>
+inline lsn_t log_t::write_buf(bool durable) noexcept
 {
   ut_ad(latch_have_wr());
   ut_ad(!is_pmem());
@@ -920,7 +1091,10 @@ template<bool release_latch> inline lsn_t log_t::write_buf() noexcept
                           write_lsn, lsn, offset));
 
     /* Do the write to the log file */
-    log_write_buf(write_buf, length, offset);
+    MYSQL_INNODB_LOG_WRITE_START(lsn, length);
+    if (log_write_buf(write_buf, length, offset, durable))
+      log_synced_lsn= lsn;
+    MYSQL_INNODB_LOG_WRITE_DONE(lsn);
 
     if (UNIV_LIKELY_NULL(resize_buf))
       resize_write_buf(length);
@@ -941,7 +1115,13 @@ bool log_t::flush(lsn_t lsn) noexcept
 {
   ut_ad(lsn >= get_flushed_lsn());
   flush_lock.set_pending(lsn);
-  const bool success{log_write_through || log.flush()};
+  bool success{log_write_through || log_synced_lsn >= lsn};
+  if (!success)
+  {
+    MYSQL_INNODB_LOG_FLUSH_START(lsn);
+    success= log.flush();
+    MYSQL_INNODB_LOG_FLUSH_DONE(!success);
+  }
   if (UNIV_LIKELY(success))
   {
     flushed_to_disk_lsn.store(lsn, std::memory_order_release);
@@ -1005,7 +1185,7 @@ void log_write_up_to(lsn_t lsn, bool durable,
   {
     ut_ad(!recv_no_log_write || srv_operation != SRV_OPERATION_NORMAL);
     log_sys.latch.wr_lock(SRW_LOCK_CALL);
-    pending_write_lsn= write_lock.release(log_sys.write_buf<true>());
+    pending_write_lsn= write_lock.release(log_sys.write_buf<true>(durable));
   }
 
   if (durable)
@@ -1047,7 +1227,7 @@ ATTRIBUTE_COLD void log_write_and_flush()
   ut_ad(!srv_read_only_mode);
   if (!log_sys.is_pmem())
   {
-    const lsn_t lsn{log_sys.write_buf<false>()};
+    const lsn_t lsn{log_sys.write_buf<false>(true)};
     write_lock.release(lsn);
     log_flush(lsn);
   }
@@ -1323,6 +1503,9 @@ void log_t::close()
   ut_ad(!(buf_free & buf_free_LOCK));
   if (!is_initialised()) return;
   close_file();
+#ifdef HAVE_URING
+  log_uring.close();
+#endif
 
 #ifndef HAVE_PMEM
   ut_free_dodump(buf, buf_size);
@@ -3070,6 +3070,8 @@ static buf_block_t *recv_recover_page(buf_block_t *block, mtr_t &mtr,
 			      block->page.id().space(),
 			      block->page.id().page_no()));
 
+	block->discard_dir_prefix();
+
 	byte *frame = UNIV_LIKELY_NULL(block->page.zip.data)
 		? block->page.zip.data
 		: block->page.frame;
@@ -3429,6 +3431,14 @@ void recv_sys_t::report_progress() const
   }
 }
 
+uint recv_sys_t::apply_threads()
+{
+  /* The pages are distributed to the read completion callbacks by page_id,
+  and applying the log is mostly CPU bound. Allow one callback per
+  CPU core, but not fewer than innodb_read_io_threads. */
+  return std::max(srv_n_read_io_threads, uint(std::max(my_getncpus(), 1)));
+}
+
 /** Apply a recovery batch.
 @param space_id       current tablespace identifier
 @param space          current tablespace
@@ -3864,6 +3874,7 @@ void recv_sys_t::apply(bool last_batch)
     apply_log_recs= true;
 
     fil_system.extend_to_recv_size();
+    os_aio_set_read_concurrency(apply_threads());
 
     fil_space_t *space= nullptr;
     uint32_t space_id= ~0;
@@ -3905,6 +3916,7 @@ void recv_sys_t::apply(bool last_batch)
             mysql_mutex_unlock(&buf_pool.mutex);
             mysql_mutex_lock(&mutex);
           }
+          os_aio_set_read_concurrency(srv_n_read_io_threads);
           return;
         }
         if (apply_batch(space_id, space, free_block, last_batch))
@@ -3921,6 +3933,8 @@ void recv_sys_t::apply(bool last_batch)
       buf_LRU_block_free_non_file_page(free_block);
       mysql_mutex_unlock(&buf_pool.mutex);
     }
+
+    os_aio_set_read_concurrency(srv_n_read_io_threads);
   }
 
   if (!last_batch)
@@ -1660,6 +1660,14 @@ buf_block_t* mtr_t::memo_contains_page_flagged(const byte *ptr, ulint flags)
 @param block   page that will be modified */
 void mtr_t::set_modified(const buf_block_t &block)
 {
+  /* Records can only be modified while holding an exclusive latch.
+  Changes under an update latch (such as the file segment headers in
+  the root page) do not invalidate the page directory search cache,
+  which may be in use by threads that are holding a shared latch. */
+  if (block.dir_prefix.load(std::memory_order_relaxed) &&
+      block.page.lock.is_write_locked())
+    const_cast<buf_block_t&>(block).discard_dir_prefix();
+
   if (block.page.id().space() >= SRV_TMP_SPACE_ID)
   {
     const_cast<buf_block_t&>(block).page.set_temp_modified();
@@ -1795,6 +1803,8 @@ void mtr_t::free(const fil_space_t &space, uint32_t offset)
         btr_search_drop_page_hash_index(block, false);
 #endif /* BTR_CUR_HASH_ADAPT */
       block->page.set_freed(block->page.state());
+      if (id.space() >= SRV_TMP_SPACE_ID)
+        buf_page_make_old(&block->page);
     }
   }
 
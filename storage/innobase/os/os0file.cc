@@ -3425,6 +3425,9 @@ int os_aio_init()
   {
     read_slots= new io_slots(max_read_events, srv_n_read_io_threads);
     write_slots= new io_slots(max_write_events, srv_n_write_io_threads);
+    /* A thread may be waiting for a page read to complete, while
+    write completions and background tasks can be delayed. */
+    read_slots->task_group().set_high_priority();
   }
   return ret;
 }
@@ -3484,6 +3487,11 @@ int os_aio_resize(ulint n_reader_threads, ulint n_writer_threads)
   return ret;
 }
 
+void os_aio_set_read_concurrency(uint n)
+{
+  read_slots->task_group().set_max_tasks(static_cast<int>(n));
+}
+
 void os_aio_free()
 {
   srv_thread_pool->disable_aio();
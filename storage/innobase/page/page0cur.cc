@@ -272,6 +272,173 @@ page_cur_rec_field_extends(
 }
 #endif /* PAGE_CUR_LE_OR_EXTENDS */
 
+/** Copy of the first key field of the records that are owned by the page
+directory slots (innodb_page_search_cache). page_cur_search_with_match()
+can compare the search key with it without decoding any records. This is
+applicable when the first field of the index is a NOT NULL fixed-length
+field of at most 8 bytes that is ordered by memcmp(), such as an INT or
+BIGINT PRIMARY KEY. The keys[] and valid[] arrays follow this struct. */
+struct page_dir_prefix_t
+{
+  /** length of the first field, in bytes */
+  uint32_t len;
+  /** number of page directory slots */
+  uint32_t n_slots;
+
+  /** @return the first field of each slot owner, as a big-endian number */
+  uint64_t *keys() { return reinterpret_cast<uint64_t*>(this + 1); }
+  /** @return the first field of each slot owner, as a big-endian number */
+  const uint64_t *keys() const
+  { return reinterpret_cast<const uint64_t*>(this + 1); }
+  /** @return whether keys[] is valid for each slot */
+  byte *valid() { return reinterpret_cast<byte*>(keys() + n_slots); }
+  /** @return whether keys[] is valid for each slot */
+  const byte *valid() const
+  { return reinterpret_cast<const byte*>(keys() + n_slots); }
+
+  /** Convert a field to a key.
+  @param b    field data
+  @param len  length of the field, in bytes
+  @return the field as a big-endian number */
+  static uint64_t key(const byte *b, ulint len)
+  {
+    uint64_t k= 0;
+    for (const byte *end= b + len; b < end; b++)
+      k= k << 8 | *b;
+    return k;
+  }
+
+  /** Compare a search key with the owner of a page directory slot.
+  @param k     search key
+  @param slot  page directory slot
+  @return the comparison result of the first field
+  @retval 0 if the record must be compared with the search key */
+  int cmp(uint64_t k, ulint slot) const
+  {
+    ut_ad(slot < n_slots);
+    if (!valid()[slot])
+      return 0;
+    const uint64_t r= keys()[slot];
+    return k < r ? -1 : k > r;
+  }
+};
+
+static_assert(sizeof(page_dir_prefix_t) == 8, "alignment");
+
+/** Minimum number of page directory slots for building page_dir_prefix_t */
+static constexpr ulint PAGE_DIR_PREFIX_MIN_SLOTS= 16;
+
+/** Determine if page_dir_prefix_t is applicable to an index.
+@param index  index tree
+@return length of the first field, in bytes
+@retval 0 if page_dir_prefix_t is not applicable */
+static ulint page_dir_prefix_len(const dict_index_t &index)
+{
+  if (!index.is_btree())
+    return 0;
+  const dict_field_t &field= index.fields[0];
+  if (field.descending || field.prefix_len || !field.fixed_len ||
+      field.fixed_len > 8 || field.col->is_nullable())
+    return 0;
+  switch (field.col->mtype) {
+  case DATA_FIXBINARY:
+    if (dtype_get_charset_coll(field.col->prtype) !=
+        DATA_MYSQL_BINARY_CHARSET_COLL)
+      break;
+    /* fall through */
+  case DATA_INT:
+  case DATA_SYS:
+    return field.fixed_len;
+  }
+  return 0;
+}
+
+/** Build block.dir_prefix.
+@param block  index page, latched in shared or update mode
+@param len    page_dir_prefix_len()
+@return the page directory search cache
+@retval nullptr if it could not be built */
+static const page_dir_prefix_t *page_dir_prefix_build(buf_block_t &block,
+                                                      ulint len)
+{
+  const page_t *page= block.page.frame;
+  const ulint n_slots= page_dir_get_n_slots(page);
+  page_dir_prefix_t *p= static_cast<page_dir_prefix_t*>
+    (ut_malloc_nokey(sizeof *p + n_slots * (sizeof(uint64_t) + 1)));
+  if (!p)
+    return nullptr;
+  p->len= uint32_t(len);
+  p->n_slots= uint32_t(n_slots);
+
+  const bool comp= page_is_comp(page);
+  const page_t *heap_top= page + page_header_get_field(page, PAGE_HEAP_TOP);
+  uint64_t *keys= p->keys();
+  byte *valid= p->valid();
+
+  /* The infimum and supremum records are never compared, because
+  the binary search in page_cur_search_with_match() only considers the
+  slots between them. */
+  keys[0]= keys[n_slots - 1]= 0;
+  valid[0]= valid[n_slots - 1]= false;
+
+  for (ulint i= 1; i < n_slots - 1; i++)
+  {
+    const rec_t *rec=
+      page_dir_slot_get_rec_validate(page_dir_get_nth_slot(page, i));
+    /* A corrupted slot or the first record of a non-leaf page
+    (or the metadata record) will be compared in the normal way. */
+    valid[i]= rec && rec + len <= heap_top &&
+      !(rec_get_info_bits(rec, comp) & REC_INFO_MIN_REC_FLAG);
+    keys[i]= valid[i] ? page_dir_prefix_t::key(rec, len) : 0;
+  }
+
+  page_dir_prefix_t *old= nullptr;
+  if (block.dir_prefix.compare_exchange_strong(old, p,
+                                               std::memory_order_release,
+                                               std::memory_order_acquire))
+    return p;
+  /* Another thread that is holding a shared latch was faster. */
+  ut_free(p);
+  return old;
+}
+
+/** Look up or build the page directory search cache for a search.
+@param block  index page
+@param index  index tree
+@param tuple  search key
+@param key    the first field of tuple, as a big-endian number
+@return the page directory search cache
+@retval nullptr if it is not applicable */
+static const page_dir_prefix_t *
+page_dir_prefix_get(const buf_block_t &block, const dict_index_t &index,
+                    const dtuple_t &tuple, uint64_t *key)
+{
+  if (!srv_page_search_cache)
+    return nullptr;
+  const ulint len= page_dir_prefix_len(index);
+  if (!len || dtuple_get_info_bits(&tuple) & REC_INFO_MIN_REC_FLAG)
+    return nullptr;
+  const dfield_t *field= dtuple_get_nth_field(&tuple, 0);
+  if (dfield_get_len(field) != len)
+    return nullptr;
+  *key= page_dir_prefix_t::key(static_cast<const byte*>
+                               (dfield_get_data(field)), len);
+
+  const ulint n_slots= page_dir_get_n_slots(block.page.frame);
+  const page_dir_prefix_t *p= block.dir_prefix.load(std::memory_order_acquire);
+  if (!p)
+  {
+    /* Do not build the cache if we are holding an exclusive latch,
+    because we are likely to modify the page. */
+    if (n_slots < PAGE_DIR_PREFIX_MIN_SLOTS ||
+        block.page.lock.is_write_locked())
+      return nullptr;
+    p= page_dir_prefix_build(const_cast<buf_block_t&>(block), len);
+  }
+
+  return p && p->len == len && p->n_slots == n_slots ? p : nullptr;
+}
+
 /****************************************************************//**
 Searches the right position for a page cursor. */
 bool
@@ -386,11 +553,30 @@ page_cur_search_with_match(
 	low = 0;
 	up = ulint(page_dir_get_n_slots(page)) - 1;
 
+	uint64_t		prefix_key;
+	const page_dir_prefix_t* const prefix = page_dir_prefix_get(
+		*block, *index, *tuple, &prefix_key);
+
 	/* Perform binary search until the lower and upper limit directory
 	slots come to the distance 1 of each other */
 
 	while (up - low > 1) {
 		mid = (low + up) / 2;
+
+		if (prefix) {
+			/* If the first field differs, no fields matched. */
+			if (int c = prefix->cmp(prefix_key, mid)) {
+				if (c > 0) {
+					low = mid;
+					low_matched_fields = 0;
+				} else {
+					up = mid;
+					up_matched_fields = 0;
+				}
+				continue;
+			}
+		}
+
 		const page_dir_slot_t* slot = page_dir_get_nth_slot(page, mid);
 		if (UNIV_UNLIKELY(!(mid_rec
 				    = page_dir_slot_get_rec_validate(slot)))) {
@@ -1462,6 +1648,9 @@ page_cur_insert_rec_low(
       return nullptr;
   }
 
+  if (!index->is_clust() && page_is_leaf(block->page.frame))
+    page_sec_rec_modified(block, heap_no);
+
   ut_ad(cur->rec != insert_buf + extra_size);
 
   rec_t *next_rec= block->page.frame + rec_get_next_offs(cur->rec, comp);
@@ -2050,6 +2239,9 @@ page_cur_insert_rec_zip(
                     rec_get_status(cursor->rec) > REC_STATUS_INFIMUM))
     return nullptr;
 
+  if (!index->is_clust() && page_is_leaf(page))
+    page_sec_rec_modified(cursor->block, heap_no);
+
   /* 3. Create the record */
   byte *insert_rec= rec_copy(insert_buf, rec, offsets);
   rec_offs_make_valid(insert_rec, index, page_is_leaf(page), offsets);
@@ -172,22 +172,57 @@ For details see: row_vers_old_has_index_entry() and row_purge_poss_sec()
 */
 inline void ReadViewBase::snapshot(trx_t *trx)
 {
-  trx_sys.snapshot_ids(trx, &m_ids, &m_low_limit_id, &m_low_limit_no);
-  if (m_ids.empty())
+  trx_sys_t::snapshot_cache_t &cache= trx_sys.snapshot_cache;
+  const size_t epoch= cache.deregistered.load(std::memory_order_acquire);
+  trx_id_t version= trx_sys.get_snapshot_version();
+
+  /* If no transaction has been registered, assigned a serialisation
+  number or removed from rw_trx_hash since the cached snapshot was
+  taken, it is identical to what we would get by iterating rw_trx_hash. */
+  cache.latch.rd_lock();
+  if (cache.version == version && cache.epoch == epoch && version)
   {
-    m_up_limit_id= m_low_limit_id;
+    m_low_limit_id= cache.view.m_low_limit_id;
+    m_up_limit_id= cache.view.m_up_limit_id;
+    m_low_limit_no= cache.view.m_low_limit_no;
+    m_ids= cache.view.m_ids;
+    cache.latch.rd_unlock();
     return;
   }
+  cache.latch.rd_unlock();
+
+  trx_sys.snapshot_ids(trx, &m_ids, &m_low_limit_id, &m_low_limit_no);
+  version= m_low_limit_id;
+
+  if (m_ids.empty())
+    m_up_limit_id= m_low_limit_id;
+  else
+  {
+    std::sort(m_ids.begin(), m_ids.end());
+    m_up_limit_id= m_ids.front();
+    ut_ad(m_up_limit_id <= m_low_limit_id);
 
-  std::sort(m_ids.begin(), m_ids.end());
-  m_up_limit_id= m_ids.front();
-  ut_ad(m_up_limit_id <= m_low_limit_id);
+    if (m_low_limit_no == m_low_limit_id &&
+        m_low_limit_id == m_up_limit_id + m_ids.size())
+    {
+      m_ids.clear();
+      m_low_limit_id= m_low_limit_no= m_up_limit_id;
+    }
+  }
 
-  if (m_low_limit_no == m_low_limit_id &&
-      m_low_limit_id == m_up_limit_id + m_ids.size())
+  if (cache.latch.wr_lock_try())
   {
-    m_ids.clear();
-    m_low_limit_id= m_low_limit_no= m_up_limit_id;
+    if (cache.version < version ||
+        (cache.version == version && cache.epoch != epoch))
+    {
+      cache.view.m_low_limit_id= m_low_limit_id;
+      cache.view.m_up_limit_id= m_up_limit_id;
+      cache.view.m_low_limit_no= m_low_limit_no;
+      cache.view.m_ids= m_ids;
+      cache.version= version;
+      cache.epoch= epoch;
+    }
+    cache.latch.wr_unlock();
   }
 }
 
@@ -289,6 +289,10 @@ int cmp_data(ulint mtype, ulint prtype, bool descending,
     /* fall through */
   case DATA_VARMYSQL:
     DBUG_ASSERT(is_strnncoll_compatible(prtype & DATA_MYSQL_TYPE_MASK));
+    /* Identical strings are equal in any collation. This avoids the
+    costly collation comparison for matching keys. */
+    if (len1 == len2 && !memcmp(data1, data2, len1))
+      return 0;
     if (CHARSET_INFO *cs= all_charsets[dtype_get_charset_coll(prtype)])
     {
       cmp= cs->coll->strnncollsp(cs, data1, len1, data2, len2);
@@ -298,6 +302,8 @@ int cmp_data(ulint mtype, ulint prtype, bool descending,
     ib::fatal() << "Unable to find charset-collation for " << prtype;
   case DATA_MYSQL:
     DBUG_ASSERT(is_strnncoll_compatible(prtype & DATA_MYSQL_TYPE_MASK));
+    if (len1 == len2 && !memcmp(data1, data2, len1))
+      return 0;
     if (CHARSET_INFO *cs= all_charsets[dtype_get_charset_coll(prtype)])
     {
       cmp= cs->coll->
@@ -327,6 +333,61 @@ int cmp_data(ulint mtype, ulint prtype, bool descending,
   goto func_exit;
 }
 
+/** Determine if non-NULL values of a data type are ordered by memcmp(),
+with a shorter value being less than a longer one that it is a prefix of.
+@param mtype   main type
+@param prtype  precise type
+@return whether cmp_data() would reduce to cmp_memcmp() */
+static inline bool cmp_is_memcmp(ulint mtype, ulint prtype)
+{
+  switch (mtype) {
+  case DATA_INT:
+  case DATA_SYS_CHILD:
+  case DATA_SYS:
+    return true;
+  case DATA_FIXBINARY:
+  case DATA_BINARY:
+    return dtype_get_charset_coll(prtype) == DATA_MYSQL_BINARY_CHARSET_COLL;
+  case DATA_BLOB:
+    return prtype & DATA_BINARY_TYPE;
+  }
+  return false;
+}
+
+/** Compare two non-NULL fields for which cmp_is_memcmp() holds.
+Equal-length fields of 4 or 8 bytes (such as INT, BIGINT, or child page
+numbers in node pointers) are compared as big-endian machine words,
+avoiding a call to memcmp().
+@param data1  data field
+@param len1   length of data1 in bytes
+@param data2  data field
+@param len2   length of data2 in bytes
+@return the comparison result of data1 and data2 */
+static inline int cmp_memcmp(const byte *data1, size_t len1,
+                             const byte *data2, size_t len2)
+{
+  if (len1 == len2)
+  {
+    switch (len1) {
+    case 8:
+      {
+        const uint64_t a= mach_read_from_8(data1), b= mach_read_from_8(data2);
+        return a < b ? -1 : a > b;
+      }
+    case 4:
+      {
+        const uint32_t a= mach_read_from_4(data1), b= mach_read_from_4(data2);
+        return a < b ? -1 : a > b;
+      }
+    }
+  }
+
+  if (size_t len= std::min(len1, len2))
+    if (int cmp= memcmp(data1, data2, len))
+      return cmp;
+  return int(len1 - len2);
+}
+
 /** Compare a data tuple to a physical record.
 @param dtuple          data tuple
 @param rec             B-tree index record
@@ -402,10 +463,24 @@ int cmp_dtuple_rec_with_match_low(const dtuple_t *dtuple, const rec_t *rec,
 
 		ut_ad(!dfield_is_ext(dtuple_field));
 
-		ret = cmp_data(type->mtype, type->prtype,
-			       index->fields[cur_field].descending,
-			       dtuple_b_ptr, dtuple_f_len,
-			       rec_b_ptr, rec_f_len);
+		/* Most key columns of a typical B-tree search (integers,
+		system columns, binary strings) are ordered by memcmp().
+		Compare them inline, without dispatching on the type. */
+		if (dtuple_f_len != UNIV_SQL_NULL
+		    && rec_f_len != UNIV_SQL_NULL
+		    && cmp_is_memcmp(type->mtype, type->prtype)) {
+			ret = cmp_memcmp(dtuple_b_ptr, dtuple_f_len,
+					 rec_b_ptr, rec_f_len);
+			if (UNIV_UNLIKELY(index->fields[cur_field]
+					  .descending)) {
+				ret = -ret;
+			}
+		} else {
+			ret = cmp_data(type->mtype, type->prtype,
+				       index->fields[cur_field].descending,
+				       dtuple_b_ptr, dtuple_f_len,
+				       rec_b_ptr, rec_f_len);
+		}
 		if (ret) {
 			goto order_resolved;
 		}
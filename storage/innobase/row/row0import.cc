@@ -30,6 +30,7 @@ Created 2012-02-08 by Sunny Bains.
 # include "btr0sea.h"
 #endif
 #include "buf0flu.h"
+#include "buf0trk.h"
 #include "que0que.h"
 #include "dict0boot.h"
 #include "dict0load.h"
@@ -4859,6 +4860,9 @@ row_import_for_mysql(
 
 	PageConverter	converter(&cfg, table->space_id, trx);
 
+	/* The pages will be written bypassing buf_pool. */
+	buf_track.space_written(table->space_id);
+
 	/* Set the IO buffer size in pages. */
 
 	err = fil_tablespace_iterate(
@@ -34,6 +34,7 @@ Created 4/20/1996 Heikki Tuuri
 #include "que0que.h"
 #include "row0upd.h"
 #include "row0sel.h"
+#include "row0merge.h"
 #include "rem0cmp.h"
 #include "lock0lock.h"
 #include "log0log.h"
@@ -1881,6 +1882,30 @@ bool row_ins_foreign_index_entry(dict_foreign_t *foreign,
   return true;
 }
 
+/** Copy the foreign key columns of an index entry.
+@param tuple  index entry, or the referencing part of it
+@param n      number of foreign key columns
+@param key    the lengths and bytes of the columns
+@return whether the value can be compared as a byte string */
+static bool row_ins_foreign_key_copy(const dtuple_t *tuple, ulint n,
+                                     std::vector<byte> &key)
+{
+  key.clear();
+  for (ulint i= 0; i < n; i++)
+  {
+    const dfield_t *field= dtuple_get_nth_field(tuple, i);
+    if (dfield_is_null(field) || dfield_is_ext(field))
+      return false;
+    const ulint len= dfield_get_len(field);
+    byte b[4];
+    mach_write_to_4(b, len);
+    key.insert(key.end(), b, b + 4);
+    const byte *data= static_cast<const byte*>(dfield_get_data(field));
+    key.insert(key.end(), data, data + len);
+  }
+  return true;
+}
+
 /***************************************************************//**
 Checks if foreign key constraints fail for an index entry. If index
 is not mentioned in any constraint, this function does nothing,
@@ -1901,12 +1926,24 @@ row_ins_check_foreign_constraints(
 	dict_foreign_t*	foreign;
 	dberr_t		err = DB_SUCCESS;
 	mem_heap_t*	heap = NULL;
+	trx_t*		trx = thr_get_trx(thr);
+	std::vector<byte> key;
 
 	DBUG_ASSERT(index->is_primary() == pk);
 
-	DEBUG_SYNC_C_IF_THD(thr_get_trx(thr)->mysql_thd,
+	DEBUG_SYNC_C_IF_THD(trx->mysql_thd,
 			    "foreign_constraint_check_for_ins");
 
+	/* When consecutive rows of an INSERT refer to the same parent
+	row, it is enough to look it up once: the parent row remains
+	locked by this transaction, and it cannot have been deleted or
+	updated by this transaction as long as the parent table is not
+	in trx->mod_tables. */
+	ins_node_t* node = que_node_get_type(thr->run_node)
+		== QUE_NODE_INSERT && trx->check_foreigns && trx->id
+		&& !table->versioned()
+		? static_cast<ins_node_t*>(thr->run_node) : nullptr;
+
 	for (dict_foreign_set::iterator it = table->foreign_set.begin();
 	     err == DB_SUCCESS && it != table->foreign_set.end();
 	     ++it) {
@@ -1949,9 +1986,41 @@ row_ins_check_foreign_constraints(
 					false, DICT_ERR_IGNORE_NONE);
 			}
 
+			ins_node_t::fk_checked_t* checked = nullptr;
+			bool cacheable = false;
+
+			if (node && referenced_table
+			    && !trx->mod_tables.count(referenced_table)
+			    && row_ins_foreign_key_copy(ref_tuple,
+							foreign->n_fields,
+							key)) {
+				cacheable = true;
+				for (auto& c : node->fk_checked) {
+					if (c.foreign == foreign) {
+						checked = &c;
+						break;
+					}
+				}
+
+				if (checked && checked->trx_id == trx->id
+				    && checked->key == key) {
+					continue;
+				}
+			}
+
 			err = row_ins_check_foreign_constraint(
 				TRUE, foreign, table, ref_tuple, thr);
 
+			if (cacheable && err == DB_SUCCESS) {
+				if (!checked) {
+					node->fk_checked.push_back(
+						{foreign, 0, {}});
+					checked = &node->fk_checked.back();
+				}
+				checked->trx_id = trx->id;
+				checked->key.swap(key);
+			}
+
 			if (ref_table) {
 				dict_table_close(ref_table);
 			}
@@ -3371,9 +3440,16 @@ row_ins_index_entry(
 
 	if (index->is_primary()) {
 		return row_ins_clust_index_entry(index, entry, thr, 0);
-	} else {
-		return row_ins_sec_index_entry(index, entry, thr);
 	}
+
+	if (row_prebuilt_t* prebuilt = thr->prebuilt) {
+		row_merge_bulk_append_t* b = prebuilt->bulk_append;
+		if (b && b->is_buffered(index)) {
+			return b->insert(entry, index, thr);
+		}
+	}
+
+	return row_ins_sec_index_entry(index, entry, thr);
 }
 
 
@@ -3763,6 +3763,17 @@ dberr_t row_log_get_error(const dict_index_t *index)
   return index->online_log->error;
 }
 
+ulint row_log_get_n_pending_blocks(dict_index_t *index)
+{
+  row_log_t *log= index->online_log;
+  ut_ad(log);
+  ut_ad(!log->table);
+  mysql_mutex_lock(&log->mutex);
+  const ulint n= log->tail.blocks - log->head.blocks;
+  mysql_mutex_unlock(&log->mutex);
+  return n;
+}
+
 dberr_t dict_table_t::clear(que_thr_t *thr)
 {
   dberr_t err= DB_SUCCESS;
@@ -28,6 +28,7 @@ Completed by Sunny Bains and Marko Makela
 #include <log.h>
 #include <sql_class.h>
 #include <math.h>
+#include <algorithm>
 
 #include "row0merge.h"
 #include "row0ext.h"
@@ -95,6 +96,42 @@ class spatial_index_info {
     m_dtuple_vec.push_back(dtuple);
   }
 
+  /** Order the cached rows by Sort-Tile-Recursive packing of the centres
+  of their MBR, so that consecutive insertions tend to go to the same leaf
+  page, and the leaf pages will cover smaller areas. */
+  void sort()
+  {
+    struct entry { double x, y; dtuple_t *tuple; };
+    const size_t n= m_dtuple_vec.size();
+    if (n < 3)
+      return;
+
+    std::vector<entry, ut_allocator<entry>> v;
+    v.reserve(n);
+    for (dtuple_t *t : m_dtuple_vec)
+    {
+      rtr_mbr_t mbr;
+      rtr_read_mbr(static_cast<const byte*>(dfield_get_data(&t->fields[0])),
+                   &mbr);
+      double x= (mbr.xmin + mbr.xmax) / 2, y= (mbr.ymin + mbr.ymax) / 2;
+      /* NaN would violate the strict weak ordering of std::sort() */
+      v.push_back({x == x ? x : 0, y == y ? y : 0, t});
+    }
+
+    /* Sort by x, cut into about sqrt(n) vertical slices, and sort
+    each slice by y. */
+    std::sort(v.begin(), v.end(),
+              [](const entry &a, const entry &b) { return a.x < b.x; });
+    const size_t slices= size_t(sqrt(double(n)));
+    const size_t slice= (n + slices - 1) / slices;
+    for (size_t i= 0; i < n; i+= slice)
+      std::sort(v.begin() + i, v.begin() + std::min(n, i + slice),
+                [](const entry &a, const entry &b) { return a.y < b.y; });
+
+    for (size_t i= 0; i < n; i++)
+      m_dtuple_vec[i]= v[i].tuple;
+  }
+
 	/** Insert spatial index rows cached in vector into spatial index
 	@param[in]	trx_id		transaction id
 	@param[in]	pcur		cluster index scanning cursor
@@ -122,6 +159,8 @@ class spatial_index_info {
 		DBUG_EXECUTE_IF("row_merge_instrument_log_check_flush",
 				log_sys.set_check_for_checkpoint(););
 
+		sort();
+
 		for (idx_tuple_vec::iterator it = m_dtuple_vec.begin();
 		     it != m_dtuple_vec.end();
 		     ++it) {
@@ -4580,6 +4619,83 @@ row_merge_is_index_usable(
 		   || trx->read_view.changes_visible(index->trx_id)));
 }
 
+/** Merge sort and bulk insert of a non-unique secondary index,
+executed in a task of srv_thread_pool */
+struct row_merge_index_task_t
+{
+	/** transaction */
+	trx_t*			trx;
+	/** table where rows are read from */
+	const dict_table_t*	old_table;
+	/** index being built */
+	dict_index_t*		index;
+	/** file containing the index entries */
+	merge_file_t*		file;
+	/** tablespace identifier of the index */
+	ulint			space;
+	/** result of the task */
+	dberr_t			error;
+	/** the task */
+	tpool::waitable_task*	task;
+};
+
+/** Merge sort the entries of a non-unique secondary index and insert
+them to the index.
+@param arg	row_merge_index_task_t */
+static void row_merge_index_task(void* arg)
+{
+	row_merge_index_task_t*	t = static_cast<row_merge_index_task_t*>(arg);
+	ut_ad(!dict_index_is_unique(t->index));
+	ut_ad(!(t->index->type & (DICT_FTS | DICT_SPATIAL)));
+
+	/* Each task needs its own buffers and temporary file. The index
+	is not unique, so dup->table will never be accessed, and the
+	progress of the parallel tasks is not reported. */
+	ut_allocator<row_merge_block_t>	alloc(mem_key_row_merge_sort);
+	ut_new_pfx_t		block_pfx;
+	ut_new_pfx_t		crypt_pfx;
+	row_merge_block_t*	crypt_block = NULL;
+	pfs_os_file_t		tmpfd = OS_FILE_CLOSED;
+	row_merge_dup_t		dup = {t->index, NULL, NULL, 0};
+	const size_t		block_size = 3 * srv_sort_buf_size;
+	row_merge_block_t*	block = alloc.allocate_large(block_size,
+							     &block_pfx);
+
+	if (!block) {
+		t->error = DB_OUT_OF_MEMORY;
+		return;
+	}
+
+	if (srv_encrypt_log) {
+		crypt_block = alloc.allocate_large(block_size, &crypt_pfx);
+		if (!crypt_block) {
+			t->error = DB_OUT_OF_MEMORY;
+			goto func_exit;
+		}
+	}
+
+	t->error = row_merge_sort(t->trx, &dup, t->file, block, &tmpfd,
+				  false, 0, 0, crypt_block, t->space, NULL);
+
+	if (t->error == DB_SUCCESS) {
+		BtrBulk	btr_bulk(t->index, t->trx);
+
+		t->error = btr_bulk.finish(
+			row_merge_insert_index_tuples(
+				t->index, t->old_table, t->file->fd, block,
+				NULL, &btr_bulk, t->file->n_rec, 0, 0,
+				crypt_block, t->space, NULL));
+	}
+
+	row_merge_file_destroy_low(tmpfd);
+
+	if (crypt_block) {
+		alloc.deallocate_large(crypt_block, &crypt_pfx);
+	}
+func_exit:
+	alloc.deallocate_large(block, &block_pfx);
+}
+
 /** Build indexes on a table by reading a clustered index, creating a temporary
 file containing index entries, merge sorting these index entries and inserting
 sorted index entries to indexes.
@@ -4645,6 +4761,8 @@ row_merge_build_indexes(
 	fts_psort_t*		psort_info = NULL;
 	fts_psort_t*		merge_info = NULL;
 	bool			fts_psort_initiated = false;
+	row_merge_index_task_t*	index_tasks = NULL;
+	tpool::task_group*	index_task_group = NULL;
 
 	double total_static_cost = 0;
 	double total_dynamic_cost = 0;
@@ -4805,6 +4923,70 @@ row_merge_build_indexes(
 	/* Now we have files containing index entries ready for
 	sorting and inserting. */
 
+	if (srv_sort_threads > 1) {
+		/* Sort and insert the non-unique secondary indexes in
+		parallel. The unique indexes (which may need to report
+		a duplicate key value in TABLE::record[0]) and the
+		FULLTEXT indexes are processed in the loop below. */
+		ulint	n_tasks = 0;
+
+		for (ulint k = 0, i = 0; i < n_indexes; i++) {
+			if (dict_index_is_spatial(indexes[i])) {
+				continue;
+			}
+
+			if (!(indexes[i]->type & DICT_FTS)
+			    && !dict_index_is_unique(indexes[i])
+			    && merge_files[k].fd != OS_FILE_CLOSED) {
+				n_tasks++;
+			}
+
+			k++;
+		}
+
+		if (n_tasks > 1) {
+			index_tasks = static_cast<row_merge_index_task_t*>(
+				ut_zalloc_nokey(n_merge_files
+						* sizeof *index_tasks));
+			index_task_group = UT_NEW_NOKEY(
+				tpool::task_group(uint(srv_sort_threads)));
+
+			for (ulint k = 0, i = 0; i < n_indexes; i++) {
+				if (dict_index_is_spatial(indexes[i])) {
+					continue;
+				}
+
+				row_merge_index_task_t&	t = index_tasks[k];
+
+				if (!(indexes[i]->type & DICT_FTS)
+				    && !dict_index_is_unique(indexes[i])
+				    && merge_files[k].fd != OS_FILE_CLOSED) {
+					t.trx = trx;
+					t.old_table = old_table;
+					t.index = indexes[i];
+					t.file = &merge_files[k];
+					t.space = new_table->space_id;
+					t.error = DB_SUCCESS;
+					t.task = new tpool::waitable_task(
+						row_merge_index_task, &t,
+						index_task_group);
+					srv_thread_pool->submit_task(t.task);
+				}
+
+				k++;
+			}
+
+			for (i = 0; i < n_merge_files; i++) {
+				if (tpool::waitable_task* task
+				    = index_tasks[i].task) {
+					task->wait();
+					delete task;
+					index_tasks[i].task = NULL;
+				}
+			}
+		}
+	}
+
 	for (ulint k = 0, i = 0; i < n_indexes; i++) {
 		dict_index_t*	sort_idx = indexes[i];
 
@@ -4812,7 +4994,19 @@ row_merge_build_indexes(
 			continue;
 		}
 
-		if (indexes[i]->type & DICT_FTS) {
+		if (index_tasks && index_tasks[k].index) {
+			/* The index was built by row_merge_index_task() */
+			error = index_tasks[k].error;
+			pct_progress += (COST_BUILD_INDEX_STATIC +
+					 (total_dynamic_cost
+					  * static_cast<double>(
+						  merge_files[k].offset)
+					  / static_cast<double>(
+						  total_index_blocks)))
+				/ (total_static_cost + total_dynamic_cost)
+				* (PCT_COST_MERGESORT_INDEX
+				   + PCT_COST_INSERT_INDEX) * 100;
+		} else if (indexes[i]->type & DICT_FTS) {
 
 			sort_idx = fts_sort_idx;
 
@@ -4981,6 +5175,9 @@ row_merge_build_indexes(
 
 	row_merge_file_destroy_low(tmpfd);
 
+	ut_free(index_tasks);
+	UT_DELETE(index_task_group);
+
 	for (i = 0; i < n_merge_files; i++) {
 		row_merge_file_destroy(&merge_files[i]);
 	}
@@ -5396,3 +5593,98 @@ dberr_t trx_t::bulk_insert_apply_low()
       }
   return DB_SUCCESS;
 }
+
+row_merge_bulk_append_t::row_merge_bulk_append_t(dict_table_t *table)
+{
+  ulint n_index= 0;
+  for (dict_index_t *index= dict_table_get_next_index(
+         dict_table_get_first_index(table));
+       index; index= dict_table_get_next_index(index))
+    if (index->is_btree() && !index->is_unique() && index->is_committed())
+      n_index++;
+
+  m_n_index= n_index;
+  m_merge_buf= static_cast<row_merge_buf_t*>(
+    ut_zalloc_nokey(n_index * sizeof *m_merge_buf));
+  m_n_inserted= static_cast<ulint*>(
+    ut_zalloc_nokey(n_index * sizeof *m_n_inserted));
+
+  ulint i= 0;
+  for (dict_index_t *index= dict_table_get_next_index(
+         dict_table_get_first_index(table));
+       index; index= dict_table_get_next_index(index))
+    if (index->is_btree() && !index->is_unique() && index->is_committed())
+      row_merge_buf_create_low(&m_merge_buf[i++], mem_heap_create(100),
+                               index);
+  ut_ad(i == n_index);
+}
+
+row_merge_bulk_append_t::~row_merge_bulk_append_t()
+{
+  for (ulint i= 0; i < m_n_index; i++)
+    row_merge_buf_free(&m_merge_buf[i]);
+  ut_free(m_merge_buf);
+  ut_free(m_n_inserted);
+}
+
+dberr_t row_merge_bulk_append_t::flush(ulint i, que_thr_t *thr)
+{
+  row_merge_buf_t *buf= &m_merge_buf[i];
+  dict_index_t *index= buf->index;
+  ulint &n= m_n_inserted[i];
+
+  if (!buf->n_tuples)
+    return DB_SUCCESS;
+  if (!n)
+    row_merge_buf_sort(buf, nullptr);
+
+  const ulint n_fields= dict_index_get_n_fields(index);
+  dtuple_t *entry= dtuple_create(buf->heap, n_fields);
+  dtuple_set_n_fields_cmp(entry, dict_index_get_n_unique_in_tree(index));
+
+  for (; n < buf->n_tuples; n++)
+  {
+    row_merge_mtuple_to_dtuple(index, entry, &buf->tuples[n]);
+    dtuple_set_info_bits(entry, 0);
+    if (dberr_t err= row_ins_sec_index_entry(index, entry, thr))
+    {
+      /* On DB_LOCK_WAIT, the caller will retry from this entry. */
+      thr_get_trx(thr)->error_info= index;
+      return err;
+    }
+  }
+
+  mem_heap_empty(buf->heap);
+  buf->total_size= buf->n_tuples= 0;
+  n= 0;
+  return DB_SUCCESS;
+}
+
+dberr_t row_merge_bulk_append_t::insert(dtuple_t *entry, dict_index_t *index,
+                                        que_thr_t *thr)
+{
+  ulint i= 0;
+  while (m_merge_buf[i].index != index)
+  {
+    i++;
+    ut_ad(i < m_n_index);
+  }
+
+  row_merge_buf_t *buf= &m_merge_buf[i];
+  if (row_merge_bulk_buf_add(buf, *index->table, *entry))
+    return DB_SUCCESS;
+  if (dberr_t err= flush(i, thr))
+    return err;
+  if (row_merge_bulk_buf_add(buf, *index->table, *entry))
+    return DB_SUCCESS;
+  /* The entry does not fit in an empty sort buffer. */
+  return row_ins_sec_index_entry(index, entry, thr);
+}
+
+dberr_t row_merge_bulk_append_t::flush(que_thr_t *thr)
+{
+  for (ulint i= 0; i < m_n_index; i++)
+    if (dberr_t err= flush(i, thr))
+      return err;
+  return DB_SUCCESS;
+}
@@ -51,6 +51,7 @@ Created 9/17/2000 Heikki Tuuri
 #include "rem0cmp.h"
 #include "row0import.h"
 #include "row0ins.h"
+#include "row0merge.h"
 #include "row0row.h"
 #include "row0sel.h"
 #include "row0upd.h"
@@ -933,6 +934,8 @@ void row_prebuilt_free(row_prebuilt_t *prebuilt)
 		que_graph_free_recursive(prebuilt->ins_graph);
 	}
 
+	delete prebuilt->bulk_append;
+
 	if (prebuilt->sel_graph) {
 		que_graph_free_recursive(prebuilt->sel_graph);
 	}
@@ -952,8 +955,9 @@ void row_prebuilt_free(row_prebuilt_t *prebuilt)
 	if (prebuilt->fetch_cache[0] != NULL) {
 		byte*	base = prebuilt->fetch_cache[0] - 4;
 		byte*	ptr = base;
+		const ulint n = prebuilt->fetch_cache_capacity();
 
-		for (ulint i = 0; i < MYSQL_FETCH_CACHE_SIZE; i++) {
+		for (ulint i = 0; i < n; i++) {
 			ulint	magic1 = mach_read_from_4(ptr);
 			ut_a(magic1 == ROW_PREBUILT_FETCH_MAGIC_N);
 			ptr += 4;
@@ -1335,6 +1339,14 @@ row_insert_for_mysql(
 			goto run_again;
 		}
 
+		if (prebuilt->bulk_append) {
+			/* The statement will fail and be rolled back. Some
+			buffered entries may belong to the row that was
+			rolled back above. */
+			delete prebuilt->bulk_append;
+			prebuilt->bulk_append = nullptr;
+		}
+
 		trx->op_info = "";
 
 		if (blob_heap != NULL) {
@@ -1415,6 +1427,78 @@ row_insert_for_mysql(
 	return(err);
 }
 
+/** Start buffering the secondary index inserts of LOAD DATA or
+of a replicated row event.
+@param[in,out]	prebuilt	prebuilt struct in MySQL handle */
+void row_bulk_append_start(row_prebuilt_t* prebuilt)
+{
+	const trx_t*		trx	= prebuilt->trx;
+	dict_table_t*		table	= prebuilt->table;
+
+	ut_ad(!prebuilt->bulk_append);
+
+	/* With IGNORE or REPLACE, a failed row would not abort the
+	statement, and we would be unable to discard its buffered
+	entries. Foreign key constraints are checked on the secondary
+	index entries. */
+	if (table->is_temporary() || table->versioned()
+	    || table->is_active_ddl() || table->skip_alter_undo
+	    || !table->is_readable() || trx->duplicates || trx->is_wsrep()
+	    || (trx->check_foreigns && !table->foreign_set.empty())) {
+		return;
+	}
+
+	auto b = new row_merge_bulk_append_t(table);
+
+	if (b->empty()) {
+		delete b;
+	} else {
+		prebuilt->bulk_append = b;
+	}
+}
+
+/** Insert the buffered secondary index entries of LOAD DATA or
+of a replicated row event.
+@param[in,out]	prebuilt	prebuilt struct in MySQL handle
+@return error code or DB_SUCCESS */
+dberr_t row_bulk_append_end(row_prebuilt_t* prebuilt)
+{
+	row_merge_bulk_append_t*	b	= prebuilt->bulk_append;
+
+	if (!b) {
+		return DB_SUCCESS;
+	}
+
+	prebuilt->bulk_append = nullptr;
+
+	dberr_t	err = DB_SUCCESS;
+
+	if (prebuilt->ins_graph) {
+		trx_t*		trx	= prebuilt->trx;
+		que_thr_t*	thr	= que_fork_get_first_thr(
+			prebuilt->ins_graph);
+
+		trx->op_info = "inserting";
+
+		while ((err = b->flush(thr)) != DB_SUCCESS) {
+			trx->error_state = err;
+			thr->lock_state = QUE_THR_LOCK_ROW;
+			bool was_lock_wait = row_mysql_handle_errors(
+				&err, trx, thr, nullptr);
+			thr->lock_state = QUE_THR_LOCK_NOLOCK;
+
+			if (!was_lock_wait) {
+				break;
+			}
+		}
+
+		trx->op_info = "";
+	}
+
+	delete b;
+	return err;
+}
+
 /*********************************************************************//**
 Builds a dummy query graph used in selects. */
 void
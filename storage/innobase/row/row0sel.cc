@@ -3871,12 +3871,13 @@ row_sel_prefetch_cache_init(
 	ulint	i;
 	ulint	sz;
 	byte*	ptr;
+	const ulint n = prebuilt->fetch_cache_capacity();
 
 	/* Reserve space for the magic number. */
-	sz = UT_ARR_SIZE(prebuilt->fetch_cache) * (prebuilt->mysql_row_len + 8);
+	sz = n * (prebuilt->mysql_row_len + 8);
 	ptr = static_cast<byte*>(ut_malloc_nokey(sz));
 
-	for (i = 0; i < UT_ARR_SIZE(prebuilt->fetch_cache); i++) {
+	for (i = 0; i < n; i++) {
 
 		/* A user has reported memory corruption in these
 		buffers in Linux. Put magic numbers there to help
@@ -3903,7 +3904,7 @@ row_sel_fetch_last_buf(
 	row_prebuilt_t*	prebuilt)	/*!< in/out: prebuilt struct */
 {
 	ut_ad(!prebuilt->templ_contains_blob);
-	ut_ad(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+	ut_ad(prebuilt->n_fetch_cached < prebuilt->fetch_cache_capacity());
 
 	if (prebuilt->fetch_cache[0] == NULL) {
 		/* Allocate memory for the fetch cache */
@@ -4456,7 +4457,8 @@ row_search_mvcc(
 		}
 
 		if (prebuilt->fetch_cache_first > 0
-		    && prebuilt->fetch_cache_first < MYSQL_FETCH_CACHE_SIZE) {
+		    && prebuilt->fetch_cache_first
+		    < prebuilt->fetch_cache_capacity()) {
 early_not_found:
 			/* The previous returned row was popped from the fetch
 			cache, but the cache was not full at the time of the
@@ -5418,6 +5420,15 @@ row_search_mvcc(
 				if (trx->read_view.sees(trx_id)) {
 					goto locks_ok;
 				}
+				/* The record may be older than the
+				latest modification of the page. */
+				if (!dict_index_is_spatial(index)
+				    && (trx_id = page_sec_rec_max_trx_id(
+						*btr_pcur_get_block(pcur),
+						page_rec_get_heap_no(rec)))
+				    && trx->read_view.sees(trx_id)) {
+					goto locks_ok;
+				}
 				/* We should look at the clustered index.
 				However, as this is a non-locking read,
 				we can skip the clustered index lookup if
@@ -5640,7 +5651,7 @@ row_search_mvcc(
 		not cache rows because there the cursor is a scrollable
 		cursor. */
 
-		ut_a(prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE);
+		ut_a(prebuilt->n_fetch_cached < prebuilt->fetch_batch_size());
 
 		/* We only convert from InnoDB row format to MySQL row
 		format when ICP is disabled. */
@@ -5692,7 +5703,7 @@ row_search_mvcc(
 			row_sel_enqueue_cache_row_for_mysql(buf, prebuilt);
 		}
 
-		if (prebuilt->n_fetch_cached < MYSQL_FETCH_CACHE_SIZE) {
+		if (prebuilt->n_fetch_cached < prebuilt->fetch_batch_size()) {
 			goto next_rec;
 		}
 	} else {
@@ -6847,6 +6858,240 @@ dberr_t row_check_index(row_prebuilt_t *prebuilt, ulint *n_rows)
   goto rec_loop;
 }
 
+/** Count the records of a key range of the clustered index that are
+visible in the read view of the transaction.
+@param prebuilt  table and transaction
+@param low       the smallest key of the range, or nullptr for the start
+@param high      the first key after the range, or nullptr for the end
+@param n_rows    number of records counted
+@return error code */
+static dberr_t row_count_range(const row_prebuilt_t *prebuilt,
+                               const dtuple_t *low, const dtuple_t *high,
+                               ulint *n_rows)
+{
+  dict_index_t *const index= dict_table_get_first_index(prebuilt->table);
+  trx_t *const trx= prebuilt->trx;
+  const bool comp= prebuilt->table->not_redundant();
+  const bool mvcc= !prebuilt->table->is_temporary() &&
+    trx->isolation_level != TRX_ISO_READ_UNCOMMITTED;
+  rec_offs offsets_[REC_OFFS_NORMAL_SIZE];
+  rec_offs_init(offsets_);
+  rec_offs *offsets= offsets_;
+  mem_heap_t *heap= nullptr;
+  mem_heap_t *vers_heap= nullptr;
+
+  *n_rows= 0;
+
+  btr_pcur_t pcur;
+  mtr_t mtr;
+  mtr.start();
+
+  dberr_t err;
+  if (low)
+  {
+    pcur.btr_cur.page_cur.index= index;
+    err= btr_pcur_open_on_user_rec(low, BTR_SEARCH_LEAF, &pcur, &mtr);
+  }
+  else
+    err= pcur.open_leaf(true, index, BTR_SEARCH_LEAF, &mtr);
+
+  /* btr_pcur_open_on_user_rec() positions the cursor on the first record
+  of the range; open_leaf() positions it before the first record. */
+  for (bool move= !low; err == DB_SUCCESS; move= true)
+  {
+    if (move && !btr_pcur_move_to_next_on_page(&pcur))
+    {
+      err= DB_CORRUPTION;
+      break;
+    }
+
+    const rec_t *rec= btr_pcur_get_rec(&pcur);
+
+    if (page_rec_is_supremum(rec))
+    {
+      if (btr_pcur_is_after_last_in_tree(&pcur))
+        break;
+      err= btr_pcur_move_to_next_page(&pcur, &mtr);
+      if (err == DB_SUCCESS && trx_is_interrupted(trx))
+        err= DB_INTERRUPTED;
+      continue;
+    }
+
+    offsets= rec_get_offsets(rec, index, offsets, index->n_core_fields,
+                             ULINT_UNDEFINED, &heap);
+
+    if (high && cmp_dtuple_rec(high, rec, index, offsets) <= 0)
+      break;
+
+    const auto info_bits= rec_get_info_bits(rec, comp);
+    if (UNIV_UNLIKELY(info_bits & REC_INFO_MIN_REC_FLAG))
+      continue; /* the metadata record of instant ALTER TABLE */
+
+    bool deleted= info_bits & REC_INFO_DELETED_FLAG;
+
+    if (mvcc &&
+        !trx->read_view.changes_visible(row_get_rec_trx_id(rec, index,
+                                                           offsets)))
+    {
+      if (vers_heap)
+        mem_heap_empty(vers_heap);
+      else
+        vers_heap= mem_heap_create(srv_page_size);
+
+      rec_t *old_vers;
+      err= row_vers_build_for_consistent_read(rec, &mtr, index, &offsets,
+                                              &trx->read_view, &heap,
+                                              vers_heap, &old_vers, nullptr);
+      if (err != DB_SUCCESS)
+        break;
+      if (!old_vers)
+        continue;
+      deleted= rec_get_deleted_flag(old_vers, comp);
+    }
+
+    if (!deleted)
+      ++*n_rows;
+  }
+
+  mtr.commit();
+  btr_pcur_close(&pcur);
+  if (heap)
+    mem_heap_free(heap);
+  if (vers_heap)
+    mem_heap_free(vers_heap);
+  return err;
+}
+
+/** Parallel COUNT(*) of the clustered index */
+struct row_count_t
+{
+  /** table and transaction */
+  const row_prebuilt_t *const prebuilt;
+  /** the boundaries of the key ranges; bounds[i] is the smallest key of
+  range i and the first key after range i-1; nullptr for the start or
+  the end of the index */
+  std::vector<const dtuple_t*> bounds;
+  /** the counts of each range */
+  std::vector<ulint> counts;
+  /** the next range that is not being counted yet */
+  std::atomic<size_t> next{0};
+  /** the first error that was encountered */
+  std::atomic<dberr_t> err{DB_SUCCESS};
+
+  row_count_t(const row_prebuilt_t *prebuilt) : prebuilt(prebuilt) {}
+
+  /** Count ranges until none are left or an error occurs. */
+  void run()
+  {
+    for (size_t i;
+         err.load(std::memory_order_relaxed) == DB_SUCCESS &&
+         (i= next.fetch_add(1, std::memory_order_relaxed)) < counts.size(); )
+      if (dberr_t e= row_count_range(prebuilt, bounds[i], bounds[i + 1],
+                                     &counts[i]))
+      {
+        dberr_t expected= DB_SUCCESS;
+        err.compare_exchange_strong(expected, e);
+      }
+  }
+
+  /** Count ranges in a thread pool task. */
+  static void task(void *arg) { static_cast<row_count_t*>(arg)->run(); }
+};
+
+/** Count the records of the clustered index that are visible in the
+read view of the transaction, for SELECT COUNT(*) without a WHERE clause.
+The index is divided into key ranges by the node pointers of the root page,
+and the ranges are scanned concurrently.
+@param prebuilt   table and transaction
+@param n_threads  maximum number of threads to use
+@param n_rows     number of records counted
+@return error code */
+dberr_t row_count_parallel(row_prebuilt_t *prebuilt, ulint n_threads,
+                           ulint *n_rows)
+{
+  ut_ad(n_threads);
+  *n_rows= 0;
+
+  dict_index_t *const index= dict_table_get_first_index(prebuilt->table);
+  if (!index->is_btree())
+    return DB_CORRUPTION;
+
+  if (prebuilt->trx->isolation_level != TRX_ISO_READ_UNCOMMITTED)
+    if (const trx_id_t bulk_trx_id= index->table->bulk_trx_id)
+      if (!prebuilt->trx->read_view.changes_visible(bulk_trx_id))
+        return DB_SUCCESS;
+
+  row_count_t count{prebuilt};
+  count.bounds.push_back(nullptr);
+
+  /* Divide the index at every step-th node pointer of the root page. */
+  mem_heap_t *heap= mem_heap_create(256);
+  mtr_t mtr;
+  mtr.start();
+  mtr_s_lock_index(index, &mtr);
+  dberr_t err;
+  if (const buf_block_t *root= btr_root_block_get(index, RW_S_LATCH, &mtr,
+                                                  &err))
+  {
+    const page_t *page= root->page.frame;
+    if (n_threads > 1 && !page_is_leaf(page))
+    {
+      const ulint n_recs= page_get_n_recs(page);
+      const ulint step= (n_recs + n_threads - 1) / n_threads;
+      const ulint n_fields= dict_index_get_n_unique_in_tree_nonleaf(index);
+      const rec_t *rec= page_get_infimum_rec(page);
+
+      for (ulint i= 0; i < n_recs; i++)
+      {
+        rec= page_rec_get_next_const(rec);
+        if (!rec || page_rec_is_supremum(rec))
+        {
+          err= DB_CORRUPTION;
+          break;
+        }
+        if (!i || i % step)
+          continue;
+        dtuple_t *tuple= dtuple_create(heap, n_fields);
+        dict_index_copy_types(tuple, index, n_fields);
+        rec_copy_prefix_to_dtuple(tuple, rec, index, 0, n_fields, heap);
+        tuple->info_bits= 0;
+        count.bounds.push_back(tuple);
+      }
+    }
+  }
+  mtr.commit();
+
+  if (err == DB_SUCCESS)
+  {
+    count.bounds.push_back(nullptr);
+    count.counts.resize(count.bounds.size() - 1);
+
+    /* The calling thread takes part in the work, so that it will
+    complete even if the thread pool is busy. */
+    std::vector<tpool::waitable_task*> tasks;
+    if (srv_thread_pool)
+      for (size_t i= std::min<size_t>(n_threads, count.counts.size()); --i; )
+      {
+        tasks.push_back(new tpool::waitable_task(row_count_t::task, &count));
+        srv_thread_pool->submit_task(tasks.back());
+      }
+    count.run();
+    for (tpool::waitable_task *t : tasks)
+    {
+      t->wait();
+      delete t;
+    }
+
+    err= count.err;
+    if (err == DB_SUCCESS)
+      for (ulint n : count.counts)
+        *n_rows+= n;
+  }
+
+  mem_heap_free(heap);
+  return err;
+}
+
 /*******************************************************************//**
 Read the AUTOINC column from the current row. If the value is less than
 0 and the type is not unsigned then we reset the value to 0.
@@ -373,6 +373,17 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_NONE,
 	 MONITOR_DEFAULT_START, MONITOR_FLUSH_LSN_AVG_RATE},
 
+	{"buffer_flush_lsn_cur_rate", "buffer",
+	 "Redo generation rate since the previous adaptive flushing decision",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_FLUSH_LSN_CUR_RATE},
+
+	{"buffer_flush_ahead", "buffer",
+	 "Number of times adaptive flushing was increased because the redo"
+	 " log was predicted to fill up",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_FLUSH_AHEAD},
+
 	{"buffer_flush_pct_for_dirty", "buffer",
 	 "Percent of IO capacity used to avoid max dirty page limit",
 	 MONITOR_NONE,
@@ -471,6 +482,24 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_NONE,
 	 MONITOR_DEFAULT_START, MONITOR_LRU_GET_FREE_SEARCH},
 
+	{"buffer_LRU_get_free_numa_local", "buffer",
+	 "Number of free blocks allocated from the NUMA node of the thread"
+	 " (innodb_numa_local)",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_LRU_GET_FREE_NUMA_LOCAL},
+
+	{"buffer_LRU_get_free_numa_remote", "buffer",
+	 "Number of free blocks allocated from a remote NUMA node"
+	 " (innodb_numa_local)",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_LRU_GET_FREE_NUMA_REMOTE},
+
+	{"buffer_LRU_ghost_hits", "buffer",
+	 "Number of pages read into the young sublist because they were"
+	 " evicted recently (innodb_lru_policy=2q)",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_LRU_GHOST_HITS},
+
 	/* Cumulative counter for LRU search scans */
 	{"buffer_LRU_search_scanned", "buffer",
 	 "Total pages scanned as part of LRU search",
@@ -699,6 +728,17 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_DISPLAY_CURRENT,
 	 MONITOR_DEFAULT_START, MONITOR_PURGE_RESUME_COUNT},
 
+	{"purge_threads_active", "purge",
+	 "Number of purge tasks that were used in the latest batch",
+	 MONITOR_DISPLAY_CURRENT,
+	 MONITOR_DEFAULT_START, MONITOR_PURGE_THREADS_ACTIVE},
+
+	{"purge_table_shards", "purge",
+	 "Number of times the undo log records of a table were assigned"
+	 " to an additional purge task",
+	 MONITOR_NONE,
+	 MONITOR_DEFAULT_START, MONITOR_PURGE_TABLE_SHARDS},
+
 	/* ========== Counters for Recovery Module ========== */
 	{"module_log", "recovery", "Recovery Module",
 	 MONITOR_MODULE,
@@ -1033,6 +1073,35 @@ static monitor_info_t	innodb_counter_info[] =
 	 MONITOR_NONE,
 	 MONITOR_DEFAULT_START, MONITOR_ICP_MATCH},
 
+	/* ========== Counters for Latch Contention Module ========== */
+	{"module_latch", "latch", "Latch contention",
+	 MONITOR_MODULE,
+	 MONITOR_DEFAULT_START, MONITOR_MODULE_LATCH},
+
+	{"latch_spin_waits", "latch",
+	 "Number of times a thread found a latch busy and started spinning",
+	 static_cast<monitor_type_t>(
+	 MONITOR_EXISTING | MONITOR_DEFAULT_ON),
+	 MONITOR_DEFAULT_START, MONITOR_OVLD_LATCH_SPIN_WAITS},
+
+	{"latch_spin_success", "latch",
+	 "Number of latch acquisitions that succeeded while spinning",
+	 static_cast<monitor_type_t>(
+	 MONITOR_EXISTING | MONITOR_DEFAULT_ON),
+	 MONITOR_DEFAULT_START, MONITOR_OVLD_LATCH_SPIN_SUCCESS},
+
+	{"latch_os_waits", "latch",
+	 "Number of times a thread was suspended waiting for a latch",
+	 static_cast<monitor_type_t>(
+	 MONITOR_EXISTING | MONITOR_DEFAULT_ON),
+	 MONITOR_DEFAULT_START, MONITOR_OVLD_LATCH_OS_WAITS},
+
+	{"latch_os_wait_usec", "latch",
+	 "Time in microseconds that threads were suspended waiting for latches",
+	 static_cast<monitor_type_t>(
+	 MONITOR_EXISTING | MONITOR_DEFAULT_ON),
+	 MONITOR_DEFAULT_START, MONITOR_OVLD_LATCH_OS_WAIT_TIME},
+
 	/* ========== To turn on/off reset all counters ========== */
 	{"all", "All Counters", "Turn on/off and reset all counters",
 	 MONITOR_MODULE,
@@ -1407,6 +1476,22 @@ srv_mon_process_existing_counter(
 		buf_dblwr.unlock();
 		break;
 
+	case MONITOR_OVLD_LATCH_SPIN_WAITS:
+		value = srv_stats.latch_spin_waits;
+		break;
+
+	case MONITOR_OVLD_LATCH_SPIN_SUCCESS:
+		value = srv_stats.latch_spin_success;
+		break;
+
+	case MONITOR_OVLD_LATCH_OS_WAITS:
+		value = srv_stats.latch_os_waits;
+		break;
+
+	case MONITOR_OVLD_LATCH_OS_WAIT_TIME:
+		value = srv_stats.latch_os_wait_time;
+		break;
+
 	/* innodb_page_size */
 	case MONITOR_OVLD_SRV_PAGE_SIZE:
 		value = srv_page_size;
@@ -44,6 +44,7 @@ Created 10/8/1995 Heikki Tuuri
 #include "mysql/psi/psi.h"
 
 #include "btr0sea.h"
+#include "buf0dump.h"
 #include "buf0flu.h"
 #include "buf0lru.h"
 #include "dict0boot.h"
@@ -127,6 +128,9 @@ bool high_level_read_only;
 
 /** Sort buffer size in index creation */
 ulong	srv_sort_buf_size;
+/** innodb_sort_threads: number of threads for building non-unique
+secondary indexes in parallel */
+ulong	srv_sort_threads;
 /** Maximum modification log file size for online index creation */
 unsigned long long	srv_online_max_size;
 
@@ -136,6 +140,9 @@ use simulated aio we build below with threads.
 Currently we support native aio on windows and linux */
 my_bool	srv_use_native_aio;
 my_bool	srv_numa_interleave;
+/** innodb_numa_local: bind buffer pool chunks to NUMA nodes round-robin
+and prefer free blocks on the node of the requesting thread */
+my_bool	srv_numa_local;
 /** copy of innodb_use_atomic_writes; @see innodb_init_params() */
 my_bool	srv_use_atomic_writes;
 /** innodb_compression_algorithm; used with page compression */
@@ -192,6 +199,8 @@ ulint	srv_buf_pool_base_size;
 ulint	srv_buf_pool_curr_size;
 /** Dump this % of each buffer pool during BP dump */
 ulong	srv_buf_pool_dump_pct;
+/** Interval between periodic BP dumps in seconds, or 0 */
+ulong	srv_buf_pool_dump_interval;
 /** Abort load after this amount of pages */
 #ifdef UNIV_DEBUG
 ulong srv_buf_pool_load_pages_abort = LONG_MAX;
@@ -207,8 +216,16 @@ uint	srv_n_read_io_threads;
 /** innodb_write_io_threads */
 uint	srv_n_write_io_threads;
 
+/** innodb_dict_size_limit */
+size_t	srv_dict_size_limit;
 /** innodb_random_read_ahead */
 my_bool	srv_random_read_ahead;
+/** innodb_page_search_cache */
+my_bool	srv_page_search_cache;
+/** innodb_scan_read_ahead */
+my_bool	srv_scan_read_ahead;
+/** innodb_parallel_read_threads */
+ulong	srv_parallel_read_threads;
 /** innodb_read_ahead_threshold; the number of pages that must be present
 in the buffer cache and accessed sequentially for InnoDB to trigger a
 readahead request. */
@@ -293,6 +310,8 @@ my_bool		srv_stats_persistent;
 my_bool		srv_stats_include_delete_marked;
 /** innodb_stats_persistent_sample_pages */
 unsigned long long	srv_stats_persistent_sample_pages;
+/** innodb_stats_analyze_threads */
+ulong		srv_stats_analyze_threads;
 /** innodb_stats_auto_recalc */
 my_bool		srv_stats_auto_recalc;
 
@@ -456,6 +475,8 @@ struct purge_coordinator_state
 {
   /** Snapshot of the last history length before the purge call.*/
   size_t history_size;
+  /** Number of purge tasks to use, at most innodb_purge_threads */
+  uint n_use_threads;
   Atomic_counter<int> m_running;
 public:
   inline void do_purge();
@@ -470,6 +491,14 @@ std::unique_ptr<tpool::timer> srv_monitor_timer;
 /** The buffer pool dump/load file name */
 char*	srv_buf_dump_filename;
 
+/** The secondary buffer pool cache file, or NULL */
+char*	srv_buf_pool_secondary_file;
+/** Size of srv_buf_pool_secondary_file in bytes */
+ulonglong	srv_buf_pool_secondary_size;
+
+/** Whether to track changed pages for incremental backup */
+my_bool	srv_track_changed_pages;
+
 /** Boolean config knobs that tell InnoDB to dump the buffer pool at shutdown
 and/or load it during startup. */
 char	srv_buffer_pool_dump_at_shutdown = TRUE;
@@ -1300,6 +1329,8 @@ void srv_master_callback(void*)
   else
     srv_master_do_idle_tasks(counter_time);
 
+  buf_dump_at_interval();
+
   srv_main_thread_op_info= "sleeping";
 }
 
@@ -1410,7 +1441,24 @@ inline void purge_coordinator_state::do_purge()
   first_loop:
     ut_ad(n_threads);
 
-    history_size= trx_sys.history_size();
+    {
+      const size_t old_history_size= history_size;
+      history_size= trx_sys.history_size();
+
+      /* Use one more task while the history keeps growing, and one
+      task less when the history is shrinking and is short enough to
+      be processed by fewer tasks. */
+      if (!n_use_threads || n_use_threads > n_threads)
+        n_use_threads= n_threads;
+      else if (history_size > old_history_size)
+      {
+        if (n_use_threads < n_threads)
+          n_use_threads++;
+      }
+      else if (history_size < old_history_size && n_use_threads > 1 &&
+               history_size < n_use_threads * srv_purge_batch_size)
+        n_use_threads--;
+    }
 
     if (!history_size)
     {
@@ -1421,7 +1469,8 @@ inline void purge_coordinator_state::do_purge()
       break;
     }
 
-    ulint n_pages_handled= trx_purge(n_threads, history_size);
+    MONITOR_SET(MONITOR_PURGE_THREADS_ACTIVE, n_use_threads);
+    ulint n_pages_handled= trx_purge(n_use_threads, history_size);
     if (!trx_sys.history_exists())
       goto no_history;
     if (purge_sys.truncating_tablespace() ||
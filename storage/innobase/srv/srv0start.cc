@@ -68,6 +68,8 @@ Created 2/16/1996 Heikki Tuuri
 #include "trx0rseg.h"
 #include "buf0flu.h"
 #include "buf0rea.h"
+#include "buf0sec.h"
+#include "buf0trk.h"
 #include "dict0boot.h"
 #include "dict0load.h"
 #include "dict0stats_bg.h"
@@ -1339,6 +1341,8 @@ dberr_t srv_start(bool create_new_db)
 
 	ib::info() << "Completed initialization of buffer pool";
 
+	buf_sec.create();
+
 #ifdef UNIV_DEBUG
 	/* We have observed deadlocks with a 5MB buffer pool but
 	the actual lower limit could very well be a little higher. */
@@ -1575,9 +1579,11 @@ dberr_t srv_start(bool create_new_db)
 			recv_group_scan_log_recs().
 			Since it may generate huge batch of threadpool tasks,
 			for read io task group, scale down thread creation rate
-			by temporarily restricting tpool concurrency.
+			by temporarily restricting tpool concurrency
+			to the number of concurrent read completion callbacks.
 			*/
-			srv_thread_pool->set_concurrency(srv_n_read_io_threads);
+			srv_thread_pool->set_concurrency(
+				recv_sys_t::apply_threads());
 
 			mysql_mutex_lock(&recv_sys.mutex);
 			recv_sys.apply(true);
@@ -1770,6 +1776,8 @@ dberr_t srv_start(bool create_new_db)
 	running in single threaded mode essentially. Only the IO threads
 	should be running at this stage. */
 
+	buf_track.create();
+
 	if (!trx_sys_create_rsegs()) {
 		return(srv_init_abort(DB_ERROR));
 	}
@@ -2023,6 +2031,8 @@ void innodb_shutdown()
 		logs_empty_and_mark_files_at_shutdown();
 	}
 
+	buf_sec.close();
+	buf_track.close();
 	os_aio_free();
 	fil_space_t::close_all();
 	/* Exit any remaining threads. */
@@ -143,19 +143,33 @@ static inline void srw_pause(unsigned delay)
   HMT_medium();
 }
 
+/** Note that a thread was suspended waiting for a latch.
+@param start  my_interval_timer() at the start of the wait */
+static void srw_os_waited(ulonglong start)
+{
+  srv_stats.latch_os_waits.inc();
+  srv_stats.latch_os_wait_time.add(ulint((my_interval_timer() - start) / 1000));
+}
+
 #ifndef PTHREAD_ADAPTIVE_MUTEX_INITIALIZER_NP
 template<> void pthread_mutex_wrapper<true>::wr_wait()
 {
   const unsigned delay= srw_pause_delay();
+  srv_stats.latch_spin_waits.inc();
 
   for (auto spin= srv_n_spin_wait_rounds; spin; spin--)
   {
     srw_pause(delay);
     if (wr_lock_try())
+    {
+      srv_stats.latch_spin_success.inc();
       return;
+    }
   }
 
+  const ulonglong start= my_interval_timer();
   pthread_mutex_lock(&lock);
+  srw_os_waited(start);
 }
 #endif
 
@@ -311,6 +325,7 @@ void srw_mutex_impl<spinloop>::wait_and_lock()
   if (spinloop)
   {
     const unsigned delay= srw_pause_delay();
+    srv_stats.latch_spin_waits.inc();
 
     for (auto spin= srv_n_spin_wait_rounds;;)
     {
@@ -320,11 +335,11 @@ void srw_mutex_impl<spinloop>::wait_and_lock()
       {
 #ifdef IF_NOT_FETCH_OR_GOTO
         static_assert(HOLDER == (1U << 31), "compatibility");
-        IF_NOT_FETCH_OR_GOTO(*this, 31, acquired);
+        IF_NOT_FETCH_OR_GOTO(*this, 31, spun);
         lk|= HOLDER;
 #else
         if (!((lk= lock.fetch_or(HOLDER, std::memory_order_relaxed)) & HOLDER))
-          goto acquired;
+          goto spun;
 #endif
       }
       if (!--spin)
@@ -338,7 +353,11 @@ void srw_mutex_impl<spinloop>::wait_and_lock()
     DBUG_ASSERT(~HOLDER & lk);
     if (lk & HOLDER)
     {
-      wait(lk);
+      {
+        const ulonglong start= my_interval_timer();
+        wait(lk);
+        srw_os_waited(start);
+      }
 #ifdef IF_FETCH_OR_GOTO
 reload:
 #endif
@@ -359,6 +378,10 @@ void srw_mutex_impl<spinloop>::wait_and_lock()
       return;
     }
   }
+
+spun:
+  srv_stats.latch_spin_success.inc();
+  goto acquired;
 }
 
 template void srw_mutex_impl<false>::wait_and_lock();
@@ -374,19 +397,24 @@ void ssux_lock_impl<spinloop>::wr_wait(uint32_t lk)
   if (spinloop)
   {
     const unsigned delay= srw_pause_delay();
+    srv_stats.latch_spin_waits.inc();
 
     for (auto spin= srv_n_spin_wait_rounds; spin; spin--)
     {
       srw_pause(delay);
       lk= readers.load(std::memory_order_acquire);
       if (lk == WRITER)
+      {
+        srv_stats.latch_spin_success.inc();
         return;
+      }
       DBUG_ASSERT(lk > WRITER);
     }
   }
 
   lk|= WRITER;
 
+  const ulonglong start= my_interval_timer();
   do
   {
     DBUG_ASSERT(lk > WRITER);
@@ -394,6 +422,7 @@ void ssux_lock_impl<spinloop>::wr_wait(uint32_t lk)
     lk= readers.load(std::memory_order_acquire);
   }
   while (lk != WRITER);
+  srw_os_waited(start);
 }
 
 template void ssux_lock_impl<true>::wr_wait(uint32_t);
@@ -406,14 +435,20 @@ void ssux_lock_impl<spinloop>::rd_wait()
 
   if (spinloop)
   {
+    srv_stats.latch_spin_waits.inc();
     for (auto spin= srv_n_spin_wait_rounds; spin; spin--)
     {
       srw_pause(delay);
       if (rd_lock_try())
+      {
+        srv_stats.latch_spin_success.inc();
         return;
+      }
     }
   }
 
+  const ulonglong start= my_interval_timer();
+
   /* Subscribe to writer.wake() or write.wake_all() calls by
   concurrently executing rd_wait() or writer.wr_unlock(). */
   uint32_t wl= 1 + writer.lock.fetch_add(1, std::memory_order_acquire);
@@ -448,6 +483,7 @@ void ssux_lock_impl<spinloop>::rd_wait()
   and waking up other threads on unlock(). */
   if (wl > 1)
     writer.wake_all();
+  srw_os_waited(start);
 }
 
 template void ssux_lock_impl<true>::rd_wait();
@@ -457,29 +493,41 @@ template void ssux_lock_impl<false>::rd_wait();
 template<> void srw_lock_<true>::rd_wait()
 {
   const unsigned delay= srw_pause_delay();
+  srv_stats.latch_spin_waits.inc();
 
   for (auto spin= srv_n_spin_wait_rounds; spin; spin--)
   {
     srw_pause(delay);
     if (rd_lock_try())
+    {
+      srv_stats.latch_spin_success.inc();
       return;
+    }
   }
 
+  const ulonglong start= my_interval_timer();
   IF_WIN(AcquireSRWLockShared(&lk), rw_rdlock(&lk));
+  srw_os_waited(start);
 }
 
 template<> void srw_lock_<true>::wr_wait()
 {
   const unsigned delay= srw_pause_delay();
+  srv_stats.latch_spin_waits.inc();
 
   for (auto spin= srv_n_spin_wait_rounds; spin; spin--)
   {
     srw_pause(delay);
     if (wr_lock_try())
+    {
+      srv_stats.latch_spin_success.inc();
       return;
+    }
   }
 
+  const ulonglong start= my_interval_timer();
   IF_WIN(AcquireSRWLockExclusive(&lk), rw_wrlock(&lk));
+  srw_os_waited(start);
 }
 #endif
 
@@ -25,6 +25,7 @@ Created 3/26/1996 Heikki Tuuri
 *******************************************************/
 
 #include "trx0purge.h"
+#include "buf0sec.h"
 #include "fsp0fsp.h"
 #include "mach0data.h"
 #include "mtr0log.h"
@@ -717,6 +718,8 @@ TRANSACTIONAL_TARGET void trx_purge_truncate_history()
     tablespace object to clear all freed ranges */
     mtr.set_named_space(space);
     mtr.trim_pages(page_id_t(space->id, size));
+    if (buf_sec.is_created())
+      buf_sec.discard(space->id);
     ut_a(fsp_header_init(space, size, &mtr) == DB_SUCCESS);
 
     for (auto &rseg : trx_sys.rseg_array)
@@ -1209,6 +1212,75 @@ dict_table_t *purge_sys_t::close_and_reopen(table_id_t id, THD *thd,
   return table;
 }
 
+/** Determine whether the undo log records of a table can be distributed
+among several purge tasks. Records that refer to the same clustered index
+record must be processed in order by a single task. That is guaranteed if
+equal PRIMARY KEY values always consist of equal bytes.
+@param table   table
+@return whether the records can be distributed by PRIMARY KEY */
+static bool trx_purge_table_can_shard(const dict_table_t &table)
+{
+  const dict_index_t *clust= dict_table_get_first_index(&table);
+  for (ulint i= dict_index_get_n_unique(clust); i--; )
+  {
+    switch (clust->fields[i].col->mtype) {
+    case DATA_INT:
+    case DATA_SYS:
+    case DATA_FIXBINARY:
+    case DATA_BINARY:
+      continue;
+    }
+    return false;
+  }
+  return true;
+}
+
+/** Determine the purge shard of an undo log record.
+@param undo_rec   undo log record
+@param table      the table that the record refers to
+@param n_shards   number of shards
+@return shard number, less than n_shards */
+static ulint trx_purge_rec_shard(const trx_undo_rec_t *undo_rec,
+                                 const dict_table_t &table, ulint n_shards)
+{
+  byte type, cmpl_info;
+  bool updated_extern;
+  undo_no_t undo_no;
+  table_id_t table_id;
+  const byte *ptr= trx_undo_rec_get_pars(undo_rec, &type, &cmpl_info,
+                                         &updated_extern, &undo_no,
+                                         &table_id);
+  switch (type) {
+  case TRX_UNDO_INSERT_REC:
+    break;
+  case TRX_UNDO_UPD_EXIST_REC:
+  case TRX_UNDO_UPD_DEL_REC:
+  case TRX_UNDO_DEL_MARK_REC:
+    trx_id_t trx_id;
+    roll_ptr_t roll_ptr;
+    byte info_bits;
+    ptr= trx_undo_update_rec_get_sys_cols(ptr, &trx_id, &roll_ptr,
+                                          &info_bits);
+    break;
+  default:
+    /* The records that do not refer to a user record are independent
+    of any other records. */
+    return 0;
+  }
+
+  const dict_index_t *clust= dict_table_get_first_index(&table);
+  ulint fold= 0;
+  for (ulint i= dict_index_get_n_unique(clust); i--; )
+  {
+    const byte *field;
+    uint32_t len, orig_len;
+    ptr= trx_undo_rec_get_col_val(ptr, &field, &len, &orig_len);
+    if (len != UNIV_SQL_NULL)
+      fold= ut_fold_ulint_pair(fold, ut_fold_binary(field, len));
+  }
+  return fold % n_shards;
+}
+
 /** Run a purge batch.
 @param n_purge_threads	number of purge threads
 @return new purge_sys.head */
@@ -1220,20 +1292,22 @@ trx_purge_attach_undo_recs(ulint n_purge_threads, THD *thd)
 
 	ut_a(n_purge_threads > 0);
 	ut_a(UT_LIST_GET_LEN(purge_sys.query->thrs) >= n_purge_threads);
+	ut_ad(n_purge_threads <= innodb_purge_threads_MAX);
 
 	purge_sys_t::iterator head = purge_sys.tail;
+	purge_node_t* nodes[innodb_purge_threads_MAX];
 
-#ifdef UNIV_DEBUG
 	i = 0;
-	/* Debug code to validate some pre-requisites and reset done flag. */
+	/* Collect the purge nodes that will be used. */
 	for (thr = UT_LIST_GET_FIRST(purge_sys.query->thrs);
-	     thr != NULL && i < n_purge_threads;
+	     i < n_purge_threads;
 	     thr = UT_LIST_GET_NEXT(thrs, thr), ++i) {
 
 		purge_node_t*		node;
 
 		/* Get the purge node. */
 		node = (purge_node_t*) thr->child;
+		nodes[i] = node;
 
 		ut_ad(que_node_get_type(node) == QUE_NODE_PURGE);
 		ut_ad(node->undo_recs.empty());
@@ -1241,20 +1315,22 @@ trx_purge_attach_undo_recs(ulint n_purge_threads, THD *thd)
 		ut_d(node->in_progress = true);
 	}
 
-	/* There should never be fewer nodes than threads, the inverse
-	however is allowed because we only use purge threads as needed. */
-	ut_ad(i == n_purge_threads);
-#endif
-
 	/* Fetch and parse the UNDO records. The UNDO records are added
 	to a per purge node vector. */
-	thr = UT_LIST_GET_FIRST(purge_sys.query->thrs);
-
 	ut_ad(head <= purge_sys.tail);
 
 	i = 0;
 
-	std::unordered_map<table_id_t, purge_node_t*>
+	/** The assignment of a table to purge nodes */
+	struct purge_table_t {
+		/** index of the node of the first shard in nodes[]; or
+		ULINT_UNDEFINED if the table has not been assigned yet */
+		ulint base = ULINT_UNDEFINED;
+		/** number of shards */
+		ulint n_shards;
+	};
+
+	std::unordered_map<table_id_t, purge_table_t>
 		table_id_map(TRX_PURGE_TABLE_BUCKETS);
 	purge_sys.m_active = true;
 
@@ -1287,9 +1363,10 @@ trx_purge_attach_undo_recs(ulint n_purge_threads, THD *thd)
 		table_id_t table_id = trx_undo_rec_get_table_id(
 			purge_rec.undo_rec);
 
-		purge_node_t*& table_node = table_id_map[table_id];
+		purge_table_t& t = table_id_map[table_id];
+		purge_node_t* node;
 
-		if (!table_node) {
+		if (t.base == ULINT_UNDEFINED) {
 			std::pair<dict_table_t*,MDL_ticket*> p;
 			p.first = trx_purge_table_open(table_id, mdl_context,
 						       &p.second);
@@ -1298,26 +1375,60 @@ trx_purge_attach_undo_recs(ulint n_purge_threads, THD *thd)
 					table_id, thd, &p.second);
 			}
 
-			thr = UT_LIST_GET_NEXT(thrs, thr);
-
-			if (!(++i % n_purge_threads)) {
-				thr = UT_LIST_GET_FIRST(
-					purge_sys.query->thrs);
+			if (++i == n_purge_threads) {
+				i = 0;
 			}
 
-			table_node = static_cast<purge_node_t*>(thr->child);
-			ut_a(que_node_get_type(table_node) == QUE_NODE_PURGE);
+			t.base = i;
+			/* Distribute the records of the table among all
+			purge tasks, so that a single table that is being
+			modified heavily will not limit the throughput. */
+			t.n_shards = n_purge_threads > 1 && p.first
+				&& trx_purge_table_can_shard(*p.first)
+				? n_purge_threads : 1;
+			node = nodes[i];
 			ut_d(auto i=)
-			table_node->tables.emplace(table_id, p);
+			node->tables.emplace(table_id, p);
 			ut_ad(i.second);
-			if (p.first) {
-				goto enqueue;
+			if (!p.first) {
+				goto next;
+			}
+		} else {
+			node = nodes[t.base];
+			const dict_table_t* table
+				= node->tables[table_id].first;
+			if (!table) {
+				goto next;
+			}
+			if (t.n_shards > 1) {
+				ulint n = t.base + trx_purge_rec_shard(
+					purge_rec.undo_rec, *table,
+					t.n_shards);
+				node = nodes[n % n_purge_threads];
+			}
+			auto s = node->tables.find(table_id);
+			if (s == node->tables.end()) {
+				/* Open the table for this purge task. */
+				std::pair<dict_table_t*,MDL_ticket*> p;
+				p.first = trx_purge_table_open(
+					table_id, mdl_context, &p.second);
+				if (p.first
+				    == reinterpret_cast<dict_table_t*>(-1)) {
+					p.first = purge_sys.close_and_reopen(
+						table_id, thd, &p.second);
+				}
+				node->tables.emplace(table_id, p);
+				MONITOR_INC(MONITOR_PURGE_TABLE_SHARDS);
+				if (!p.first) {
+					goto next;
+				}
+			} else if (!s->second.first) {
+				goto next;
 			}
-		} else if (table_node->tables[table_id].first) {
-enqueue:
-			table_node->undo_recs.push(purge_rec);
 		}
 
+		node->undo_recs.push(purge_rec);
+next:
 		if (purge_sys.n_pages_handled() >= max_pages) {
 			break;
 		}
@@ -146,6 +146,10 @@ void trx_sys_t::create()
   m_initialised= true;
   trx_list.create();
   rw_trx_hash.init();
+  snapshot_cache.latch.init();
+  snapshot_cache.version= 0;
+  snapshot_cache.epoch= 0;
+  snapshot_cache.deregistered.store(0, std::memory_order_relaxed);
 }
 
 size_t trx_sys_t::history_size()
@@ -320,6 +324,7 @@ trx_sys_t::close()
 	}
 
 	rw_trx_hash.destroy();
+	snapshot_cache.latch.destroy();
 
 	/* There can't be any active transactions. */
 
@@ -571,7 +571,9 @@ Recover (repair)/ options (When using '--recover' or '--safe-recover'):\n\
 		      file would be very big.\n\
   -p, --parallel-recover\n\
                       Uses the same technique as '-r' and '-n', but creates\n\
-                      all the keys in parallel, in different threads.");
+                      all the keys in parallel, in different threads.\n\
+                      For BLOCK_RECORD tables this is only done together\n\
+                      with '-q'.");
   puts("\
   -o, --safe-recover  Uses old recovery method; Slower than '-r' but can\n \
 		      handle a couple of cases where '-r' reports that it\n\
@@ -1094,8 +1096,8 @@ static int maria_chk(HA_CHECK *param, char *filename)
       error= 1;
       goto end2;
     }
-    /* We can't do parallel repair with BLOCK_RECORD yet */
-    if (param->testflag & T_REP_PARALLEL)
+    /* Only the indexes of BLOCK_RECORD tables can be rebuilt in parallel */
+    if ((param->testflag & T_REP_PARALLEL) && !rep_quick)
     {
       param->testflag&= ~T_REP_PARALLEL;
       param->testflag|= T_REP_BY_SORT;
@@ -62,6 +62,7 @@ C_MODE_END
 #define THD_TRN (TRN*) thd_get_ha_data(thd, maria_hton)
 
 ulong pagecache_division_limit, pagecache_age_threshold, pagecache_file_hash_size;
+ulong pagecache_segments;
 ulonglong pagecache_buffer_size;
 const char *zerofill_error_msg=
   "Table is probably from another system and must be zerofilled or repaired ('REPAIR TABLE table_name') to be usable on this system";
@@ -258,6 +259,13 @@ static MYSQL_SYSVAR_ULONG(pagecache_file_hash_size, pagecache_file_hash_size,
        "value is probably 1/10 of number of possible open Aria files", 0,0,
        512, 128, 16384, 1);
 
+static MYSQL_SYSVAR_ULONG(pagecache_segments, pagecache_segments,
+       PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+       "Number of independent segments the Aria page cache is divided into. "
+       "Each segment has its own mutex, so a larger value lets more threads "
+       "use the page cache at the same time", 0, 0,
+       1, 1, 64, 1);
+
 static MYSQL_SYSVAR_SET(recover_options, maria_recover_options, PLUGIN_VAR_OPCMDARG,
        "Specifies how corrupted tables should be automatically repaired",
        NULL, NULL, HA_RECOVER_BACKUP|HA_RECOVER_QUICK, &maria_recover_typelib);
@@ -1730,9 +1738,10 @@ int ha_maria::repair(THD *thd, HA_CHECK *param, bool do_optimize)
       local_testflag |= T_STATISTICS;
       param->testflag |= T_STATISTICS;           // We get this for free
       statistics_done= 1;
-      /* TODO: Remove BLOCK_RECORD test when parallel works with blocks */
+      /* Only the indexes of BLOCK_RECORD tables can be rebuilt in parallel */
       if (THDVAR(thd,repair_threads) > 1 &&
-          share->data_file_type != BLOCK_RECORD)
+          (share->data_file_type != BLOCK_RECORD ||
+           ((param->testflag & T_QUICK) && !share->temporary)))
       {
         char buf[40];
         /* TODO: respect maria_repair_threads variable */
@@ -3979,10 +3988,11 @@ static int ha_maria_init(void *p)
   res= res ||
     ((force_start_after_recovery_failures != 0 && !aria_readonly) &&
      mark_recovery_start(log_dir)) ||
-    !init_pagecache(maria_pagecache,
-                    (size_t) pagecache_buffer_size, pagecache_division_limit,
-                    pagecache_age_threshold, maria_block_size, pagecache_file_hash_size,
-                    0) ||
+    !init_segmented_pagecache(maria_pagecache, (uint) pagecache_segments,
+                              (size_t) pagecache_buffer_size,
+                              pagecache_division_limit,
+                              pagecache_age_threshold, maria_block_size,
+                              pagecache_file_hash_size, 0) ||
     !init_pagecache(maria_log_pagecache,
                     TRANSLOG_PAGECACHE_SIZE, 0, 0,
                     TRANSLOG_PAGE_SIZE, 0, 0) ||
@@ -4107,6 +4117,7 @@ static struct st_mysql_sys_var *system_variables[]= {
   MYSQL_SYSVAR(pagecache_buffer_size),
   MYSQL_SYSVAR(pagecache_division_limit),
   MYSQL_SYSVAR(pagecache_file_hash_size),
+  MYSQL_SYSVAR(pagecache_segments),
   MYSQL_SYSVAR(recover_options),
   MYSQL_SYSVAR(repair_threads),
   MYSQL_SYSVAR(sort_buffer_size),
@@ -4231,14 +4242,29 @@ static void update_log_file_size(MYSQL_THD thd,
 }
 
 
+static SHOW_VAR pagecache_status_variables[]= {
+  {"blocks_not_flushed", (char*) &maria_pagecache_var.global_blocks_changed, SHOW_LONG},
+  {"blocks_unused",      (char*) &maria_pagecache_var.blocks_unused, SHOW_LONG},
+  {"blocks_used",        (char*) &maria_pagecache_var.blocks_used, SHOW_LONG},
+  {"read_requests",      (char*) &maria_pagecache_var.global_cache_r_requests, SHOW_LONGLONG},
+  {"reads",              (char*) &maria_pagecache_var.global_cache_read, SHOW_LONGLONG},
+  {"write_requests",     (char*) &maria_pagecache_var.global_cache_w_requests, SHOW_LONGLONG},
+  {"writes",             (char*) &maria_pagecache_var.global_cache_write, SHOW_LONGLONG},
+  {NullS, NullS, SHOW_LONG}
+};
+
+static int show_pagecache_vars(THD*, SHOW_VAR *var, void *,
+                               struct system_status_var *,
+                               enum enum_var_type)
+{
+  pagecache_update_stats(maria_pagecache);
+  var->type= SHOW_ARRAY;
+  var->value= (char*) &pagecache_status_variables;
+  return 0;
+}
+
 static SHOW_VAR status_variables[]= {
-  {"pagecache_blocks_not_flushed", (char*) &maria_pagecache_var.global_blocks_changed, SHOW_LONG},
-  {"pagecache_blocks_unused",      (char*) &maria_pagecache_var.blocks_unused, SHOW_LONG},
-  {"pagecache_blocks_used",        (char*) &maria_pagecache_var.blocks_used, SHOW_LONG},
-  {"pagecache_read_requests",      (char*) &maria_pagecache_var.global_cache_r_requests, SHOW_LONGLONG},
-  {"pagecache_reads",              (char*) &maria_pagecache_var.global_cache_read, SHOW_LONGLONG},
-  {"pagecache_write_requests",     (char*) &maria_pagecache_var.global_cache_w_requests, SHOW_LONGLONG},
-  {"pagecache_writes",             (char*) &maria_pagecache_var.global_cache_write, SHOW_LONGLONG},
+  SHOW_FUNC_ENTRY("pagecache", &show_pagecache_vars),
   {"transaction_log_syncs",        (char*) &translog_syncs, SHOW_LONGLONG},
   {NullS, NullS, SHOW_LONG}
 };
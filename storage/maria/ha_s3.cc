@@ -81,7 +81,8 @@ static PAGECACHE s3_pagecache;
 static ulong s3_block_size, s3_protocol_version;
 static ulong s3_pagecache_division_limit, s3_pagecache_age_threshold;
 static ulong s3_pagecache_file_hash_size;
-static ulonglong s3_pagecache_buffer_size;
+static ulonglong s3_pagecache_buffer_size, s3_block_cache_size;
+static char *s3_block_cache_path;
 static char *s3_bucket, *s3_access_key=0, *s3_secret_key=0, *s3_region;
 static char *s3_host_name;
 static int s3_port;
@@ -151,6 +152,19 @@ static MYSQL_SYSVAR_ULONG(block_size, s3_block_size,
        "Block size for S3", 0, 0,
        4*1024*1024, 65536, 16*1024*1024, 8192);
 
+static MYSQL_SYSVAR_STR(block_cache_path, s3_block_cache_path,
+       PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+       "Directory for a local disk cache of blocks read from S3. Blocks "
+       "in the cache are not fetched again from S3, also after a restart. "
+       "If not set, no local cache is used",
+       0, 0, "");
+
+static MYSQL_SYSVAR_ULONGLONG(block_cache_size, s3_block_cache_size,
+       PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
+       "Maximum size of the local disk cache of S3 blocks. The least "
+       "recently used blocks are removed when the cache is full", 0, 0,
+       1024*1024*1024, 0, ~(ulonglong) 0, 1024*1024);
+
 static MYSQL_SYSVAR_BOOL(debug, s3_debug,
        PLUGIN_VAR_RQCMDARG,
       "Generates trace file from libmarias3 on stderr for debugging",
@@ -754,6 +768,7 @@ static int s3_hton_panic(handlerton *hton, ha_panic_function flag)
   if (flag == HA_PANIC_CLOSE && s3_hton)
   {
     end_pagecache(&s3_pagecache, TRUE);
+    s3_block_cache_end();
     s3_deinit_library();
     my_free(s3_access_key);
     my_free(s3_secret_key);
@@ -1077,6 +1092,10 @@ static int ha_s3_init(void *p)
   s3_init_library();
   if (s3_debug)
     ms3_debug(1);
+  if (s3_block_cache_init(s3_block_cache_path, s3_block_cache_size))
+    sql_print_warning("S3: Can't use '%s' for s3_block_cache_path, "
+                      "errno: %d. Blocks are not cached on local disk",
+                      s3_block_cache_path, my_errno);
 
   struct s3_func s3f_real =
   {
@@ -1096,6 +1115,10 @@ static int ha_s3_deinit(void*)
 }
 
 static SHOW_VAR status_variables[]= {
+  {"block_cache_hits",
+   (char*) &s3_block_cache_hits, SHOW_LONGLONG},
+  {"block_cache_misses",
+   (char*) &s3_block_cache_misses, SHOW_LONGLONG},
   {"pagecache_blocks_not_flushed",
    (char*) &s3_pagecache.global_blocks_changed, SHOW_LONG},
   {"pagecache_blocks_unused",
@@ -1111,6 +1134,8 @@ static SHOW_VAR status_variables[]= {
 
 
 static struct st_mysql_sys_var* system_variables[]= {
+  MYSQL_SYSVAR(block_cache_path),
+  MYSQL_SYSVAR(block_cache_size),
   MYSQL_SYSVAR(block_size),
   MYSQL_SYSVAR(debug),
   MYSQL_SYSVAR(protocol_version),
@@ -6424,13 +6424,15 @@ uint _ma_apply_redo_insert_row_head_or_tail(MARIA_HA *info, LSN lsn,
     lock_method= PAGECACHE_LOCK_LEFT_WRITELOCKED;
     pin_method=  PAGECACHE_PIN_LEFT_PINNED;
 
-    share->pagecache->readwrite_flags&= ~MY_WME;
+    pagecache_set_readwrite_flags(share->pagecache,
+                                  share->pagecache->readwrite_flags & ~MY_WME);
     share->silence_encryption_errors= 1;
     buff= pagecache_read(share->pagecache, &info->dfile,
                          page, 0, 0,
                          PAGECACHE_PLAIN_PAGE, PAGECACHE_LOCK_WRITE,
                          &page_link.link);
-    share->pagecache->readwrite_flags= share->pagecache->org_readwrite_flags;
+    pagecache_set_readwrite_flags(share->pagecache,
+                                  share->pagecache->org_readwrite_flags);
     share->silence_encryption_errors= 0;
     if (!buff)
     {
@@ -6928,15 +6930,17 @@ uint _ma_apply_redo_insert_row_blobs(MARIA_HA *info,
         }
         else
         {
-          share->pagecache->readwrite_flags&= ~MY_WME;
+          pagecache_set_readwrite_flags(share->pagecache,
+                                        share->pagecache->readwrite_flags &
+                                        ~MY_WME);
           share->silence_encryption_errors= 1;
           buff= pagecache_read(share->pagecache,
                                &info->dfile,
                                page, 0, 0,
                                PAGECACHE_PLAIN_PAGE,
                                PAGECACHE_LOCK_WRITE, &page_link.link);
-          share->pagecache->readwrite_flags= share->pagecache->
-            org_readwrite_flags;
+          pagecache_set_readwrite_flags(share->pagecache,
+                                        share->pagecache->org_readwrite_flags);
           share->silence_encryption_errors= 0;
           if (!buff)
           {
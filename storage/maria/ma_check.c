@@ -4286,6 +4286,11 @@ int maria_repair_by_sort(HA_CHECK *param, register MARIA_HA *info,
     Each key is handled by a separate thread.
     TODO: make a number of threads a parameter
 
+    For BLOCK_RECORD tables only quick repair is done in parallel. Every
+    thread scans the data file through its own handler, so the data file
+    is read through the page cache once for all indexes instead of once
+    per index as in maria_repair_by_sort.
+
     In parallel repair we use one thread per index. There are two modes:
 
     Quick
@@ -4334,9 +4339,20 @@ int maria_repair_parallel(HA_CHECK *param, register MARIA_HA *info,
   pthread_attr_t thr_attr;
   myf sync_dir= ((share->now_transactional && !share->temporary) ?
                  MY_SYNC_DIR : 0);
-  my_bool reenable_logging= 0;
+  my_bool reenable_logging= 0, restore_page_type= 0;
+  enum pagecache_page_type UNINIT_VAR(save_page_type);
   DBUG_ENTER("maria_repair_parallel");
 
+  /*
+    A BLOCK_RECORD data file can't be rebuilt in parallel. Temporary
+    tables are private to the connection and are not scanned in parallel.
+  */
+  if ((share->data_file_type == BLOCK_RECORD &&
+       (!rep_quick || share->temporary)) ||
+      ((param->testflag & T_UNPACK) &&
+       share->state.header.org_data_file_type == BLOCK_RECORD))
+    DBUG_RETURN(maria_repair_by_sort(param, info, name, rep_quick));
+
   got_error= 1;
   new_file= -1;
   start_records= share->state.state.records;
@@ -4576,6 +4592,29 @@ int maria_repair_parallel(HA_CHECK *param, register MARIA_HA *info,
   if (!maria_ftparser_alloc_param(info))
     goto err;
 
+  if (share->data_file_type == BLOCK_RECORD)
+  {
+    /*
+      The scan state of a handler can't be shared between threads, so
+      every thread gets its own handler. See sort_get_next_record() for
+      why the UNKNOWN page type is used.
+    */
+    share->state.state.data_file_length= sort_info.filelength;
+    save_page_type= share->page_type;
+    share->page_type= PAGECACHE_READ_UNKNOWN_PAGE;
+    restore_page_type= 1;
+    for (i=0 ; i < sort_info.total_keys ; i++)
+    {
+      if (!(sort_param[i].scan_info= maria_clone(share, O_RDONLY)) ||
+          maria_scan_init(sort_param[i].scan_info))
+      {
+        _ma_check_print_error(param, "Can't open table for parallel scan, "
+                              "error: %d", my_errno);
+        goto err;
+      }
+    }
+  }
+
   sort_info.got_error=0;
   mysql_mutex_lock(&sort_info.mutex);
 
@@ -4585,7 +4624,7 @@ int maria_repair_parallel(HA_CHECK *param, register MARIA_HA *info,
     the cache lock, the writer copies the write cache contents to the
     read caches.
   */
-  if (i > 1)
+  if (i > 1 && share->data_file_type != BLOCK_RECORD)
   {
     if (rep_quick)
       init_io_cache_share(&param->read_cache, &io_share, NULL, i);
@@ -4776,6 +4815,19 @@ int maria_repair_parallel(HA_CHECK *param, register MARIA_HA *info,
   */
   if (!rep_quick && my_b_inited(&new_data_cache))
     end_io_cache(&new_data_cache);
+  if (sort_param)
+  {
+    for (i=0 ; i < share->base.keys ; i++)
+    {
+      if (sort_param[i].scan_info)
+      {
+        maria_scan_end(sort_param[i].scan_info);
+        maria_close(sort_param[i].scan_info);
+      }
+    }
+  }
+  if (restore_page_type)
+    share->page_type= save_page_type;
   if (!got_error)
   {
     /* Replace the actual file with the temporary file */
@@ -4963,7 +5015,8 @@ static int sort_get_next_record(MARIA_SORT_PARAM *sort_param)
   MARIA_BLOCK_INFO block_info;
   MARIA_SORT_INFO *sort_info=sort_param->sort_info;
   HA_CHECK *param=sort_info->param;
-  MARIA_HA *info=sort_info->info;
+  MARIA_HA *info= (sort_param->scan_info ? sort_param->scan_info :
+                   sort_info->info);
   MARIA_SHARE *share= info->s;
   char llbuff[22],llbuff2[22];
   DBUG_ENTER("sort_get_next_record");
@@ -4989,10 +5042,13 @@ static int sort_get_next_record(MARIA_SORT_PARAM *sort_param)
         type is PLAIN); page cache would assert if it finds a cached LSN page
         while _ma_scan_block_record() requested a PLAIN page. So we use
         UNKNOWN.
+        In parallel repair this is done by maria_repair_parallel() for
+        all threads.
       */
       enum pagecache_page_type save_page_type= share->page_type;
-      share->page_type= PAGECACHE_READ_UNKNOWN_PAGE;
-      if (info != sort_info->new_info)
+      if (!sort_param->scan_info)
+        share->page_type= PAGECACHE_READ_UNKNOWN_PAGE;
+      if (sort_info->info != sort_info->new_info)
       {
         /* Safe scanning */
         flag= _ma_safe_scan_block_record(sort_info, info,
@@ -5004,11 +5060,14 @@ static int sort_get_next_record(MARIA_SORT_PARAM *sort_param)
           Scan on clean table.
           It requires a reliable data_file_length so we set it.
         */
-        share->state.state.data_file_length= sort_info->filelength;
+        if (!sort_param->scan_info)
+          share->state.state.data_file_length= sort_info->filelength;
         info->cur_row.trid= 0;
         flag= _ma_scan_block_record(info, sort_param->record,
                                     info->cur_row.nextpos, 1);
-        set_if_bigger(param->max_found_trid, info->cur_row.trid);
+        /* All threads see the same rows */
+        if (sort_param->master)
+          set_if_bigger(param->max_found_trid, info->cur_row.trid);
         if (info->cur_row.trid > param->max_trid)
         {
           _ma_check_print_not_visible_error(param, info->cur_row.trid);
@@ -5018,7 +5077,8 @@ static int sort_get_next_record(MARIA_SORT_PARAM *sort_param)
       param->progress= (ma_recordpos_to_page(info->cur_row.lastpos)*
                         share->block_size);
 
-      share->page_type= save_page_type;
+      if (!sort_param->scan_info)
+        share->page_type= save_page_type;
       if (!flag)
       {
 	if (sort_param->calc_checksum)
@@ -569,8 +569,7 @@ pthread_handler_t ma_checkpoint_background(void *arg)
   size_t sleeps, sleep_time;
   TRANSLOG_ADDRESS log_horizon_at_last_checkpoint=
     translog_get_horizon();
-  ulonglong pagecache_flushes_at_last_checkpoint=
-    maria_pagecache->global_cache_write;
+  ulonglong pagecache_flushes_at_last_checkpoint;
   uint UNINIT_VAR(pages_bunch_size);
   struct st_filter_param filter_param;
   PAGECACHE_FILE *UNINIT_VAR(dfile); /**< data file currently being flushed */
@@ -582,6 +581,8 @@ pthread_handler_t ma_checkpoint_background(void *arg)
   DBUG_ASSERT(interval > 0);
 
   PSI_CALL_set_thread_account(0,0,0,0);
+  pagecache_update_stats(maria_pagecache);
+  pagecache_flushes_at_last_checkpoint= maria_pagecache->global_cache_write;
 
   /*
     Recovery ended with all tables closed and a checkpoint: no need to take
@@ -622,6 +623,7 @@ pthread_handler_t ma_checkpoint_background(void *arg)
           want to checkpoint every minute, hence the positive
           maria_checkpoint_min_activity.
         */
+        pagecache_update_stats(maria_pagecache);
         if ((ulonglong) (horizon - log_horizon_at_last_checkpoint) <=
             maria_checkpoint_min_log_activity &&
             ((ulonglong) (maria_pagecache->global_cache_write -
@@ -643,6 +645,7 @@ pthread_handler_t ma_checkpoint_background(void *arg)
           below is possibly greater than last_checkpoint_lsn.
         */
         log_horizon_at_last_checkpoint= translog_get_horizon();
+        pagecache_update_stats(maria_pagecache);
         pagecache_flushes_at_last_checkpoint=
           maria_pagecache->global_cache_write;
         /*
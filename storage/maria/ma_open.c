@@ -249,6 +249,41 @@ static MARIA_HA *maria_clone_internal(MARIA_SHARE *share,
 } /* maria_clone_internal */
 
 
+/*
+  Create a new handler for an already open table
+
+  SYNOPSIS
+    maria_clone()
+    share	Table to create a handler for
+    mode	O_RDONLY or O_RDWR
+
+  NOTES
+    Used by parallel repair, where every thread needs its own scan
+    position in the data file.
+
+ RETURN
+    #   Maria handler
+    0   Error
+*/
+
+MARIA_HA *maria_clone(MARIA_SHARE *share, int mode)
+{
+  MARIA_HA *new_info;
+  my_bool internal_table= share->internal_table;
+  DBUG_ENTER("maria_clone");
+
+  if (!internal_table)
+    mysql_mutex_lock(&THR_LOCK_maria);
+  new_info= maria_clone_internal(share, mode,
+                                 (share->data_file_type == BLOCK_RECORD ?
+                                  share->bitmap.file.file : -1),
+                                 internal_table, 0);
+  if (!internal_table)
+    mysql_mutex_unlock(&THR_LOCK_maria);
+  DBUG_RETURN(new_info);
+}
+
+
 /******************************************************************************
   open a MARIA table
 
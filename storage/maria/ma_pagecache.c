@@ -944,6 +944,134 @@ size_t init_pagecache(PAGECACHE *pagecache, size_t use_mem,
 }
 
 
+/*
+  Initialize a page cache that is divided into independent segments
+
+  SYNOPSIS
+    init_segmented_pagecache()
+    pagecache			pointer to a page cache data structure
+    segments			number of segments; 0 or 1 gives a plain cache
+    use_mem                     total memory to use for all segments
+    (other arguments as for init_pagecache())
+
+  RETURN VALUE
+    number of blocks in all segments, if successful,
+    0 - otherwise.
+
+  NOTES.
+    Each segment is a complete page cache with its own cache_lock, LRU
+    chain and hash tables. A page is always cached in the segment chosen
+    by pagecache_segment() from its file and page number, so threads that
+    work on different pages seldom wait for each other. The functions that
+    take a file and a page number, or a block, are forwarded to the segment;
+    the functions that work on a whole file or the whole cache are run for
+    every segment.
+*/
+
+size_t init_segmented_pagecache(PAGECACHE *pagecache, uint segments,
+                                size_t use_mem, uint division_limit,
+                                uint age_threshold, uint block_size,
+                                uint changed_blocks_hash_size,
+                                myf my_readwrite_flags)
+{
+  size_t blocks= 0;
+  uint i;
+  DBUG_ENTER("init_segmented_pagecache");
+
+  /* Don't make the segments too small to be useful */
+  while (segments > 1 && use_mem / segments < (size_t) block_size * 16)
+    segments--;
+  if (segments <= 1)
+  {
+    pagecache->segments= 0;
+    DBUG_RETURN(init_pagecache(pagecache, use_mem, division_limit,
+                               age_threshold, block_size,
+                               changed_blocks_hash_size, my_readwrite_flags));
+  }
+  if (pagecache->inited && pagecache->disk_blocks > 0)
+  {
+    DBUG_PRINT("warning",("key cache already in use"));
+    DBUG_RETURN(0);
+  }
+
+  if (!(pagecache->segment= (PAGECACHE*)
+        my_malloc(PSI_INSTRUMENT_ME, sizeof(PAGECACHE) * segments,
+                  MYF(MY_WME | MY_ZEROFILL))))
+    DBUG_RETURN(0);
+
+  pagecache->mem_size= 0;
+  for (i= 0; i < segments; i++)
+  {
+    size_t segment_blocks;
+    if (!(segment_blocks= init_pagecache(pagecache->segment + i,
+                                         use_mem / segments,
+                                         division_limit, age_threshold,
+                                         block_size,
+                                         changed_blocks_hash_size / segments,
+                                         my_readwrite_flags)))
+    {
+      int error= my_errno;
+      while (i--)
+        end_pagecache(pagecache->segment + i, 1);
+      my_free(pagecache->segment);
+      pagecache->segment= NULL;
+      my_errno= error;
+      DBUG_RETURN(0);
+    }
+    blocks+= segment_blocks;
+    pagecache->mem_size+= pagecache->segment[i].mem_size;
+  }
+
+  pagecache->big_block_read= NULL;
+  pagecache->big_block_free= NULL;
+  pagecache->segments= segments;
+  pagecache->block_size= block_size;
+  pagecache->shift= my_bit_log2_uint64(block_size);
+  pagecache->readwrite_flags= pagecache->segment->readwrite_flags;
+  pagecache->org_readwrite_flags= pagecache->readwrite_flags;
+  pagecache->disk_blocks= pagecache->blocks= pagecache->blocks_unused= blocks;
+  pagecache->blocks_used= pagecache->blocks_changed= 0;
+  pagecache->global_blocks_changed= 0;
+  pagecache->global_cache_w_requests= pagecache->global_cache_r_requests= 0;
+  pagecache->global_cache_read= pagecache->global_cache_write= 0;
+  pagecache->inited= 1;
+  pagecache->in_init= 0;
+  pagecache->can_be_used= 1;
+  DBUG_RETURN(blocks);
+}
+
+
+/*
+  Get the segment of a segmented page cache that caches a page
+*/
+
+static inline PAGECACHE *pagecache_segment(PAGECACHE *pagecache,
+                                           PAGECACHE_FILE *file,
+                                           pgcache_page_no_t pageno)
+{
+  DBUG_ASSERT(pagecache->segments);
+  return pagecache->segment + (uint) ((pageno + (ulong) file->file) %
+                                      pagecache->segments);
+}
+
+
+/*
+  Get the segment of a segmented page cache that a block belongs to
+
+  The block is pinned or locked by the caller, so its hash_link is stable.
+*/
+
+static inline PAGECACHE *pagecache_block_segment(PAGECACHE *pagecache,
+                                                 PAGECACHE_BLOCK_LINK *block)
+{
+  PAGECACHE *segment= pagecache_segment(pagecache, &block->hash_link->file,
+                                        block->hash_link->pageno);
+  DBUG_ASSERT(block >= segment->block_root &&
+              block < segment->block_root + segment->disk_blocks);
+  return segment;
+}
+
+
 /*
   Flush all blocks in the key cache to disk
 */
@@ -1133,6 +1261,14 @@ void change_pagecache_param(PAGECACHE *pagecache, uint division_limit,
 {
   DBUG_ENTER("change_pagecache_param");
 
+  if (pagecache->segments)
+  {
+    uint i;
+    for (i= 0; i < pagecache->segments; i++)
+      change_pagecache_param(pagecache->segment + i, division_limit,
+                             age_threshold);
+    DBUG_VOID_RETURN;
+  }
   pagecache_pthread_mutex_lock(&pagecache->cache_lock);
   if (division_limit)
     pagecache->min_warm_blocks= (pagecache->disk_blocks *
@@ -1196,6 +1332,23 @@ void end_pagecache(PAGECACHE *pagecache, my_bool cleanup)
   if (!pagecache->inited)
     DBUG_VOID_RETURN;
 
+  if (pagecache->segments)
+  {
+    uint i;
+    for (i= 0; i < pagecache->segments; i++)
+      end_pagecache(pagecache->segment + i, cleanup);
+    pagecache->disk_blocks= -1;
+    pagecache->blocks_changed= 0;
+    if (cleanup)
+    {
+      my_free(pagecache->segment);
+      pagecache->segment= NULL;
+      pagecache->segments= 0;
+      pagecache->inited= pagecache->can_be_used= 0;
+    }
+    DBUG_VOID_RETURN;
+  }
+
   if (pagecache->disk_blocks > 0)
   {
 #ifndef DBUG_OFF
@@ -3215,6 +3368,8 @@ void pagecache_unlock(PAGECACHE *pagecache,
   PAGECACHE_BLOCK_LINK *block;
   int page_st;
   DBUG_ENTER("pagecache_unlock");
+  if (pagecache->segments)
+    pagecache= pagecache_segment(pagecache, file, pageno);
   DBUG_PRINT("enter", ("fd: %u  page: %lu  %s  %s",
                        (uint) file->file, (ulong) pageno,
                        page_cache_page_lock_str[lock],
@@ -3309,6 +3464,8 @@ void pagecache_unpin(PAGECACHE *pagecache,
   PAGECACHE_BLOCK_LINK *block;
   int page_st;
   DBUG_ENTER("pagecache_unpin");
+  if (pagecache->segments)
+    pagecache= pagecache_segment(pagecache, file, pageno);
   DBUG_PRINT("enter", ("fd: %u  page: %lu",
                        (uint) file->file, (ulong) pageno));
   pagecache_pthread_mutex_lock(&pagecache->cache_lock);
@@ -3386,6 +3543,8 @@ void pagecache_unlock_by_link(PAGECACHE *pagecache,
                               my_bool any)
 {
   DBUG_ENTER("pagecache_unlock_by_link");
+  if (pagecache->segments)
+    pagecache= pagecache_block_segment(pagecache, block);
   DBUG_PRINT("enter", ("block: %p  fd: %u  page: %lu  changed: %d  %s  %s",
                        block, (uint) block->hash_link->file.file,
                        (ulong) block->hash_link->pageno, was_changed,
@@ -3497,6 +3656,8 @@ void pagecache_unpin_by_link(PAGECACHE *pagecache,
                              LSN lsn)
 {
   DBUG_ENTER("pagecache_unpin_by_link");
+  if (pagecache->segments)
+    pagecache= pagecache_block_segment(pagecache, block);
   DBUG_PRINT("enter", ("block: %p  fd: %u page: %lu",
                        block, (uint) block->hash_link->file.file,
                        (ulong) block->hash_link->pageno));
@@ -3721,6 +3882,8 @@ uchar *pagecache_read(PAGECACHE *pagecache,
   char llbuf[22];
 #endif
   DBUG_ENTER("pagecache_read");
+  if (pagecache->segments)
+    pagecache= pagecache_segment(pagecache, file, pageno);
   DBUG_PRINT("enter", ("fd: %u  page: %s  buffer: %p  level: %u  "
                        "t:%s  (%d)%s->%s  %s->%s  big block: %d",
                        (uint) file->file, ullstr(pageno, llbuf),
@@ -4087,6 +4250,8 @@ my_bool pagecache_delete_by_link(PAGECACHE *pagecache,
   my_bool error= 0;
   enum pagecache_page_pin pin= PAGECACHE_PIN_LEFT_PINNED;
   DBUG_ENTER("pagecache_delete_by_link");
+  if (pagecache->segments)
+    pagecache= pagecache_block_segment(pagecache, block);
   DBUG_PRINT("enter", ("fd: %d block %p  %s  %s",
                        block->hash_link->file.file,
                        block,
@@ -4201,6 +4366,8 @@ my_bool pagecache_delete(PAGECACHE *pagecache,
   my_bool error= 0;
   enum pagecache_page_pin pin= lock_to_pin_one_phase[lock];
   DBUG_ENTER("pagecache_delete");
+  if (pagecache->segments)
+    pagecache= pagecache_segment(pagecache, file, pageno);
   DBUG_PRINT("enter", ("fd: %u  page: %lu  %s  %s",
                        (uint) file->file, (ulong) pageno,
                        page_cache_page_lock_str[lock],
@@ -4382,6 +4549,8 @@ my_bool pagecache_write_part(PAGECACHE *pagecache,
   char llbuf[22];
 #endif
   DBUG_ENTER("pagecache_write_part");
+  if (pagecache->segments)
+    pagecache= pagecache_segment(pagecache, file, pageno);
   DBUG_PRINT("enter", ("fd: %u  page: %s  level: %u  type: %s  lock: %s  "
                        "pin: %s   mode: %s  offset: %u  size %u",
                        (uint) file->file, ullstr(pageno, llbuf), level,
@@ -5233,6 +5402,14 @@ int flush_pagecache_blocks_with_filter(PAGECACHE *pagecache,
 
   if (pagecache->disk_blocks <= 0)
     DBUG_RETURN(0);
+  if (pagecache->segments)
+  {
+    uint i;
+    for (i= 0, res= 0; i < pagecache->segments; i++)
+      res|= flush_pagecache_blocks_with_filter(pagecache->segment + i, file,
+                                               type, filter, filter_arg);
+    DBUG_RETURN(res);
+  }
   pagecache_pthread_mutex_lock(&pagecache->cache_lock);
   inc_counter_for_resize_op(pagecache);
   res= flush_pagecache_blocks_int(pagecache, file, type, filter, filter_arg);
@@ -5269,6 +5446,12 @@ int reset_pagecache_counters(const char *name __attribute__((unused)),
   }
   DBUG_PRINT("info", ("Resetting counters for key cache %s.", name));
 
+  if (pagecache->segments)
+  {
+    uint i;
+    for (i= 0; i < pagecache->segments; i++)
+      reset_pagecache_counters(name, pagecache->segment + i);
+  }
   pagecache->global_blocks_changed= 0;   /* Key_blocks_not_flushed */
   pagecache->global_cache_r_requests= 0; /* Key_read_requests */
   pagecache->global_cache_read= 0;       /* Key_reads */
@@ -5278,6 +5461,64 @@ int reset_pagecache_counters(const char *name __attribute__((unused)),
 }
 
 
+/*
+  Update the statistics of a segmented page cache
+
+  SYNOPSIS
+    pagecache_update_stats()
+    pagecache  pointer to the pagecache
+
+  DESCRIPTION
+    The segments of a segmented cache keep their own counters. This sums
+    them into the counters of 'pagecache', which are the ones shown to
+    the user. Nothing is done for a cache that is not segmented.
+*/
+
+void pagecache_update_stats(PAGECACHE *pagecache)
+{
+  size_t blocks_used= 0, blocks_unused= 0, blocks_changed= 0;
+  ulonglong w_requests= 0, writes= 0, r_requests= 0, reads= 0;
+  uint i;
+
+  for (i= 0; i < pagecache->segments; i++)
+  {
+    PAGECACHE *segment= pagecache->segment + i;
+    blocks_used+=    segment->blocks_used;
+    blocks_unused+=  segment->blocks_unused;
+    blocks_changed+= segment->global_blocks_changed;
+    w_requests+=     segment->global_cache_w_requests;
+    writes+=         segment->global_cache_write;
+    r_requests+=     segment->global_cache_r_requests;
+    reads+=          segment->global_cache_read;
+  }
+  if (pagecache->segments)
+  {
+    pagecache->blocks_used= blocks_used;
+    pagecache->blocks_unused= blocks_unused;
+    pagecache->global_blocks_changed= blocks_changed;
+    pagecache->global_cache_w_requests= w_requests;
+    pagecache->global_cache_write= writes;
+    pagecache->global_cache_r_requests= r_requests;
+    pagecache->global_cache_read= reads;
+  }
+}
+
+
+/*
+  Change the flags used for pread/pwrite() of a page cache
+
+  Only used during recovery, when there is no concurrent access.
+*/
+
+void pagecache_set_readwrite_flags(PAGECACHE *pagecache, myf flags)
+{
+  uint i;
+  pagecache->readwrite_flags= flags;
+  for (i= 0; i < pagecache->segments; i++)
+    pagecache->segment[i].readwrite_flags= flags;
+}
+
+
 /**
    @brief Allocates a buffer and stores in it some info about all dirty pages
 
@@ -5298,6 +5539,10 @@ int reset_pagecache_counters(const char *name __attribute__((unused)),
      @retval 1      Error
 */
 
+static my_bool collect_changed_blocks_of_segments(PAGECACHE *pagecache,
+                                                  LEX_STRING *str,
+                                                  LSN *min_rec_lsn);
+
 my_bool pagecache_collect_changed_blocks_with_lsn(PAGECACHE *pagecache,
                                                   LEX_STRING *str,
                                                   LSN *min_rec_lsn)
@@ -5310,6 +5555,9 @@ my_bool pagecache_collect_changed_blocks_with_lsn(PAGECACHE *pagecache,
   DBUG_ENTER("pagecache_collect_changed_blocks_with_LSN");
 
   DBUG_ASSERT(NULL == str->str);
+  if (pagecache->segments)
+    DBUG_RETURN(collect_changed_blocks_of_segments(pagecache, str,
+                                                   min_rec_lsn));
   /*
     We lock the entire cache but will be quick, just reading/writing a few MBs
     of memory at most.
@@ -5432,6 +5680,63 @@ my_bool pagecache_collect_changed_blocks_with_lsn(PAGECACHE *pagecache,
 }
 
 
+/**
+   @brief Collect the dirty pages of all segments of a segmented page cache
+
+   Every segment is scanned under its own cache_lock, and the lists are
+   concatenated into one list in the format of
+   pagecache_collect_changed_blocks_with_lsn().
+*/
+
+static my_bool collect_changed_blocks_of_segments(PAGECACHE *pagecache,
+                                                  LEX_STRING *str,
+                                                  LSN *min_rec_lsn)
+{
+  LEX_STRING *lists;
+  LSN minimum_rec_lsn= LSN_MAX;
+  ulonglong stored_list_size= 0;
+  char *ptr;
+  uint i;
+  my_bool error= 1;
+  DBUG_ENTER("collect_changed_blocks_of_segments");
+
+  if (!(lists= (LEX_STRING*) my_malloc(PSI_INSTRUMENT_ME,
+                                       sizeof(*lists) * pagecache->segments,
+                                       MYF(MY_WME | MY_ZEROFILL))))
+    DBUG_RETURN(1);
+  str->length= 8;
+  for (i= 0; i < pagecache->segments; i++)
+  {
+    LSN lsn;
+    if (pagecache_collect_changed_blocks_with_lsn(pagecache->segment + i,
+                                                  lists + i, &lsn))
+      goto end;
+    stored_list_size+= uint8korr(lists[i].str);
+    str->length+= lists[i].length - 8;
+    if (cmp_translog_addr(lsn, minimum_rec_lsn) < 0)
+      minimum_rec_lsn= lsn;
+  }
+  if (!(str->str= my_malloc(PSI_INSTRUMENT_ME, str->length, MYF(MY_WME))))
+    goto end;
+  ptr= str->str;
+  int8store(ptr, stored_list_size);
+  ptr+= 8;
+  for (i= 0; i < pagecache->segments; i++)
+  {
+    memcpy(ptr, lists[i].str + 8, lists[i].length - 8);
+    ptr+= lists[i].length - 8;
+  }
+  *min_rec_lsn= minimum_rec_lsn;
+  error= 0;
+
+end:
+  for (i= 0; i < pagecache->segments; i++)
+    my_free(lists[i].str);
+  my_free(lists);
+  DBUG_RETURN(error);
+}
+
+
 #ifndef DBUG_OFF
 
 /**
@@ -5442,6 +5747,13 @@ void pagecache_file_no_dirty_page(PAGECACHE *pagecache, PAGECACHE_FILE *file)
 {
   File fd= file->file;
   PAGECACHE_BLOCK_LINK *block;
+  if (pagecache->segments)
+  {
+    uint i;
+    for (i= 0; i < pagecache->segments; i++)
+      pagecache_file_no_dirty_page(pagecache->segment + i, file);
+    return;
+  }
   for (block= pagecache->changed_blocks[FILE_HASH(*file, pagecache)];
        block != NULL;
        block= block->next_changed)
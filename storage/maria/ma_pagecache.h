@@ -218,6 +218,12 @@ typedef struct st_pagecache
   my_bool in_init;		/* Set to 1 in MySQL during init/resize     */
   my_bool extra_debug;	        /* set to 1 if one wants extra logging */
   HASH    files_in_flush;       /**< files in flush_pagecache_blocks_int() */
+  /*
+    Number of independent caches that the pages are divided between,
+    or 0 if the pages are kept in this cache (see init_segmented_pagecache())
+  */
+  uint segments;
+  struct st_pagecache *segment;  /* array of 'segments' page caches */
 } PAGECACHE;
 
 /** @brief Return values for PAGECACHE_FLUSH_FILTER */
@@ -240,6 +246,11 @@ extern size_t init_pagecache(PAGECACHE *pagecache, size_t use_mem,
                             uint division_limit, uint age_threshold,
                             uint block_size, uint changed_blocks_hash_size,
                             myf my_read_flags)__attribute__((visibility("default"))) ;
+extern size_t init_segmented_pagecache(PAGECACHE *pagecache, uint segments,
+                                       size_t use_mem, uint division_limit,
+                                       uint age_threshold, uint block_size,
+                                       uint changed_blocks_hash_size,
+                                       myf my_read_flags);
 extern size_t resize_pagecache(PAGECACHE *pagecache,
                               size_t use_mem, uint division_limit,
                               uint age_threshold, uint changed_blocks_hash_size);
@@ -340,6 +351,8 @@ extern my_bool pagecache_collect_changed_blocks_with_lsn(PAGECACHE *pagecache,
                                                          LEX_STRING *str,
                                                          LSN *min_lsn);
 extern int reset_pagecache_counters(const char *name, PAGECACHE *pagecache);
+extern void pagecache_update_stats(PAGECACHE *pagecache);
+extern void pagecache_set_readwrite_flags(PAGECACHE *pagecache, myf flags);
 extern uchar *pagecache_block_link_to_buffer(PAGECACHE_BLOCK_LINK *block);
 
 extern uint pagecache_pagelevel(PAGECACHE_BLOCK_LINK *block);
@@ -389,6 +389,8 @@ typedef struct st_maria_sort_param
   
   MARIA_KEYDEF *keyinfo;
   MARIA_SORT_INFO *sort_info;
+  /* Own handler for scanning BLOCK_RECORD data in parallel repair */
+  struct st_maria_handler *scan_info;
   HA_KEYSEG *seg;
   uchar **sort_keys;
   uchar *rec_buff;
@@ -1688,6 +1690,7 @@ int _ma_def_scan_restore_pos(MARIA_HA *info, MARIA_RECORD_POS lastpos);
 #include "ma_commit.h"
 
 extern MARIA_HA *_ma_test_if_reopen(const char *filename);
+extern MARIA_HA *maria_clone(MARIA_SHARE *share, int mode);
 my_bool _ma_check_table_is_closed(const char *name, const char *where);
 int _ma_open_datafile(MARIA_HA *info, MARIA_SHARE *share);
 int _ma_open_keyfile(MARIA_SHARE *share);
@@ -24,6 +24,7 @@
 #include <sql_const.h>
 #include <mysys_err.h>
 #include <mysql_com.h>
+#include <my_dir.h>
 #include <zlib.h>
 
 /* number of '.' to print during a copy in verbose mode */
@@ -121,6 +122,8 @@ S3_INFO *s3_info_copy(S3_INFO *old)
                        &tmp.database.str,   old->database.length+1,
                        &tmp.table.str,      old->table.length+1,
                        &tmp.base_table.str, old->base_table.length+1,
+                       &tmp.tabledef_version.str,
+                       old->tabledef_version.length+1,
                        NullS))
     return 0;
   /* Copy lengths and new pointers to to */
@@ -134,6 +137,9 @@ S3_INFO *s3_info_copy(S3_INFO *old)
   strmake((char*) to->database.str,  old->database.str, old->database.length);
   strmov((char*) to->table.str,      old->table.str);
   strmov((char*) to->base_table.str, old->base_table.str);
+  if (old->tabledef_version.length)
+    memcpy((uchar*) to->tabledef_version.str, old->tabledef_version.str,
+           old->tabledef_version.length);
   return to;
 }
 
@@ -1590,6 +1596,366 @@ my_bool s3_block_read(struct st_pagecache *pagecache,
 #endif
 
 
+/******************************************************************************
+ Local disk cache of S3 blocks
+
+ Blocks read from S3 are stored as files in s3_block_cache_path, so that
+ repeated scans of the same tables don't fetch them from S3 again. The
+ file name is a hash of the key of the block (bucket, S3 path and table
+ version). The key is stored at the start of the file and is checked when
+ the file is read, so a hash collision only causes a cache miss.
+ Files are removed in LRU order when the total size of the cache would
+ exceed s3_block_cache_size. On startup the files already in the cache
+ directory are ordered by their modification time.
+******************************************************************************/
+
+#define S3_CACHE_EXT ".s3b"
+#define S3_CACHE_TMP_EXT ".tmp"
+/* 16 hex digits and S3_CACHE_EXT */
+#define S3_CACHE_NAME_LENGTH 20
+
+typedef struct st_s3_cache_entry
+{
+  struct st_s3_cache_entry *next, *prev;        /* LRU list, newest first */
+  my_off_t size;
+  time_t time;
+  char name[S3_CACHE_NAME_LENGTH + 1];
+} S3_CACHE_ENTRY;
+
+static struct st_s3_block_cache
+{
+  mysql_mutex_t lock;
+  HASH hash;
+  S3_CACHE_ENTRY *first, *last;
+  ulonglong size, max_size;
+  char path[FN_REFLEN];
+  my_bool inited;
+} s3_block_cache;
+
+ulonglong s3_block_cache_hits, s3_block_cache_misses;
+
+
+static void s3_block_cache_name(char *to, const char *key, size_t length)
+{
+  my_snprintf(to, S3_CACHE_NAME_LENGTH + 1, "%08x%08x" S3_CACHE_EXT,
+              (uint) my_checksum(0, key, length),
+              (uint) my_crc32c(0, key, length));
+}
+
+
+static void s3_cache_unlink(S3_CACHE_ENTRY *entry)
+{
+  if (entry->prev)
+    entry->prev->next= entry->next;
+  else
+    s3_block_cache.first= entry->next;
+  if (entry->next)
+    entry->next->prev= entry->prev;
+  else
+    s3_block_cache.last= entry->prev;
+}
+
+
+static void s3_cache_link_first(S3_CACHE_ENTRY *entry)
+{
+  entry->prev= 0;
+  if ((entry->next= s3_block_cache.first))
+    entry->next->prev= entry;
+  else
+    s3_block_cache.last= entry;
+  s3_block_cache.first= entry;
+}
+
+
+/*
+  Remove the least recently used files until the cache fits in max_size
+
+  @param keep   Entry that should not be removed
+*/
+
+static void s3_cache_evict(S3_CACHE_ENTRY *keep)
+{
+  char path[FN_REFLEN];
+  mysql_mutex_assert_owner(&s3_block_cache.lock);
+
+  while (s3_block_cache.size > s3_block_cache.max_size &&
+         s3_block_cache.last && s3_block_cache.last != keep)
+  {
+    S3_CACHE_ENTRY *entry= s3_block_cache.last;
+    s3_cache_unlink(entry);
+    s3_block_cache.size-= entry->size;
+    strxnmov(path, sizeof(path)-1, s3_block_cache.path, entry->name, NullS);
+    (void) my_delete(path, MYF(0));
+    my_hash_delete(&s3_block_cache.hash, (uchar*) entry);
+  }
+}
+
+
+static int s3_cache_entry_cmp(const void *a, const void *b)
+{
+  time_t time_a= (*(S3_CACHE_ENTRY* const*) a)->time;
+  time_t time_b= (*(S3_CACHE_ENTRY* const*) b)->time;
+  return time_a < time_b ? -1 : time_a > time_b;
+}
+
+
+/**
+   Start using a local disk cache of S3 blocks
+
+   @param path       Directory for the cache. It's created if needed
+   @param max_size   Maximum total size of the cached blocks
+
+   @return 0  ok (or cache not used as path is not set)
+   @return 1  error. The cache is not used
+*/
+
+my_bool s3_block_cache_init(const char *path, ulonglong max_size)
+{
+  MY_DIR *dir;
+  S3_CACHE_ENTRY **entries= 0;
+  size_t i, count= 0;
+  DBUG_ENTER("s3_block_cache_init");
+
+  if (!path || !path[0] || !max_size)
+    DBUG_RETURN(0);
+
+  convert_dirname(s3_block_cache.path, path, NullS);
+  if (my_mkdir(s3_block_cache.path, 0777, MYF(0)) && my_errno != EEXIST)
+    DBUG_RETURN(1);
+  if (!(dir= my_dir(s3_block_cache.path, MYF(MY_WANT_STAT | MY_DONT_SORT))))
+    DBUG_RETURN(1);
+
+  mysql_mutex_init(0, &s3_block_cache.lock, MY_MUTEX_INIT_FAST);
+  if (my_hash_init(PSI_NOT_INSTRUMENTED, &s3_block_cache.hash,
+                   &my_charset_bin, 1024,
+                   offsetof(S3_CACHE_ENTRY, name), S3_CACHE_NAME_LENGTH,
+                   0, my_free, 0) ||
+      (dir->number_of_files &&
+       !(entries= (S3_CACHE_ENTRY**)
+         my_malloc(PSI_NOT_INSTRUMENTED,
+                   dir->number_of_files * sizeof(*entries), MYF(MY_WME)))))
+    goto err;
+
+  s3_block_cache.first= s3_block_cache.last= 0;
+  s3_block_cache.size= 0;
+  s3_block_cache.max_size= max_size;
+
+  for (i= 0 ; i < dir->number_of_files ; i++)
+  {
+    FILEINFO *file= dir->dir_entry + i;
+    size_t length= strlen(file->name);
+    S3_CACHE_ENTRY *entry;
+
+    if (!MY_S_ISREG(file->mystat->st_mode))
+      continue;
+    if (length > 4 && !strcmp(file->name + length - 4, S3_CACHE_TMP_EXT))
+    {
+      /* Left from a crash during s3_block_cache_write() */
+      char name[FN_REFLEN];
+      strxnmov(name, sizeof(name)-1, s3_block_cache.path, file->name, NullS);
+      (void) my_delete(name, MYF(0));
+      continue;
+    }
+    if (length != S3_CACHE_NAME_LENGTH ||
+        strcmp(file->name + length - 4, S3_CACHE_EXT))
+      continue;
+    if (!(entry= (S3_CACHE_ENTRY*) my_malloc(PSI_NOT_INSTRUMENTED,
+                                             sizeof(*entry), MYF(MY_WME))))
+      goto err;
+    strmov(entry->name, file->name);
+    entry->size= (my_off_t) file->mystat->st_size;
+    entry->time= file->mystat->st_mtime;
+    entries[count++]= entry;
+  }
+  if (count)
+    my_qsort(entries, count, sizeof(*entries), s3_cache_entry_cmp);
+
+  /* Oldest first, so that the newest file ends first in the LRU list */
+  for (i= 0 ; i < count ; i++)
+  {
+    if (my_hash_insert(&s3_block_cache.hash, (uchar*) entries[i]))
+    {
+      for ( ; i < count ; i++)
+        my_free(entries[i]);
+      count= 0;
+      goto err;
+    }
+    s3_cache_link_first(entries[i]);
+    s3_block_cache.size+= entries[i]->size;
+  }
+  count= 0;
+  my_free(entries);
+  my_dirend(dir);
+
+  s3_block_cache.inited= 1;
+  mysql_mutex_lock(&s3_block_cache.lock);
+  s3_cache_evict(0);
+  mysql_mutex_unlock(&s3_block_cache.lock);
+  DBUG_RETURN(0);
+
+err:
+  for (i= 0 ; i < count ; i++)
+    my_free(entries[i]);
+  my_free(entries);
+  my_dirend(dir);
+  my_hash_free(&s3_block_cache.hash);
+  mysql_mutex_destroy(&s3_block_cache.lock);
+  DBUG_RETURN(1);
+}
+
+
+/*
+  Stop using the local disk cache of S3 blocks. The cached files are kept.
+*/
+
+void s3_block_cache_end()
+{
+  if (s3_block_cache.inited)
+  {
+    s3_block_cache.inited= 0;
+    my_hash_free(&s3_block_cache.hash);
+    mysql_mutex_destroy(&s3_block_cache.lock);
+  }
+}
+
+
+/**
+   Read a block from the local disk cache
+
+   @return 0  Block found. It should be freed with s3_free()
+   @return 1  Block not in cache
+*/
+
+static my_bool s3_block_cache_read(const char *key, size_t key_length,
+                                   const char *name, S3_BLOCK *block)
+{
+  char path[FN_REFLEN];
+  File file;
+  MY_STAT stat_info;
+  size_t length;
+  uchar *data;
+  my_bool found;
+
+  mysql_mutex_lock(&s3_block_cache.lock);
+  {
+    S3_CACHE_ENTRY *entry;
+    if ((found= MY_TEST(entry= (S3_CACHE_ENTRY*)
+                        my_hash_search(&s3_block_cache.hash, (uchar*) name,
+                                       S3_CACHE_NAME_LENGTH))))
+    {
+      s3_cache_unlink(entry);
+      s3_cache_link_first(entry);
+    }
+  }
+  mysql_mutex_unlock(&s3_block_cache.lock);
+  if (!found)
+    goto miss;
+
+  strxnmov(path, sizeof(path)-1, s3_block_cache.path, name, NullS);
+  if ((file= my_open(path, O_RDONLY | O_SHARE, MYF(0))) < 0)
+    goto miss;
+  if (my_fstat(file, &stat_info, MYF(0)) ||
+      (length= (size_t) stat_info.st_size) <= key_length + 2 ||
+      !(data= (uchar*) my_malloc(PSI_NOT_INSTRUMENTED, length,
+                                 MYF(MY_THREAD_SPECIFIC))))
+  {
+    my_close(file, MYF(0));
+    goto miss;
+  }
+  if (my_read(file, data, length, MYF(MY_NABP)) ||
+      uint2korr(data) != key_length || memcmp(data + 2, key, key_length))
+  {
+    my_free(data);
+    my_close(file, MYF(0));
+    goto miss;
+  }
+  my_close(file, MYF(0));
+
+  block->alloc_ptr= data;
+  block->str= data + 2 + key_length;
+  block->length= length - 2 - key_length;
+  my_atomic_add64_explicit((volatile int64*) &s3_block_cache_hits, 1,
+                           MY_MEMORY_ORDER_RELAXED);
+  return 0;
+
+miss:
+  my_atomic_add64_explicit((volatile int64*) &s3_block_cache_misses, 1,
+                           MY_MEMORY_ORDER_RELAXED);
+  return 1;
+}
+
+
+/*
+  Store a block read from S3 in the local disk cache
+
+  The block is written to a temporary file that is renamed when complete,
+  so that a concurrent reader never sees a partial block.
+*/
+
+static void s3_block_cache_write(const char *key, size_t key_length,
+                                 const char *name, const S3_BLOCK *block)
+{
+  char path[FN_REFLEN], tmp_path[FN_REFLEN];
+  uchar header[2];
+  File file;
+  int error;
+  S3_CACHE_ENTRY *entry;
+  my_off_t size= (my_off_t) (2 + key_length + block->length);
+
+  if (size > s3_block_cache.max_size)
+    return;
+
+  strxnmov(path, sizeof(path)-1, s3_block_cache.path, name, NullS);
+  my_snprintf(tmp_path, sizeof(tmp_path), "%s.%d" S3_CACHE_TMP_EXT, path,
+              (int) s3_unique_file_number());
+  if ((file= my_create(tmp_path, 0, O_WRONLY | O_TRUNC | O_SHARE,
+                       MYF(0))) < 0)
+    return;
+  int2store(header, key_length);
+  error= (my_write(file, header, 2, MYF(MY_NABP)) ||
+          my_write(file, (uchar*) key, key_length, MYF(MY_NABP)) ||
+          my_write(file, block->str, block->length, MYF(MY_NABP)));
+  if (my_close(file, MYF(0)) || error ||
+      my_rename(tmp_path, path, MYF(0)))
+  {
+    (void) my_delete(tmp_path, MYF(0));
+    return;
+  }
+
+  mysql_mutex_lock(&s3_block_cache.lock);
+  if ((entry= (S3_CACHE_ENTRY*) my_hash_search(&s3_block_cache.hash,
+                                               (uchar*) name,
+                                               S3_CACHE_NAME_LENGTH)))
+  {
+    /* Another thread stored the same block or a block with the same hash */
+    s3_cache_unlink(entry);
+    s3_block_cache.size-= entry->size;
+  }
+  else
+  {
+    if (!(entry= (S3_CACHE_ENTRY*) my_malloc(PSI_NOT_INSTRUMENTED,
+                                             sizeof(*entry), MYF(0))))
+      goto err;
+    strmov(entry->name, name);
+    if (my_hash_insert(&s3_block_cache.hash, (uchar*) entry))
+    {
+      my_free(entry);
+      goto err;
+    }
+  }
+  entry->size= size;
+  s3_cache_link_first(entry);
+  s3_block_cache.size+= size;
+  s3_cache_evict(entry);
+  mysql_mutex_unlock(&s3_block_cache.lock);
+  return;
+
+err:
+  (void) my_delete(path, MYF(0));
+  mysql_mutex_unlock(&s3_block_cache.lock);
+}
+
+
 /**
    Read a block from S3 to page cache
 */
@@ -1608,6 +1974,10 @@ my_bool s3_block_read(struct st_pagecache *pagecache,
   char *end;
   S3_INFO *s3= share->s3_path;
   ulong block_number;
+  char key[AWS_PATH_LENGTH + NAME_LEN + 44 + MY_UUID_SIZE * 2];
+  char name[S3_CACHE_NAME_LENGTH + 1];
+  size_t UNINIT_VAR(key_length);
+  int error;
   DBUG_ENTER("s3_block_read");
 
   DBUG_ASSERT(file->big_block_size > 0);
@@ -1622,8 +1992,35 @@ my_bool s3_block_read(struct st_pagecache *pagecache,
                 s3->table.str, path_suffix, "000000", NullS);
   fix_suffix(end, block_number);
 
-  DBUG_RETURN(s3_get_object(client, s3->bucket.str, aws_path, block,
-                            share->base.compression_algorithm, 1));
+  if (s3_block_cache.inited)
+  {
+    /*
+      The table definition version, the creation time and the file length
+      identify the version of the table, so that a block of a dropped table
+      is never returned for a new table with the same name.
+    */
+    char version[MY_UUID_SIZE * 2 + 1];
+    uint i;
+    for (i= 0; i < s3->tabledef_version.length && i < MY_UUID_SIZE; i++)
+      my_snprintf(version + i * 2, 3, "%02x",
+                  (uint) s3->tabledef_version.str[i]);
+    version[i * 2]= 0;
+    key_length= my_snprintf(key, sizeof(key), "%s/%s/%s/%lu/%llu",
+                            s3->bucket.str, aws_path, version,
+                            (ulong) share->state.create_time,
+                            (ulonglong) (datafile ?
+                                         share->state.state.data_file_length :
+                                         share->state.state.key_file_length));
+    s3_block_cache_name(name, key, key_length);
+    if (!s3_block_cache_read(key, key_length, name, block))
+      DBUG_RETURN(0);
+  }
+
+  error= s3_get_object(client, s3->bucket.str, aws_path, block,
+                       share->base.compression_algorithm, 1);
+  if (!error && s3_block_cache.inited)
+    s3_block_cache_write(key, key_length, name, block);
+  DBUG_RETURN(error);
 }
 
 /*
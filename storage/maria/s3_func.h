@@ -135,6 +135,9 @@ my_bool s3_block_read(struct st_pagecache *pagecache,
                       PAGECACHE_IO_HOOK_ARGS *args,
                       struct st_pagecache_file *file,
                       S3_BLOCK *block);
+my_bool s3_block_cache_init(const char *path, ulonglong max_size);
+void s3_block_cache_end(void);
+extern ulonglong s3_block_cache_hits, s3_block_cache_misses;
 C_MODE_END
 #else
 
@@ -750,7 +750,8 @@ ha_myisam::ha_myisam(handlerton *hton, TABLE_SHARE *table_arg)
                   HA_CAN_INSERT_DELAYED | HA_CAN_BIT_FIELD | HA_CAN_RTREEKEYS |
                   HA_HAS_RECORDS | HA_STATS_RECORDS_IS_EXACT | HA_CAN_REPAIR |
                   HA_CAN_TABLES_WITHOUT_ROLLBACK),
-   can_enable_indexes(0)
+   can_enable_indexes(0), zone_map(0), zone_fields(0), zone_columns(0),
+   zone_cond(0), zone_ranges_done(0), zone_block(HA_POS_ERROR)
 {}
 
 handler *ha_myisam::clone(const char *name __attribute__((unused)),
@@ -770,6 +771,24 @@ static const char *ha_myisam_exts[] = {
   NullS
 };
 
+/*
+  Field options, given in CREATE TABLE after the column definition:
+
+  ZONEMAP=1   Remember the smallest and the largest value of the column
+              for every block of rows, see Myisam_zone_map
+*/
+
+struct ha_field_option_struct
+{
+  bool zonemap;
+};
+
+static ha_create_table_option myisam_field_option_list[]=
+{
+  HA_FOPTION_BOOL("ZONEMAP", zonemap, 0),
+  HA_FOPTION_END
+};
+
 const char *ha_myisam::index_type(uint key_number)
 {
   return ((table->key_info[key_number].flags & HA_FULLTEXT) ? 
@@ -816,6 +835,508 @@ IO_AND_CPU_COST ha_myisam::rnd_pos_time(ha_rows rows)
 }
 
 
+/****************************************************************************
+  Zone maps
+
+  For a table with fixed size rows, the data file is divided into blocks
+  of zone_map_block_rows rows. For every block that a table scan has read
+  completely, the smallest and the largest value of each ZONEMAP column
+  is remembered in a Myisam_zone_map, which is shared by all handlers of
+  the table. A table scan with a pushed condition skips the blocks that
+  can't contain a row matching the condition. The condition is returned
+  from cond_push(), so the SQL layer still checks every row that is read.
+
+  The map is kept in memory only and is built again by table scans after
+  the table has been opened. New rows are appended after the last
+  complete block, so only UPDATE and INSERT into a deleted row make a
+  block unknown again. DELETE only makes the remembered range wider than
+  necessary. REPAIR, OPTIMIZE and TRUNCATE forget all blocks. The changes
+  are reported by mi_write(), mi_update() and mi_delete_all_rows(), so
+  that changes through a MERGE table are noticed as well.
+****************************************************************************/
+
+static const ha_rows zone_map_block_rows= 1024;
+
+/* Range of the values that a row matching the pushed condition can have */
+
+struct Myisam_zone_range
+{
+  longlong min, max;
+  bool used;
+};
+
+
+class Myisam_zone_map : public Handler_share
+{
+  uint columns;
+  ulonglong blocks;                     /* Number of elements in known */
+  uchar *known;                         /* If the block is in values */
+  longlong *values;                     /* min and max of every column */
+
+public:
+  mysql_mutex_t mutex;
+  ulonglong version;                    /* Incremented by forget() */
+
+  Myisam_zone_map(uint columns_arg)
+    :columns(columns_arg), blocks(0), known(0), values(0), version(0)
+  {
+    mysql_mutex_init(PSI_NOT_INSTRUMENTED, &mutex, MY_MUTEX_INIT_FAST);
+  }
+  ~Myisam_zone_map()
+  {
+    my_free(known);
+    my_free(values);
+    mysql_mutex_destroy(&mutex);
+  }
+
+  bool is_known(ulonglong block) const
+  {
+    mysql_mutex_assert_owner(&mutex);
+    return block < blocks && known[block];
+  }
+
+  /* Check if no row of a known block can be inside the ranges */
+  bool can_skip(ulonglong block, const Myisam_zone_range *ranges) const
+  {
+    const longlong *min_max= values + block * columns * 2;
+    DBUG_ASSERT(is_known(block));
+    for (uint i= 0; i < columns; i++, min_max+= 2)
+    {
+      if (ranges[i].used &&
+          (min_max[1] < ranges[i].min || min_max[0] > ranges[i].max))
+        return true;
+    }
+    return false;
+  }
+
+  void store(ulonglong block, const longlong *min_max)
+  {
+    mysql_mutex_assert_owner(&mutex);
+    if (block >= blocks)
+    {
+      ulonglong new_blocks= MY_MAX(block + 1, blocks * 2);
+      uchar *new_known;
+      longlong *new_values;
+      if (!(new_known= (uchar*) my_realloc(PSI_INSTRUMENT_ME, known,
+                                           (size_t) new_blocks,
+                                           MYF(MY_ALLOW_ZERO_PTR))))
+        return;
+      known= new_known;
+      bzero(known + blocks, (size_t) (new_blocks - blocks));
+      if (!(new_values= (longlong*) my_realloc(PSI_INSTRUMENT_ME, values,
+                                               (size_t) new_blocks * columns *
+                                               2 * sizeof(longlong),
+                                               MYF(MY_ALLOW_ZERO_PTR))))
+        return;
+      values= new_values;
+      blocks= new_blocks;
+    }
+    memcpy(values + block * columns * 2, min_max,
+           columns * 2 * sizeof(longlong));
+    known[block]= 1;
+  }
+
+  void forget(ulonglong block)
+  {
+    mysql_mutex_lock(&mutex);
+    version++;
+    if (block < blocks)
+      known[block]= 0;
+    mysql_mutex_unlock(&mutex);
+  }
+
+  void forget_all()
+  {
+    mysql_mutex_lock(&mutex);
+    version++;
+    if (blocks)
+      bzero(known, (size_t) blocks);
+    mysql_mutex_unlock(&mutex);
+  }
+};
+
+
+/* Check if the zone map can remember the values of the column */
+
+static bool zone_map_field_ok(Field *field)
+{
+  if (!field->option_struct || !field->option_struct->zonemap ||
+      !field->stored_in_db())
+    return false;
+  switch (field->real_type()) {
+  case MYSQL_TYPE_TINY:
+  case MYSQL_TYPE_SHORT:
+  case MYSQL_TYPE_INT24:
+  case MYSQL_TYPE_LONG:
+    return true;
+  case MYSQL_TYPE_LONGLONG:
+    /* Values above LONGLONG_MAX would not be ordered as longlong */
+    return !(field->flags & UNSIGNED_FLAG);
+  case MYSQL_TYPE_DATE:
+  case MYSQL_TYPE_NEWDATE:
+  case MYSQL_TYPE_DATETIME:
+  case MYSQL_TYPE_DATETIME2:
+    return true;
+  default:
+    return false;
+  }
+}
+
+
+/*
+  Value of a ZONEMAP column, compared the way Arg_comparator compares it.
+  Temporal columns use the packed datetime format.
+*/
+
+static longlong zone_map_value(THD *thd, Field *field)
+{
+  if (field->cmp_type() == TIME_RESULT)
+    return field->val_datetime_packed(thd);
+  return field->val_int();
+}
+
+
+/*
+  Value of the constant side of a comparison with a ZONEMAP column
+
+  @return false if the comparison can't be used
+*/
+
+static bool zone_map_const_value(THD *thd, Field *field, Item *item,
+                                 longlong *value)
+{
+  if (!item->const_item() || item->is_expensive())
+    return false;
+  if (field->cmp_type() == TIME_RESULT)
+  {
+    if (item->type_handler()->field_type() == MYSQL_TYPE_TIME)
+      return false;
+    *value= item->val_datetime_packed(thd);
+  }
+  else
+  {
+    if (item->cmp_type() != INT_RESULT)
+      return false;
+    *value= item->val_int();
+    /* An unsigned constant above LONGLONG_MAX */
+    if (item->unsigned_flag && *value < 0)
+      return false;
+  }
+  return !item->null_value;
+}
+
+
+bool ha_myisam::zone_map_open()
+{
+  uint columns= 0, i= 0;
+  Field **field;
+
+  if (file->s->data_file_type != STATIC_RECORD)
+    return false;
+  for (field= table->field; *field; field++)
+  {
+    if (zone_map_field_ok(*field))
+      columns++;
+  }
+  if (!columns)
+    return false;
+
+  if (!my_multi_malloc(PSI_INSTRUMENT_ME, MYF(MY_WME),
+                       &zone_fields, sizeof(Field*) * columns,
+                       &zone_ranges, sizeof(Myisam_zone_range) * columns,
+                       &zone_block_values, sizeof(longlong) * 2 * columns,
+                       NullS))
+    return true;
+  for (field= table->field; *field; field++)
+  {
+    if (zone_map_field_ok(*field))
+      zone_fields[i++]= *field;
+  }
+
+  lock_shared_ha_data();
+  if (!(zone_map= static_cast<Myisam_zone_map*>(get_ha_share_ptr())))
+  {
+    if ((zone_map= new Myisam_zone_map(columns)))
+      set_ha_share_ptr(static_cast<Handler_share*>(zone_map));
+  }
+  unlock_shared_ha_data();
+  if (!zone_map)
+  {
+    my_free(zone_fields);
+    zone_fields= 0;
+    return true;
+  }
+  zone_columns= columns;
+  zone_block= HA_POS_ERROR;
+  int_table_flags|= HA_CAN_TABLE_CONDITION_PUSHDOWN;
+  return false;
+}
+
+
+/*
+  Narrow the range of a ZONEMAP column with a part of the pushed condition
+  of the form "column <op> constant" or "column BETWEEN constant AND
+  constant".
+*/
+
+void ha_myisam::zone_map_add_range(THD *thd, Item *cond)
+{
+  Item_func *func;
+  Item **args;
+  Item *field_item, *value_item;
+  Item_func::Functype type;
+  Field *field;
+  Myisam_zone_range *range;
+  longlong value, value2;
+  uint column;
+
+  if (cond->type() != Item::FUNC_ITEM)
+    return;
+  func= (Item_func*) cond;
+  args= func->arguments();
+  type= func->functype();
+
+  switch (type) {
+  case Item_func::EQ_FUNC:
+  case Item_func::LT_FUNC:
+  case Item_func::LE_FUNC:
+  case Item_func::GT_FUNC:
+  case Item_func::GE_FUNC:
+  {
+    Item_bool_rowready_func2 *cmp= (Item_bool_rowready_func2*) func;
+    field_item= args[0]->real_item();
+    value_item= args[1];
+    if (field_item->type() != Item::FIELD_ITEM)
+    {
+      /* constant <op> column */
+      field_item= args[1]->real_item();
+      value_item= args[0];
+      type= cmp->rev_functype();
+    }
+    if (field_item->type() != Item::FIELD_ITEM)
+      return;
+    field= ((Item_field*) field_item)->field;
+    if (cmp->compare_type_handler()->cmp_type() != field->cmp_type() ||
+        cmp->compare_type_handler()->field_type() == MYSQL_TYPE_TIME)
+      return;
+    break;
+  }
+  case Item_func::BETWEEN:
+    field_item= args[0]->real_item();
+    if (((Item_func_between*) func)->negated ||
+        field_item->type() != Item::FIELD_ITEM)
+      return;
+    field= ((Item_field*) field_item)->field;
+    value_item= args[1];
+    break;
+  default:
+    return;
+  }
+
+  if (field->table != table)
+    return;
+  for (column= 0; column < zone_columns; column++)
+  {
+    if (zone_fields[column] == field)
+      break;
+  }
+  if (column == zone_columns ||
+      !zone_map_const_value(thd, field, value_item, &value))
+    return;
+  range= zone_ranges + column;
+
+  switch (type) {
+  case Item_func::EQ_FUNC:
+    set_if_bigger(range->min, value);
+    set_if_smaller(range->max, value);
+    break;
+  case Item_func::LT_FUNC:
+    if (value == LONGLONG_MIN)
+      return;
+    set_if_smaller(range->max, value - 1);
+    break;
+  case Item_func::LE_FUNC:
+    set_if_smaller(range->max, value);
+    break;
+  case Item_func::GT_FUNC:
+    if (value == LONGLONG_MAX)
+      return;
+    set_if_bigger(range->min, value + 1);
+    break;
+  case Item_func::GE_FUNC:
+    set_if_bigger(range->min, value);
+    break;
+  case Item_func::BETWEEN:
+    if (!zone_map_const_value(thd, field, args[2], &value2))
+      return;
+    set_if_bigger(range->min, value);
+    set_if_smaller(range->max, value2);
+    break;
+  default:
+    DBUG_ASSERT(0);
+    return;
+  }
+  range->used= true;
+  zone_ranges_used= true;
+}
+
+
+/* Compute the column ranges for the pushed condition */
+
+void ha_myisam::zone_map_prepare_scan()
+{
+  THD *thd= table->in_use;
+  Dummy_error_handler error_handler;
+
+  for (uint i= 0; i < zone_columns; i++)
+  {
+    zone_ranges[i].min= LONGLONG_MIN;
+    zone_ranges[i].max= LONGLONG_MAX;
+    zone_ranges[i].used= false;
+  }
+  zone_ranges_used= false;
+  zone_ranges_done= true;
+  if (!zone_cond)
+    return;
+
+  /* Don't repeat warnings about the constants, the SQL layer gives them */
+  thd->push_internal_handler(&error_handler);
+  Item *cond= (Item*) zone_cond;
+  if (cond->type() == Item::COND_ITEM &&
+      ((Item_cond*) cond)->functype() == Item_func::COND_AND_FUNC)
+  {
+    List_iterator_fast<Item> li(*((Item_cond*) cond)->argument_list());
+    Item *item;
+    while ((item= li++))
+      zone_map_add_range(thd, item);
+  }
+  else
+    zone_map_add_range(thd, cond);
+  thd->pop_internal_handler();
+}
+
+
+/*
+  Called by rnd_next() when the scan is at the start of a block.
+  Skip the known blocks that can't have a matching row and start
+  adding the next block to the zone map if it is not known.
+*/
+
+void ha_myisam::zone_map_next_block()
+{
+  my_off_t block_length= file->s->base.pack_reclength * zone_map_block_rows;
+  ulonglong block= file->nextpos / block_length;
+  ulonglong first_block= block;
+
+  mysql_mutex_lock(&zone_map->mutex);
+  if (zone_ranges_used)
+  {
+    while (zone_map->is_known(block) &&
+           zone_map->can_skip(block, zone_ranges))
+      block++;
+  }
+  if (zone_map->is_known(block))
+    zone_block= HA_POS_ERROR;
+  else
+  {
+    zone_block= block;
+    zone_block_version= zone_map->version;
+    zone_block_rows= 0;
+    for (uint i= 0; i < zone_columns; i++)
+    {
+      zone_block_values[i * 2]= LONGLONG_MAX;
+      zone_block_values[i * 2 + 1]= LONGLONG_MIN;
+    }
+  }
+  mysql_mutex_unlock(&zone_map->mutex);
+
+  if (block != first_block)
+    mi_scan_seek(file, block * block_length);
+}
+
+
+/*
+  Add a row read by rnd_next() to the block that is being built.
+  The block is stored in the zone map when all its rows have been read,
+  unless some block has been forgotten in the meantime.
+*/
+
+void ha_myisam::zone_map_add_row(int error, const uchar *buf)
+{
+  my_off_t reclength= file->s->base.pack_reclength;
+
+  if ((error && error != HA_ERR_RECORD_DELETED) ||
+      file->lastpos != (zone_block * zone_map_block_rows + zone_block_rows) *
+                       reclength)
+  {
+    zone_block= HA_POS_ERROR;
+    return;
+  }
+  if (!error)
+  {
+    THD *thd= table->in_use;
+    my_ptrdiff_t diff= buf - table->record[0];
+    MY_BITMAP *old_map= dbug_tmp_use_all_columns(table, &table->read_set);
+    for (uint i= 0; i < zone_columns; i++)
+    {
+      Field *field= zone_fields[i];
+      if (field->is_null_in_record(buf))
+        continue;
+      field->move_field_offset(diff);
+      longlong value= zone_map_value(thd, field);
+      field->move_field_offset(-diff);
+      set_if_smaller(zone_block_values[i * 2], value);
+      set_if_bigger(zone_block_values[i * 2 + 1], value);
+    }
+    dbug_tmp_restore_column_map(&table->read_set, old_map);
+  }
+  if (++zone_block_rows == zone_map_block_rows)
+  {
+    mysql_mutex_lock(&zone_map->mutex);
+    if (zone_map->version == zone_block_version)
+      zone_map->store(zone_block, zone_block_values);
+    mysql_mutex_unlock(&zone_map->mutex);
+    zone_block= HA_POS_ERROR;
+  }
+}
+
+
+/*
+  Forget the block of a row that is changed, or all blocks if pos is
+  HA_OFFSET_ERROR. This is called by the MyISAM layer, so that changes
+  through a MERGE table are noticed as well.
+*/
+
+void ha_myisam::zone_map_row_changed(void *arg, my_off_t pos)
+{
+  ha_myisam *h= static_cast<ha_myisam*>(arg);
+  if (pos == HA_OFFSET_ERROR)
+    h->zone_map->forget_all();
+  else
+    h->zone_map->forget(pos / h->file->s->base.pack_reclength /
+                        zone_map_block_rows);
+}
+
+
+const COND *ha_myisam::cond_push(const COND *cond)
+{
+  if (zone_map)
+  {
+    zone_cond= cond;
+    zone_ranges_done= false;
+  }
+  /* The SQL layer has to check the condition for all rows that are read */
+  return cond;
+}
+
+
+void ha_myisam::cond_pop()
+{
+  zone_cond= 0;
+  zone_ranges_done= false;
+}
+
+
 /* Name is here without an extension */
 int ha_myisam::open(const char *name, int mode, uint test_if_locked)
 {
@@ -938,6 +1459,14 @@ int ha_myisam::open(const char *name, int mode, uint test_if_locked)
       (file->s->has_varchar_fields || file->s->has_null_fields))
     int_table_flags|= HA_RECORD_MUST_BE_CLEAN_ON_WRITE;
 
+  if (zone_map_open())
+  {
+    my_errno= HA_ERR_OUT_OF_MEM;
+    goto err;
+  }
+  if (zone_map)
+    mi_set_row_changed_func(file, zone_map_row_changed, this);
+
   for (i= 0; i < table->s->keys; i++)
   {
     plugin_ref parser= table->key_info[i].parser;
@@ -975,6 +1504,9 @@ int ha_myisam::open(const char *name, int mode, uint test_if_locked)
 int ha_myisam::close(void)
 {
   MI_INFO *tmp=file;
+  my_free(zone_fields);
+  zone_fields= 0;
+  zone_map= 0;
   if (!tmp)
     return 0;
   file=0;
@@ -1306,6 +1838,10 @@ int ha_myisam::repair(THD *thd, HA_CHECK &param, bool do_optimize)
   my_bool locking= 0;
   DBUG_ENTER("ha_myisam::repair");
 
+  /* The rows may be moved */
+  if (zone_map)
+    zone_map->forget_all();
+
   param.db_name=    table->s->db.str;
   param.table_name= table->alias.c_ptr();
   param.using_global_keycache = 1;
@@ -2085,6 +2621,8 @@ int ha_myisam::index_next_same(uchar *buf,
 
 int ha_myisam::rnd_init(bool scan)
 {
+  zone_block= HA_POS_ERROR;
+  zone_ranges_done= false;
   if (scan)
     return mi_scan_init(file);
   return mi_reset(file);                        // Free buffers
@@ -2092,7 +2630,18 @@ int ha_myisam::rnd_init(bool scan)
 
 int ha_myisam::rnd_next(uchar *buf)
 {
-  int error=mi_scan(file, buf);
+  int error;
+  if (zone_map)
+  {
+    if (!zone_ranges_done)
+      zone_map_prepare_scan();
+    if (!(file->nextpos %
+          (file->s->base.pack_reclength * zone_map_block_rows)))
+      zone_map_next_block();
+  }
+  error=mi_scan(file, buf);
+  if (zone_block != HA_POS_ERROR)
+    zone_map_add_row(error, buf);
   return error;
 }
 
@@ -2206,6 +2755,8 @@ int ha_myisam::extra(enum ha_extra_function operation)
 
 int ha_myisam::reset(void)
 {
+  zone_cond= 0;
+  zone_ranges_done= false;
   mi_set_index_cond_func(file, NULL, 0);
   ds_mrr.dsmrr_close();
   return mi_reset(file);
@@ -2646,6 +3197,7 @@ static int myisam_init(void *p)
   hton->update_optimizer_costs= myisam_update_optimizer_costs;
   hton->flags= HTON_CAN_RECREATE | HTON_SUPPORT_LOG_TABLES;
   hton->tablefile_extensions= ha_myisam_exts;
+  hton->field_options= myisam_field_option_list;
   mi_killed= mi_killed_in_mariadb;
 
   return 0;
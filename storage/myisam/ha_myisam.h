@@ -41,6 +41,9 @@ C_MODE_START
 check_result_t index_cond_func_myisam(void *arg);
 C_MODE_END
 
+class Myisam_zone_map;
+struct Myisam_zone_range;
+
 class ha_myisam final : public handler
 {
   MI_INFO *file;
@@ -51,6 +54,24 @@ class ha_myisam final : public handler
   void setup_vcols_for_repair(HA_CHECK *param);
   void restore_vcos_after_repair();
 
+  /* Zone map of ZONEMAP columns, only used for fixed size rows */
+  Myisam_zone_map *zone_map;
+  Field **zone_fields;                  /* The ZONEMAP columns */
+  uint zone_columns;
+  const COND *zone_cond;                /* Pushed condition */
+  Myisam_zone_range *zone_ranges;       /* Ranges from zone_cond */
+  bool zone_ranges_done, zone_ranges_used;
+  /* Block that the current table scan is adding to the zone map */
+  ulonglong zone_block, zone_block_version;
+  ha_rows zone_block_rows;
+  longlong *zone_block_values;
+  bool zone_map_open();
+  void zone_map_add_range(THD *thd, Item *cond);
+  void zone_map_prepare_scan();
+  void zone_map_next_block();
+  void zone_map_add_row(int error, const uchar *buf);
+  static void zone_map_row_changed(void *arg, my_off_t pos);
+
  public:
   ha_myisam(handlerton *hton, TABLE_SHARE *table_arg);
   ~ha_myisam() = default;
@@ -108,6 +129,8 @@ class ha_myisam final : public handler
   int extra(enum ha_extra_function operation) override;
   int extra_opt(enum ha_extra_function operation, ulong cache_size) override;
   int reset(void) override;
+  const COND *cond_push(const COND *cond) override;
+  void cond_pop() override;
   int external_lock(THD *thd, int lock_type) override;
   int delete_all_rows(void) override;
   int reset_auto_increment(ulonglong value) override;
@@ -34,6 +34,8 @@ int mi_delete_all_rows(MI_INFO *info)
     DBUG_RETURN(my_errno);
   if (_mi_mark_file_changed(info))
     goto err;
+  if (info->row_changed_func)
+    (*info->row_changed_func)(info->row_changed_func_arg, HA_OFFSET_ERROR);
 
   info->state->records=info->state->del=state->split=0;
   state->dellink = HA_OFFSET_ERROR;
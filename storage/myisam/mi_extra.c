@@ -381,6 +381,13 @@ void mi_set_rowid_filter_func(MI_INFO *info,
   info->has_cond_pushdown= (info->index_cond_func || info->rowid_filter_func);
 }
 
+void mi_set_row_changed_func(MI_INFO *info, mi_row_changed_func_t func,
+                             void *func_arg)
+{
+  info->row_changed_func= func;
+  info->row_changed_func_arg= func_arg;
+}
+
 /*
     Start/Stop Inserting Duplicates Into a Table, WL#1648.
  */
@@ -46,3 +46,22 @@ int mi_scan(MI_INFO *info, uchar *buf)
   tmp= (*info->s->read_rnd)(info,buf,info->nextpos,1);
   DBUG_RETURN(tmp);
 }
+
+
+/*
+  Continue a table scan at another row.
+
+  filepos must be the start of a row, so this can only be used with
+  fixed size rows. The record cache is moved as well, so that the
+  following mi_scan() calls read ahead from the new position.
+*/
+
+void mi_scan_seek(MI_INFO *info, my_off_t filepos)
+{
+  DBUG_ENTER("mi_scan_seek");
+  DBUG_ASSERT(info->s->data_file_type == STATIC_RECORD);
+  info->nextpos= filepos;
+  if (info->opt_flag & READ_CACHE_USED)
+    my_b_seek(&info->rec_cache, filepos);
+  DBUG_VOID_RETURN;
+}
@@ -50,6 +50,8 @@ int mi_update(register MI_INFO *info, const uchar *oldrec,
   pos=info->lastpos;
   if (_mi_readinfo(info,F_WRLCK,1))
     DBUG_RETURN(my_errno);
+  if (info->row_changed_func)
+    (*info->row_changed_func)(info->row_changed_func_arg, pos);
 
   if (share->calc_checksum)
     old_checksum=info->checksum=(*share->calc_checksum)(info,oldrec);
@@ -69,6 +69,8 @@ int mi_write(MI_INFO *info, const uchar *record)
              !info->append_insert_at_end) ?
 	    share->state.dellink :
 	    info->state->data_file_length);
+  if (info->row_changed_func && filepos != info->state->data_file_length)
+    (*info->row_changed_func)(info->row_changed_func_arg, filepos);
 
   if (share->base.reloc == (ha_rows) 1 &&
       share->base.records == (ha_rows) 1 &&
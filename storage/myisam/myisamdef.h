@@ -232,6 +232,8 @@ typedef struct st_mi_isam_share
 } MYISAM_SHARE;
 
 
+typedef void (*mi_row_changed_func_t)(void *param, my_off_t pos);
+
 struct st_myisam_info
 {
   MYISAM_SHARE *s;                      /* Shared between opens */
@@ -309,6 +311,9 @@ struct st_myisam_info
   void *index_cond_func_arg;           /* parameter for the func */
   rowid_filter_func_t rowid_filter_func;   /* rowid filter check function */
   void *rowid_filter_func_arg;             /* parameter for the func */
+  /* Called before a row is changed in place, HA_OFFSET_ERROR for all rows */
+  mi_row_changed_func_t row_changed_func;
+  void *row_changed_func_arg;              /* parameter for the func */
   THR_LOCK_DATA lock;
   uchar *rtree_recursion_state;         /* For RTREE */
   int rtree_recursion_depth;
@@ -763,6 +768,9 @@ extern void mi_set_index_cond_func(MI_INFO *info, index_cond_func_t check_func,
 extern void mi_set_rowid_filter_func(MI_INFO *info,
                                      rowid_filter_func_t check_func,
                                      void *func_arg);
+extern void mi_set_row_changed_func(MI_INFO *info,
+                                    mi_row_changed_func_t func,
+                                    void *func_arg);
 int flush_blocks(HA_CHECK *param, KEY_CACHE *key_cache, File file,
                  ulonglong *dirty_part_map);
 
@@ -2644,6 +2644,8 @@ pfs_start_mutex_wait_v1(PSI_mutex_locker_state *state,
       return NULL;
     if (! pfs_thread->m_enabled)
       return NULL;
+    if (unlikely(wait_sampling_interval > 1) && ! pfs_thread->sample_wait())
+      return NULL;
     state->m_thread= reinterpret_cast<PSI_thread *> (pfs_thread);
     flags= STATE_FLAG_THREAD;
 
@@ -2762,6 +2764,8 @@ pfs_start_rwlock_wait_v1(PSI_rwlock_locker_state *state,
       return NULL;
     if (! pfs_thread->m_enabled)
       return NULL;
+    if (unlikely(wait_sampling_interval > 1) && ! pfs_thread->sample_wait())
+      return NULL;
     state->m_thread= reinterpret_cast<PSI_thread *> (pfs_thread);
     flags= STATE_FLAG_THREAD;
 
@@ -2901,6 +2905,8 @@ pfs_start_cond_wait_v1(PSI_cond_locker_state *state,
       return NULL;
     if (! pfs_thread->m_enabled)
       return NULL;
+    if (unlikely(wait_sampling_interval > 1) && ! pfs_thread->sample_wait())
+      return NULL;
     state->m_thread= reinterpret_cast<PSI_thread *> (pfs_thread);
     flags= STATE_FLAG_THREAD;
 
@@ -5445,6 +5451,7 @@ void pfs_end_statement_v1(PSI_statement_locker *locker, void *stmt_da)
    Capture statement stats by digest.
   */
   const sql_digest_storage *digest_storage= NULL;
+  PFS_statements_digest_stat *digest_record= NULL;
   PFS_statement_stat *digest_stat= NULL;
   PFS_program *pfs_program= NULL;
   PFS_prepared_stmt *pfs_prepared_stmt= NULL;
@@ -5464,9 +5471,9 @@ void pfs_end_statement_v1(PSI_statement_locker *locker, void *stmt_da)
       if (digest_storage != NULL)
       {
         /* Populate PFS_statements_digest_stat with computed digest information.*/
-        digest_stat= find_or_create_digest(thread, digest_storage,
-                                           state->m_schema_name,
-                                           state->m_schema_name_length);
+        digest_record= find_or_create_digest(thread, digest_storage,
+                                             state->m_schema_name,
+                                             state->m_schema_name_length);
       }
     }
 
@@ -5549,9 +5556,9 @@ void pfs_end_statement_v1(PSI_statement_locker *locker, void *stmt_da)
         if (digest_storage != NULL)
         {
           /* Populate statements_digest_stat with computed digest information. */
-          digest_stat= find_or_create_digest(thread, digest_storage,
-                                             state->m_schema_name,
-                                             state->m_schema_name_length);
+          digest_record= find_or_create_digest(thread, digest_storage,
+                                               state->m_schema_name,
+                                               state->m_schema_name_length);
         }
       }
     }
@@ -5591,13 +5598,15 @@ void pfs_end_statement_v1(PSI_statement_locker *locker, void *stmt_da)
   stat->m_no_index_used+= state->m_no_index_used;
   stat->m_no_good_index_used+= state->m_no_good_index_used;
 
-  if (digest_stat != NULL)
+  if (digest_record != NULL)
   {
+    digest_stat= & digest_record->m_stat;
     digest_stat->mark_used();
 
     if (flags & STATE_FLAG_TIMED)
     {
       digest_stat->aggregate_value(wait_time);
+      digest_record->m_latency.aggregate_value(wait_time);
     }
     else
     {
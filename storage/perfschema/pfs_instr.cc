@@ -66,6 +66,7 @@ ulong events_statements_history_per_thread= 0;
 uint statement_stack_max= 0;
 size_t pfs_max_digest_length= 0;
 size_t pfs_max_sqltext= 0;
+uint wait_sampling_interval= 1;
 /** Number of locker lost. @sa LOCKER_STACK_SIZE. */
 ulong locker_lost= 0;
 /** Number of statements lost. @sa STATEMENT_STACK_SIZE. */
@@ -116,6 +117,7 @@ int init_instruments(const PFS_global_param *param)
 
   pfs_max_digest_length= param->m_max_digest_length;
   pfs_max_sqltext= param->m_max_sql_text_length;
+  wait_sampling_interval= param->m_wait_sampling_interval;
 
   events_waits_history_per_thread= param->m_events_waits_history_sizing;
 
@@ -532,6 +534,7 @@ PFS_thread* create_thread(PFS_thread_class *klass, const void *identity,
     pfs->m_processlist_id= static_cast<ulong>(processlist_id);
     pfs->m_thread_os_id= my_thread_os_id();
     pfs->m_event_id= 1;
+    pfs->m_wait_sample_count= 0;
     pfs->m_stmt_lock.set_allocated();
     pfs->m_session_lock.set_allocated();
     pfs->set_enabled(true);
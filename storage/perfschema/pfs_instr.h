@@ -342,6 +342,8 @@ extern uint statement_stack_max;
 extern size_t pfs_max_digest_length;
 /** Max size of SQL TEXT. */
 extern size_t pfs_max_sqltext;
+/** Instrument one out of this many synchronization waits of a thread. */
+extern uint wait_sampling_interval;
 
 /** Instrumented thread implementation. @see PSI_thread. */
 struct PFS_ALIGNED PFS_thread : PFS_connection_slice
@@ -422,6 +424,20 @@ struct PFS_ALIGNED PFS_thread : PFS_connection_slice
   PFS_events_waits *m_events_waits_current;
   /** Event ID counter */
   ulonglong m_event_id;
+  /** Number of synchronization waits since the last sampled one. */
+  uint m_wait_sample_count;
+
+  /**
+    Check if the next synchronization wait is sampled.
+    @sa wait_sampling_interval
+  */
+  bool sample_wait()
+  {
+    if (++m_wait_sample_count < wait_sampling_interval)
+      return false;
+    m_wait_sample_count= 0;
+    return true;
+  }
   /**
     Internal lock.
     This lock is exclusively used to protect against races
@@ -248,6 +248,12 @@ struct PFS_global_param
   long m_max_digest_length;
   ulong m_max_sql_text_length;
 
+  /**
+    Instrument one out of this many mutex, rwlock and cond waits
+    of each instrumented thread.
+  */
+  uint m_wait_sampling_interval;
+
   /** Sizing hints, for auto tuning. */
   PFS_sizing_hints m_hints;
 };
@@ -24,7 +24,9 @@
 #define PFS_STAT_H
 
 #include <algorithm>
+#include <atomic>
 #include "sql_const.h"
+#include "my_bit.h"
 /* memcpy */
 #include "string.h"
 
@@ -519,6 +521,85 @@ struct PFS_statement_stat
   }
 };
 
+/**
+  Histogram of statement latencies.
+  Timer values are counted in logarithmic buckets, 4 buckets for each
+  power of 2, so that a quantile read from the histogram is at most
+  25% above the exact value.
+  The buckets are updated with relaxed atomic increments,
+  without a lock.
+*/
+struct PFS_latency_histogram
+{
+  /** Number of buckets, covering timer values below 2^49. */
+  static constexpr uint BUCKETS= 192;
+
+  std::atomic<ulonglong> m_count[BUCKETS];
+
+  PFS_latency_histogram()
+  {
+    reset();
+  }
+
+  /** Bucket of a timer value. */
+  static inline uint bucket(ulonglong value)
+  {
+    if (value < 4)
+      return (uint) value;
+    uint log2= my_bit_log2_uint64(value);
+    uint index= ((log2 - 1) << 2) | (uint) ((value >> (log2 - 2)) & 3);
+    return std::min(index, BUCKETS - 1);
+  }
+
+  /** Smallest timer value above the values of a bucket. */
+  static inline ulonglong bucket_limit(uint index)
+  {
+    if (index < 8)
+      return index + 1;
+    return (ulonglong) (5 + (index & 3)) << ((index >> 2) - 1);
+  }
+
+  inline void reset()
+  {
+    for (uint i= 0; i < BUCKETS; i++)
+      m_count[i].store(0, std::memory_order_relaxed);
+  }
+
+  inline void aggregate_value(ulonglong value)
+  {
+    m_count[bucket(value)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+    Compute quantiles of the latency distribution.
+    @param fractions  quantiles to compute, in ascending order
+    @param values     upper bounds of the quantiles, 0 if nothing was counted
+    @param n          number of quantiles
+  */
+  void get_quantiles(const double *fractions, ulonglong *values, uint n) const
+  {
+    ulonglong count[BUCKETS];
+    ulonglong total= 0;
+
+    for (uint i= 0; i < BUCKETS; i++)
+    {
+      count[i]= m_count[i].load(std::memory_order_relaxed);
+      total+= count[i];
+    }
+
+    ulonglong sum= 0;
+    uint q= 0;
+    for (uint i= 0; i < BUCKETS && q < n; i++)
+    {
+      sum+= count[i];
+      while (q < n && sum != 0 && sum >= fractions[q] * total)
+        values[q++]= bucket_limit(i);
+    }
+    for (; q < n; q++)
+      values[q]= 0;
+  }
+};
+
 /** Statistics for transaction usage. */
 struct PFS_transaction_stat
 {
@@ -86,7 +86,10 @@ table_esms_by_digest::m_share=
                       "SUM_NO_INDEX_USED BIGINT unsigned not null comment 'Sum of the NO_INDEX_USED column in the events_statements_current table.',"
                       "SUM_NO_GOOD_INDEX_USED BIGINT unsigned not null comment 'Sum of the NO_GOOD_INDEX_USED column in the events_statements_current table.',"
                       "FIRST_SEEN TIMESTAMP(0) NOT NULL default 0 comment 'Time at which the digest was first seen.',"
-                      "LAST_SEEN TIMESTAMP(0) NOT NULL default 0 comment 'Time at which the digest was most recently seen.')") },
+                      "LAST_SEEN TIMESTAMP(0) NOT NULL default 0 comment 'Time at which the digest was most recently seen.',"
+                      "QUANTILE_95 BIGINT unsigned not null comment 'Upper bound of the 95th percentile of the wait time of the timed events.',"
+                      "QUANTILE_99 BIGINT unsigned not null comment 'Upper bound of the 99th percentile of the wait time of the timed events.',"
+                      "QUANTILE_999 BIGINT unsigned not null comment 'Upper bound of the 99.9th percentile of the wait time of the timed events.')") },
   false, /* m_perpetual */
   false, /* m_optional */
   &m_share_state
@@ -185,6 +188,17 @@ void table_esms_by_digest::make_row(PFS_statements_digest_stat* digest_stat)
   time_normalizer *normalizer= time_normalizer::get(statement_timer);
   m_row.m_stat.set(normalizer, & digest_stat->m_stat);
 
+  static const double fractions[]= { 0.95, 0.99, 0.999 };
+  ulonglong max= digest_stat->m_stat.m_timer1_stat.m_max;
+  digest_stat->m_latency.get_quantiles(fractions, m_row.m_quantile,
+                                       array_elements(m_row.m_quantile));
+  for (uint i= 0; i < array_elements(m_row.m_quantile); i++)
+  {
+    /* The bucket limit may be above the largest wait seen. */
+    m_row.m_quantile[i]=
+      normalizer->wait_to_pico(std::min(m_row.m_quantile[i], max));
+  }
+
   m_row_exists= true;
 }
 
@@ -221,6 +235,11 @@ ::read_row_values(TABLE *table, unsigned char *buf, Field **fields,
       case 28: /* LAST_SEEN */
         set_field_timestamp(f, m_row.m_last_seen);
         break;
+      case 29: /* QUANTILE_95 */
+      case 30: /* QUANTILE_99 */
+      case 31: /* QUANTILE_999 */
+        set_field_ulonglong(f, m_row.m_quantile[f->field_index - 29]);
+        break;
       default: /* 3, ... COUNT/SUM/MIN/AVG/MAX */
         m_row.m_stat.set_field(f->field_index - 3, f);
         break;
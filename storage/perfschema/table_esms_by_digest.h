@@ -52,6 +52,9 @@ struct row_esms_by_digest
   ulonglong m_first_seen;
   /** Column LAST_SEEN. */
   ulonglong m_last_seen;
+
+  /** Columns QUANTILE_95, QUANTILE_99, QUANTILE_999. */
+  ulonglong m_quantile[3];
 };
 
 /** Table PERFORMANCE_SCHEMA.EVENTS_STATEMENTS_SUMMARY_BY_DIGEST. */
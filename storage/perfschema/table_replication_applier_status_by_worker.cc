@@ -65,7 +65,11 @@ table_replication_applier_status_by_worker::m_share=
   "LAST_ERROR_MESSAGE VARCHAR(1024) not null comment 'Last error specific message.',"
   "LAST_ERROR_TIMESTAMP TIMESTAMP(0) not null comment 'Time stamp of last error.',"
   "WORKER_IDLE_TIME BIGINT UNSIGNED not null comment 'Total idle time in seconds that the worker thread has spent waiting for work from SQL thread.',"
-  "LAST_TRANS_RETRY_COUNT INTEGER not null comment 'Total number of retries attempted by last transaction.')") },
+  "LAST_TRANS_RETRY_COUNT INTEGER not null comment 'Total number of retries attempted by last transaction.',"
+  "TRANSACTIONS_APPLIED BIGINT UNSIGNED not null comment 'Number of transactions applied by the worker thread.',"
+  "TRANS_RETRIES BIGINT UNSIGNED not null comment 'Total number of transaction retries by the worker thread.',"
+  "WAIT_FOR_PRIOR_START_TIME BIGINT UNSIGNED not null comment 'Total time in microseconds the worker thread has spent waiting for prior transactions to start committing, before it could start a transaction.',"
+  "WAIT_FOR_PRIOR_COMMIT_TIME BIGINT UNSIGNED not null comment 'Total time in microseconds the worker thread has spent waiting for prior transactions to commit, to preserve the commit order.')") },
   false, /* m_perpetual */
   false, /* m_optional */
   &m_share_state
@@ -229,6 +233,10 @@ void table_replication_applier_status_by_worker::make_row(rpl_parallel_thread *r
 
   m_row.last_trans_retry_count= rpt->last_trans_retry_count;
   m_row.worker_idle_time= rpt->get_worker_idle_time();
+  m_row.transactions_applied= rpt->transactions_applied;
+  m_row.trans_retries= rpt->trans_retries;
+  m_row.prior_start_wait_time= rpt->prior_start_wait_time;
+  m_row.prior_commit_wait_time= rpt->prior_commit_wait_time;
   m_row_exists= true;
 }
 
@@ -280,6 +288,18 @@ int table_replication_applier_status_by_worker
       case 8: /*last_trans_retry_count*/
         set_field_ulong(f, m_row.last_trans_retry_count);
         break;
+      case 9: /*transactions_applied*/
+        set_field_ulonglong(f, m_row.transactions_applied);
+        break;
+      case 10: /*trans_retries*/
+        set_field_ulonglong(f, m_row.trans_retries);
+        break;
+      case 11: /*wait_for_prior_start_time*/
+        set_field_ulonglong(f, m_row.prior_start_wait_time);
+        break;
+      case 12: /*wait_for_prior_commit_time*/
+        set_field_ulonglong(f, m_row.prior_commit_wait_time);
+        break;
       default:
         assert(false);
       }
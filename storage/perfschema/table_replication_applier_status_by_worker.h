@@ -70,6 +70,10 @@ struct st_row_worker {
   ulonglong last_error_timestamp;
   ulonglong worker_idle_time;
   ulong last_trans_retry_count;
+  ulonglong transactions_applied;
+  ulonglong trans_retries;
+  ulonglong prior_start_wait_time;
+  ulonglong prior_commit_wait_time;
 };
 
 /**
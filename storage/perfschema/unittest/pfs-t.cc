@@ -130,6 +130,7 @@ void test_bootstrap()
   param.m_metadata_lock_sizing= 0;
   param.m_max_digest_length= 0;
   param.m_max_sql_text_length= 0;
+  param.m_wait_sampling_interval= 1;
 
   param.m_hints.m_table_definition_cache = 100;
   param.m_hints.m_table_open_cache       = 100;
@@ -203,6 +204,7 @@ PSI * load_perfschema()
   param.m_metadata_lock_sizing= 10;
   param.m_max_digest_length= 0;
   param.m_max_sql_text_length= 1000;
+  param.m_wait_sampling_interval= 1;
 
   param.m_hints.m_table_definition_cache = 100;
   param.m_hints.m_table_open_cache       = 100;
@@ -1621,6 +1623,7 @@ void test_event_name_index()
   param.m_metadata_lock_sizing= 10;
   param.m_max_digest_length= 0;
   param.m_max_sql_text_length= 1000;
+  param.m_wait_sampling_interval= 1;
 
   param.m_mutex_sizing= 0;
   param.m_rwlock_sizing= 0;
@@ -1870,6 +1873,7 @@ void test_leaks()
   param.m_statement_stack_sizing= 10;
   param.m_max_digest_length= 1000;
   param.m_max_sql_text_length= 1000;
+  param.m_wait_sampling_interval= 1;
 
   param.m_hints.m_table_definition_cache = 100;
   param.m_hints.m_table_open_cache       = 100;
@@ -80,6 +80,7 @@ void test_oom()
   param.m_metadata_lock_sizing= 0;
   param.m_max_digest_length= 0;
   param.m_max_sql_text_length= 0;
+  param.m_wait_sampling_interval= 1;
 
   /* Setup */
 
@@ -969,6 +969,14 @@ static MYSQL_THDVAR_BOOL(bulk_load_allow_unsorted, PLUGIN_VAR_RQCMDARG,
                          rocksdb_check_bulk_load_allow_unsorted, nullptr,
                          FALSE);
 
+static MYSQL_THDVAR_BOOL(alter_table_bulk_load, PLUGIN_VAR_RQCMDARG,
+                         "Use the bulk load API for the rows that a copying "
+                         "ALTER TABLE writes into a RocksDB table. As with "
+                         "rocksdb_bulk_load, the table is not checked for "
+                         "duplicate primary keys before the SST files are "
+                         "created",
+                         nullptr, nullptr, FALSE);
+
 static MYSQL_SYSVAR_BOOL(enable_bulk_load_api, rocksdb_enable_bulk_load_api,
                          PLUGIN_VAR_RQCMDARG | PLUGIN_VAR_READONLY,
                          "Enables using SstFileWriter for bulk loading",
@@ -2002,6 +2010,7 @@ static struct st_mysql_sys_var *rocksdb_system_variables[] = {
     MYSQL_SYSVAR(bulk_load),
     MYSQL_SYSVAR(bulk_load_allow_sk),
     MYSQL_SYSVAR(bulk_load_allow_unsorted),
+    MYSQL_SYSVAR(alter_table_bulk_load),
     MYSQL_SYSVAR(skip_unique_check_tables),
     MYSQL_SYSVAR(trace_sst_api),
     MYSQL_SYSVAR(commit_in_the_middle),
@@ -6374,7 +6383,8 @@ ha_rocksdb::ha_rocksdb(my_core::handlerton *const hton,
       m_dup_pk_found(false),
       m_in_rpl_delete_rows(false),
       m_in_rpl_update_rows(false),
-      m_force_skip_unique_check(false) {}
+      m_force_skip_unique_check(false),
+      m_alter_bulk_load(false) {}
 
 
 const std::string &ha_rocksdb::get_table_basename() const {
@@ -6891,6 +6901,8 @@ int ha_rocksdb::open(const char *const name, int mode, uint test_if_locked) {
 int ha_rocksdb::close(void) {
   DBUG_ENTER_FUNC();
 
+  m_ds_mrr.dsmrr_close();
+
   m_pk_descr = nullptr;
   m_key_descr_arr = nullptr;
   m_converter = nullptr;
@@ -9647,6 +9659,54 @@ int ha_rocksdb::write_row(const uchar *const buf) {
   DBUG_RETURN(rv);
 }
 
+/**
+  Prepare for inserting many rows
+
+  A copying ALTER TABLE calls this on the new table before copying the
+  rows. The new table is empty, so the rows can be sorted and written to
+  SST files that are ingested in end_bulk_insert(), instead of growing
+  the DDL transaction write batch by the whole table.
+*/
+void ha_rocksdb::start_bulk_insert(ha_rows rows, uint flags) {
+  DBUG_ENTER_FUNC();
+
+  THD *const thd = ha_thd();
+  const enum_sql_command sql_command = thd->lex->sql_command;
+
+  m_alter_bulk_load = rocksdb_enable_bulk_load_api &&
+                      THDVAR(thd, alter_table_bulk_load) &&
+                      !THDVAR(thd, bulk_load) &&
+                      (sql_command == SQLCOM_ALTER_TABLE ||
+                       sql_command == SQLCOM_CREATE_INDEX) &&
+                      !thd->lex->ignore && !has_hidden_pk(table);
+
+  DBUG_VOID_RETURN;
+}
+
+/**
+  Ingest the SST files that were written since start_bulk_insert()
+
+  @return
+    HA_EXIT_SUCCESS  OK
+    other            HA_ERR error code (can be SE-specific)
+*/
+int ha_rocksdb::end_bulk_insert() {
+  DBUG_ENTER_FUNC();
+
+  if (!m_alter_bulk_load) {
+    DBUG_RETURN(HA_EXIT_SUCCESS);
+  }
+  m_alter_bulk_load = false;
+
+  Rdb_transaction *const tx = get_tx_from_thd(ha_thd());
+  int rc = HA_EXIT_SUCCESS;
+  if (tx != nullptr) {
+    rc = tx->finish_bulk_load();
+  }
+
+  DBUG_RETURN(rc);
+}
+
 /**
   Constructing m_last_rowkey (MyRocks key expression) from
   before_update|delete image (MySQL row expression).
@@ -10167,8 +10227,15 @@ int ha_rocksdb::update_write_pk(const Rdb_key_def &kd,
   }
 
   const auto cf = m_pk_descr->get_cf();
-  if (rocksdb_enable_bulk_load_api && THDVAR(table->in_use, bulk_load) &&
-      !hidden_pk) {
+  if (m_alter_bulk_load && row_info.old_data == nullptr) {
+    /*
+      The rows of ALTER TABLE come in the order of the old table, which
+      need not be the order of the new primary key
+    */
+    rc = bulk_load_key(row_info.tx, kd, row_info.new_pk_slice, value_slice,
+                       true);
+  } else if (rocksdb_enable_bulk_load_api &&
+             THDVAR(table->in_use, bulk_load) && !hidden_pk) {
     /*
       Write the primary key directly to an SST file using an SstFileWriter
      */
@@ -10342,8 +10409,11 @@ int ha_rocksdb::update_write_indexes(const struct update_row_info &row_info,
       continue;
     }
 
+    /* Unique secondary keys are checked and written as usual */
     rc = update_write_sk(table, *m_key_descr_arr[key_id], row_info,
-                         bulk_load_sk);
+                         bulk_load_sk ||
+                             (m_alter_bulk_load &&
+                              !(table->key_info[key_id].flags & HA_NOSAME)));
     if (rc != HA_EXIT_SUCCESS) {
       return rc;
     }
@@ -10777,6 +10847,7 @@ int ha_rocksdb::rnd_end() {
   DBUG_ENTER_FUNC();
 
   release_scan_iterator();
+  m_ds_mrr.dsmrr_close();
 
   DBUG_RETURN(HA_EXIT_SUCCESS);
 }
@@ -10824,6 +10895,7 @@ int ha_rocksdb::index_end() {
   DBUG_ENTER_FUNC();
 
   release_scan_iterator();
+  m_ds_mrr.dsmrr_close();
 
   my_bitmap_free(&m_lookup_bitmap);
 
@@ -12481,6 +12553,45 @@ class Item *ha_rocksdb::idx_cond_push(uint keyno, class Item *const idx_cond) {
   DBUG_RETURN(nullptr);
 }
 
+/****************************************************************************
+ * MyRocks MRR implementation: use DS-MRR
+ ***************************************************************************/
+
+int ha_rocksdb::multi_range_read_init(RANGE_SEQ_IF *seq, void *seq_init_param,
+                                      uint n_ranges, uint mode,
+                                      HANDLER_BUFFER *buf) {
+  return m_ds_mrr.dsmrr_init(this, seq, seq_init_param, n_ranges, mode, buf);
+}
+
+int ha_rocksdb::multi_range_read_next(range_id_t *range_info) {
+  return m_ds_mrr.dsmrr_next(range_info);
+}
+
+ha_rows ha_rocksdb::multi_range_read_info_const(uint keyno, RANGE_SEQ_IF *seq,
+                                                void *seq_init_param,
+                                                uint n_ranges, uint *bufsz,
+                                                uint *flags, ha_rows limit,
+                                                Cost_estimate *cost) {
+  /* There is no earlier point where this->table is known */
+  m_ds_mrr.init(this, table);
+  return m_ds_mrr.dsmrr_info_const(keyno, seq, seq_init_param, n_ranges,
+                                   bufsz, flags, limit, cost);
+}
+
+ha_rows ha_rocksdb::multi_range_read_info(uint keyno, uint n_ranges, uint keys,
+                                          uint key_parts, uint *bufsz,
+                                          uint *flags, Cost_estimate *cost) {
+  m_ds_mrr.init(this, table);
+  return m_ds_mrr.dsmrr_info(keyno, n_ranges, keys, key_parts, bufsz, flags,
+                             cost);
+}
+
+int ha_rocksdb::multi_range_read_explain_info(uint mrr_mode, char *str,
+                                              size_t size) {
+  return m_ds_mrr.dsmrr_explain_info(mrr_mode, str, size);
+}
+/* MyRocks MRR implementation ends */
+
 /*
   Checks if inplace alter is supported for a given operation.
 */
@@ -311,6 +311,12 @@ class ha_rocksdb : public my_core::handler {
   /* SST information used for bulk loading the primary key */
   std::shared_ptr<Rdb_sst_info> m_sst_info;
 
+  /*
+    TRUE <=> the rows that ALTER TABLE copies into this table are written
+    with the bulk load API (rocksdb_alter_table_bulk_load)
+  */
+  bool m_alter_bulk_load;
+
   /*
     MySQL index number for duplicate key error
   */
@@ -643,6 +649,8 @@ class ha_rocksdb : public my_core::handler {
 
   int write_row(const uchar *const buf) override
       MY_ATTRIBUTE((__warn_unused_result__));
+  void start_bulk_insert(ha_rows rows, uint flags) override;
+  int end_bulk_insert() override MY_ATTRIBUTE((__warn_unused_result__));
   int update_row(const uchar *const old_data, const uchar *const new_data) override
       MY_ATTRIBUTE((__warn_unused_result__));
   int delete_row(const uchar *const buf) override
@@ -668,7 +676,29 @@ class ha_rocksdb : public my_core::handler {
   /*
     Default implementation from cancel_pushed_idx_cond() suits us
   */
+
+  /*
+    Multi Range Read interface. DS-MRR sorts the primary key values found
+    in a secondary index before the rows are fetched, so that the point
+    lookups hit the block cache in key order.
+  */
+  int multi_range_read_init(RANGE_SEQ_IF *seq, void *seq_init_param,
+                            uint n_ranges, uint mode,
+                            HANDLER_BUFFER *buf) override;
+  int multi_range_read_next(range_id_t *range_info) override;
+  ha_rows multi_range_read_info_const(uint keyno, RANGE_SEQ_IF *seq,
+                                      void *seq_init_param, uint n_ranges,
+                                      uint *bufsz, uint *flags, ha_rows limit,
+                                      Cost_estimate *cost) override;
+  ha_rows multi_range_read_info(uint keyno, uint n_ranges, uint keys,
+                                uint key_parts, uint *bufsz, uint *flags,
+                                Cost_estimate *cost) override;
+  int multi_range_read_explain_info(uint mrr_mode, char *str,
+                                    size_t size) override;
+
  private:
+  DsMrr_impl m_ds_mrr;
+
   struct key_def_cf_info {
     rocksdb::ColumnFamilyHandle *cf_handle;
     bool is_reverse_cf;
@@ -902,6 +932,7 @@ class ha_rocksdb : public my_core::handler {
 
     /* Free blob data */
     m_retrieved_record.Reset();
+    m_ds_mrr.dsmrr_close();
 
     DBUG_RETURN(HA_EXIT_SUCCESS);
   }
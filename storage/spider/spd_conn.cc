@@ -337,6 +337,7 @@ void spider_free_conn_from_trx(
         ) {
           spider_free_conn(conn);
         } else {
+          conn->idle_time = (time_t) time((time_t*) 0);
           pthread_mutex_lock(&spider_conn_mutex);
           uint old_elements = spider_open_connections.array.max_element;
           if (my_hash_insert(&spider_open_connections, (uchar*) conn))
@@ -376,6 +377,40 @@ void spider_free_conn_from_trx(
   DBUG_VOID_RETURN;
 }
 
+/**
+  Take a recycled connection for a link out of spider_open_connections
+
+  Connections that have been idle for longer than spider_idle_conn_timeout
+  are closed on the way.
+
+  @return  the connection, or NULL if there is none
+*/
+static SPIDER_CONN *spider_get_recycled_conn(
+  SPIDER_SHARE *share,
+  int link_idx
+) {
+  SPIDER_CONN *conn;
+  uint idle_timeout = spider_param_idle_conn_timeout();
+  time_t now = idle_timeout ? (time_t) time((time_t*) 0) : 0;
+  DBUG_ENTER("spider_get_recycled_conn");
+  pthread_mutex_lock(&spider_conn_mutex);
+  while ((conn = (SPIDER_CONN*) my_hash_search_using_hash_value(
+    &spider_open_connections, share->conn_keys_hash_value[link_idx],
+    (uchar*) share->conn_keys[link_idx],
+    share->conn_keys_lengths[link_idx])))
+  {
+    my_hash_delete(&spider_open_connections, (uchar*) conn);
+    if (!idle_timeout || difftime(now, conn->idle_time) < idle_timeout)
+      break;
+    pthread_mutex_unlock(&spider_conn_mutex);
+    DBUG_PRINT("info",("spider free idle conn=%p", conn));
+    spider_free_conn(conn);
+    pthread_mutex_lock(&spider_conn_mutex);
+  }
+  pthread_mutex_unlock(&spider_conn_mutex);
+  DBUG_RETURN(conn);
+}
+
 SPIDER_CONN *spider_create_conn(
   SPIDER_SHARE *share,
   ha_spider *spider,
@@ -720,13 +755,8 @@ SPIDER_CONN *spider_get_conn(
           spider_param_conn_recycle_strict(trx->thd)
         )
     ) {
-        pthread_mutex_lock(&spider_conn_mutex);
-        if (!(conn = (SPIDER_CONN*) my_hash_search_using_hash_value(
-          &spider_open_connections, share->conn_keys_hash_value[link_idx],
-          (uchar*) share->conn_keys[link_idx],
-          share->conn_keys_lengths[link_idx])))
+        if (!(conn = spider_get_recycled_conn(share, link_idx)))
         {
-          pthread_mutex_unlock(&spider_conn_mutex);
           if (spider_param_max_connections())
           { /* enable connection pool */
             conn= spider_get_conn_from_idle_connection(
@@ -751,8 +781,6 @@ SPIDER_CONN *spider_get_conn(
             }
           }
         } else {
-          my_hash_delete(&spider_open_connections, (uchar*) conn);
-          pthread_mutex_unlock(&spider_conn_mutex);
           DBUG_PRINT("info",("spider get global conn"));
           if (spider)
           {
@@ -3959,15 +3987,8 @@ SPIDER_CONN* spider_get_conn_from_idle_connection(
         DBUG_RETURN(NULL);
       }
 
-      pthread_mutex_lock(&spider_conn_mutex);
-      if ((conn = (SPIDER_CONN*) my_hash_search_using_hash_value(
-        &spider_open_connections, share->conn_keys_hash_value[link_idx],
-        (uchar*) share->conn_keys[link_idx],
-        share->conn_keys_lengths[link_idx])))
+      if ((conn = spider_get_recycled_conn(share, link_idx)))
       {
-        /* get conn from spider_open_connections, then delete conn in spider_open_connections */
-        my_hash_delete(&spider_open_connections, (uchar*) conn);  
-        pthread_mutex_unlock(&spider_conn_mutex);
         DBUG_PRINT("info",("spider get global conn"));
         if (spider)
         {
@@ -3977,10 +3998,6 @@ SPIDER_CONN* spider_get_conn_from_idle_connection(
         }
         DBUG_RETURN(conn);
       }
-      else
-      {
-        pthread_mutex_unlock(&spider_conn_mutex);
-      }
     }
   }
   else
@@ -1384,9 +1384,186 @@ int spider_group_by_handler::end_scan()
   DBUG_RETURN(0);
 }
 
-group_by_handler *spider_create_group_by_handler(
+spider_partition_aggregate_handler::spider_partition_aggregate_handler(
+  THD *thd_arg,
+  Query *query_arg,
+  spider_group_by_handler **parts_arg,
+  uint part_count_arg
+) : group_by_handler(thd_arg, spider_hton_ptr),
+  query(*query_arg), parts(parts_arg), part_count(part_count_arg),
+  first(FALSE)
+{
+  DBUG_ENTER("spider_partition_aggregate_handler::"
+    "spider_partition_aggregate_handler");
+  DBUG_VOID_RETURN;
+}
+
+spider_partition_aggregate_handler::~spider_partition_aggregate_handler()
+{
+  DBUG_ENTER("spider_partition_aggregate_handler::"
+    "~spider_partition_aggregate_handler");
+  for (uint i = 0; i < part_count; i++)
+    delete parts[i];
+  spider_free(spider_current_trx, parts, MYF(0));
+  DBUG_VOID_RETURN;
+}
+
+int spider_partition_aggregate_handler::init_scan()
+{
+  DBUG_ENTER("spider_partition_aggregate_handler::init_scan");
+  for (uint i = 0; i < part_count; i++)
+    parts[i]->table = table;
+  first = TRUE;
+  DBUG_RETURN(0);
+}
+
+/*
+  Merge the partial result in table->record[0] into the result collected
+  in table->record[1]. The fields of the temporary table correspond to the
+  non-constant items of the select list.
+*/
+void spider_partition_aggregate_handler::merge_row()
+{
+  List_iterator_fast<Item> it(*query.select);
+  Item *item;
+  Field **field_ptr = table->field;
+  my_ptrdiff_t diff = table->record[1] - table->record[0];
+  DBUG_ENTER("spider_partition_aggregate_handler::merge_row");
+  while ((item = it++))
+  {
+    if (item->const_item())
+      continue;
+    Field *field = *field_ptr++;
+    Item_sum::Sumfunctype sum_func = ((Item_sum *) item)->sum_func();
+    if (sum_func == Item_sum::COUNT_FUNC)
+    {
+      longlong count = field->val_int();
+      field->move_field_offset(diff);
+      field->store(field->val_int() + count, FALSE);
+      field->move_field_offset(-diff);
+      continue;
+    }
+    if (field->is_null())
+      continue;
+    if (sum_func == Item_sum::SUM_FUNC)
+    {
+      if (field->result_type() == REAL_RESULT)
+      {
+        double sum = field->val_real();
+        field->move_field_offset(diff);
+        if (!field->is_null())
+          sum += field->val_real();
+        field->set_notnull();
+        field->store(sum);
+      } else {
+        my_decimal value, sum, *partial = field->val_decimal(&value);
+        field->move_field_offset(diff);
+        if (!field->is_null())
+        {
+          my_decimal other;
+          my_decimal_add(E_DEC_FATAL_ERROR, &sum, partial,
+            field->val_decimal(&other));
+          partial = &sum;
+        }
+        field->set_notnull();
+        field->store_decimal(partial);
+      }
+      field->move_field_offset(-diff);
+      continue;
+    }
+    DBUG_ASSERT(sum_func == Item_sum::MIN_FUNC ||
+      sum_func == Item_sum::MAX_FUNC);
+    if (!field->is_null_in_record(table->record[1]))
+    {
+      int cmp = field->cmp(field->ptr, field->ptr + diff);
+      if (sum_func == Item_sum::MIN_FUNC ? cmp >= 0 : cmp <= 0)
+        continue;
+    }
+    memcpy(field->ptr + diff, field->ptr, field->pack_length());
+    field->move_field_offset(diff);
+    field->set_notnull();
+    field->move_field_offset(-diff);
+  }
+  DBUG_VOID_RETURN;
+}
+
+/*
+  Run the query on each partition in turn, and return the merged result.
+  Each partition returns one row; it is read to the end before the next
+  partition is queried, because partitions may share a connection.
+*/
+int spider_partition_aggregate_handler::next_row()
+{
+  int error_num;
+  bool found = FALSE;
+  DBUG_ENTER("spider_partition_aggregate_handler::next_row");
+  if (!first)
+  {
+    table->status = STATUS_NOT_FOUND;
+    DBUG_RETURN(HA_ERR_END_OF_FILE);
+  }
+  first = FALSE;
+  for (uint i = 0; i < part_count; i++)
+  {
+    spider_group_by_handler *part = parts[i];
+    if ((error_num = part->init_scan()))
+      DBUG_RETURN(error_num);
+    if (!(error_num = part->next_row()))
+    {
+      if (found)
+        merge_row();
+      else
+        store_record(table, record[1]);
+      found = TRUE;
+      while (!(error_num = part->next_row()))
+        ;
+    }
+    if (error_num != HA_ERR_END_OF_FILE)
+      DBUG_RETURN(error_num);
+    if ((error_num = part->end_scan()))
+      DBUG_RETURN(error_num);
+  }
+  if (!found)
+  {
+    table->status = STATUS_NOT_FOUND;
+    DBUG_RETURN(HA_ERR_END_OF_FILE);
+  }
+  restore_record(table, record[1]);
+  table->status = 0;
+  DBUG_RETURN(0);
+}
+
+int spider_partition_aggregate_handler::end_scan()
+{
+  DBUG_ENTER("spider_partition_aggregate_handler::end_scan");
+  DBUG_RETURN(0);
+}
+
+/* Return the spider handler of a table, or of one of its partitions.
+If part is MY_BIT_NONE, the first partition that is read is used. */
+static ha_spider *spider_get_table_spider(
+  TABLE_LIST *from,
+  uint part
+) {
+  partition_info *part_info = from->table->part_info;
+  if (!part_info)
+    return (ha_spider *) from->table->file;
+  if (part == MY_BIT_NONE)
+    part = bitmap_get_first_set(&part_info->read_partitions);
+  ha_partition *partition = (ha_partition *) from->table->file;
+  handler **handlers = partition->get_child_handlers();
+  return (ha_spider *) handlers[part];
+}
+
+/*
+  Create a group by handler for the query, reading the partition first_part
+  of the first table, or the first partition that is read if first_part is
+  MY_BIT_NONE. The other tables must read a single partition.
+*/
+static spider_group_by_handler *spider_create_group_by_handler_for_part(
   THD *thd,
-  Query *query
+  Query *query,
+  uint first_part
 ) {
   spider_group_by_handler *group_by_handler;
   Item *item;
@@ -1405,39 +1582,12 @@ group_by_handler *spider_create_group_by_handler(
   SPIDER_TABLE_HOLDER *table_holder;
   uint table_idx, dbton_id, table_count= 0;
   long tgt_link_status;
-  DBUG_ENTER("spider_create_group_by_handler");
-
-  if (spider_param_disable_group_by_handler(thd))
-    DBUG_RETURN(NULL);
-
-  switch (thd_sql_command(thd))
-  {
-    case SQLCOM_UPDATE:
-    case SQLCOM_UPDATE_MULTI:
-    case SQLCOM_DELETE:
-    case SQLCOM_DELETE_MULTI:
-      DBUG_PRINT("info",("spider update and delete does not support this feature"));
-      DBUG_RETURN(NULL);
-    default:
-      break;
-  }
+  DBUG_ENTER("spider_create_group_by_handler_for_part");
 
   from = query->from;
   do {
     DBUG_PRINT("info",("spider from=%p", from));
     ++table_count;
-    if (from->table->part_info)
-    {
-      DBUG_PRINT("info",("spider partition handler"));
-      partition_info *part_info = from->table->part_info;
-      uint bits = bitmap_bits_set(&part_info->read_partitions);
-      DBUG_PRINT("info",("spider bits=%u", bits));
-      if (bits != 1)
-      {
-        DBUG_PRINT("info",("spider using multiple partitions is not supported by this feature yet"));
-        DBUG_RETURN(NULL);
-      }
-    }
   } while ((from = from->next_local));
 
   if (!(table_holder= spider_create_table_holder(table_count)))
@@ -1445,16 +1595,7 @@ group_by_handler *spider_create_group_by_handler(
 
   table_idx = 0;
   from = query->from;
-  if (from->table->part_info)
-  {
-    partition_info *part_info = from->table->part_info;
-    uint part = bitmap_get_first_set(&part_info->read_partitions);
-    ha_partition *partition = (ha_partition *) from->table->file;
-    handler **handlers = partition->get_child_handlers();
-    spider = (ha_spider *) handlers[part];
-  } else {
-    spider = (ha_spider *) from->table->file;
-  }
+  spider = spider_get_table_spider(from, first_part);
   share = spider->share;
   spider->idx_for_direct_join = table_idx;
   ++table_idx;
@@ -1476,16 +1617,7 @@ group_by_handler *spider_create_group_by_handler(
   }
   while ((from = from->next_local))
   {
-    if (from->table->part_info)
-    {
-      partition_info *part_info = from->table->part_info;
-      uint part = bitmap_get_first_set(&part_info->read_partitions);
-      ha_partition *partition = (ha_partition *) from->table->file;
-      handler **handlers = partition->get_child_handlers();
-      spider = (ha_spider *) handlers[part];
-    } else {
-      spider = (ha_spider *) from->table->file;
-    }
+    spider = spider_get_table_spider(from, MY_BIT_NONE);
     share = spider->share;
     spider->idx_for_direct_join = table_idx;
     ++table_idx;
@@ -1514,16 +1646,8 @@ group_by_handler *spider_create_group_by_handler(
 
   from = query->from;
   do {
-    if (from->table->part_info)
-    {
-      partition_info *part_info = from->table->part_info;
-      uint part = bitmap_get_first_set(&part_info->read_partitions);
-      ha_partition *partition = (ha_partition *) from->table->file;
-      handler **handlers = partition->get_child_handlers();
-      spider = (ha_spider *) handlers[part];
-    } else {
-      spider = (ha_spider *) from->table->file;
-    }
+    spider = spider_get_table_spider(from,
+      from == query->from ? first_part : MY_BIT_NONE);
     share = spider->share;
     if (spider_param_skip_default_condition(thd,
       share->skip_default_condition))
@@ -1653,16 +1777,7 @@ group_by_handler *spider_create_group_by_handler(
     goto skip_free_table_holder;
 
   from = query->from;
-  if (from->table->part_info)
-  {
-    partition_info *part_info = from->table->part_info;
-    uint part = bitmap_get_first_set(&part_info->read_partitions);
-    ha_partition *partition = (ha_partition *) from->table->file;
-    handler **handlers = partition->get_child_handlers();
-    spider = (ha_spider *) handlers[part];
-  } else {
-    spider = (ha_spider *) from->table->file;
-  }
+  spider = spider_get_table_spider(from, first_part);
   share = spider->share;
   lock_mode = spider_conn_lock_mode(spider);
   if (lock_mode)
@@ -1721,16 +1836,7 @@ group_by_handler *spider_create_group_by_handler(
   {
     fields->clear_conn_holder_from_conn();
 
-    if (from->table->part_info)
-    {
-      partition_info *part_info = from->table->part_info;
-      uint part = bitmap_get_first_set(&part_info->read_partitions);
-      ha_partition *partition = (ha_partition *) from->table->file;
-      handler **handlers = partition->get_child_handlers();
-      spider = (ha_spider *) handlers[part];
-    } else {
-      spider = (ha_spider *) from->table->file;
-    }
+    spider = spider_get_table_spider(from, MY_BIT_NONE);
     share = spider->share;
     DBUG_PRINT("info",("spider s->db=%s", from->table->s->db.str));
     DBUG_PRINT("info",("spider s->table_name=%s", from->table->s->table_name.str));
@@ -1813,11 +1919,6 @@ group_by_handler *spider_create_group_by_handler(
     DBUG_PRINT("info",("spider can't create group_by_handler"));
     goto skip_free_fields;
   }
-  query->distinct = FALSE;
-  query->where = NULL;
-  query->group_by = NULL;
-  query->having = NULL;
-  query->order_by = NULL;
   DBUG_RETURN(group_by_handler);
 
 skip_free_fields:
@@ -1826,3 +1927,141 @@ group_by_handler *spider_create_group_by_handler(
   spider_free(spider_current_trx, table_holder, MYF(0));
   DBUG_RETURN(NULL);
 }
+
+/*
+  Check if the partial results of the query on several partitions can be
+  merged by spider_partition_aggregate_handler: the query has no GROUP BY
+  and it selects only COUNT(), SUM(), MIN() and MAX() of non-string values.
+*/
+static bool spider_can_merge_partial_aggregates(
+  Query *query
+) {
+  List_iterator_fast<Item> it(*query->select);
+  Item *item;
+  DBUG_ENTER("spider_can_merge_partial_aggregates");
+  if (query->distinct || query->group_by || query->order_by ||
+      query->having || query->limit->get_offset_limit() ||
+      !query->limit->get_select_limit())
+    DBUG_RETURN(FALSE);
+  while ((item = it++))
+  {
+    if (item->const_item())
+      continue;
+    if (item->type() != Item::SUM_FUNC_ITEM)
+      DBUG_RETURN(FALSE);
+    switch (((Item_sum *) item)->sum_func())
+    {
+      case Item_sum::COUNT_FUNC:
+      case Item_sum::SUM_FUNC:
+        break;
+      case Item_sum::MIN_FUNC:
+      case Item_sum::MAX_FUNC:
+        if (item->cmp_type() == STRING_RESULT ||
+            item->cmp_type() == ROW_RESULT ||
+            item->field_type() == MYSQL_TYPE_BIT)
+          DBUG_RETURN(FALSE);
+        break;
+      default:
+        DBUG_RETURN(FALSE);
+    }
+  }
+  DBUG_RETURN(TRUE);
+}
+
+/* Create a handler for each partition that is read, and merge them. */
+static group_by_handler *spider_create_partition_aggregate_handler(
+  THD *thd,
+  Query *query
+) {
+  partition_info *part_info = query->from->table->part_info;
+  uint part_count = bitmap_bits_set(&part_info->read_partitions);
+  uint part, created = 0;
+  spider_group_by_handler **parts;
+  group_by_handler *group_by_handler;
+  DBUG_ENTER("spider_create_partition_aggregate_handler");
+  if (!(parts = (spider_group_by_handler **)
+    spider_malloc(spider_current_trx, SPD_MID_CREATE_GROUP_BY_HANDLER_1,
+      part_count * sizeof(spider_group_by_handler *),
+      MYF(MY_WME | MY_ZEROFILL))))
+    DBUG_RETURN(NULL);
+  for (part = bitmap_get_first_set(&part_info->read_partitions);
+    part != MY_BIT_NONE;
+    part = bitmap_get_next_set(&part_info->read_partitions, part))
+  {
+    if (!(parts[created] =
+      spider_create_group_by_handler_for_part(thd, query, part)))
+      goto error;
+    ++created;
+  }
+  if (!(group_by_handler = new spider_partition_aggregate_handler(thd, query,
+    parts, part_count)))
+    goto error;
+  DBUG_RETURN(group_by_handler);
+
+error:
+  while (created)
+    delete parts[--created];
+  spider_free(spider_current_trx, parts, MYF(0));
+  DBUG_RETURN(NULL);
+}
+
+group_by_handler *spider_create_group_by_handler(
+  THD *thd,
+  Query *query
+) {
+  group_by_handler *group_by_handler;
+  TABLE_LIST *from;
+  bool merge_partitions = FALSE;
+  DBUG_ENTER("spider_create_group_by_handler");
+
+  if (spider_param_disable_group_by_handler(thd))
+    DBUG_RETURN(NULL);
+
+  switch (thd_sql_command(thd))
+  {
+    case SQLCOM_UPDATE:
+    case SQLCOM_UPDATE_MULTI:
+    case SQLCOM_DELETE:
+    case SQLCOM_DELETE_MULTI:
+      DBUG_PRINT("info",("spider update and delete does not support this feature"));
+      DBUG_RETURN(NULL);
+    default:
+      break;
+  }
+
+  from = query->from;
+  do {
+    DBUG_PRINT("info",("spider from=%p", from));
+    if (from->table->part_info)
+    {
+      DBUG_PRINT("info",("spider partition handler"));
+      partition_info *part_info = from->table->part_info;
+      uint bits = bitmap_bits_set(&part_info->read_partitions);
+      DBUG_PRINT("info",("spider bits=%u", bits));
+      if (bits > 1 && from == query->from && !from->next_local &&
+          spider_can_merge_partial_aggregates(query))
+      {
+        DBUG_PRINT("info",("spider merge partial aggregates of partitions"));
+        merge_partitions = TRUE;
+      } else if (bits != 1)
+      {
+        DBUG_PRINT("info",("spider using multiple partitions is not supported by this feature yet"));
+        DBUG_RETURN(NULL);
+      }
+    }
+  } while ((from = from->next_local));
+
+  if (merge_partitions)
+    group_by_handler = spider_create_partition_aggregate_handler(thd, query);
+  else
+    group_by_handler =
+      spider_create_group_by_handler_for_part(thd, query, MY_BIT_NONE);
+  if (!group_by_handler)
+    DBUG_RETURN(NULL);
+  query->distinct = FALSE;
+  query->where = NULL;
+  query->group_by = NULL;
+  query->having = NULL;
+  query->order_by = NULL;
+  DBUG_RETURN(group_by_handler);
+}
@@ -36,6 +36,34 @@ class spider_group_by_handler: public group_by_handler
   int end_scan() override;
 };
 
+/*
+  Handler for an aggregate query without GROUP BY on several partitions.
+  The query is pushed down to each partition by a spider_group_by_handler,
+  and the partial results are merged: COUNT() and SUM() are added up,
+  MIN() and MAX() are compared.
+*/
+class spider_partition_aggregate_handler: public group_by_handler
+{
+  Query query;
+  spider_group_by_handler **parts;
+  uint part_count;
+  bool first;
+
+  void merge_row();
+
+public:
+  spider_partition_aggregate_handler(
+    THD *thd_arg,
+    Query *query_arg,
+    spider_group_by_handler **parts_arg,
+    uint part_count_arg
+  );
+  ~spider_partition_aggregate_handler();
+  int init_scan() override;
+  int next_row() override;
+  int end_scan() override;
+};
+
 group_by_handler *spider_create_group_by_handler(
   THD *thd,
   Query *query
@@ -196,6 +196,7 @@ enum spider_malloc_id {
   SPD_MID_CREATE_CONN_6,
   SPD_MID_CREATE_CONN_KEYS_1,
   SPD_MID_CREATE_CONN_THREAD_1,
+  SPD_MID_CREATE_GROUP_BY_HANDLER_1,
   SPD_MID_CREATE_LONGLONG_LIST_1,
   SPD_MID_CREATE_LONG_LIST_1,
   SPD_MID_CREATE_MON_THREADS_1,
@@ -654,6 +655,8 @@ typedef struct st_spider_conn
   char               *error_str;
   int                error_length;
   time_t             ping_time;
+  /* when the connection was put into spider_open_connections */
+  time_t             idle_time;
   CHARSET_INFO       *access_charset;
   Time_zone          *time_zone;
   uint               connect_timeout;
@@ -1971,6 +1971,27 @@ static MYSQL_SYSVAR_UINT(
 
 SPIDER_SYSVAR_VALUE_FUNC(uint, conn_wait_timeout)
 
+static uint spider_idle_conn_timeout;
+/*
+  0: no limit
+  1-: seconds
+ */
+static MYSQL_SYSVAR_UINT(
+  idle_conn_timeout,
+  spider_idle_conn_timeout,
+  PLUGIN_VAR_RQCMDARG,
+  "Number of seconds after which a connection that was recycled by "
+  "spider_conn_recycle_mode=1 and not reused is closed. 0 means no limit",
+  NULL,
+  NULL,
+  0, /* def */
+  0, /* min */
+  31536000, /* max */
+  0 /* blk */
+);
+
+SPIDER_SYSVAR_VALUE_FUNC(uint, idle_conn_timeout)
+
 static uint spider_log_result_errors;
 /*
   0: no log
@@ -2502,6 +2523,7 @@ static struct st_mysql_sys_var* spider_system_variables[] = {
   MYSQL_SYSVAR(index_hint_pushdown),
   MYSQL_SYSVAR(max_connections),
   MYSQL_SYSVAR(conn_wait_timeout),
+  MYSQL_SYSVAR(idle_conn_timeout),
   MYSQL_SYSVAR(log_result_errors),
   MYSQL_SYSVAR(log_result_error_with_sql),
   MYSQL_SYSVAR(internal_xa_id_type),
@@ -98,6 +98,24 @@ static inline ulonglong my_ascii_to_upper_magic_uint64(ulonglong i)
 }
 
 
+/*
+  Return the length of the 7bit ASCII prefix of the string [s,e)
+  rounded down to a multiple of 8, checking 8 bytes at a time.
+  The caller handles the remaining bytes one by one.
+*/
+static inline size_t
+my_ascii_prefix_length_8bytes(const uchar *s, const uchar *e)
+{
+  const uchar *s0= s;
+  for ( ; s + 8 <= e; s+= 8)
+  {
+    if (uint8korr(s) & 0x8080808080808080ULL)
+      break;
+  }
+  return (size_t) (s - s0);
+}
+
+
 /*
   Check if:
   - both strings "a" and "b" have at least 4 bytes, and
@@ -182,6 +182,17 @@ MY_FUNCTION_NAME(well_formed_char_length)(CHARSET_INFO *cs __attribute__((unused
 {
   size_t nchars0= nchars;
   int chlen;
+#ifdef WELL_FORMED_CHAR_LENGTH_OPTIMIZE_ASCII
+  /* Skip the leading 7bit ASCII characters, 8 bytes at a time */
+  if (nchars >= 8)
+  {
+    const char *ascii_end= b + MY_MIN(nchars, (size_t) (e - b));
+    size_t length= my_ascii_prefix_length_8bytes((const uchar *) b,
+                                                 (const uchar *) ascii_end);
+    b+= length;
+    nchars-= length;
+  }
+#endif
   for ( ; nchars ; nchars--, b+= chlen)
   {
     if ((chlen= CHARLEN(cs, (uchar*) b, (uchar*) e)) <= 0)
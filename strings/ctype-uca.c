@@ -34347,6 +34347,16 @@ my_uca_level_booster_equal_prefix_length(const MY_UCA_LEVEL_BOOSTER *booster,
   {
     const MY_UCA_WEIGHT2 *ws, *wt;
     ws= my_uca_level_booster_simple_weight2_addr_const(booster, s[0], s[1]);
+    if (s[0] == t[0] && s[1] == t[1])
+    {
+      /*
+        The most common case, e.g. keys with a common prefix.
+        Equal bytes give equal weights, no need to look up "t".
+      */
+      if (ws->weight[0])
+        continue;
+      break;
+    }
     wt= my_uca_level_booster_simple_weight2_addr_const(booster, t[0], t[1]);
     if (ws->weight[0] &&
         ws->weight[0] == wt->weight[0] &&
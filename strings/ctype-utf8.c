@@ -30,6 +30,7 @@
 
 #include "ctype-utf8.h"
 #include "ctype-unidata.h"
+#include "ctype-ascii.h"
 
 
 /* Definitions for strcoll.inl */
@@ -653,10 +654,12 @@ int my_charlen_utf8mb3(CHARSET_INFO *cs __attribute__((unused)),
 #define MY_FUNCTION_NAME(x)       my_ ## x ## _utf8mb3
 #define CHARLEN(cs,str,end)       my_charlen_utf8mb3(cs,str,end)
 #define DEFINE_WELL_FORMED_CHAR_LENGTH_USING_CHARLEN
+#define WELL_FORMED_CHAR_LENGTH_OPTIMIZE_ASCII
 #include "ctype-mb.inl"
 #undef MY_FUNCTION_NAME
 #undef CHARLEN
 #undef DEFINE_WELL_FORMED_CHAR_LENGTH_USING_CHARLEN
+#undef WELL_FORMED_CHAR_LENGTH_OPTIMIZE_ASCII
 /* my_well_formed_char_length_utf8mb3 */
 
 
@@ -3006,10 +3009,12 @@ my_charlen_utf8mb4(CHARSET_INFO *cs __attribute__((unused)),
 #define MY_FUNCTION_NAME(x)       my_ ## x ## _utf8mb4
 #define CHARLEN(cs,str,end)       my_charlen_utf8mb4(cs,str,end)
 #define DEFINE_WELL_FORMED_CHAR_LENGTH_USING_CHARLEN
+#define WELL_FORMED_CHAR_LENGTH_OPTIMIZE_ASCII
 #include "ctype-mb.inl"
 #undef MY_FUNCTION_NAME
 #undef CHARLEN
 #undef DEFINE_WELL_FORMED_CHAR_LENGTH_USING_CHARLEN
+#undef WELL_FORMED_CHAR_LENGTH_OPTIMIZE_ASCII
 /* my_well_formed_char_length_utf8mb4 */
 
 
@@ -17,6 +17,7 @@
 #include "strings_def.h"
 #include <m_ctype.h>
 #include <my_xml.h>
+#include "ctype-ascii.h"
 
 /*
 
@@ -1241,21 +1242,18 @@ my_convert(char *to, uint32 to_length, CHARSET_INFO *to_cs,
 
   length= length2= MY_MIN(to_length, from_length);
 
-#if defined(__i386__) || defined(__x86_64__)
   /*
-    Special loop for i386, it allows to refer to a
-    non-aligned memory block as UINT32, which makes
-    it possible to copy four bytes at once. This
-    gives about 10% performance improvement comparing
-    to byte-by-byte loop.
+    Copy the leading ASCII characters eight bytes at a time.
+    The tail is copied by the byte-by-byte loop below.
   */
-  for ( ; length >= 4; length-= 4, from+= 4, to+= 4)
   {
-    if ((*(uint32*)from) & 0x80808080)
-      break;
-    *((uint32*) to)= *((const uint32*) from);
+    size_t ascii= my_ascii_prefix_length_8bytes((const uchar *) from,
+                                                (const uchar *) from + length);
+    memcpy(to, from, ascii);
+    from+= ascii;
+    to+= ascii;
+    length-= (uint32) ascii;
   }
-#endif /* __i386__ */
 
   for (; ; *to++= *from++, length--)
   {
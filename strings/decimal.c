@@ -1205,6 +1205,90 @@ int decimal2longlong(const decimal_t *from, longlong *to)
   return E_DEC_OK;
 }
 
+/*
+  Convert decimal to an integer scaled by 10^scale, e.g. 12.34 with
+  scale=3 becomes 12340
+
+  SYNOPSIS
+    decimal2scaled_longlong()
+      from    - value to convert
+      scale   - number of decimal digits of the result
+      to      - result
+
+  NOTE
+    This is a fast path for fixed point arithmetic on small values,
+    see Item_sum_sum. Values that may not fit are not converted.
+
+  RETURN VALUE
+    E_DEC_OK
+    E_DEC_OVERFLOW - more than 18 digits, or more than 'scale' decimal
+                     digits would be needed; *to is not changed
+*/
+
+int decimal2scaled_longlong(const decimal_t *from, decimal_digits_t scale,
+                            longlong *to)
+{
+  dec1 *buf=from->buf;
+  longlong x=0;
+  int intg, frac;
+
+  if (from->frac > scale || from->intg + scale > 2*DIG_PER_DEC1)
+    return E_DEC_OVERFLOW;
+
+  for (intg=from->intg; intg > 0; intg-=DIG_PER_DEC1)
+    x=x*DIG_BASE + *buf++;
+  for (frac=from->frac; frac > 0; frac-=DIG_PER_DEC1, buf++)
+  {
+    if (frac >= DIG_PER_DEC1)
+      x=x*DIG_BASE + *buf;
+    else
+      x=x*powers10[frac] + *buf / powers10[DIG_PER_DEC1 - frac];
+  }
+  for (frac=scale - from->frac; frac > 0; frac-=DIG_PER_DEC1)
+    x*=powers10[MY_MIN(frac, DIG_PER_DEC1)];
+
+  *to=from->sign ? -x : x;
+  return E_DEC_OK;
+}
+
+
+/*
+  Convert an integer scaled by 10^scale to decimal,
+  the reverse of decimal2scaled_longlong()
+*/
+
+int scaled_longlong2decimal(longlong from, decimal_digits_t scale,
+                            decimal_t *to)
+{
+  ulonglong x= from < 0 ? -(ulonglong) from : (ulonglong) from;
+  ulonglong div= 1;
+  dec1 *buf;
+  int error, frac, i;
+
+  DBUG_ASSERT(scale <= 2*DIG_PER_DEC1);
+  for (i= scale; i > 0; i--)
+    div*= 10;
+  if ((error= ull2dec(x / div, to)))
+    return error;
+  x%= div;
+
+  buf= to->buf + ROUND_UP(to->intg);
+  if (unlikely(buf + ROUND_UP(scale) > to->buf + to->len))
+    return E_DEC_OVERFLOW;
+  /* Unlike decimal_shift(), keep the trailing zeros of the fraction */
+  for (frac= scale; frac > 0; frac-= DIG_PER_DEC1)
+  {
+    int n= MY_MIN(frac, DIG_PER_DEC1);
+    for (div= 1, i= frac - n; i > 0; i--)
+      div*= 10;
+    *buf++= (dec1) (x / div) * powers10[DIG_PER_DEC1 - n];
+    x%= div;
+  }
+  to->frac= scale;
+  to->sign= from < 0;
+  return E_DEC_OK;
+}
+
 /*
   Convert decimal to its binary fixed-length representation
   two representations of the same length can be compared with memcmp
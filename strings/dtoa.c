@@ -222,6 +222,27 @@ size_t my_gcvt(double x, my_gcvt_arg_type type, int width, char *to,
   if (x < 0.)
     width--;
 
+  /*
+    Integral values of up to DBL_DIG digits, which are common in DOUBLE
+    columns, get the 'f' format with all digits from dtoa(). Print them
+    as integers instead.
+  */
+  if (x > -1e15 && x < 1e15 && x == (double) (longlong) x &&
+      (x != 0. || !signbit(x)))
+  {
+    char tmp[DBL_DIG + 3]; /* sign, digits and '\0' */
+    int digits;
+    len= (int) (longlong10_to_str((longlong) x, tmp, -10) - tmp);
+    digits= len - (x < 0.);
+    if (digits <= (type == MY_GCVT_ARG_DOUBLE ? width : MY_MIN(width, FLT_DIG)))
+    {
+      memcpy(to, tmp, len + 1);
+      if (error != NULL)
+        *error= FALSE;
+      return len;
+    }
+  }
+
   res= dtoa(x, 4, type == MY_GCVT_ARG_DOUBLE ? width : MY_MIN(width, FLT_DIG),
             &decpt, &sign, &end, buf, sizeof(buf));
   if (decpt == DTOA_OVERFLOW)
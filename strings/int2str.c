@@ -37,6 +37,12 @@ const char _dig_vec_upper[] =
   "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
 const char _dig_vec_lower[] =
   "0123456789abcdefghijklmnopqrstuvwxyz";
+const char my_dig_pairs[]=
+  "0001020304050607080910111213141516171819"
+  "2021222324252627282930313233343536373839"
+  "4041424344454647484950515253545556575859"
+  "6061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
 
 
 /*
@@ -151,9 +157,6 @@ int2str(register long int val, register char *dst, register int radix,
 
 char *int10_to_str(long int val,char *dst,int radix)
 {
-  char buffer[65];
-  register char *p;
-  long int new_val;
   unsigned long int uval = (unsigned long int) val;
 
   if (radix < 0)				/* -10 */
@@ -165,19 +168,5 @@ char *int10_to_str(long int val,char *dst,int radix)
       uval = (unsigned long int)0 - uval;
     }
   }
-
-  p = &buffer[sizeof(buffer)-1];
-  *p = '\0';
-  new_val= (long) (uval / 10);
-  *--p = '0'+ (char) (uval - (unsigned long) new_val * 10);
-  val = new_val;
-
-  while (val != 0)
-  {
-    new_val=val/10;
-    *--p = '0' + (char) (val-new_val*10);
-    val= new_val;
-  }
-  while ((*dst++ = *p++) != 0) ;
-  return dst-1;
+  return my_ull10_to_str(uval, dst);
 }
@@ -366,11 +366,52 @@ int json_read_string_const_chr(json_string_t *js)
 }
 
 
+/*
+  Skip the bytes of a string constant that need no special handling:
+  printable ASCII other than the quote and the backslash. Eight bytes
+  are tested at a time.
+  Only to be used with ASCII based character sets, where a byte below
+  128 is always a complete character.
+*/
+
+#define JSON_BYTES(n) (~(ulonglong) 0 / 255 * (n))
+#define JSON_HAS_ZERO_BYTE(w) \
+  (((w) - JSON_BYTES(1)) & ~(w) & JSON_BYTES(128))
+#define JSON_HAS_BYTE_BELOW(w, n) \
+  (((w) - JSON_BYTES(n)) & ~(w) & JSON_BYTES(128))
+
+static const uchar *skip_plain_str_bytes(const uchar *p, const uchar *end)
+{
+  for (; p + 8 <= end; p+= 8)
+  {
+    ulonglong w;
+    memcpy(&w, p, 8);
+    if ((w & JSON_BYTES(128)) ||
+        JSON_HAS_BYTE_BELOW(w, ' ') ||
+        JSON_HAS_ZERO_BYTE(w ^ JSON_BYTES('"')) ||
+        JSON_HAS_ZERO_BYTE(w ^ JSON_BYTES('\\')))
+      break;
+  }
+  while (p < end && *p < 128 && json_instr_chr_map[*p] <= S_ETC)
+    p++;
+  return p;
+}
+
+
+static inline my_bool json_ascii_based(CHARSET_INFO *cs)
+{
+  return cs->mbminlen == 1 && !(cs->state & MY_CS_NONASCII);
+}
+
+
 static int skip_str_constant(json_engine_t *j)
 {
   int t, c_len;
+  my_bool ascii_based= json_ascii_based(j->s.cs);
   for (;;)
   {
+    if (ascii_based)
+      j->s.c_str= skip_plain_str_bytes(j->s.c_str, j->s.str_end);
     if ((c_len= json_next_char(&j->s)) > 0)
     {
       j->s.c_str+= c_len;
@@ -954,6 +995,8 @@ int json_read_value(json_engine_t *j)
   j->value_type= JSON_VALUE_UNINITIALIZED;
   if (j->state == JST_KEY)
   {
+    if (json_ascii_based(j->s.cs))
+      j->s.c_str= skip_plain_str_bytes(j->s.c_str, j->s.str_end);
     while (json_read_keyname_chr(j) == 0) {}
 
     if (j->s.error)
@@ -1403,6 +1446,20 @@ static int handle_match(json_engine_t *je, json_path_t *p,
 */
 int json_key_matches(json_engine_t *je, json_string_t *k)
 {
+  if (json_ascii_based(je->s.cs) && json_ascii_based(k->cs))
+  {
+    /* Skip the common prefix of plain ASCII characters bytewise. */
+    const uchar *c= je->s.c_str, *kc= k->c_str;
+    while (c < je->s.str_end && kc < k->str_end && *c == *kc &&
+           *c < 128 && json_instr_chr_map[*c] <= S_ETC)
+    {
+      c++;
+      kc++;
+    }
+    je->s.c_str= c;
+    k->c_str= kc;
+  }
+
   while (json_read_keyname_chr(je) == 0)
   {
     if (json_read_string_const_chr(k) ||
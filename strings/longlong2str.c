@@ -116,9 +116,6 @@ char *ll2str(longlong val,char *dst,int radix, int upcase)
 #ifndef longlong10_to_str
 char *longlong10_to_str(longlong val,char *dst,int radix)
 {
-  char buffer[65];
-  register char *p;
-  long long_val;
   ulonglong uval= (ulonglong) val;
 
   if (radix < 0)
@@ -130,31 +127,6 @@ char *longlong10_to_str(longlong val,char *dst,int radix)
       uval = (ulonglong)0 - uval;
     }
   }
-
-  if (uval == 0)
-  {
-    *dst++='0';
-    *dst='\0';
-    return dst;
-  }
-  p = &buffer[sizeof(buffer)-1];
-  *p = '\0';
-
-  while (uval > (ulonglong) LONG_MAX)
-  {
-    ulonglong quo= uval/(uint) 10;
-    uint rem= (uint) (uval- quo* (uint) 10);
-    *--p = _dig_vec_upper[rem];
-    uval= quo;
-  }
-  long_val= (long) uval;
-  while (long_val != 0)
-  {
-    long quo= long_val/10;
-    *--p = _dig_vec_upper[(uchar) (long_val - quo*10)];
-    long_val= quo;
-  }
-  while ((*dst++ = *p++) != 0) ;
-  return dst-1;
+  return my_ull10_to_str(uval, dst);
 }
 #endif
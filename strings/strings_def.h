@@ -149,6 +149,42 @@ uint my_casefold_multiply_1(CHARSET_INFO *cs);
 uint my_casefold_multiply_2(CHARSET_INFO *cs);
 
 
+/* "00", "01", ..., "99", see my_ull10_to_str() */
+extern const char my_dig_pairs[];
+
+/*
+  Write the decimal representation of an unsigned value, two digits
+  at a time, and return a pointer to the terminating NUL.
+*/
+static inline char *my_ull10_to_str(ulonglong val, char *dst)
+{
+  ulonglong tmp;
+  char *end= dst + 1;
+  uint i;
+
+  for (tmp= val; tmp >= 10000; tmp/= 10000)
+    end+= 4;
+  end+= (tmp >= 10) + (tmp >= 100) + (tmp >= 1000);
+  *end= '\0';
+
+  for (dst= end; val >= 100; val/= 100)
+  {
+    i= (uint) (val % 100) * 2;
+    *--dst= my_dig_pairs[i + 1];
+    *--dst= my_dig_pairs[i];
+  }
+  if (val >= 10)
+  {
+    i= (uint) val * 2;
+    *--dst= my_dig_pairs[i + 1];
+    *--dst= my_dig_pairs[i];
+  }
+  else
+    *--dst= (char) ('0' + val);
+  return end;
+}
+
+
 /* Some common character set names */
 extern const char charset_name_latin2[];
 #define charset_name_latin2_length 6
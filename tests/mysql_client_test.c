@@ -21079,6 +21079,86 @@ static void test_bulk_delete_returning()
   mysql_free_result(result);
 
 
+  rc= mysql_query(mysql, "DROP TABLE t1");
+  myquery(rc);
+}
+
+static void test_bulk_insert_secondary_index()
+{
+  int rc;
+  MYSQL_STMT *stmt;
+  MYSQL_BIND bind[2];
+  MYSQL_ROW  row;
+  int        i,
+             id[]= {1, 2, 3, 4},
+             val[]= {40, 30, 20, 10},
+             dup_id[]= {5, 6, 1},
+             count= sizeof(id)/sizeof(id[0]);
+  MYSQL_RES *result;
+
+  myheader("test_bulk_insert_secondary_index");
+  rc= mysql_query(mysql, "DROP TABLE IF EXISTS t1");
+  myquery(rc);
+  rc= mysql_query(mysql, "CREATE TABLE t1 (id int not null primary key, "
+                         "val int, key(val)) engine=innodb");
+  myquery(rc);
+
+  stmt= mysql_stmt_init(mysql);
+  rc= mysql_stmt_prepare(stmt, "INSERT INTO t1 VALUES (?, ?)", -1);
+  check_execute(stmt, rc);
+
+  memset(bind, 0, sizeof(bind));
+  bind[0].buffer_type = MYSQL_TYPE_LONG;
+  bind[0].buffer = (void *)id;
+  bind[1].buffer_type = MYSQL_TYPE_LONG;
+  bind[1].buffer = (void *)val;
+
+  mysql_stmt_attr_set(stmt, STMT_ATTR_ARRAY_SIZE, (void*)&count);
+  rc= mysql_stmt_bind_param(stmt, bind);
+  check_execute(stmt, rc);
+
+  rc= mysql_stmt_execute(stmt);
+  check_execute(stmt, rc);
+  verify_affected_rows(4);
+
+  /* A duplicate in the last parameter set fails the whole execution. */
+  count= sizeof(dup_id)/sizeof(dup_id[0]);
+  bind[0].buffer = (void *)dup_id;
+  mysql_stmt_attr_set(stmt, STMT_ATTR_ARRAY_SIZE, (void*)&count);
+  rc= mysql_stmt_bind_param(stmt, bind);
+  check_execute(stmt, rc);
+
+  rc= mysql_stmt_execute(stmt);
+  DIE_UNLESS(rc);
+  DIE_UNLESS(mysql_stmt_errno(stmt) == 1062);
+
+  mysql_stmt_close(stmt);
+
+  rc= mysql_query(mysql, "SELECT id, val FROM t1 FORCE INDEX(val) "
+                         "ORDER BY val");
+  myquery(rc);
+
+  result= mysql_store_result(mysql);
+  mytest(result);
+
+  i= 0;
+  while ((row= mysql_fetch_row(result)))
+  {
+    DIE_IF(atoi(row[0]) != id[3 - i]);
+    DIE_IF(atoi(row[1]) != val[3 - i]);
+    i++;
+  }
+  DIE_IF(i != 4);
+  mysql_free_result(result);
+
+  rc= mysql_query(mysql, "CHECK TABLE t1");
+  myquery(rc);
+  result= mysql_store_result(mysql);
+  mytest(result);
+  row= mysql_fetch_row(result);
+  DIE_IF(strcmp(row[3], "OK"));
+  mysql_free_result(result);
+
   rc= mysql_query(mysql, "DROP TABLE t1");
   myquery(rc);
 }
@@ -22615,6 +22695,7 @@ static struct my_tests_st my_tests[]= {
   { "test_bulk_replace", test_bulk_replace },
   { "test_bulk_insert_returning", test_bulk_insert_returning },
   { "test_bulk_delete_returning", test_bulk_delete_returning },
+  { "test_bulk_insert_secondary_index", test_bulk_insert_secondary_index },
 #endif
   { "test_ps_params_in_ctes", test_ps_params_in_ctes },
   { "test_explain_meta", test_explain_meta },
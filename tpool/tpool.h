@@ -83,10 +83,18 @@ class task_group
   unsigned int m_tasks_running;
   unsigned int m_max_concurrent_tasks;
   const bool m_enable_task_release;
+  /** whether the tasks are dequeued before those of other groups */
+  bool m_high_priority= false;
 
 public:
   task_group(unsigned int max_concurrency= 100000, bool m_enable_task_release= true);
   void set_max_tasks(unsigned int max_concurrent_tasks);
+  /** Let the tasks of this group bypass the tasks of other groups and
+  ungrouped tasks that are waiting for a worker thread. This must be
+  invoked before any task of the group is submitted. */
+  void set_high_priority(bool high_priority= true)
+  { m_high_priority= high_priority; }
+  bool is_high_priority() const { return m_high_priority; }
   void execute(task* t);
   void cancel_pending(task *t);
   void get_stats(group_stats *stats);
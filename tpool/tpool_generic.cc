@@ -202,6 +202,14 @@ class thread_pool_generic : public thread_pool
   /** The task queue */
   circular_queue<task*> m_task_queue;
 
+  /** The queue of tasks of task_group::is_high_priority() groups,
+  which are dequeued before m_task_queue */
+  circular_queue<task*> m_high_priority_queue;
+
+  /** @return whether no tasks are waiting for a worker */
+  bool queues_empty()
+  { return m_task_queue.empty() && m_high_priority_queue.empty(); }
+
   /** List of standby (idle) workers */
   doubly_linked_list<worker_data> m_standby_threads;
 
@@ -460,6 +468,15 @@ void thread_pool_generic::cancel_pending(task* t)
       *it = nullptr;
     }
   }
+  for (auto it = m_high_priority_queue.begin();
+       it != m_high_priority_queue.end(); it++)
+  {
+    if (*it == t)
+    {
+      t->release();
+      *it = nullptr;
+    }
+  }
 }
 /**
   Register worker in standby list, and wait to be woken.
@@ -470,7 +487,7 @@ void thread_pool_generic::cancel_pending(task* t)
 bool thread_pool_generic::wait_for_tasks(std::unique_lock<std::mutex> &lk,
                                          worker_data *thread_data)
 {
-  assert(m_task_queue.empty());
+  assert(queues_empty());
   assert(!m_in_shutdown);
 
   thread_data->m_wake_reason= WAKE_REASON_NONE;
@@ -527,14 +544,14 @@ bool thread_pool_generic::get_task(worker_data *thread_var, task **t)
   DBUG_ASSERT(!thread_var->is_waiting());
   thread_var->m_state = worker_data::NONE;
 
-  while (m_task_queue.empty())
+  while (queues_empty())
   {
     if (m_in_shutdown)
       return false;
 
     if (!wait_for_tasks(lk, thread_var))
       return false;
-    if (m_task_queue.empty())
+    if (queues_empty())
     {
       m_spurious_wakeups++;
       continue;
@@ -542,8 +559,10 @@ bool thread_pool_generic::get_task(worker_data *thread_var, task **t)
   }
 
   /* Dequeue from the task queue.*/
-  *t= m_task_queue.front();
-  m_task_queue.pop();
+  circular_queue<task*> &q= m_high_priority_queue.empty()
+    ? m_task_queue : m_high_priority_queue;
+  *t= q.front();
+  q.pop();
   m_tasks_dequeued++;
   thread_var->m_state |= worker_data::EXECUTING_TASK;
   thread_var->m_task_start_time = m_timestamp;
@@ -606,7 +625,7 @@ constexpr auto max_idle_time= std::chrono::minutes(1);
 static std::chrono::system_clock::time_point idle_since= invalid_timestamp;
 void thread_pool_generic::check_idle(std::chrono::system_clock::time_point now)
 {
-  DBUG_ASSERT(m_task_queue.empty());
+  DBUG_ASSERT(queues_empty());
 
   /*
    We think that there is no activity, if there were at most 2 tasks
@@ -663,7 +682,7 @@ void thread_pool_generic::maintenance()
 
   m_timestamp = std::chrono::system_clock::now();
 
-  if (m_task_queue.empty())
+  if (queues_empty())
   {
     check_idle(m_timestamp);
     m_last_activity = m_tasks_dequeued + m_wakeups;
@@ -808,6 +827,7 @@ bool thread_pool_generic::wake(worker_wake_reason reason, task *)
 thread_pool_generic::thread_pool_generic(int min_threads, int max_threads) :
   m_thread_data_cache(max_threads),
   m_task_queue(10000),
+  m_high_priority_queue(1000),
   m_standby_threads(),
   m_active_threads(),
   m_mtx(),
@@ -842,7 +862,7 @@ thread_pool_generic::thread_pool_generic(int min_threads, int max_threads) :
 
 void thread_pool_generic::maybe_wake_or_create_thread()
 {
-  if (m_task_queue.empty())
+  if (queues_empty())
     return;
   DBUG_ASSERT(m_active_threads.size() >= static_cast<size_t>(m_long_tasks_count + m_waiting_task_count));
   if (m_active_threads.size() - m_long_tasks_count - m_waiting_task_count > m_concurrency)
@@ -885,7 +905,10 @@ void thread_pool_generic::submit_task(task* task)
     return;
   task->add_ref();
   m_tasks_enqueued++;
-  m_task_queue.push(task);
+  if (task->m_group && task->m_group->is_high_priority())
+    m_high_priority_queue.push(task);
+  else
+    m_task_queue.push(task);
   maybe_wake_or_create_thread();
 }
 
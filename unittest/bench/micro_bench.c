@@ -0,0 +1,257 @@
+/* Copyright (c) 2026, MariaDB Corporation.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; version 2 of the License.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program; if not, write to the Free Software
+   Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1335  USA */
+
+/*
+  Micro benchmarks of core data structures and string kernels.
+
+  Usage: micro_bench [name-prefix]
+
+  Runs every benchmark whose name starts with name-prefix, or all of them,
+  and prints one line per benchmark with the tab separated fields
+
+    <name>  <iterations>  <nanoseconds per iteration>
+
+  so that the output of two builds can be compared with a script.
+  This is not a unit test and it is not run by ctest.
+*/
+
+#include <my_global.h>
+#include <my_sys.h>
+#include <m_ctype.h>
+#include <m_string.h>
+#include <lf.h>
+#include <json_lib.h>
+#include <decimal.h>
+
+static volatile ulonglong sink;
+
+static const char text[]= "The quick brown fox jumps over the lazy dog";
+static const char text_other[]= "The quick brown fox jumps over the lazy cat";
+
+static const char json_doc[]=
+  "{\"id\": 12345, \"name\": \"micro bench\", \"tags\": [\"a\", \"b\", \"c\"],"
+  " \"price\": 12.75, \"stock\": {\"warehouse\": 17, \"shop\": null},"
+  " \"active\": true, \"dims\": [1.5, 2.25, 3.125, 4, 5, 6, 7, 8]}";
+
+
+static void bench_lf_hash_insert_delete(ulonglong n)
+{
+  LF_HASH hash;
+  LF_PINS *pins;
+  ulonglong i;
+
+  lf_hash_init(&hash, sizeof(int), LF_HASH_UNIQUE, 0, sizeof(int), 0,
+               &my_charset_bin);
+  pins= lf_hash_get_pins(&hash);
+  for (i= 0; i < n; i++)
+  {
+    int key= (int) (i & 0xffff);
+    sink+= lf_hash_insert(&hash, pins, &key);
+    sink+= lf_hash_delete(&hash, pins, &key, sizeof key);
+  }
+  lf_hash_put_pins(pins);
+  lf_hash_destroy(&hash);
+}
+
+
+static void bench_lf_hash_search(ulonglong n)
+{
+  LF_HASH hash;
+  LF_PINS *pins;
+  ulonglong i;
+  int key;
+
+  lf_hash_init(&hash, sizeof(int), LF_HASH_UNIQUE, 0, sizeof(int), 0,
+               &my_charset_bin);
+  pins= lf_hash_get_pins(&hash);
+  for (key= 0; key < 10000; key++)
+    lf_hash_insert(&hash, pins, &key);
+  for (i= 0; i < n; i++)
+  {
+    key= (int) (i % 10000);
+    sink+= lf_hash_search(&hash, pins, &key, sizeof key) != NULL;
+    lf_hash_search_unpin(pins);
+  }
+  lf_hash_put_pins(pins);
+  lf_hash_destroy(&hash);
+}
+
+
+static void bench_alloc_root(ulonglong n)
+{
+  MEM_ROOT root;
+  ulonglong i;
+
+  init_alloc_root(PSI_NOT_INSTRUMENTED, &root, 4096, 0, MYF(0));
+  for (i= 0; i < n; i++)
+  {
+    sink+= (size_t) alloc_root(&root, 32) & 1;
+    if ((i & 1023) == 1023)
+      free_root(&root, MYF(MY_MARK_BLOCKS_FREE));
+  }
+  free_root(&root, MYF(0));
+}
+
+
+static void bench_hash_sort(const char *collation, ulonglong n)
+{
+  CHARSET_INFO *cs= get_charset_by_name(collation, MYF(0));
+  ulonglong i;
+
+  for (i= 0; i < n; i++)
+  {
+    ulong nr1= 1, nr2= 4;
+    my_ci_hash_sort(cs, (const uchar *) text, sizeof text - 1, &nr1, &nr2);
+    sink+= nr1;
+  }
+}
+
+static void bench_hash_sort_latin1(ulonglong n)
+{
+  bench_hash_sort("latin1_swedish_ci", n);
+}
+
+static void bench_hash_sort_utf8mb4_general(ulonglong n)
+{
+  bench_hash_sort("utf8mb4_general_ci", n);
+}
+
+static void bench_hash_sort_utf8mb4_uca(ulonglong n)
+{
+  bench_hash_sort("utf8mb4_uca1400_ai_ci", n);
+}
+
+
+static void bench_strnncollsp(const char *collation, ulonglong n)
+{
+  CHARSET_INFO *cs= get_charset_by_name(collation, MYF(0));
+  ulonglong i;
+
+  for (i= 0; i < n; i++)
+    sink+= my_ci_strnncollsp(cs, (const uchar *) text, sizeof text - 1,
+                             (const uchar *) text_other,
+                             sizeof text_other - 1);
+}
+
+static void bench_strnncollsp_utf8mb4_general(ulonglong n)
+{
+  bench_strnncollsp("utf8mb4_general_ci", n);
+}
+
+static void bench_strnncollsp_utf8mb4_uca(ulonglong n)
+{
+  bench_strnncollsp("utf8mb4_uca1400_ai_ci", n);
+}
+
+
+static void bench_json_scan(ulonglong n)
+{
+  json_engine_t je;
+  ulonglong i;
+
+  for (i= 0; i < n; i++)
+  {
+    json_scan_start(&je, &my_charset_utf8mb4_bin, (const uchar *) json_doc,
+                    (const uchar *) json_doc + sizeof json_doc - 1);
+    while (json_scan_next(&je) == 0)
+      sink+= je.state;
+  }
+}
+
+
+static void bench_decimal_add_mul(ulonglong n)
+{
+  decimal_digit_t buf1[9], buf2[9], buf3[9];
+  decimal_t a, b, c;
+  char *end;
+  ulonglong i;
+
+  a.buf= buf1; a.len= array_elements(buf1);
+  b.buf= buf2; b.len= array_elements(buf2);
+  c.buf= buf3; c.len= array_elements(buf3);
+
+  end= strend("123456789.123456789");
+  string2decimal("123456789.123456789", &a, &end);
+  end= strend("98765.4321");
+  string2decimal("98765.4321", &b, &end);
+
+  for (i= 0; i < n; i++)
+  {
+    sink+= decimal_add(&a, &b, &c);
+    sink+= decimal_mul(&a, &b, &c);
+  }
+}
+
+
+static void bench_crc32c(ulonglong n)
+{
+  static uchar page[16384];
+  ulonglong i;
+
+  for (i= 0; i < n; i++)
+    sink+= my_crc32c((uint32) i, page, sizeof page);
+}
+
+
+typedef struct st_bench
+{
+  const char *name;
+  ulonglong iterations;
+  void (*run)(ulonglong iterations);
+} BENCH;
+
+static const BENCH benchmarks[]=
+{
+  { "lf_hash_insert_delete", 2000000, bench_lf_hash_insert_delete },
+  { "lf_hash_search", 5000000, bench_lf_hash_search },
+  { "alloc_root", 20000000, bench_alloc_root },
+  { "hash_sort_latin1_swedish_ci", 5000000, bench_hash_sort_latin1 },
+  { "hash_sort_utf8mb4_general_ci", 5000000, bench_hash_sort_utf8mb4_general },
+  { "hash_sort_utf8mb4_uca1400_ai_ci", 2000000, bench_hash_sort_utf8mb4_uca },
+  { "strnncollsp_utf8mb4_general_ci", 5000000,
+    bench_strnncollsp_utf8mb4_general },
+  { "strnncollsp_utf8mb4_uca1400_ai_ci", 2000000,
+    bench_strnncollsp_utf8mb4_uca },
+  { "json_scan_next", 500000, bench_json_scan },
+  { "decimal_add_mul", 5000000, bench_decimal_add_mul },
+  { "crc32c_16k", 200000, bench_crc32c },
+};
+
+
+int main(int argc, char **argv)
+{
+  const char *prefix= argc > 1 ? argv[1] : "";
+  size_t prefix_length= strlen(prefix);
+  const BENCH *b;
+
+  MY_INIT(argv[0]);
+
+  for (b= benchmarks; b < benchmarks + array_elements(benchmarks); b++)
+  {
+    ulonglong start;
+    if (strncmp(b->name, prefix, prefix_length))
+      continue;
+    /* Warm up the caches and the lazily initialized collations. */
+    b->run(b->iterations / 100 + 1);
+    start= my_interval_timer();
+    b->run(b->iterations);
+    printf("%s\t%llu\t%.2f\n", b->name, b->iterations,
+           (double) (my_interval_timer() - start) / (double) b->iterations);
+    fflush(stdout);
+  }
+
+  my_end(0);
+  return 0;
+}
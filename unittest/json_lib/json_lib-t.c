@@ -171,16 +171,84 @@ test_search()
 }
 
 
+/*
+  Read a scalar string value, return its length in value_len or -1 on error.
+*/
+static int read_string_value(const uchar *j, int *value_len, int *escaped)
+{
+  json_engine_t je;
+  if (json_scan_start(&je, ci, s_e(j)) || json_read_value(&je) ||
+      je.value_type != JSON_VALUE_STRING)
+    return 1;
+  *value_len= je.value_len;
+  *escaped= je.value_escaped;
+  return json_scan_next(&je) != 0 && je.s.error != 0;
+}
+
+
+/*
+  Test string constants that are longer than the blocks the scanner
+  skips at once, with special characters at different offsets.
+*/
+static void
+test_string_values()
+{
+  int len, esc;
+  ok(!read_string_value((const uchar *) "\"abcdefghijklmnopqrstuvwxyz\"",
+                        &len, &esc) && len == 26 && !esc,
+     "long plain string");
+  ok(!read_string_value((const uchar *) "\"abcdefghij\\\"klmnopq\"",
+                        &len, &esc) && len == 19 && esc,
+     "escaped quote inside a block");
+  ok(!read_string_value((const uchar *) "\"abcdefgh\xc3\xa4ijklmnop\"",
+                        &len, &esc) && len == 18 && !esc,
+     "multibyte character inside a block");
+  ok(read_string_value((const uchar *) "\"abcdefghijk\tlmnop\"",
+                       &len, &esc),
+     "control character inside a block");
+  ok(read_string_value((const uchar *) "\"abcdefghijklmnop", &len, &esc),
+     "unterminated string");
+}
+
+
+static const uchar *fj1=(const uchar *) "{\"abcdefghijklmnoq\":1,"
+                                        " \"abcdefghijklmnop\":[2],"
+                                        " \"abcdefgh\":3}";
+static const uchar *fp1= (const uchar *) "$.abcdefghijklmnop";
+/*
+  Test key matching when the keys share a long prefix.
+*/
+static void
+test_key_prefix()
+{
+  json_engine_t je;
+  json_path_t p;
+  json_path_step_t *cur_step;
+  int array_counters[JSON_DEPTH_LIMIT];
+
+  if (json_scan_start(&je, ci, s_e(fj1)) ||
+      json_path_setup(&p, ci, s_e(fp1)))
+    return;
+
+  cur_step= p.steps;
+  ok(json_find_path(&je, &p, &cur_step, array_counters) == 0 &&
+     !json_read_value(&je) && je.value_type == JSON_VALUE_ARRAY,
+     "key with common prefix");
+}
+
+
 int main()
 {
   ci= &my_charset_utf8mb3_general_ci;
 
-  plan(6);
+  plan(12);
   diag("Testing json_lib functions.");
 
   test_json_parsing();
   test_path_parsing();
   test_search();
+  test_string_values();
+  test_key_prefix();
 
   return exit_status();
 }
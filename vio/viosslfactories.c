@@ -515,8 +515,32 @@ new_VioSSLAcceptorFd(const char *key_file, const char *cert_file,
   {
     return 0;
   }
-  /* Set max number of cached sessions, returns the previous size */
-  SSL_CTX_sess_set_cache_size(ssl_fd->ssl_context, 128);
+  /*
+    Set max number of cached sessions, returns the previous size.
+    The cache must be large enough to let clients resume their sessions
+    when many of them reconnect at once, e.g after a restart of a
+    client application. FLUSH SSL creates a new context, i.e empties
+    the cache and rotates session ticket keys.
+  */
+  SSL_CTX_sess_set_cache_size(ssl_fd->ssl_context, 8192);
+
+#if !defined(HAVE_WOLFSSL) && !defined(LIBRESSL_VERSION_NUMBER) && \
+    OPENSSL_VERSION_NUMBER >= 0x10101000L
+  /*
+    A TLSv1.3 server sends 2 session tickets after every full handshake
+    by default. One is sufficient for resumption by a single client.
+  */
+  SSL_CTX_set_num_tickets(ssl_fd->ssl_context, 1);
+#endif
+
+#ifdef SSL_OP_ENABLE_KTLS
+  /*
+    Let the kernel encrypt and decrypt records after the handshake,
+    if it supports the negotiated cipher. OpenSSL silently falls back to
+    userspace encryption otherwise.
+  */
+  SSL_CTX_set_options(ssl_fd->ssl_context, SSL_OP_ENABLE_KTLS);
+#endif
 
   SSL_CTX_set_verify(ssl_fd->ssl_context, verify, NULL);
 